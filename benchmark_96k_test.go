@@ -0,0 +1,91 @@
+package gopus
+
+import (
+	"fmt"
+	"math"
+	"testing"
+)
+
+// hiRes96kRates returns the codec and PCM rates for a 96 kHz stream: the
+// native HD96k CELT rate when the build supports it (gopus_qext), otherwise
+// the 48 kHz codec behind a 96 kHz PCM resampler.
+func hiRes96kRates() (codecRate, pcmRate int) {
+	if validSampleRate(96000) {
+		return 96000, 0
+	}
+	return 48000, 96000
+}
+
+// hiRes96kStereo returns frames of 96 kHz stereo program material: a chord
+// with harmonics above 20 kHz, so the extension band has content.
+func hiRes96kStereo(frames, frameSize int) [][]float32 {
+	out := make([][]float32, frames)
+	for f := range out {
+		pcm := make([]float32, frameSize*2)
+		for i := 0; i < frameSize; i++ {
+			tm := float64(f*frameSize+i) / 96000
+			l := 0.2*math.Sin(2*math.Pi*220*tm) + 0.1*math.Sin(2*math.Pi*3300*tm) + 0.02*math.Sin(2*math.Pi*26000*tm)
+			r := 0.2*math.Sin(2*math.Pi*277*tm) + 0.1*math.Sin(2*math.Pi*4100*tm) + 0.02*math.Sin(2*math.Pi*31000*tm)
+			pcm[2*i], pcm[2*i+1] = float32(l), float32(r)
+		}
+		out[f] = pcm
+	}
+	return out
+}
+
+// Benchmark96kStereo measures 96 kHz stereo encode and decode at 20 ms and
+// 10 ms frames. Under gopus_qext the 20 ms frames run the native HD96k CELT
+// path and 10 ms frames the 2:1 decimation fallback; without it both run the
+// 48 kHz codec behind the PCM resampler.
+func Benchmark96kStereo(b *testing.B) {
+	codecRate, pcmRate := hiRes96kRates()
+	for _, frameSize := range []int{1920, 960} {
+		frames := hiRes96kStereo(25, frameSize)
+		enc, err := NewEncoder(EncoderConfig{SampleRate: codecRate, PCMSampleRate: pcmRate, Channels: 2, Application: ApplicationAudio})
+		if err != nil {
+			b.Fatalf("NewEncoder: %v", err)
+		}
+		if err := enc.SetBitrate(256000); err != nil {
+			b.Fatalf("SetBitrate: %v", err)
+		}
+		if err := enc.SetFrameSize(frameSize); err != nil {
+			b.Fatalf("SetFrameSize: %v", err)
+		}
+		packets := make([][]byte, len(frames))
+		for i, pcm := range frames {
+			pkt, err := enc.EncodeFloat32(pcm)
+			if err != nil {
+				b.Fatalf("frame %d Encode: %v", i, err)
+			}
+			packets[i] = append([]byte(nil), pkt...)
+		}
+		ms := fmt.Sprintf("%dms", frameSize/96)
+
+		b.Run("encode_"+ms, func(b *testing.B) {
+			data := make([]byte, 4000)
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				if _, err := enc.Encode(frames[i%len(frames)], data); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+		b.Run("decode_"+ms, func(b *testing.B) {
+			cfg := DefaultDecoderConfig(codecRate, 2)
+			cfg.PCMSampleRate = pcmRate
+			dec, err := NewDecoder(cfg)
+			if err != nil {
+				b.Fatalf("NewDecoder: %v", err)
+			}
+			pcm := make([]float32, frameSize*2)
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				if _, err := dec.Decode(packets[i%len(packets)], pcm); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
@@ -8,6 +8,7 @@
 package gopus_test
 
 import (
+	"fmt"
 	"github.com/thesyncim/gopus"
 	"math"
 	"runtime"
@@ -365,6 +366,142 @@ func BenchmarkEncoderEncode_VoIP(b *testing.B) {
 	}
 }
 
+// BenchmarkEncoderEncode_Silence measures the per-frame cost of a VoIP encoder
+// fed digital silence after DTX has settled: without DTX, with DTX, and with
+// DTX plus the silence fast path.
+// Target: 0 allocs/op
+func BenchmarkEncoderEncode_Silence(b *testing.B) {
+	for _, tc := range []struct {
+		name          string
+		dtx, fastPath bool
+	}{
+		{name: "dtx_off"},
+		{name: "dtx_on", dtx: true},
+		{name: "dtx_fastpath", dtx: true, fastPath: true},
+	} {
+		b.Run(tc.name, func(b *testing.B) {
+			enc, err := gopus.NewEncoder(gopus.EncoderConfig{SampleRate: 48000, Channels: 1, Application: gopus.ApplicationVoIP})
+			if err != nil {
+				b.Fatalf("NewEncoder: %v", err)
+			}
+			enc.SetDTX(tc.dtx)
+			enc.SetDTXFastPath(tc.fastPath)
+			pcm := make([]float32, 960)
+			packet := make([]byte, 4000)
+			// Warmup past the 200 ms of silence that establishes DTX.
+			for range 20 {
+				if _, err := enc.Encode(pcm, packet); err != nil {
+					b.Fatalf("Encode: %v", err)
+				}
+			}
+
+			b.ResetTimer()
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				if _, err := enc.Encode(pcm, packet); err != nil {
+					b.Fatalf("Encode: %v", err)
+				}
+			}
+		})
+	}
+}
+
+// BenchmarkEncoderEncode_SILKVoice benchmarks SILK-only wideband encoding of
+// a voiced, pitch-gliding harmonic signal at complexity 5 and 10, so the SILK
+// analysis front-end (pitch search, Burg LPC, noise shaping) dominates.
+// Target: 0 allocs/op
+func BenchmarkEncoderEncode_SILKVoice(b *testing.B) {
+	const frames = 50
+	pcm := make([]float32, frames*960)
+	phase := 0.0
+	for i := range pcm {
+		f0 := 120 + 40*math.Sin(2*math.Pi*0.7*float64(i)/48000)
+		phase += 2 * math.Pi * f0 / 48000
+		var v float64
+		for h := 1; h <= 12; h++ {
+			v += math.Sin(float64(h)*phase) / float64(h)
+		}
+		pcm[i] = float32(0.2 * v * (0.6 + 0.4*math.Sin(2*math.Pi*3*float64(i)/48000)))
+	}
+	for _, complexity := range []int{5, 10} {
+		b.Run(fmt.Sprintf("complexity%d", complexity), func(b *testing.B) {
+			enc, err := gopus.NewEncoder(gopus.EncoderConfig{SampleRate: 48000, Channels: 1, Application: gopus.ApplicationVoIP})
+			if err != nil {
+				b.Fatalf("NewEncoder: %v", err)
+			}
+			if err := enc.SetMode(gopus.EncoderModeSILK); err != nil {
+				b.Fatalf("SetMode: %v", err)
+			}
+			if err := enc.SetComplexity(complexity); err != nil {
+				b.Fatalf("SetComplexity: %v", err)
+			}
+			packet := make([]byte, 4000)
+			for f := 0; f < frames; f++ {
+				enc.Encode(pcm[f*960:(f+1)*960], packet)
+			}
+
+			b.ResetTimer()
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				f := i % frames
+				if _, err := enc.Encode(pcm[f*960:(f+1)*960], packet); err != nil {
+					b.Fatalf("Encode: %v", err)
+				}
+			}
+		})
+	}
+}
+
+// BenchmarkEncoderEncode_CELTMusic benchmarks CELT-only 48 kHz stereo
+// encoding of a polyphonic, decaying-note music signal at complexity 10, so
+// the CELT analysis (forward MDCT, transient/TF/dynalloc decisions and the
+// tonality analyser) dominates.
+// Target: 0 allocs/op
+func BenchmarkEncoderEncode_CELTMusic(b *testing.B) {
+	const frames = 50
+	pcm := make([]float32, frames*960*2)
+	notes := []float64{220, 277.18, 329.63, 440, 554.37}
+	for i := 0; i < frames*960; i++ {
+		tm := float64(i) / 48000
+		var l, r float64
+		for n, f := range notes {
+			onset := 0.2 * float64(n)
+			env := math.Exp(-3 * math.Mod(tm+onset, 1))
+			v := env * (math.Sin(2*math.Pi*f*tm) + 0.3*math.Sin(4*math.Pi*f*tm))
+			l += v * float64(len(notes)-n)
+			r += v * float64(n+1)
+		}
+		pcm[2*i] = float32(0.03 * l)
+		pcm[2*i+1] = float32(0.03 * r)
+	}
+	enc, err := gopus.NewEncoder(gopus.EncoderConfig{SampleRate: 48000, Channels: 2, Application: gopus.ApplicationAudio})
+	if err != nil {
+		b.Fatalf("NewEncoder: %v", err)
+	}
+	if err := enc.SetMode(gopus.EncoderModeCELT); err != nil {
+		b.Fatalf("SetMode: %v", err)
+	}
+	if err := enc.SetComplexity(10); err != nil {
+		b.Fatalf("SetComplexity: %v", err)
+	}
+	if err := enc.SetBitrate(128000); err != nil {
+		b.Fatalf("SetBitrate: %v", err)
+	}
+	packet := make([]byte, 4000)
+	for f := 0; f < frames; f++ {
+		enc.Encode(pcm[f*1920:(f+1)*1920], packet)
+	}
+
+	b.ResetTimer()
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		f := i % frames
+		if _, err := enc.Encode(pcm[f*1920:(f+1)*1920], packet); err != nil {
+			b.Fatalf("Encode: %v", err)
+		}
+	}
+}
+
 // BenchmarkEncoderEncode_LowDelay benchmarks low-delay mode encoding (CELT).
 // Target: 0 allocs/op
 func BenchmarkEncoderEncode_LowDelay(b *testing.B) {
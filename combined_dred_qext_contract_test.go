@@ -78,13 +78,13 @@ func TestCombinedDREDQEXTBuildPublicAPIContract(t *testing.T) {
 			got:  &Encoder{},
 			want: []string{
 				"Application", "Bandwidth", "Bitrate", "BitrateMode", "Channels", "Complexity",
-				"DREDDuration", "DTXEnabled", "Encode", "EncodeFloat32", "EncodeInt16",
+				"DREDDuration", "DTXEnabled", "DTXFastPath", "Encode", "EncodeFloat32", "EncodeInt16",
 				"EncodeInt16Slice", "EncodeInt24", "EncodeInt24Slice", "ExpertFrameDuration",
 				"FECEnabled", "FinalRange", "ForceChannels", "FrameSize", "InBandFEC", "InDTX", "LSBDepth",
-				"Lookahead", "MaxBandwidth", "Mode", "PacketLoss", "PhaseInversionDisabled",
+				"Lookahead", "MaxBandwidth", "Mode", "PCMSampleRate", "PacketLoss", "PhaseInversionDisabled",
 				"PredictionDisabled", "QEXT", "Reset", "SampleRate", "SetApplication",
 				"SetBandwidth", "SetBandwidthAuto", "SetBitrate", "SetBitrateMode", "SetComplexity", "SetDNNBlob",
-				"SetDREDDuration", "SetDTX", "SetExpertFrameDuration", "SetFEC",
+				"SetDREDDuration", "SetDTX", "SetDTXFastPath", "SetExpertFrameDuration", "SetFEC",
 				"SetForceChannels", "SetFrameSize", "SetInBandFEC", "SetLSBDepth", "SetMaxBandwidth",
 				"SetMode", "SetPacketLoss", "SetPhaseInversionDisabled", "SetPredictionDisabled", "SetQEXT",
 				"SetSignal", "SetVBR", "SetVBRConstraint", "Signal", "VADActivity", "VBR", "VBRConstraint",
@@ -94,11 +94,11 @@ func TestCombinedDREDQEXTBuildPublicAPIContract(t *testing.T) {
 			name: "Decoder",
 			got:  &Decoder{},
 			want: []string{
-				"Bandwidth", "Channels", "Complexity", "Decode", "DecodeDRED", "DecodeDREDInt24",
+				"Bandwidth", "Channels", "Complexity", "Decode", "DecodeAccumulate", "DecodeDRED", "DecodeDREDInt24",
 				"DecodeInt16", "DecodeInt24", "DecodeInt24Slice", "DecodeWithFEC", "FinalRange",
-				"Gain", "IgnoreExtensions", "InDTX", "LastPacketDuration", "PhaseInversionDisabled",
+				"Gain", "IgnoreExtensions", "InDTX", "LastPacketDuration", "PCMSampleRate", "PhaseInversionDisabled",
 				"Pitch", "Reset", "SampleRate", "SetComplexity", "SetDNNBlob", "SetGain",
-				"SetIgnoreExtensions", "SetPhaseInversionDisabled",
+				"SetIgnoreExtensions", "SetPhaseInversionDisabled", "SetSkipInaudibleDTX", "SkipInaudibleDTX",
 			},
 		},
 		{
@@ -125,7 +125,7 @@ func TestCombinedDREDQEXTBuildPublicAPIContract(t *testing.T) {
 				"Bandwidth", "Channels", "Complexity", "CoupledStreams", "Decode", "DecodeInt16",
 				"DecodeInt24", "DecodeInt24Slice", "FinalRange",
 				"Gain", "GetFinalRange", "IgnoreExtensions", "LastPacketDuration",
-				"PhaseInversionDisabled", "Reset", "SampleRate", "SetComplexity", "SetDNNBlob",
+				"OutputChannels", "PhaseInversionDisabled", "Reset", "SampleRate", "SetComplexity", "SetDNNBlob", "SetDownmix",
 				"SetGain", "SetIgnoreExtensions", "SetPhaseInversionDisabled", "Streams",
 			},
 		},
@@ -148,7 +148,7 @@ func TestCombinedDREDQEXTBuildPublicAPIContract(t *testing.T) {
 			name: "Reader",
 			got:  &Reader{},
 			want: []string{
-				"Channels", "LastGranulePos", "Read", "Reset", "SampleRate",
+				"Channels", "LastGranulePos", "Read", "Reset", "SampleRate", "SeekSample",
 			},
 		},
 		{
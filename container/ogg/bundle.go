@@ -0,0 +1,359 @@
+package ogg
+
+// MaxBundleSamples is the longest bundled packet WriterConfig.BundleSamples
+// allows: 120 ms at 48 kHz, the Opus packet duration limit (RFC 6716 §3.2.5).
+const MaxBundleSamples = 5760
+
+// maxPacketFrames is the Opus limit on frames in one packet (RFC 6716 §3.2.5).
+const maxPacketFrames = 48
+
+// maxFrameBytes is the Opus limit on a single compressed frame.
+const maxFrameBytes = 1275
+
+// opusFrames is an Opus packet split into its compressed frames. Frames alias
+// the packet they were parsed from.
+type opusFrames struct {
+	toc    byte // TOC with the frame-count code cleared
+	n      int
+	frames [maxPacketFrames][]byte
+}
+
+// duration48k returns the duration of the parsed frames at 48 kHz.
+func (f *opusFrames) duration48k() int {
+	return int(opusFrameSizes48k[f.toc>>3]) * f.n
+}
+
+// parseOpusFrames splits a single-stream Opus packet into its frames (RFC 6716
+// §3.2), dropping code-3 padding that is only filler. It reports false for
+// packets that do not parse and for packets whose padding carries extensions
+// (DRED, QEXT, ...), which would be lost with the padding; the bundler and
+// unbundler pass those through whole.
+func parseOpusFrames(packet []byte, f *opusFrames) bool {
+	if len(packet) < 1 {
+		return false
+	}
+	f.toc = packet[0] &^ 0x03
+	data := packet[1:]
+	switch packet[0] & 0x03 {
+	case 0:
+		f.n = 1
+		f.frames[0] = data
+	case 1:
+		if len(data)%2 != 0 {
+			return false
+		}
+		f.n = 2
+		f.frames[0], f.frames[1] = data[:len(data)/2], data[len(data)/2:]
+	case 2:
+		l, k, ok := readFrameLength(data)
+		if !ok || k+l > len(data) {
+			return false
+		}
+		f.n = 2
+		f.frames[0], f.frames[1] = data[k:k+l], data[k+l:]
+	default:
+		if len(data) < 1 {
+			return false
+		}
+		count, vbr, padded := int(data[0]&0x3F), data[0]&0x80 != 0, data[0]&0x40 != 0
+		data = data[1:]
+		if count == 0 || count*int(opusFrameSizes48k[f.toc>>3]) > MaxBundleSamples {
+			return false
+		}
+		if padded {
+			pad := 0
+			for {
+				if len(data) < 1 {
+					return false
+				}
+				p := int(data[0])
+				data = data[1:]
+				if p == 255 {
+					pad += 254
+					continue
+				}
+				pad += p
+				break
+			}
+			if pad > len(data) || paddingCarriesExtensions(data[len(data)-pad:]) {
+				return false
+			}
+			data = data[:len(data)-pad]
+		}
+		f.n = count
+		if !vbr {
+			if len(data)%count != 0 {
+				return false
+			}
+			l := len(data) / count
+			for i := 0; i < count; i++ {
+				f.frames[i] = data[i*l : (i+1)*l]
+			}
+			break
+		}
+		var lens [maxPacketFrames]int
+		for i := 0; i < count-1; i++ {
+			l, k, ok := readFrameLength(data)
+			if !ok {
+				return false
+			}
+			lens[i] = l
+			data = data[k:]
+		}
+		for i := 0; i < count-1; i++ {
+			if lens[i] > len(data) {
+				return false
+			}
+			f.frames[i], data = data[:lens[i]], data[lens[i]:]
+		}
+		f.frames[count-1] = data
+	}
+	for i := 0; i < f.n; i++ {
+		if len(f.frames[i]) > maxFrameBytes {
+			return false
+		}
+	}
+	return true
+}
+
+// paddingCarriesExtensions reports whether a code-3 padding region holds any
+// packet extension. Only ID 0 bytes are filler: 0x00 pads one byte and 0x01
+// pads to the end; any other leading byte starts an extension.
+func paddingCarriesExtensions(pad []byte) bool {
+	for _, b := range pad {
+		switch b {
+		case 0x00:
+		case 0x01:
+			return false
+		default:
+			return true
+		}
+	}
+	return false
+}
+
+// readFrameLength decodes a one- or two-byte Opus frame length and returns the
+// length and the bytes it occupied.
+func readFrameLength(data []byte) (length, size int, ok bool) {
+	if len(data) < 1 {
+		return 0, 0, false
+	}
+	if data[0] < 252 {
+		return int(data[0]), 1, true
+	}
+	if len(data) < 2 {
+		return 0, 0, false
+	}
+	return int(data[1])*4 + int(data[0]), 2, true
+}
+
+// appendFrameLength appends the one- or two-byte Opus encoding of length.
+func appendFrameLength(dst []byte, length int) []byte {
+	if length < 252 {
+		return append(dst, byte(length))
+	}
+	b0 := 252 + length&3
+	return append(dst, byte(b0), byte((length-b0)>>2))
+}
+
+// packetBundler accumulates consecutive packets that share a TOC configuration
+// into one multi-frame packet for WriterConfig.BundleSamples. It assembles the
+// code 0-3 framing itself rather than using gopus.Repacketizer because gopus
+// imports container/ogg, so container/ogg cannot import gopus.
+type packetBundler struct {
+	limit int // bundle duration cap in 48 kHz samples; 0 disables bundling
+
+	parsed   opusFrames
+	toc      byte
+	n        int
+	lens     [maxPacketFrames]int
+	data     []byte // pending frame payloads, concatenated
+	duration int    // pending duration from the TOC
+	samples  int    // pending granule advance from WritePacket
+
+	packet []byte // assembled bundle, reused
+}
+
+// accepts reports whether the frames in b.parsed can join the pending bundle.
+func (b *packetBundler) accepts() bool {
+	return b.n == 0 || (b.parsed.toc == b.toc && b.n+b.parsed.n <= maxPacketFrames &&
+		b.duration+b.parsed.duration48k() <= b.limit)
+}
+
+// add appends the frames in b.parsed to the pending bundle.
+func (b *packetBundler) add(samples int) {
+	b.toc = b.parsed.toc
+	for i := 0; i < b.parsed.n; i++ {
+		b.lens[b.n] = len(b.parsed.frames[i])
+		b.data = append(b.data, b.parsed.frames[i]...)
+		b.n++
+	}
+	b.duration += b.parsed.duration48k()
+	b.samples += samples
+}
+
+// assemble builds the pending frames into the smallest Opus packet framing
+// that carries them: code 0 for one frame, code 1 or 2 for two, and code 3
+// (CBR when every frame has the same size, VBR otherwise) beyond that.
+func (b *packetBundler) assemble() []byte {
+	out := b.packet[:0]
+	cbr := true
+	for i := 1; i < b.n; i++ {
+		cbr = cbr && b.lens[i] == b.lens[0]
+	}
+	switch {
+	case b.n == 1:
+		out = append(out, b.toc)
+	case b.n == 2 && cbr:
+		out = append(out, b.toc|1)
+	case b.n == 2:
+		out = appendFrameLength(append(out, b.toc|2), b.lens[0])
+	case cbr:
+		out = append(out, b.toc|3, byte(b.n))
+	default:
+		out = append(out, b.toc|3, byte(b.n)|0x80)
+		for i := 0; i < b.n-1; i++ {
+			out = appendFrameLength(out, b.lens[i])
+		}
+	}
+	out = append(out, b.data...)
+	b.packet = out
+	return out
+}
+
+// reset drops the pending bundle.
+func (b *packetBundler) reset() {
+	b.n = 0
+	b.data = b.data[:0]
+	b.duration = 0
+	b.samples = 0
+}
+
+// bundlePacket implements WritePacket for a Writer with bundling enabled.
+// Packets that do not parse are written as they are, after the pending bundle.
+// So are trimmed packets, whose samples differ from their TOC duration: the
+// unbundler derives frame granules from the TOC durations of a bundle, which
+// a trimmed packet in the middle or at the end would throw off.
+func (ow *Writer) bundlePacket(packet []byte, samples int) error {
+	b := &ow.bundle
+	if !parseOpusFrames(packet, &b.parsed) || samples != b.parsed.duration48k() {
+		if err := ow.flushBundle(); err != nil {
+			return err
+		}
+		return ow.writeAudioPacket(packet, samples)
+	}
+	if !b.accepts() {
+		if err := ow.flushBundle(); err != nil {
+			return err
+		}
+	}
+	b.add(samples)
+	if b.duration >= b.limit {
+		return ow.flushBundle()
+	}
+	return nil
+}
+
+// flushBundle writes the pending bundle, if any, as one packet on its own page.
+func (ow *Writer) flushBundle() error {
+	b := &ow.bundle
+	if b.n == 0 {
+		return nil
+	}
+	if err := ow.writeAudioPacket(b.assemble(), b.samples); err != nil {
+		return err
+	}
+	b.reset()
+	return nil
+}
+
+// Flush writes any packets held back for bundling as one page. It is a no-op
+// unless WriterConfig.BundleSamples is set; Close flushes implicitly.
+func (ow *Writer) Flush() error {
+	if ow.closed {
+		return ErrUnexpectedEOS
+	}
+	return ow.flushBundle()
+}
+
+// packetUnbundler splits multi-frame packets back into single-frame packets
+// for Reader.SetUnbundle.
+type packetUnbundler struct {
+	enabled bool
+
+	packet  []byte // copy of the packet being split
+	parsed  opusFrames
+	next    int    // next frame of parsed to return
+	granule uint64 // granule position of the whole packet
+}
+
+// pending reports whether frames of a split packet remain to be returned.
+func (u *packetUnbundler) pending() bool {
+	return u.next < u.parsed.n
+}
+
+// load starts splitting packet, whose granule position is granule. It reports
+// false, leaving nothing pending, when packet is not a multi-frame packet.
+func (u *packetUnbundler) load(packet []byte, granule uint64) bool {
+	u.next, u.parsed.n = 0, 0
+	if len(packet) < 1 || packet[0]&0x03 == 0 {
+		return false
+	}
+	u.packet = append(u.packet[:0], packet...)
+	if !parseOpusFrames(u.packet, &u.parsed) {
+		u.parsed.n = 0
+		return false
+	}
+	u.granule = granule
+	return true
+}
+
+// frameGranule returns the granule position at the end of frame i.
+func (u *packetUnbundler) frameGranule(i int) uint64 {
+	after := uint64(opusFrameSizes48k[u.parsed.toc>>3]) * uint64(u.parsed.n-1-i)
+	if u.granule >= after {
+		return u.granule - after
+	}
+	return 0
+}
+
+// emit appends the next frame to dst[:0] as a code-0 packet and returns it
+// with its granule position.
+func (u *packetUnbundler) emit(dst []byte) ([]byte, uint64) {
+	i := u.next
+	u.next++
+	dst = append(append(dst[:0], u.parsed.toc), u.parsed.frames[i]...)
+	return dst, u.frameGranule(i)
+}
+
+// SetUnbundle makes ReadPacket and ReadPacketInto return every frame of a
+// multi-frame packet as its own single-frame packet, with the granule position
+// at the end of that frame. It undoes WriterConfig.BundleSamples for consumers
+// that expect one frame per packet; decoders need no such step, since a
+// bundled packet is a valid Opus packet of up to 120 ms. Packets whose padding
+// carries extensions (DRED, QEXT, ...) are returned whole, since the
+// extensions would not survive the split. Multistream streams are returned
+// unchanged.
+func (or *Reader) SetUnbundle(enabled bool) {
+	or.unbundle.enabled = enabled && or.Header != nil &&
+		(or.Header.MappingFamily == 0 || or.Header.StreamCount == 1)
+	or.unbundle.next, or.unbundle.parsed.n = 0, 0
+}
+
+// readUnit returns the next packet, or the next frame of a split packet when
+// unbundling.
+func (or *Reader) readUnit(dst []byte) ([]byte, uint64, error) {
+	u := &or.unbundle
+	if u.enabled && !u.pending() {
+		out, granule, err := or.nextPacket(dst)
+		if err != nil || !u.load(out, granule) {
+			return out, granule, err
+		}
+	}
+	if u.pending() {
+		out, granule := u.emit(dst)
+		or.granulePos = granule
+		return out, granule, nil
+	}
+	return or.nextPacket(dst)
+}
@@ -0,0 +1,398 @@
+package ogg
+
+import (
+	"bytes"
+	"io"
+	"math"
+	"testing"
+
+	gopus "github.com/thesyncim/gopus"
+)
+
+// encodeArchivePackets encodes frames 20 ms stereo packets, switching encoder
+// mode every 25 frames so bundles are broken by TOC changes.
+func encodeArchivePackets(tb testing.TB, frames int) [][]byte {
+	tb.Helper()
+	enc, err := gopus.NewEncoder(gopus.EncoderConfig{SampleRate: 48000, Channels: 2, Application: gopus.ApplicationAudio})
+	if err != nil {
+		tb.Fatalf("NewEncoder: %v", err)
+	}
+	if err := enc.SetBitrate(48000); err != nil {
+		tb.Fatalf("SetBitrate: %v", err)
+	}
+	modes := []gopus.EncoderMode{gopus.EncoderModeCELT, gopus.EncoderModeSILK, gopus.EncoderModeHybrid}
+	pcm := make([]float32, 960*2)
+	packets := make([][]byte, 0, frames)
+	for f := 0; f < frames; f++ {
+		if f%25 == 0 {
+			if err := enc.SetMode(modes[(f/25)%len(modes)]); err != nil {
+				tb.Fatalf("SetMode: %v", err)
+			}
+		}
+		for i := 0; i < 960; i++ {
+			tm := float64(f*960+i) / 48000
+			pcm[2*i] = float32(0.3 * math.Sin(2*math.Pi*440*tm))
+			pcm[2*i+1] = float32(0.2 * math.Sin(2*math.Pi*660*tm))
+		}
+		pkt, err := enc.EncodeFloat32(pcm)
+		if err != nil {
+			tb.Fatalf("frame %d Encode: %v", f, err)
+		}
+		packets = append(packets, append([]byte(nil), pkt...))
+	}
+	return packets
+}
+
+// writeArchive writes packets as a stereo Ogg Opus stream with the given
+// bundle duration and returns the file bytes.
+func writeArchive(tb testing.TB, packets [][]byte, bundleSamples int) []byte {
+	tb.Helper()
+	return writeTrimmedArchive(tb, packets, 960, bundleSamples)
+}
+
+// writeTrimmedArchive is writeArchive with the last packet written as
+// lastSamples samples, end-trimming the stream.
+func writeTrimmedArchive(tb testing.TB, packets [][]byte, lastSamples, bundleSamples int) []byte {
+	tb.Helper()
+	var buf bytes.Buffer
+	w, err := NewWriterWithConfig(&buf, WriterConfig{SampleRate: 48000, Channels: 2, BundleSamples: bundleSamples})
+	if err != nil {
+		tb.Fatalf("NewWriterWithConfig: %v", err)
+	}
+	for i, pkt := range packets {
+		samples := 960
+		if i == len(packets)-1 {
+			samples = lastSamples
+		}
+		if err := w.WritePacket(pkt, samples); err != nil {
+			tb.Fatalf("packet %d WritePacket: %v", i, err)
+		}
+	}
+	if err := w.Close(); err != nil {
+		tb.Fatalf("Close: %v", err)
+	}
+	return buf.Bytes()
+}
+
+// decodeArchive decodes an Ogg Opus stream through gopus.Reader.
+func decodeArchive(tb testing.TB, data []byte) []byte {
+	tb.Helper()
+	r, err := NewReader(bytes.NewReader(data))
+	if err != nil {
+		tb.Fatalf("NewReader: %v", err)
+	}
+	pr, err := gopus.NewReader(gopus.DefaultDecoderConfig(48000, 2), r, gopus.FormatInt16LE)
+	if err != nil {
+		tb.Fatalf("gopus.NewReader: %v", err)
+	}
+	pcm, err := io.ReadAll(pr)
+	if err != nil {
+		tb.Fatalf("decode: %v", err)
+	}
+	return pcm
+}
+
+// TestWriterBundleRoundTrip checks that a bundled archive is smaller, unbundles
+// to the original frames and granule positions, and decodes to the same PCM.
+func TestWriterBundleRoundTrip(t *testing.T) {
+	packets := encodeArchivePackets(t, 150)
+	plain := writeArchive(t, packets, 0)
+	bundled := writeArchive(t, packets, MaxBundleSamples)
+	if len(bundled) >= len(plain) {
+		t.Fatalf("bundled archive %d bytes, plain %d", len(bundled), len(plain))
+	}
+	t.Logf("plain %d bytes, bundled %d bytes", len(plain), len(bundled))
+
+	r, err := NewReader(bytes.NewReader(bundled))
+	if err != nil {
+		t.Fatalf("NewReader: %v", err)
+	}
+	pages := 0
+	for {
+		pkt, granule, err := r.ReadPacket()
+		if err == io.EOF {
+			break
+		}
+		if err != nil {
+			t.Fatalf("ReadPacket: %v", err)
+		}
+		if dur, _ := packetDuration48k(pkt); dur > MaxBundleSamples || granule%960 != 0 {
+			t.Fatalf("bundle of %d samples at granule %d", dur, granule)
+		}
+		pages++
+	}
+	if pages >= len(packets)/4 {
+		t.Fatalf("%d bundles for %d packets", pages, len(packets))
+	}
+
+	r, err = NewReader(bytes.NewReader(bundled))
+	if err != nil {
+		t.Fatalf("NewReader: %v", err)
+	}
+	r.SetUnbundle(true)
+	dst := make([]byte, 1500)
+	var want, got opusFrames
+	for i, pkt := range packets {
+		n, granule, err := r.ReadPacketInto(dst)
+		if err != nil {
+			t.Fatalf("packet %d ReadPacketInto: %v", i, err)
+		}
+		if granule != uint64(960*(i+1)) {
+			t.Fatalf("packet %d granule %d, want %d", i, granule, 960*(i+1))
+		}
+		if !parseOpusFrames(pkt, &want) || !parseOpusFrames(dst[:n], &got) {
+			t.Fatalf("packet %d does not parse", i)
+		}
+		if got.n != 1 || got.toc != want.toc || !bytes.Equal(got.frames[0], want.frames[0]) {
+			t.Fatalf("packet %d: unbundled frame differs from the original", i)
+		}
+	}
+	if _, _, err := r.ReadPacketInto(dst); err != io.EOF {
+		t.Fatalf("after last packet err=%v, want io.EOF", err)
+	}
+
+	if !bytes.Equal(decodeArchive(t, bundled), decodeArchive(t, plain)) {
+		t.Fatal("bundled archive decodes differently from the plain one")
+	}
+}
+
+// TestReaderUnbundleSeek checks that SeekGranule with unbundling resumes at
+// the first frame ending at or after the target, inside a bundle.
+func TestReaderUnbundleSeek(t *testing.T) {
+	packets := encodeArchivePackets(t, 400)
+	bundled := writeArchive(t, packets, MaxBundleSamples)
+	r, err := NewReader(bytes.NewReader(bundled))
+	if err != nil {
+		t.Fatalf("NewReader: %v", err)
+	}
+	r.SetUnbundle(true)
+	for _, target := range []uint64{960 * 203, 960*77 + 10, 960} {
+		if err := r.SeekGranule(target); err != nil {
+			t.Fatalf("SeekGranule(%d): %v", target, err)
+		}
+		pkt, granule, err := r.ReadPacket()
+		if err != nil {
+			t.Fatalf("ReadPacket after seek: %v", err)
+		}
+		i := int((granule+959)/960) - 1
+		if granule < target || granule-960 >= target || !bytes.Equal(pkt[1:], packets[i][1:]) {
+			t.Fatalf("seek to %d landed on granule %d", target, granule)
+		}
+	}
+}
+
+// TestReaderUnbundleEndTrimmed checks that the frames of a bundle whose last
+// packet is end-trimmed read back with the granule positions the plain writer
+// gives them, both from the start and after a seek into the bundle.
+func TestReaderUnbundleEndTrimmed(t *testing.T) {
+	for _, frames := range []int{6, 12, 14} {
+		packets := encodeArchivePackets(t, frames)
+		plain := writeTrimmedArchive(t, packets, 400, 0)
+		bundled := writeTrimmedArchive(t, packets, 400, MaxBundleSamples)
+
+		pr, err := NewReader(bytes.NewReader(plain))
+		if err != nil {
+			t.Fatalf("NewReader: %v", err)
+		}
+		want := make([]uint64, 0, frames)
+		for {
+			_, granule, err := pr.ReadPacket()
+			if err == io.EOF {
+				break
+			}
+			if err != nil {
+				t.Fatalf("plain ReadPacket: %v", err)
+			}
+			want = append(want, granule)
+		}
+		if len(want) != frames || want[frames-1] != uint64(960*(frames-1)+400) {
+			t.Fatalf("%d frames: plain granules %v", frames, want)
+		}
+
+		br, err := NewReader(bytes.NewReader(bundled))
+		if err != nil {
+			t.Fatalf("NewReader: %v", err)
+		}
+		br.SetUnbundle(true)
+		for i := range want {
+			_, granule, err := br.ReadPacket()
+			if err != nil {
+				t.Fatalf("%d frames: frame %d ReadPacket: %v", frames, i, err)
+			}
+			if granule != want[i] {
+				t.Fatalf("%d frames: frame %d granule %d, want %d", frames, i, granule, want[i])
+			}
+		}
+		if _, _, err := br.ReadPacket(); err != io.EOF {
+			t.Fatalf("%d frames: after last frame err=%v, want io.EOF", frames, err)
+		}
+
+		for i := range want {
+			target := want[i] - 1
+			if err := br.SeekGranule(target); err != nil {
+				t.Fatalf("%d frames: SeekGranule(%d): %v", frames, target, err)
+			}
+			if _, granule, err := br.ReadPacket(); err != nil || granule != want[i] {
+				t.Fatalf("%d frames: seek to %d read granule %d, %v; want %d", frames, target, granule, err, want[i])
+			}
+		}
+	}
+}
+
+// extensionPacket builds a VBR code-3 packet of frames whose padding is pad.
+func extensionPacket(toc byte, frames [][]byte, pad []byte) []byte {
+	pkt := []byte{toc | 3, 0xC0 | byte(len(frames)), byte(len(pad))}
+	for _, f := range frames[:len(frames)-1] {
+		pkt = appendFrameLength(pkt, len(f))
+	}
+	for _, f := range frames {
+		pkt = append(pkt, f...)
+	}
+	return append(pkt, pad...)
+}
+
+// TestBundleKeepsExtensionPackets checks that packets whose padding carries
+// DRED or QEXT extensions pass through bundling and unbundling whole.
+func TestBundleKeepsExtensionPackets(t *testing.T) {
+	plain := encodeArchivePackets(t, 10)
+	for i, pkt := range plain {
+		if pkt[0]&3 != 0 || pkt[0]&^3 != plain[0][0]&^3 {
+			t.Fatalf("packet %d: want same-config code-0 packets, TOC %#x", i, pkt[0])
+		}
+	}
+	toc := plain[0][0]
+	dred := append([]byte{126 << 1}, bytes.Repeat([]byte{0xD5}, 40)...)
+	qext := []byte{124<<1 | 1, 3, 7, 8, 9, 1, 1, 1}
+	stream := [][]byte{
+		plain[0], plain[1],
+		extensionPacket(toc, [][]byte{plain[2][1:]}, dred),
+		plain[3],
+		extensionPacket(toc, [][]byte{plain[4][1:], plain[5][1:]}, qext),
+		plain[6], plain[7],
+	}
+
+	var buf bytes.Buffer
+	w, err := NewWriterWithConfig(&buf, WriterConfig{SampleRate: 48000, Channels: 2, BundleSamples: MaxBundleSamples})
+	if err != nil {
+		t.Fatalf("NewWriterWithConfig: %v", err)
+	}
+	for i, pkt := range stream {
+		dur, _ := packetDuration48k(pkt)
+		if err := w.WritePacket(pkt, int(dur)); err != nil {
+			t.Fatalf("packet %d WritePacket: %v", i, err)
+		}
+	}
+	if err := w.Close(); err != nil {
+		t.Fatalf("Close: %v", err)
+	}
+
+	r, err := NewReader(bytes.NewReader(buf.Bytes()))
+	if err != nil {
+		t.Fatalf("NewReader: %v", err)
+	}
+	r.SetUnbundle(true)
+	var granule uint64
+	for i, want := range stream {
+		got, g, err := r.ReadPacket()
+		if err != nil {
+			t.Fatalf("packet %d ReadPacket: %v", i, err)
+		}
+		dur, _ := packetDuration48k(want)
+		granule += dur
+		if !bytes.Equal(got, want) || g != granule {
+			t.Fatalf("packet %d: got %x at granule %d, want %x at %d", i, got, g, want, granule)
+		}
+	}
+	if _, _, err := r.ReadPacket(); err != io.EOF {
+		t.Fatalf("after last packet err=%v, want io.EOF", err)
+	}
+}
+
+func TestOpusFramesAssembleParse(t *testing.T) {
+	for _, lens := range [][]int{{7}, {40, 40}, {40, 300}, {0, 12}, {60, 60, 60}, {251, 252, 253, 1275, 0, 9}} {
+		b := packetBundler{limit: MaxBundleSamples}
+		for i, l := range lens {
+			frame := bytes.Repeat([]byte{byte(i + 1)}, l)
+			b.parsed = opusFrames{toc: 0xF8, n: 1}
+			b.parsed.frames[0] = frame
+			b.add(120)
+		}
+		var f opusFrames
+		if !parseOpusFrames(b.assemble(), &f) || f.n != len(lens) || f.toc != 0xF8 {
+			t.Fatalf("lens %v: assembled packet does not parse back", lens)
+		}
+		for i, l := range lens {
+			if !bytes.Equal(f.frames[i], bytes.Repeat([]byte{byte(i + 1)}, l)) {
+				t.Fatalf("lens %v: frame %d differs", lens, i)
+			}
+		}
+	}
+
+	// A padded code-3 packet drops its padding.
+	var f opusFrames
+	padded := []byte{0xFB, 0x42, 255, 3, 1, 1, 2, 2}
+	padded = append(padded, make([]byte, 257)...)
+	if !parseOpusFrames(padded, &f) || f.n != 2 || !bytes.Equal(f.frames[1], []byte{2, 2}) {
+		t.Fatal("padded CBR packet parsed wrongly")
+	}
+	filler := []byte{0xFB, 0x42, 5, 1, 1, 2, 2, 0, 0, 1, 9, 9}
+	if !parseOpusFrames(filler, &f) || f.n != 2 {
+		t.Fatal("packet padded with ID 0 filler did not parse")
+	}
+	if parseOpusFrames([]byte{0xFB, 0x42, 3, 1, 1, 2, 2, 0, 126 << 1, 9}, &f) {
+		t.Fatal("packet with a DRED extension in its padding was split")
+	}
+}
+
+// BenchmarkArchiveWriter compares the plain writer with 120 ms bundling on
+// 20 ms packets: archive size per minute of audio and write and read
+// throughput in packets.
+func BenchmarkArchiveWriter(b *testing.B) {
+	packets := encodeArchivePackets(b, 150)
+	payload := 0
+	for _, pkt := range packets {
+		payload += len(pkt)
+	}
+	for _, mode := range []struct {
+		name   string
+		bundle int
+	}{{"plain", 0}, {"bundle120ms", MaxBundleSamples}} {
+		archive := writeArchive(b, packets, mode.bundle)
+		minute := float64(len(archive)) * 3000 / float64(len(packets))
+		b.Run(mode.name+"/write", func(b *testing.B) {
+			w, err := NewWriterWithConfig(io.Discard, WriterConfig{SampleRate: 48000, Channels: 2, BundleSamples: mode.bundle})
+			if err != nil {
+				b.Fatal(err)
+			}
+			b.SetBytes(int64(payload / len(packets)))
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				if err := w.WritePacket(packets[i%len(packets)], 960); err != nil {
+					b.Fatal(err)
+				}
+			}
+			b.ReportMetric(minute, "archive-B/min")
+		})
+		b.Run(mode.name+"/read", func(b *testing.B) {
+			dst := make([]byte, 1500)
+			b.SetBytes(int64(payload / len(packets)))
+			b.ReportAllocs()
+			var r *Reader
+			for i := 0; i < b.N; i++ {
+				if i%len(packets) == 0 {
+					b.StopTimer()
+					var err error
+					if r, err = NewReader(bytes.NewReader(archive)); err != nil {
+						b.Fatal(err)
+					}
+					r.SetUnbundle(true)
+					b.StartTimer()
+				}
+				if _, _, err := r.ReadPacketInto(dst); err != nil {
+					b.Fatal(err)
+				}
+			}
+			b.ReportMetric(minute, "archive-B/min")
+		})
+	}
+}
@@ -0,0 +1,269 @@
+package ogg
+
+import "io"
+
+// DemuxTrack describes one Opus logical bitstream found by a Demuxer.
+type DemuxTrack struct {
+	Serial uint32    // Bitstream serial number
+	Header *OpusHead // Parsed ID header
+	Tags   *OpusTags // Parsed comment header
+}
+
+// Demuxer reads every Opus logical bitstream of a multiplexed Ogg stream, the
+// counterpart to Muxer. Where Reader follows the first bitstream and skips the
+// rest, Demuxer returns the packets of all Opus tracks in file order, tagged
+// with the index of the track they belong to.
+//
+// Logical bitstreams whose beginning-of-stream page does not carry an OpusHead
+// (for example a Skeleton or video track) are skipped.
+type Demuxer struct {
+	pageReader
+
+	// Tracks lists the Opus tracks in beginning-of-stream page order; the
+	// track index returned with each packet indexes this slice.
+	Tracks []DemuxTrack
+
+	states   []demuxTrackState // Per-track reassembly state, parallel to Tracks
+	havePage bool              // page holds a loaded page
+	cur      int               // Track index of the loaded page, -1 for foreign streams
+	segIdx   int               // Next unread lacing segment in page.Segments
+	payOff   int               // Next unread byte in page.Payload
+	eof      bool              // Underlying reader exhausted
+
+	pending []demuxPacket // Audio packets read ahead while parsing headers
+	pktBuf  []byte        // Reused assembly buffer backing ReadPacket
+}
+
+// demuxTrackState holds a track's partially assembled packet while it spans
+// pages of interleaved bitstreams.
+type demuxTrackState struct {
+	partial    []byte
+	continuing bool // partial holds the head of a packet continued on a later page
+	tagsDone   bool
+}
+
+type demuxPacket struct {
+	track   int
+	data    []byte
+	granule uint64
+}
+
+// NewDemuxer creates a Demuxer over r and parses the headers of every Opus
+// track up front: all beginning-of-stream pages (RFC 3533 requires them
+// first) and then each track's OpusTags packet, which may span pages.
+//
+// It returns ErrNilReader if r is nil, ErrNoOpusTracks if no beginning-of-
+// stream page carries an OpusHead, ErrInvalidHeader for malformed headers and
+// ErrUnexpectedEOS if the stream ends before every track's OpusTags.
+func NewDemuxer(r io.Reader) (*Demuxer, error) {
+	if r == nil {
+		return nil, ErrNilReader
+	}
+	d := &Demuxer{
+		pageReader: pageReader{r: r, pageBuffer: make([]byte, readerBufferSize)},
+	}
+
+	firstDataPage := false
+	for {
+		page, err := d.readPage()
+		if err == io.EOF {
+			d.eof = true
+			break
+		}
+		if err != nil {
+			return nil, err
+		}
+		if !page.IsBOS() {
+			firstDataPage = true
+			break
+		}
+		packets := page.Packets()
+		if len(packets) == 0 || d.trackIndex(page.SerialNumber) >= 0 {
+			return nil, ErrInvalidPage
+		}
+		if !isOpusHead(packets[0]) {
+			continue // not an Opus bitstream
+		}
+		head, err := ParseOpusHead(packets[0])
+		if err != nil {
+			return nil, err
+		}
+		d.Tracks = append(d.Tracks, DemuxTrack{Serial: page.SerialNumber, Header: head})
+	}
+	if len(d.Tracks) == 0 {
+		return nil, ErrNoOpusTracks
+	}
+	d.states = make([]demuxTrackState, len(d.Tracks))
+	if firstDataPage {
+		d.loadPage()
+	}
+
+	for remaining := len(d.Tracks); remaining > 0; {
+		out, track, granule, err := d.nextPacket(d.pktBuf[:0])
+		if err == io.EOF {
+			return nil, ErrUnexpectedEOS
+		}
+		if err != nil {
+			return nil, err
+		}
+		d.pktBuf = out
+		st := &d.states[track]
+		if st.tagsDone {
+			d.pending = append(d.pending, demuxPacket{track: track, data: append([]byte(nil), out...), granule: granule})
+			continue
+		}
+		tags, err := ParseOpusTags(out)
+		if err != nil {
+			return nil, err
+		}
+		d.Tracks[track].Tags = tags
+		st.tagsDone = true
+		remaining--
+	}
+	return d, nil
+}
+
+func isOpusHead(packet []byte) bool {
+	return len(packet) >= 8 && string(packet[:8]) == "OpusHead"
+}
+
+// trackIndex returns the index in Tracks of the bitstream with the given serial
+// number, or -1.
+func (d *Demuxer) trackIndex(serial uint32) int {
+	for i := range d.Tracks {
+		if d.Tracks[i].Serial == serial {
+			return i
+		}
+	}
+	return -1
+}
+
+// ReadPacket reads the next Opus packet of any track. It returns the index of
+// the track in Tracks, the packet bytes and the packet's granule position.
+//
+// The returned slice is freshly allocated and owned by the caller. ReadPacket
+// returns io.EOF once the underlying stream is exhausted. To avoid the
+// per-packet allocation, use ReadPacketInto.
+func (d *Demuxer) ReadPacket() (track int, packet []byte, granulePos uint64, err error) {
+	if len(d.pending) > 0 {
+		p := d.pending[0]
+		d.pending = d.pending[1:]
+		return p.track, p.data, p.granule, nil
+	}
+	out, track, granule, err := d.nextPacket(d.pktBuf[:0])
+	if err != nil {
+		return 0, nil, 0, err
+	}
+	d.pktBuf = out
+	return track, append([]byte(nil), out...), granule, nil
+}
+
+// ReadPacketInto reads the next Opus packet of any track into dst, allocating
+// nothing when the packet fits. It returns the track index, the number of bytes
+// written and the packet's granule position.
+//
+// If the packet is larger than dst it returns ErrPacketTooLarge with n == 0;
+// the packet has already been consumed in that case.
+func (d *Demuxer) ReadPacketInto(dst []byte) (track, n int, granulePos uint64, err error) {
+	if len(d.pending) > 0 {
+		p := d.pending[0]
+		d.pending = d.pending[1:]
+		if len(p.data) > len(dst) {
+			return 0, 0, 0, ErrPacketTooLarge
+		}
+		return p.track, copy(dst, p.data), p.granule, nil
+	}
+	limit := len(dst)
+	out, track, granule, err := d.nextPacket(dst[:0])
+	if err != nil {
+		return 0, 0, 0, err
+	}
+	if len(out) > limit {
+		return 0, 0, 0, ErrPacketTooLarge
+	}
+	return track, len(out), granule, nil
+}
+
+// nextPacket appends the next complete packet of any Opus track to dst[:0] and
+// returns it with its track index and granule position. Packets continued
+// across pages are accumulated per track, so pages of other bitstreams may sit
+// between the pieces. A continuation whose head was never seen, or a head
+// whose continuation never arrives, is dropped as Reader does.
+func (d *Demuxer) nextPacket(dst []byte) ([]byte, int, uint64, error) {
+	for {
+		for !d.havePage || d.segIdx >= len(d.page.Segments) {
+			if d.eof {
+				return dst[:0], 0, 0, io.EOF
+			}
+			if _, err := d.readPage(); err != nil {
+				if err == io.EOF {
+					d.eof = true
+				}
+				return dst[:0], 0, 0, err
+			}
+			d.loadPage()
+		}
+
+		st := &d.states[d.cur]
+		start := d.payOff
+		complete := false
+		for d.segIdx < len(d.page.Segments) {
+			seg := int(d.page.Segments[d.segIdx])
+			d.segIdx++
+			d.payOff = min(d.payOff+seg, len(d.page.Payload))
+			if seg < 255 {
+				complete = true
+				break
+			}
+		}
+		piece := d.page.Payload[start:d.payOff]
+		if !complete {
+			st.partial = append(st.partial, piece...)
+			st.continuing = true
+			continue
+		}
+		if st.continuing {
+			dst = append(dst[:0], st.partial...)
+			dst = append(dst, piece...)
+			st.partial = st.partial[:0]
+			st.continuing = false
+		} else {
+			dst = append(dst[:0], piece...)
+		}
+		if len(dst) == 0 {
+			continue // skip an empty packet
+		}
+		return dst, d.cur, completedPacketGranule(&d.page, d.segIdx, d.payOff), nil
+	}
+}
+
+// loadPage resets the segment cursor for the page just read. Pages of foreign
+// bitstreams are marked consumed; for Opus tracks, continuation state that
+// does not match the page flags is discarded.
+func (d *Demuxer) loadPage() {
+	d.havePage = true
+	d.segIdx = 0
+	d.payOff = 0
+	d.cur = d.trackIndex(d.page.SerialNumber)
+	if d.cur < 0 {
+		d.segIdx = len(d.page.Segments) // foreign bitstream
+		return
+	}
+	st := &d.states[d.cur]
+	switch {
+	case d.page.IsContinuation() && !st.continuing:
+		// The packet head was never seen: skip its tail.
+		for d.segIdx < len(d.page.Segments) {
+			seg := int(d.page.Segments[d.segIdx])
+			d.segIdx++
+			d.payOff = min(d.payOff+seg, len(d.page.Payload))
+			if seg < 255 {
+				break
+			}
+		}
+	case !d.page.IsContinuation() && st.continuing:
+		// The continuation never arrived: abandon the partial packet.
+		st.partial = st.partial[:0]
+		st.continuing = false
+	}
+}
@@ -12,7 +12,9 @@
 // header and OpusTags comment header up front, then yields one Opus packet per
 // ReadPacket call. Packets that span multiple pages via the lacing table are
 // reassembled transparently. When the underlying reader is also an
-// io.ReadSeeker, SeekGranule provides sample-accurate positioning.
+// io.ReadSeeker, SeekGranule bisects the file to the packet holding a given
+// granule position; gopus.Reader.SeekSample builds on it to add decoder
+// pre-roll.
 //
 // # Writing
 //
@@ -21,6 +23,15 @@
 // terminal end-of-stream page on Close. Files produced this way play back in
 // standard tools (VLC, FFmpeg, browsers).
 //
+// # Multiplexing
+//
+// Muxer writes several Opus logical bitstreams into one file, each with its
+// own serial number and OpusHead, interleaving audio pages in granule order.
+// Each MuxTrack is meant to be fed by its own encoder goroutine; a bounded
+// per-track page queue keeps a fast track from running arbitrarily far ahead.
+// Demuxer reads such files back and returns the packets of every Opus track,
+// while Reader follows only the first one.
+//
 // # Buffer ownership and partial reads
 //
 // ParsePage, ParseOpusHead, and ParseOpusTags copy the bytes they retain, so
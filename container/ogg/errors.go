@@ -31,4 +31,15 @@ var (
 
 	// ErrNotSeekable indicates the reader does not support seeking.
 	ErrNotSeekable = errors.New("ogg: reader is not seekable")
+
+	// ErrInvalidMuxConfig indicates a MuxerConfig field is out of range.
+	ErrInvalidMuxConfig = errors.New("ogg: invalid muxer config")
+
+	// ErrMuxStarted indicates a track was added to a Muxer after its header
+	// pages were written.
+	ErrMuxStarted = errors.New("ogg: muxer already started")
+
+	// ErrNoOpusTracks indicates a multiplexed stream has no Opus logical
+	// bitstream.
+	ErrNoOpusTracks = errors.New("ogg: no Opus tracks in stream")
 )
@@ -0,0 +1,326 @@
+package ogg
+
+import (
+	"io"
+	"math/rand"
+	"sync"
+	"time"
+)
+
+// DefaultMuxTrackBuffer is the per-track page queue depth used when
+// MuxerConfig.TrackBuffer is zero.
+const DefaultMuxTrackBuffer = 16
+
+// MuxerConfig configures a Muxer.
+type MuxerConfig struct {
+	// TrackBuffer is the number of pages a track may queue while it is ahead
+	// of the slowest track. MuxTrack.WritePacket blocks once its queue is full,
+	// which bounds the memory held for a fast producer. Zero selects
+	// DefaultMuxTrackBuffer.
+	TrackBuffer int
+}
+
+// Muxer writes several Ogg Opus logical bitstreams into one physical stream
+// (RFC 3533 §4 grouping), for example one track per conference participant.
+//
+// Every track gets its own serial number and OpusHead. All beginning-of-stream
+// pages are written first, then each track's OpusTags page, then audio pages
+// interleaved in granule order. Each track is fed through its own MuxTrack,
+// which is designed to be driven by one producer goroutine per track (for
+// example a per-track encoder loop): a page is only written once every open
+// track has queued audio, so the output stays time-ordered while the
+// per-track queues bound how far a fast producer can run ahead.
+//
+// Because a full queue waits for the other tracks, a single goroutine feeding
+// several tracks must interleave its writes so no track gets more than
+// TrackBuffer packets ahead of another.
+type Muxer struct {
+	mu     sync.Mutex
+	space  sync.Cond // signalled when queued pages are written
+	w      io.Writer
+	depth  int
+	rng    *rand.Rand
+	tracks []*MuxTrack
+
+	started bool  // header pages written; no more tracks may be added
+	err     error // sticky write error
+
+	pageScratch [oggPageScratchSize]byte
+}
+
+// MuxTrack is one logical bitstream of a Muxer.
+type MuxTrack struct {
+	m          *Muxer
+	config     WriterConfig
+	serial     uint32
+	pageSeq    uint32
+	granulePos uint64
+
+	queue  []muxPage // ring of serialized pages awaiting their turn
+	head   int
+	queued int
+	closed bool // EOS page queued
+}
+
+// muxPage is a serialized page held in a track queue. data keeps its capacity
+// across reuse so steady-state muxing allocates nothing.
+type muxPage struct {
+	data    []byte
+	granule uint64
+}
+
+// NewMuxer creates a Muxer writing to w. Tracks are added with AddTrack before
+// the first packet is written.
+func NewMuxer(w io.Writer, config MuxerConfig) (*Muxer, error) {
+	if w == nil {
+		return nil, ErrNilWriter
+	}
+	if config.TrackBuffer < 0 {
+		return nil, ErrInvalidMuxConfig
+	}
+	depth := config.TrackBuffer
+	if depth == 0 {
+		depth = DefaultMuxTrackBuffer
+	}
+	m := &Muxer{
+		w:     w,
+		depth: depth,
+		rng:   rand.New(rand.NewSource(time.Now().UnixNano())),
+	}
+	m.space.L = &m.mu
+	return m, nil
+}
+
+// AddTrack adds a logical bitstream described by config, which is validated
+// exactly as for NewWriterWithConfig. Each track receives a serial number that
+// is unique within the Muxer.
+//
+// It returns ErrMuxStarted once any track has written a packet or the Muxer
+// has been closed, since Ogg requires all beginning-of-stream pages first.
+func (m *Muxer) AddTrack(config WriterConfig) (*MuxTrack, error) {
+	if err := normalizeWriterConfig(&config); err != nil {
+		return nil, err
+	}
+
+	m.mu.Lock()
+	defer m.mu.Unlock()
+	if m.started {
+		return nil, ErrMuxStarted
+	}
+
+	serial := m.rng.Uint32()
+	for m.serialInUse(serial) {
+		serial = m.rng.Uint32()
+	}
+	t := &MuxTrack{
+		m:      m,
+		config: config,
+		serial: serial,
+		queue:  make([]muxPage, m.depth),
+	}
+	m.tracks = append(m.tracks, t)
+	return t, nil
+}
+
+func (m *Muxer) serialInUse(serial uint32) bool {
+	for _, t := range m.tracks {
+		if t.serial == serial {
+			return true
+		}
+	}
+	return false
+}
+
+// Tracks returns the number of tracks added so far.
+func (m *Muxer) Tracks() int {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+	return len(m.tracks)
+}
+
+// Close ends every track that is still open, writes all queued pages and
+// returns the first write error encountered, if any. Close is idempotent; it
+// does not close the underlying io.Writer.
+func (m *Muxer) Close() error {
+	m.mu.Lock()
+	defer m.mu.Unlock()
+	if err := m.start(); err != nil {
+		return err
+	}
+	// Mark every open track ended before queueing any EOS page so drain no
+	// longer waits on them; each queue is then emptied before its EOS page is
+	// added, so every EOS page has a free slot.
+	var ending []*MuxTrack
+	for _, t := range m.tracks {
+		if !t.closed {
+			t.closed = true
+			ending = append(ending, t)
+		}
+	}
+	for _, t := range ending {
+		if err := m.drain(); err != nil {
+			return err
+		}
+		t.enqueue(nil, PageFlagEOS)
+	}
+	return m.drain()
+}
+
+// start writes every track's OpusHead BOS page followed by every track's
+// OpusTags page, once. Caller holds m.mu.
+func (m *Muxer) start() error {
+	if m.started {
+		return m.err
+	}
+	m.started = true
+	for _, t := range m.tracks {
+		if err := m.writeHeaderPage(t, opusHeadFor(&t.config).Encode(), PageFlagBOS); err != nil {
+			return err
+		}
+	}
+	tags := DefaultOpusTags().Encode()
+	for _, t := range m.tracks {
+		if err := m.writeHeaderPage(t, tags, 0); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+func (m *Muxer) writeHeaderPage(t *MuxTrack, payload []byte, headerType byte) error {
+	buf := appendPage(m.pageScratch[:0], payload, headerType, 0, t.serial, t.pageSeq)
+	t.pageSeq++
+	return m.write(buf)
+}
+
+// write writes one serialized page, recording the first failure so every later
+// call observes it. Caller holds m.mu.
+func (m *Muxer) write(buf []byte) error {
+	if m.err != nil {
+		return m.err
+	}
+	n, err := m.w.Write(buf)
+	if err == nil && n != len(buf) {
+		err = io.ErrShortWrite
+	}
+	if err != nil {
+		m.err = err
+		m.space.Broadcast()
+	}
+	return err
+}
+
+// drain writes queued pages in granule order for as long as the next page is
+// known: every track that is still open must have a page queued, otherwise it
+// might yet produce an earlier one. Ties go to the track added first. Caller
+// holds m.mu.
+func (m *Muxer) drain() error {
+	for {
+		var next *MuxTrack
+		for _, t := range m.tracks {
+			if t.queued == 0 {
+				if !t.closed {
+					return nil
+				}
+				continue
+			}
+			if next == nil || t.queue[t.head].granule < next.queue[next.head].granule {
+				next = t
+			}
+		}
+		if next == nil {
+			return nil
+		}
+		if err := m.write(next.queue[next.head].data); err != nil {
+			return err
+		}
+		next.head = (next.head + 1) % len(next.queue)
+		next.queued--
+		m.space.Broadcast()
+	}
+}
+
+// Serial returns the track's bitstream serial number.
+func (t *MuxTrack) Serial() uint32 {
+	return t.serial
+}
+
+// GranulePos returns the track's granule position (samples at 48 kHz) after
+// the packets queued so far.
+func (t *MuxTrack) GranulePos() uint64 {
+	t.m.mu.Lock()
+	defer t.m.mu.Unlock()
+	return t.granulePos
+}
+
+// WritePacket queues an Opus packet on this track, one packet per page as
+// Writer does. samples is the packet duration in 48 kHz samples. The packet is
+// copied, so the caller may reuse it immediately.
+//
+// WritePacket blocks while the track's queue is full, that is while the track
+// is TrackBuffer pages ahead of the slowest open track. It returns
+// ErrUnexpectedEOS after the track has been closed and the Muxer's sticky write
+// error once any page write has failed.
+func (t *MuxTrack) WritePacket(packet []byte, samples int) error {
+	m := t.m
+	m.mu.Lock()
+	defer m.mu.Unlock()
+	if t.closed {
+		return ErrUnexpectedEOS
+	}
+	if err := m.start(); err != nil {
+		return err
+	}
+	if err := t.waitForSpace(); err != nil {
+		return err
+	}
+	if t.closed {
+		return ErrUnexpectedEOS // the Muxer was closed while we waited
+	}
+	t.granulePos += uint64(samples)
+	t.enqueue(packet, 0)
+	return m.drain()
+}
+
+// Close queues the track's end-of-stream page. The Muxer keeps interleaving the
+// remaining tracks without waiting for this one. Close is idempotent.
+func (t *MuxTrack) Close() error {
+	m := t.m
+	m.mu.Lock()
+	defer m.mu.Unlock()
+	if t.closed {
+		return nil
+	}
+	if err := m.start(); err != nil {
+		return err
+	}
+	if err := t.waitForSpace(); err != nil {
+		return err
+	}
+	if t.closed {
+		return nil
+	}
+	t.enqueue(nil, PageFlagEOS)
+	t.closed = true
+	return m.drain()
+}
+
+// waitForSpace blocks until the track's queue has a free slot or a write has
+// failed. Caller holds m.mu.
+func (t *MuxTrack) waitForSpace() error {
+	m := t.m
+	for t.queued == len(t.queue) && m.err == nil {
+		m.space.Wait()
+	}
+	return m.err
+}
+
+// enqueue serializes a page at the track's current granule position into the
+// next free queue slot. Caller holds m.mu and has ensured there is room.
+func (t *MuxTrack) enqueue(payload []byte, headerType byte) {
+	slot := &t.queue[(t.head+t.queued)%len(t.queue)]
+	slot.data = appendPage(slot.data[:0], payload, headerType, t.granulePos, t.serial, t.pageSeq)
+	slot.granule = t.granulePos
+	t.pageSeq++
+	t.queued++
+}
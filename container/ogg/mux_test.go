@@ -0,0 +1,422 @@
+package ogg
+
+import (
+	"bytes"
+	"errors"
+	"fmt"
+	"io"
+	"sync"
+	"testing"
+	"time"
+
+	gopus "github.com/thesyncim/gopus"
+)
+
+// muxTestTrack describes the synthetic packet stream of one muxed track.
+type muxTestTrack struct {
+	toc     byte
+	samples int
+	size    int
+}
+
+var muxTestTracks = []muxTestTrack{
+	{toc: 0xF8, samples: 960, size: 40},   // CELT FB 20 ms
+	{toc: 0xF0, samples: 480, size: 600},  // CELT FB 10 ms, multi-segment
+	{toc: 0x18, samples: 2880, size: 120}, // SILK NB 60 ms
+}
+
+// muxTestPacket returns packet i of track tr; the payload encodes its
+// position so round trips can be checked byte for byte.
+func muxTestPacket(tr muxTestTrack, track, i int) []byte {
+	pkt := make([]byte, tr.size)
+	pkt[0] = tr.toc
+	for j := 1; j < len(pkt); j++ {
+		pkt[j] = byte(track*31 + i*7 + j)
+	}
+	return pkt
+}
+
+// buildMuxedStream muxes packets of muxTestTracks from one goroutine per track
+// covering roughly the given duration in 48 kHz samples.
+func buildMuxedStream(t *testing.T, duration int, config MuxerConfig) ([]byte, *Muxer, []*MuxTrack) {
+	t.Helper()
+	var buf bytes.Buffer
+	m, err := NewMuxer(&buf, config)
+	if err != nil {
+		t.Fatalf("NewMuxer: %v", err)
+	}
+	tracks := make([]*MuxTrack, len(muxTestTracks))
+	for i := range muxTestTracks {
+		tracks[i], err = m.AddTrack(WriterConfig{SampleRate: 48000, Channels: 1})
+		if err != nil {
+			t.Fatalf("AddTrack(%d): %v", i, err)
+		}
+	}
+
+	var wg sync.WaitGroup
+	errs := make([]error, len(tracks))
+	for i, tr := range muxTestTracks {
+		wg.Add(1)
+		go func(i int, tr muxTestTrack) {
+			defer wg.Done()
+			for n := 0; n*tr.samples < duration; n++ {
+				if err := tracks[i].WritePacket(muxTestPacket(tr, i, n), tr.samples); err != nil {
+					errs[i] = err
+					return
+				}
+			}
+			errs[i] = tracks[i].Close()
+		}(i, tr)
+	}
+	wg.Wait()
+	for i, err := range errs {
+		if err != nil {
+			t.Fatalf("track %d: %v", i, err)
+		}
+	}
+	if err := m.Close(); err != nil {
+		t.Fatalf("Muxer.Close: %v", err)
+	}
+	return buf.Bytes(), m, tracks
+}
+
+func TestMuxer_PageOrder(t *testing.T) {
+	data, _, tracks := buildMuxedStream(t, 48000, MuxerConfig{TrackBuffer: 2})
+
+	serialTrack := make(map[uint32]int)
+	for i, tr := range tracks {
+		serialTrack[tr.Serial()] = i
+	}
+	if len(serialTrack) != len(tracks) {
+		t.Fatalf("serial numbers not unique: %v", serialTrack)
+	}
+
+	nTracks := len(tracks)
+	var lastGranule uint64
+	eos := make([]bool, nTracks)
+	nextSeq := make([]uint32, nTracks)
+	for i := 0; len(data) > 0; i++ {
+		page, n, err := ParsePage(data)
+		if err != nil {
+			t.Fatalf("page %d: %v", i, err)
+		}
+		data = data[n:]
+		track, ok := serialTrack[page.SerialNumber]
+		if !ok {
+			t.Fatalf("page %d: unknown serial %d", i, page.SerialNumber)
+		}
+		if page.PageSequence != nextSeq[track] {
+			t.Errorf("page %d: track %d sequence = %d, want %d", i, track, page.PageSequence, nextSeq[track])
+		}
+		nextSeq[track]++
+		if eos[track] {
+			t.Errorf("page %d: track %d page after EOS", i, track)
+		}
+		eos[track] = page.IsEOS()
+
+		switch {
+		case i < nTracks:
+			if !page.IsBOS() || track != i {
+				t.Errorf("page %d: want BOS page of track %d, got BOS=%v track %d", i, i, page.IsBOS(), track)
+			}
+		case i < 2*nTracks:
+			if page.IsBOS() || page.GranulePos != 0 || track != i-nTracks {
+				t.Errorf("page %d: want OpusTags page of track %d", i, i-nTracks)
+			}
+		default:
+			if page.IsBOS() {
+				t.Errorf("page %d: BOS page after audio", i)
+			}
+			if page.GranulePos < lastGranule {
+				t.Errorf("page %d: granule %d after %d", i, page.GranulePos, lastGranule)
+			}
+			lastGranule = page.GranulePos
+		}
+	}
+	for i, done := range eos {
+		if !done {
+			t.Errorf("track %d: missing EOS page", i)
+		}
+	}
+}
+
+func TestMuxer_DemuxRoundTrip(t *testing.T) {
+	const duration = 48000
+	data, _, tracks := buildMuxedStream(t, duration, MuxerConfig{})
+
+	d, err := NewDemuxer(bytes.NewReader(data))
+	if err != nil {
+		t.Fatalf("NewDemuxer: %v", err)
+	}
+	if len(d.Tracks) != len(tracks) {
+		t.Fatalf("Demuxer found %d tracks, want %d", len(d.Tracks), len(tracks))
+	}
+	for i, dt := range d.Tracks {
+		if dt.Serial != tracks[i].Serial() {
+			t.Errorf("track %d: serial %d, want %d", i, dt.Serial, tracks[i].Serial())
+		}
+		if dt.Header == nil || dt.Tags == nil {
+			t.Fatalf("track %d: missing headers", i)
+		}
+	}
+
+	counts := make([]int, len(tracks))
+	for {
+		track, pkt, granule, err := d.ReadPacket()
+		if err == io.EOF {
+			break
+		}
+		if err != nil {
+			t.Fatalf("ReadPacket: %v", err)
+		}
+		tr := muxTestTracks[track]
+		n := counts[track]
+		if want := muxTestPacket(tr, track, n); !bytes.Equal(pkt, want) {
+			t.Fatalf("track %d packet %d: payload mismatch", track, n)
+		}
+		if want := uint64((n + 1) * tr.samples); granule != want {
+			t.Errorf("track %d packet %d: granule %d, want %d", track, n, granule, want)
+		}
+		counts[track]++
+	}
+	for i, tr := range muxTestTracks {
+		if want := (duration + tr.samples - 1) / tr.samples; counts[i] != want {
+			t.Errorf("track %d: %d packets, want %d", i, counts[i], want)
+		}
+		if got := tracks[i].GranulePos(); got != uint64(counts[i]*tr.samples) {
+			t.Errorf("track %d: GranulePos %d", i, got)
+		}
+	}
+
+	// A plain Reader follows the first track and skips the others.
+	r, err := NewReader(bytes.NewReader(data))
+	if err != nil {
+		t.Fatalf("NewReader: %v", err)
+	}
+	for n := 0; ; n++ {
+		pkt, _, err := r.ReadPacket()
+		if err == io.EOF {
+			if n != counts[0] {
+				t.Errorf("Reader read %d packets, want %d", n, counts[0])
+			}
+			break
+		}
+		if err != nil {
+			t.Fatalf("Reader.ReadPacket: %v", err)
+		}
+		if !bytes.Equal(pkt, muxTestPacket(muxTestTracks[0], 0, n)) {
+			t.Fatalf("Reader packet %d: payload mismatch", n)
+		}
+	}
+}
+
+func TestDemuxer_ReadPacketInto(t *testing.T) {
+	data, _, _ := buildMuxedStream(t, 9600, MuxerConfig{})
+	d, err := NewDemuxer(bytes.NewReader(data))
+	if err != nil {
+		t.Fatalf("NewDemuxer: %v", err)
+	}
+	if _, _, _, err := d.ReadPacketInto(make([]byte, 1)); !errors.Is(err, ErrPacketTooLarge) {
+		t.Fatalf("ReadPacketInto(small) error = %v, want ErrPacketTooLarge", err)
+	}
+	buf := make([]byte, 4096)
+	for {
+		track, n, _, err := d.ReadPacketInto(buf)
+		if err == io.EOF {
+			break
+		}
+		if err != nil {
+			t.Fatalf("ReadPacketInto: %v", err)
+		}
+		if n != muxTestTracks[track].size {
+			t.Errorf("track %d: packet size %d, want %d", track, n, muxTestTracks[track].size)
+		}
+	}
+}
+
+func TestDemuxer_NoOpusTracks(t *testing.T) {
+	page := &Page{
+		HeaderType:   PageFlagBOS,
+		SerialNumber: 7,
+		Segments:     BuildSegmentTable(8),
+		Payload:      []byte("fishead\x00"),
+	}
+	if _, err := NewDemuxer(bytes.NewReader(page.Encode())); !errors.Is(err, ErrNoOpusTracks) {
+		t.Fatalf("NewDemuxer error = %v, want ErrNoOpusTracks", err)
+	}
+	if _, err := NewDemuxer(nil); !errors.Is(err, ErrNilReader) {
+		t.Fatalf("NewDemuxer(nil) error = %v, want ErrNilReader", err)
+	}
+}
+
+func TestMuxer_AddTrackAfterStart(t *testing.T) {
+	m, err := NewMuxer(io.Discard, MuxerConfig{})
+	if err != nil {
+		t.Fatal(err)
+	}
+	tr, err := m.AddTrack(WriterConfig{SampleRate: 48000, Channels: 2})
+	if err != nil {
+		t.Fatal(err)
+	}
+	if err := tr.WritePacket([]byte{0xFC, 0x00}, 960); err != nil {
+		t.Fatal(err)
+	}
+	if _, err := m.AddTrack(WriterConfig{SampleRate: 48000, Channels: 2}); !errors.Is(err, ErrMuxStarted) {
+		t.Fatalf("AddTrack after start error = %v, want ErrMuxStarted", err)
+	}
+	if err := m.Close(); err != nil {
+		t.Fatal(err)
+	}
+	if err := tr.WritePacket([]byte{0xFC, 0x00}, 960); !errors.Is(err, ErrUnexpectedEOS) {
+		t.Fatalf("WritePacket after Close error = %v, want ErrUnexpectedEOS", err)
+	}
+	if _, err := NewMuxer(io.Discard, MuxerConfig{TrackBuffer: -1}); !errors.Is(err, ErrInvalidMuxConfig) {
+		t.Fatalf("NewMuxer(TrackBuffer=-1) error = %v, want ErrInvalidMuxConfig", err)
+	}
+	if _, err := m.AddTrack(WriterConfig{SampleRate: 48000, Channels: 0}); err == nil {
+		t.Fatal("AddTrack accepted an invalid config")
+	}
+}
+
+// TestMuxer_Backpressure checks that a track blocks once it is TrackBuffer
+// pages ahead of a silent track and resumes when that track catches up.
+func TestMuxer_Backpressure(t *testing.T) {
+	m, err := NewMuxer(io.Discard, MuxerConfig{TrackBuffer: 1})
+	if err != nil {
+		t.Fatal(err)
+	}
+	fast, _ := m.AddTrack(WriterConfig{SampleRate: 48000, Channels: 1})
+	slow, _ := m.AddTrack(WriterConfig{SampleRate: 48000, Channels: 1})
+	pkt := []byte{0xF8, 0x01}
+
+	if err := fast.WritePacket(pkt, 960); err != nil {
+		t.Fatal(err)
+	}
+	done := make(chan error, 1)
+	go func() { done <- fast.WritePacket(pkt, 960) }()
+	select {
+	case err := <-done:
+		t.Fatalf("second WritePacket returned %v while its queue was full", err)
+	case <-time.After(20 * time.Millisecond):
+	}
+	if err := slow.WritePacket(pkt, 960); err != nil {
+		t.Fatal(err)
+	}
+	select {
+	case err := <-done:
+		if err != nil {
+			t.Fatal(err)
+		}
+	case <-time.After(5 * time.Second):
+		t.Fatal("WritePacket still blocked after the slow track caught up")
+	}
+	if err := m.Close(); err != nil {
+		t.Fatal(err)
+	}
+}
+
+type failingWriter struct{ n int }
+
+func (w *failingWriter) Write(p []byte) (int, error) {
+	if w.n == 0 {
+		return 0, io.ErrClosedPipe
+	}
+	w.n--
+	return len(p), nil
+}
+
+func TestMuxer_StickyWriteError(t *testing.T) {
+	m, err := NewMuxer(&failingWriter{n: 2}, MuxerConfig{})
+	if err != nil {
+		t.Fatal(err)
+	}
+	tr, _ := m.AddTrack(WriterConfig{SampleRate: 48000, Channels: 1})
+	// The BOS and OpusTags pages fit; the first audio page fails.
+	if err := tr.WritePacket([]byte{0xF8}, 960); !errors.Is(err, io.ErrClosedPipe) {
+		t.Fatalf("WritePacket error = %v, want io.ErrClosedPipe", err)
+	}
+	if err := m.Close(); !errors.Is(err, io.ErrClosedPipe) {
+		t.Fatalf("Close error = %v, want sticky io.ErrClosedPipe", err)
+	}
+}
+
+func TestMuxTrackZeroAlloc(t *testing.T) {
+	m, err := NewMuxer(io.Discard, MuxerConfig{})
+	if err != nil {
+		t.Fatal(err)
+	}
+	tr, err := m.AddTrack(WriterConfig{SampleRate: 48000, Channels: 2})
+	if err != nil {
+		t.Fatal(err)
+	}
+	pkt := []byte{0x78, 0x01, 0x02, 0x03, 0x04, 0x05}
+	for range DefaultMuxTrackBuffer {
+		if err := tr.WritePacket(pkt, 960); err != nil {
+			t.Fatal(err)
+		}
+	}
+	if n := testing.AllocsPerRun(200, func() {
+		_ = tr.WritePacket(pkt, 960)
+	}); n != 0 {
+		t.Errorf("MuxTrack.WritePacket allocs/op = %v, want 0", n)
+	}
+}
+
+// BenchmarkMuxerParallelEncode encodes one second of audio per track, each
+// track on its own goroutine with its own encoder, into a shared Muxer. The
+// track-s/s metric is audio seconds muxed per wall-clock second.
+func BenchmarkMuxerParallelEncode(b *testing.B) {
+	const frameSize = 960
+	const frames = 50
+	pcm := generateSineWave(440, frameSize)
+	for _, nTracks := range []int{4, 16} {
+		b.Run(fmt.Sprintf("tracks=%d", nTracks), func(b *testing.B) {
+			encoders := make([]*gopus.Encoder, nTracks)
+			for i := range encoders {
+				enc, err := gopus.NewEncoder(gopus.EncoderConfig{
+					SampleRate:  48000,
+					Channels:    1,
+					Application: gopus.ApplicationAudio,
+				})
+				if err != nil {
+					b.Fatal(err)
+				}
+				encoders[i] = enc
+			}
+			b.ReportAllocs()
+			b.ResetTimer()
+			for range b.N {
+				m, _ := NewMuxer(io.Discard, MuxerConfig{})
+				tracks := make([]*MuxTrack, nTracks)
+				for i := range tracks {
+					tracks[i], _ = m.AddTrack(WriterConfig{SampleRate: 48000, Channels: 1})
+				}
+				var wg sync.WaitGroup
+				for i := range tracks {
+					wg.Add(1)
+					go func(enc *gopus.Encoder, tr *MuxTrack) {
+						defer wg.Done()
+						packet := make([]byte, 1275)
+						for range frames {
+							n, err := enc.Encode(pcm, packet)
+							if err != nil {
+								b.Error(err)
+								return
+							}
+							if err := tr.WritePacket(packet[:n], frameSize); err != nil {
+								b.Error(err)
+								return
+							}
+						}
+						_ = tr.Close()
+					}(encoders[i], tracks[i])
+				}
+				wg.Wait()
+				if err := m.Close(); err != nil {
+					b.Fatal(err)
+				}
+			}
+			b.ReportMetric(float64(b.N*nTracks*frames*frameSize)/48000/b.Elapsed().Seconds(), "track-s/s")
+		})
+	}
+}
@@ -1,11 +1,15 @@
 package ogg
 
-import "io"
+import (
+	"bytes"
+	"io"
+)
 
 // Reader reads Opus packets from an Ogg container.
 // It parses the Ogg stream and extracts Opus packets for decoding.
 type Reader struct {
-	r           io.Reader
+	pageReader
+
 	rs          io.ReadSeeker
 	Header      *OpusHead // Parsed ID header (set after NewReader)
 	Tags        *OpusTags // Parsed comment header (set after NewReader)
@@ -14,11 +18,6 @@ type Reader struct {
 	serial      uint32    // Stream serial number
 	audioOffset int64     // Stream offset of the first audio page for seekable inputs
 
-	pageBuffer   []byte // Read buffer; parsed pages alias it
-	bufferOffset int    // Start of unconsumed bytes in pageBuffer
-	bufferLen    int    // End of valid bytes in pageBuffer
-
-	page     Page // Current page, parsed zero-copy over pageBuffer
 	havePage bool // page holds a loaded page of this stream
 	segIdx   int  // Next unread lacing segment in page.Segments
 	payOff   int  // Next unread byte in page.Payload
@@ -27,11 +26,35 @@ type Reader struct {
 	pushback   []byte // One-packet pushback set by SeekGranule
 	pushbackG  uint64 // Granule of the pushed-back packet
 	hasPush    bool   // pushback holds a packet
+	resync     bool   // Drop a leading continuation after a mid-stream seek
+
+	unbundle packetUnbundler // Frame splitting enabled by SetUnbundle
+}
+
+// pageReader buffers an io.Reader and parses Ogg pages zero-copy over its read
+// buffer. Reader and Demuxer share it.
+type pageReader struct {
+	r io.Reader
+
+	pageBuffer   []byte // Read buffer; parsed pages alias it
+	bufferOffset int    // Start of unconsumed bytes in pageBuffer
+	bufferLen    int    // End of valid bytes in pageBuffer
+
+	page Page // Current page, parsed zero-copy over pageBuffer
 }
 
 // readerBufferSize is the size of the internal read buffer.
 const readerBufferSize = 64 * 1024 // 64KB
 
+// seekBisectSpan is the byte span below which SeekGranule stops bisecting and
+// scans packets linearly. One read buffer's worth keeps the final scan to a
+// single refill.
+const seekBisectSpan = readerBufferSize
+
+// granuleNone is the granule position of a page on which no packet completes
+// (RFC 3533 §6: -1 as an unsigned 64-bit value).
+const granuleNone = ^uint64(0)
+
 // NewReader creates a Reader over r and parses the Ogg Opus headers up front:
 // it reads the beginning-of-stream page carrying OpusHead and the following
 // page(s) carrying OpusTags, exposing them via the Header and Tags fields. The
@@ -48,8 +71,7 @@ func NewReader(r io.Reader) (*Reader, error) {
 	}
 
 	or := &Reader{
-		r:          r,
-		pageBuffer: make([]byte, readerBufferSize),
+		pageReader: pageReader{r: r, pageBuffer: make([]byte, readerBufferSize)},
 	}
 	if rs, ok := r.(io.ReadSeeker); ok {
 		or.rs = rs
@@ -79,7 +101,8 @@ func NewReader(r io.Reader) (*Reader, error) {
 	or.serial = page.SerialNumber
 
 	// Read comment page(s) with OpusTags. OpusTags may span multiple pages if
-	// there are many comments.
+	// there are many comments. In a grouped stream the other bitstreams' BOS
+	// and header pages come in between; they are skipped.
 	var tagsData []byte
 	for {
 		page, err = or.readPage()
@@ -87,7 +110,7 @@ func NewReader(r io.Reader) (*Reader, error) {
 			return nil, err
 		}
 		if page.SerialNumber != or.serial {
-			return nil, ErrInvalidPage
+			continue
 		}
 		if page.IsContinuation() && len(tagsData) == 0 {
 			return nil, ErrInvalidPage // Can't continue from nothing.
@@ -125,7 +148,7 @@ func NewReader(r io.Reader) (*Reader, error) {
 // surfaces the underlying parse error. To avoid the per-packet allocation, use
 // ReadPacketInto.
 func (or *Reader) ReadPacket() (packet []byte, granulePos uint64, err error) {
-	out, granule, err := or.nextPacket(or.pktScratch[:0])
+	out, granule, err := or.readUnit(or.pktScratch[:0])
 	if err != nil {
 		return nil, 0, err
 	}
@@ -143,7 +166,7 @@ func (or *Reader) ReadPacket() (packet []byte, granulePos uint64, err error) {
 // is returned at end of stream.
 func (or *Reader) ReadPacketInto(dst []byte) (n int, granulePos uint64, err error) {
 	limit := len(dst)
-	out, granule, err := or.nextPacket(dst[:0])
+	out, granule, err := or.readUnit(dst[:0])
 	if err != nil {
 		return 0, 0, err
 	}
@@ -239,19 +262,46 @@ func (or *Reader) advancePage() error {
 		if or.page.IsEOS() {
 			or.eos = true
 		}
+		if or.resync {
+			or.skipContinuation()
+		}
 		return nil
 	}
 }
 
-// packetGranule returns the granule position of the packet just assembled: the
-// current page granule minus the duration of every packet that completes after
-// it on the same page (RFC 7845 §4). If any trailing packet's duration is
-// unparseable the page granule is used as a safe fallback.
+// skipContinuation drops the tail of a packet that began before the page a
+// seek landed on, so reassembly restarts on a packet boundary. It stays armed
+// while pages carry only the continued packet.
+func (or *Reader) skipContinuation() {
+	if !or.page.IsContinuation() {
+		or.resync = false
+		return
+	}
+	for or.segIdx < len(or.page.Segments) {
+		seg := int(or.page.Segments[or.segIdx])
+		or.segIdx++
+		or.payOff = min(or.payOff+seg, len(or.page.Payload))
+		if seg < 255 {
+			or.resync = false
+			return
+		}
+	}
+}
+
+// packetGranule returns the granule position of the packet just assembled.
 func (or *Reader) packetGranule() uint64 {
-	page := &or.page
+	return completedPacketGranule(&or.page, or.segIdx, or.payOff)
+}
+
+// completedPacketGranule returns the granule position of a packet that
+// completed on page just before lacing segment segIdx (payload offset payOff):
+// the page granule minus the duration of every packet that completes after it
+// on the same page (RFC 7845 §4). If any trailing packet's duration is
+// unparseable the page granule is used as a safe fallback.
+func completedPacketGranule(page *Page, segIdx, payOff int) uint64 {
 	trailing := uint64(0)
-	off := or.payOff
-	for i := or.segIdx; i < len(page.Segments); {
+	off := payOff
+	for i := segIdx; i < len(page.Segments); {
 		start := off
 		terminated := false
 		for i < len(page.Segments) {
@@ -281,27 +331,27 @@ func (or *Reader) packetGranule() uint64 {
 	return 0
 }
 
-// SeekGranule rewinds a seekable stream to the first packet at or after target.
+// SeekGranule rewinds a seekable stream to the first packet at or after target,
+// that is, the first packet whose granule position (end sample at 48 kHz) is
+// not before target.
 //
-// This is a correctness-first linear scan from the first audio page, which keeps
-// the API small and deterministic for in-memory or file-backed readers. Later
-// optimizations can replace the linear walk with a true bisection search.
+// The byte range of the stream is bisected on page granule positions until it
+// is narrower than one read buffer, then packets are scanned linearly from the
+// last page known to end before target. Seeking therefore costs O(log n) page
+// syncs rather than a walk from the first audio page. It returns io.EOF when
+// target lies beyond the last packet.
 func (or *Reader) SeekGranule(target uint64) error {
 	if or.rs == nil {
 		return ErrNotSeekable
 	}
-	if _, err := or.rs.Seek(or.audioOffset, io.SeekStart); err != nil {
+	start, err := or.bisectGranule(target)
+	if err != nil {
 		return err
 	}
-
-	or.granulePos = 0
-	or.eos = false
-	or.havePage = false
-	or.hasPush = false
-	or.segIdx = 0
-	or.payOff = 0
-	or.bufferOffset = 0
-	or.bufferLen = 0
+	if err := or.rewind(start); err != nil {
+		return err
+	}
+	or.resync = start != or.audioOffset
 
 	for {
 		out, granule, err := or.nextPacket(or.pktScratch[:0])
@@ -315,11 +365,131 @@ func (or *Reader) SeekGranule(target uint64) error {
 			or.hasPush = true
 			or.granulePos = 0
 			or.eos = false
+			if or.unbundle.enabled && or.unbundle.load(out, granule) {
+				// Resume at the first frame that ends at or after target.
+				or.hasPush = false
+				for or.unbundle.frameGranule(or.unbundle.next) < target {
+					or.unbundle.next++
+				}
+			}
 			return nil
 		}
 	}
 }
 
+// rewind repositions the underlying stream at offset and clears the packet
+// cursor and read buffer.
+func (or *Reader) rewind(offset int64) error {
+	if _, err := or.rs.Seek(offset, io.SeekStart); err != nil {
+		return err
+	}
+	or.granulePos = 0
+	or.eos = false
+	or.havePage = false
+	or.hasPush = false
+	or.resync = false
+	or.unbundle.next, or.unbundle.parsed.n = 0, 0
+	or.segIdx = 0
+	or.payOff = 0
+	or.bufferOffset = 0
+	or.bufferLen = 0
+	return nil
+}
+
+// bisectGranule returns the offset of a page of this stream whose granule
+// position is below target (or the first audio page), chosen so that at most
+// seekBisectSpan bytes separate it from the page holding target.
+func (or *Reader) bisectGranule(target uint64) (int64, error) {
+	lo := or.audioOffset
+	hi, err := or.rs.Seek(0, io.SeekEnd)
+	if err != nil {
+		return 0, err
+	}
+	for hi-lo > seekBisectSpan {
+		mid := lo + (hi-lo)/2
+		off, granule, err := or.granulePageAfter(mid, hi)
+		if err != nil {
+			return 0, err
+		}
+		if off < 0 || granule >= target {
+			hi = mid
+			continue
+		}
+		lo = off
+	}
+	return lo, nil
+}
+
+// granulePageAfter returns the offset and granule position of the first page
+// of this stream that starts in [from, limit) and completes a packet, or -1 when
+// there is none.
+func (or *Reader) granulePageAfter(from, limit int64) (int64, uint64, error) {
+	if err := or.rewind(from); err != nil {
+		return 0, 0, err
+	}
+	for {
+		off, err := or.syncPage()
+		if err == io.EOF {
+			return -1, 0, nil
+		}
+		if err != nil {
+			return 0, 0, err
+		}
+		if off >= limit {
+			return -1, 0, nil
+		}
+		if or.page.SerialNumber == or.serial && or.page.GranulePos != granuleNone {
+			return off, or.page.GranulePos, nil
+		}
+	}
+}
+
+// syncPage loads the next CRC-clean page at or after the read position into
+// or.page and returns its stream offset. Unlike readPage it tolerates starting
+// mid-page: bytes that do not begin a valid page are skipped, as are capture
+// patterns that occur inside payload data.
+func (or *Reader) syncPage() (int64, error) {
+	magic := []byte(oggMagic)
+	atEOF := false
+	for {
+		buf := or.pageBuffer[or.bufferOffset:or.bufferLen]
+		if i := bytes.Index(buf, magic); i >= 0 {
+			or.bufferOffset += i
+			consumed, err := parsePageInto(or.pageBuffer[or.bufferOffset:or.bufferLen], &or.page)
+			if err == nil {
+				off, offErr := or.streamOffset()
+				if offErr != nil {
+					return 0, offErr
+				}
+				or.bufferOffset += consumed
+				return off, nil
+			}
+			if err == ErrBadCRC || atEOF {
+				or.bufferOffset++ // false capture; resume past it
+				continue
+			}
+			// Incomplete page; read more below.
+		} else if atEOF {
+			return 0, io.EOF
+		} else if keep := len(magic) - 1; len(buf) > keep {
+			or.bufferOffset = or.bufferLen - keep // magic may straddle the refill
+		}
+
+		if or.bufferOffset > 0 {
+			remaining := copy(or.pageBuffer, or.pageBuffer[or.bufferOffset:or.bufferLen])
+			or.bufferLen = remaining
+			or.bufferOffset = 0
+		}
+		n, err := or.r.Read(or.pageBuffer[or.bufferLen:])
+		or.bufferLen += n
+		if err == io.EOF {
+			atEOF = true
+		} else if err != nil {
+			return 0, err
+		}
+	}
+}
+
 var opusFrameSizes48k = [32]uint16{
 	480, 960, 1920, 2880,
 	480, 960, 1920, 2880,
@@ -373,46 +543,46 @@ func (or *Reader) streamOffset() (int64, error) {
 	return current - buffered, nil
 }
 
-// readPage parses the next Ogg page into the reused or.page, refilling the read
+// readPage parses the next Ogg page into the reused pr.page, refilling the read
 // buffer as needed, and returns a pointer to it.
-func (or *Reader) readPage() (*Page, error) {
+func (pr *pageReader) readPage() (*Page, error) {
 	for {
-		if or.bufferLen > or.bufferOffset {
-			consumed, err := parsePageInto(or.pageBuffer[or.bufferOffset:or.bufferLen], &or.page)
+		if pr.bufferLen > pr.bufferOffset {
+			consumed, err := parsePageInto(pr.pageBuffer[pr.bufferOffset:pr.bufferLen], &pr.page)
 			if err == nil {
-				or.bufferOffset += consumed
-				return &or.page, nil
+				pr.bufferOffset += consumed
+				return &pr.page, nil
 			}
 			// Not enough buffered for a complete page; read more.
 		}
 
 		// Compact the buffer.
-		if or.bufferOffset > 0 {
-			remaining := or.bufferLen - or.bufferOffset
+		if pr.bufferOffset > 0 {
+			remaining := pr.bufferLen - pr.bufferOffset
 			if remaining > 0 {
-				copy(or.pageBuffer, or.pageBuffer[or.bufferOffset:or.bufferLen])
+				copy(pr.pageBuffer, pr.pageBuffer[pr.bufferOffset:pr.bufferLen])
 			}
-			or.bufferLen = remaining
-			or.bufferOffset = 0
+			pr.bufferLen = remaining
+			pr.bufferOffset = 0
 		}
 
 		// Grow if a single page exceeds the buffer.
-		if or.bufferLen >= len(or.pageBuffer) {
-			newBuffer := make([]byte, len(or.pageBuffer)*2)
-			copy(newBuffer, or.pageBuffer[:or.bufferLen])
-			or.pageBuffer = newBuffer
+		if pr.bufferLen >= len(pr.pageBuffer) {
+			newBuffer := make([]byte, len(pr.pageBuffer)*2)
+			copy(newBuffer, pr.pageBuffer[:pr.bufferLen])
+			pr.pageBuffer = newBuffer
 		}
 
-		n, err := or.r.Read(or.pageBuffer[or.bufferLen:])
+		n, err := pr.r.Read(pr.pageBuffer[pr.bufferLen:])
 		if n > 0 {
-			or.bufferLen += n
+			pr.bufferLen += n
 		}
 		if err != nil {
-			if err == io.EOF && or.bufferLen > or.bufferOffset {
-				consumed, parseErr := parsePageInto(or.pageBuffer[or.bufferOffset:or.bufferLen], &or.page)
+			if err == io.EOF && pr.bufferLen > pr.bufferOffset {
+				consumed, parseErr := parsePageInto(pr.pageBuffer[pr.bufferOffset:pr.bufferLen], &pr.page)
 				if parseErr == nil {
-					or.bufferOffset += consumed
-					return &or.page, nil
+					pr.bufferOffset += consumed
+					return &pr.page, nil
 				}
 			}
 			return nil, err
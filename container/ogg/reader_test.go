@@ -578,6 +578,154 @@ func TestReader_SeekGranule(t *testing.T) {
 	}
 }
 
+// buildMultiPacketPageStream builds an Ogg Opus stream that packs the given
+// packets into pages of roughly pageBytes payload, splitting packets across
+// page boundaries with continuation pages as a libopus-style muxer would.
+func buildMultiPacketPageStream(packets [][]byte, samples, pageBytes int) []byte {
+	const serial = 0x5EE4
+	var out []byte
+	seq := uint32(0)
+	emit := func(flags byte, granule uint64, segments, payload []byte) {
+		p := Page{HeaderType: flags, GranulePos: granule, SerialNumber: serial, PageSequence: seq, Segments: segments, Payload: payload}
+		out = append(out, p.Encode()...)
+		seq++
+	}
+	emit(PageFlagBOS, 0, BuildSegmentTable(19), DefaultOpusHead(48000, 1).Encode())
+	tags := DefaultOpusTags().Encode()
+	emit(0, 0, BuildSegmentTable(len(tags)), tags)
+
+	var segments, payload []byte
+	granule := uint64(0)
+	pageGranule := granuleNone
+	continued := false
+	flush := func(flags byte) {
+		if continued {
+			flags |= PageFlagContinuation
+		}
+		emit(flags, pageGranule, segments, payload)
+		continued = len(segments) > 0 && segments[len(segments)-1] == 255
+		segments, payload, pageGranule = nil, nil, granuleNone
+	}
+	for _, pkt := range packets {
+		lacing := BuildSegmentTable(len(pkt))
+		off := 0
+		for i, seg := range lacing {
+			segments = append(segments, seg)
+			payload = append(payload, pkt[off:off+int(seg)]...)
+			off += int(seg)
+			if i == len(lacing)-1 {
+				granule += uint64(samples)
+				pageGranule = granule
+			}
+			if len(payload) >= pageBytes || len(segments) == 255 {
+				flush(0)
+			}
+		}
+	}
+	flush(PageFlagEOS)
+	return out
+}
+
+// TestReader_SeekGranule_BisectMatchesLinear checks that the bisecting seek
+// lands on the same packet a linear walk finds, across multi-packet pages,
+// packets continued over page boundaries, and payload bytes that mimic the
+// "OggS" capture pattern.
+func TestReader_SeekGranule_BisectMatchesLinear(t *testing.T) {
+	const numPackets = 3000
+	packets := make([][]byte, numPackets)
+	seed := uint32(1)
+	for i := range packets {
+		seed = seed*1664525 + 1013904223
+		pkt := make([]byte, 40+int(seed>>20)%900)
+		pkt[0] = 0xF8 // CELT FB 20 ms mono, code 0
+		for j := 1; j < len(pkt); j++ {
+			pkt[j] = byte(i*7 + j)
+		}
+		if i%5 == 0 {
+			copy(pkt[len(pkt)/2:], oggMagic)
+		}
+		packets[i] = pkt
+	}
+	stream := buildMultiPacketPageStream(packets, 960, 4000)
+
+	r, err := NewReader(bytes.NewReader(stream))
+	if err != nil {
+		t.Fatalf("NewReader failed: %v", err)
+	}
+	targets := []uint64{0, 1, 959, 960, 961, 123456, 1440000, 1440001, 2879040, numPackets * 960}
+	for i := uint64(0); i < 40; i++ {
+		targets = append(targets, (i*7919*960+i*131)%(numPackets*960))
+	}
+	for _, target := range targets {
+		want := int((target + 959) / 960) // first packet whose end granule >= target
+		if want > 0 {
+			want--
+		}
+		if err := r.SeekGranule(target); err != nil {
+			t.Fatalf("SeekGranule(%d) failed: %v", target, err)
+		}
+		for k := range 3 {
+			idx := want + k
+			packet, granule, err := r.ReadPacket()
+			if idx >= numPackets {
+				if err != io.EOF {
+					t.Fatalf("SeekGranule(%d) read %d past end: err=%v, want io.EOF", target, k, err)
+				}
+				break
+			}
+			if err != nil {
+				t.Fatalf("SeekGranule(%d) read %d failed: %v", target, k, err)
+			}
+			if !bytes.Equal(packet, packets[idx]) {
+				t.Fatalf("SeekGranule(%d) read %d returned the wrong packet (len %d, want packet %d len %d)",
+					target, k, len(packet), idx, len(packets[idx]))
+			}
+			if wantG := uint64(idx+1) * 960; granule != wantG {
+				t.Fatalf("SeekGranule(%d) read %d granule = %d, want %d", target, k, granule, wantG)
+			}
+		}
+	}
+
+	if err := r.SeekGranule(numPackets*960 + 1); err != io.EOF {
+		t.Fatalf("SeekGranule past end error = %v, want io.EOF", err)
+	}
+}
+
+func BenchmarkReaderSeekGranule(b *testing.B) {
+	// One hour of 20 ms packets, one packet per page as Writer emits them.
+	const numPackets = 180000
+	var buf bytes.Buffer
+	w, err := NewWriter(&buf, 48000, 2)
+	if err != nil {
+		b.Fatal(err)
+	}
+	pkt := make([]byte, 120)
+	pkt[0] = 0xFC
+	for range numPackets {
+		if err := w.WritePacket(pkt, 960); err != nil {
+			b.Fatal(err)
+		}
+	}
+	_ = w.Close()
+	r, err := NewReader(bytes.NewReader(buf.Bytes()))
+	if err != nil {
+		b.Fatal(err)
+	}
+	dst := make([]byte, 4096)
+	b.SetBytes(int64(buf.Len()))
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		target := uint64(i*7919%numPackets) * 960
+		if err := r.SeekGranule(target); err != nil {
+			b.Fatal(err)
+		}
+		if _, _, err := r.ReadPacketInto(dst); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
+
 func TestReader_SeekGranule_NotSeekable(t *testing.T) {
 	var buf bytes.Buffer
 	w, err := NewWriter(&buf, 48000, 1)
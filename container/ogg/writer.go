@@ -46,6 +46,20 @@ type WriterConfig struct {
 	// when (channels,streams,coupled) matches a valid projection layout;
 	// otherwise an identity matrix is emitted.
 	DemixingMatrix []byte
+
+	// BundleSamples enables archival bundling: consecutive packets with the
+	// same TOC configuration are repacketized into one multi-frame packet of
+	// up to BundleSamples samples at 48 kHz (capped at MaxBundleSamples), and
+	// each bundle is written on a single page with the summed granule
+	// advance. This saves the per-page header and per-packet TOC overhead of
+	// short frames. Packets whose padding carries extensions (DRED, QEXT,
+	// ...) are written whole on their own page so the extensions survive,
+	// and so are trimmed packets (samples other than the TOC duration) so
+	// their granule positions survive unbundling.
+	// The output is standard Ogg Opus; Reader.SetUnbundle recovers
+	// single-frame packets. Zero writes one packet per page as given.
+	// Ignored for multistream streams.
+	BundleSamples int
 }
 
 // oggPageScratchSize is the inline page-serialization buffer carried by each
@@ -68,6 +82,11 @@ type Writer struct {
 	// pageScratch is reused across writePage calls so steady-state writing
 	// allocates nothing; it is part of the Writer's own allocation.
 	pageScratch [oggPageScratchSize]byte
+	// pageSpill backs pages too large for pageScratch, such as long bundles
+	// at high bitrates; it is kept so they too stop allocating.
+	pageSpill []byte
+
+	bundle packetBundler // Pending bundle when config.BundleSamples is set
 }
 
 // NewWriter creates a new OggWriter with default configuration.
@@ -106,23 +125,51 @@ func NewWriterWithConfig(w io.Writer, config WriterConfig) (*Writer, error) {
 		return nil, ErrNilWriter
 	}
 
+	if err := normalizeWriterConfig(&config); err != nil {
+		return nil, err
+	}
+
+	// Generate random serial number.
+	rng := rand.New(rand.NewSource(time.Now().UnixNano()))
+	serial := rng.Uint32()
+
+	ow := &Writer{
+		w:      w,
+		config: config,
+		serial: serial,
+	}
+	if config.StreamCount <= 1 {
+		ow.bundle.limit = min(max(config.BundleSamples, 0), MaxBundleSamples)
+	}
+
+	// Write headers immediately.
+	if err := ow.writeHeaders(); err != nil {
+		return nil, err
+	}
+
+	return ow, nil
+}
+
+// normalizeWriterConfig validates config and fills in defaults: the pre-skip
+// and, for mapping family 3, the default or identity demixing matrix.
+func normalizeWriterConfig(config *WriterConfig) error {
 	// Validate config.
 	if config.Channels == 0 {
-		return nil, ErrInvalidHeader
+		return ErrInvalidHeader
 	}
 
 	// Validate mapping family 0 constraints.
 	if config.MappingFamily == 0 && config.Channels > 2 {
-		return nil, ErrInvalidHeader
+		return ErrInvalidHeader
 	}
 
 	// Validate non-RTP multistream requirements.
 	if config.MappingFamily != 0 {
 		if config.StreamCount == 0 {
-			return nil, ErrInvalidHeader
+			return ErrInvalidHeader
 		}
 		if int(config.CoupledCount) > int(config.StreamCount) {
-			return nil, ErrInvalidHeader
+			return ErrInvalidHeader
 		}
 
 		if config.MappingFamily == MappingFamilyProjection {
@@ -137,17 +184,17 @@ func NewWriterWithConfig(w io.Writer, config WriterConfig) (*Writer, error) {
 					config.DemixingMatrix = identityDemixingMatrix(config.Channels, config.StreamCount, config.CoupledCount)
 				}
 			} else if len(config.DemixingMatrix) != expected {
-				return nil, ErrInvalidHeader
+				return ErrInvalidHeader
 			}
 		} else {
 			if len(config.ChannelMapping) != int(config.Channels) {
-				return nil, ErrInvalidHeader
+				return ErrInvalidHeader
 			}
 			// Validate mapping values.
 			maxStream := config.StreamCount + config.CoupledCount
 			for _, m := range config.ChannelMapping {
 				if m >= maxStream && m != 255 { // 255 = silence
-					return nil, ErrInvalidHeader
+					return ErrInvalidHeader
 				}
 			}
 		}
@@ -157,23 +204,7 @@ func NewWriterWithConfig(w io.Writer, config WriterConfig) (*Writer, error) {
 	if config.PreSkip == 0 {
 		config.PreSkip = DefaultPreSkip
 	}
-
-	// Generate random serial number.
-	rng := rand.New(rand.NewSource(time.Now().UnixNano()))
-	serial := rng.Uint32()
-
-	ow := &Writer{
-		w:      w,
-		config: config,
-		serial: serial,
-	}
-
-	// Write headers immediately.
-	if err := ow.writeHeaders(); err != nil {
-		return nil, err
-	}
-
-	return ow, nil
+	return nil
 }
 
 // writeHeaders writes the OpusHead (BOS page) and OpusTags pages.
@@ -182,29 +213,7 @@ func (ow *Writer) writeHeaders() error {
 		return nil
 	}
 
-	// Create OpusHead.
-	var head *OpusHead
-	if ow.config.MappingFamily == 0 {
-		head = DefaultOpusHead(ow.config.SampleRate, ow.config.Channels)
-		head.PreSkip = ow.config.PreSkip
-		head.OutputGain = ow.config.OutputGain
-	} else {
-		head = DefaultOpusHeadMultistreamWithFamily(
-			ow.config.SampleRate,
-			ow.config.Channels,
-			ow.config.MappingFamily,
-			ow.config.StreamCount,
-			ow.config.CoupledCount,
-			ow.config.ChannelMapping,
-		)
-		if ow.config.MappingFamily == MappingFamilyProjection && len(ow.config.DemixingMatrix) > 0 {
-			head.DemixingMatrix = ow.config.DemixingMatrix
-		}
-		head.PreSkip = ow.config.PreSkip
-		head.OutputGain = ow.config.OutputGain
-	}
-
-	headPayload := head.Encode()
+	headPayload := opusHeadFor(&ow.config).Encode()
 
 	// Write BOS page with OpusHead.
 	// Header pages MUST have granulePos = 0.
@@ -225,10 +234,65 @@ func (ow *Writer) writeHeaders() error {
 	return nil
 }
 
+// opusHeadFor builds the OpusHead identification header described by config.
+func opusHeadFor(config *WriterConfig) *OpusHead {
+	var head *OpusHead
+	if config.MappingFamily == 0 {
+		head = DefaultOpusHead(config.SampleRate, config.Channels)
+		head.PreSkip = config.PreSkip
+		head.OutputGain = config.OutputGain
+	} else {
+		head = DefaultOpusHeadMultistreamWithFamily(
+			config.SampleRate,
+			config.Channels,
+			config.MappingFamily,
+			config.StreamCount,
+			config.CoupledCount,
+			config.ChannelMapping,
+		)
+		if config.MappingFamily == MappingFamilyProjection && len(config.DemixingMatrix) > 0 {
+			head.DemixingMatrix = config.DemixingMatrix
+		}
+		head.PreSkip = config.PreSkip
+		head.OutputGain = config.OutputGain
+	}
+	return head
+}
+
 // writePage writes a single Ogg page.
 // For header pages, granulePos is always 0.
 // For audio pages, granulePos is the current granule position.
 func (ow *Writer) writePage(payload []byte, headerType byte) error {
+	// Header pages (BOS flag set or before headersDone) have granule = 0.
+	granulePos := ow.granulePos
+	if headerType&PageFlagBOS != 0 || !ow.headersDone {
+		granulePos = 0
+	}
+
+	dst := ow.pageScratch[:0]
+	if pageHeaderSize+len(payload)/255+1+len(payload) > len(ow.pageScratch) {
+		dst = ow.pageSpill[:0]
+	}
+	buf := appendPage(dst, payload, headerType, granulePos, ow.serial, ow.pageSeq)
+	if cap(buf) > len(ow.pageScratch) {
+		ow.pageSpill = buf[:0]
+	}
+	n, err := ow.w.Write(buf)
+	if err != nil {
+		return err
+	}
+	if n != len(buf) {
+		return io.ErrShortWrite
+	}
+
+	ow.pageSeq++
+	return nil
+}
+
+// appendPage serializes a page carrying a single packet (or, for a packetless
+// EOS page, none) onto dst and returns the extended slice. dst is only
+// reallocated when its capacity is too small, so callers pass reused scratch.
+func appendPage(dst, payload []byte, headerType byte, granulePos uint64, serial, pageSeq uint32) []byte {
 	// Lacing: ceil-style segment table for the payload. An EOS page with no
 	// payload is emitted packetless (zero segments) — a zero-length lacing entry
 	// would encode an empty packet, which strict demuxers reject for the EOS
@@ -238,26 +302,21 @@ func (ow *Writer) writePage(payload []byte, headerType byte) error {
 		numSegments = 0
 	}
 
+	start := len(dst)
 	total := pageHeaderSize + numSegments + len(payload)
-	var buf []byte
-	if total <= len(ow.pageScratch) {
-		buf = ow.pageScratch[:total]
-	} else {
-		buf = make([]byte, total)
-	}
-
-	// Header pages (BOS flag set or before headersDone) have granule = 0.
-	granulePos := ow.granulePos
-	if headerType&PageFlagBOS != 0 || !ow.headersDone {
-		granulePos = 0
+	if cap(dst)-start < total {
+		grown := make([]byte, start, start+total)
+		copy(grown, dst)
+		dst = grown
 	}
+	buf := dst[start : start+total]
 
 	copy(buf[0:4], oggMagic)
 	buf[4] = 0 // stream structure version
 	buf[5] = headerType
 	binary.LittleEndian.PutUint64(buf[6:14], granulePos)
-	binary.LittleEndian.PutUint32(buf[14:18], ow.serial)
-	binary.LittleEndian.PutUint32(buf[18:22], ow.pageSeq)
+	binary.LittleEndian.PutUint32(buf[14:18], serial)
+	binary.LittleEndian.PutUint32(buf[18:22], pageSeq)
 	buf[22], buf[23], buf[24], buf[25] = 0, 0, 0, 0 // CRC, computed below
 	buf[26] = byte(numSegments)
 
@@ -273,28 +332,30 @@ func (ow *Writer) writePage(payload []byte, headerType byte) error {
 	copy(buf[si:], payload)
 
 	binary.LittleEndian.PutUint32(buf[22:26], oggCRC(buf))
-
-	n, err := ow.w.Write(buf)
-	if err != nil {
-		return err
-	}
-	if n != len(buf) {
-		return io.ErrShortWrite
-	}
-
-	ow.pageSeq++
-	return nil
+	return dst[:start+total]
 }
 
 // WritePacket writes an Opus packet to the stream.
 // samples is the number of PCM samples at 48kHz represented by this packet
 // (typically 960 for 20ms frames).
 // Updates the granule position accordingly.
+//
+// With WriterConfig.BundleSamples set, the packet may be held back and merged
+// with the following ones; it is written by a later WritePacket, Flush or
+// Close.
 func (ow *Writer) WritePacket(packet []byte, samples int) error {
 	if ow.closed {
 		return ErrUnexpectedEOS
 	}
+	if ow.bundle.limit > 0 {
+		return ow.bundlePacket(packet, samples)
+	}
+	return ow.writeAudioPacket(packet, samples)
+}
 
+// writeAudioPacket writes packet on its own audio page, advancing the granule
+// position by samples.
+func (ow *Writer) writeAudioPacket(packet []byte, samples int) error {
 	if !ow.headersDone {
 		if err := ow.writeHeaders(); err != nil {
 			return err
@@ -322,6 +383,9 @@ func (ow *Writer) Close() error {
 	if ow.closed {
 		return nil
 	}
+	if err := ow.flushBundle(); err != nil {
+		return err
+	}
 
 	// Write empty EOS page.
 	if err := ow.writePage(nil, PageFlagEOS); err != nil {
@@ -337,9 +401,10 @@ func (ow *Writer) Serial() uint32 {
 	return ow.serial
 }
 
-// GranulePos returns the current granule position (samples at 48kHz).
+// GranulePos returns the current granule position (samples at 48kHz),
+// including packets held back for bundling.
 func (ow *Writer) GranulePos() uint64 {
-	return ow.granulePos
+	return ow.granulePos + uint64(ow.bundle.samples)
 }
 
 // PageCount returns the number of pages written so far.
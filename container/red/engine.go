@@ -0,0 +1,331 @@
+package red
+
+// DefaultMaxAdaptiveDepth is the redundancy depth ceiling a Sender uses when
+// SenderConfig.MaxDepth is zero.
+const DefaultMaxAdaptiveDepth = 3
+
+// DefaultMaxRecoveryGap is the largest run of missing packets a Receiver
+// plans recovery for when ReceiverConfig.MaxGap is zero. Longer gaps are
+// treated as a stream discontinuity.
+const DefaultMaxRecoveryGap = 16
+
+// SenderConfig configures a Sender.
+type SenderConfig struct {
+	// PayloadType is the RTP payload type of the primary and redundant blocks.
+	PayloadType byte
+
+	// FrameSamples is the RTP timestamp increment per Opus frame (960 for
+	// 20 ms at 48 kHz).
+	FrameSamples int
+
+	// MinDepth and MaxDepth bound the adaptive redundancy depth. MaxDepth is
+	// clamped to the package MaxDepth; zero selects DefaultMaxAdaptiveDepth.
+	// Setting both to the same value disables adaptation.
+	MinDepth int
+	MaxDepth int
+}
+
+// Sender is a per-stream RED packetizer for gateways that build packets for
+// many streams per tick. Unlike Encoder it does not copy frames into its
+// history: it keeps the caller's payload slices in a fixed ring, and
+// EncodeAppend writes into a caller-supplied buffer so one arena can hold the
+// packets of every stream. The redundancy depth adapts to the loss reported
+// through ReportFractionLost.
+//
+// The zero value is unusable; call Init (or NewSender). A Sender has no heap
+// state of its own, so a []Sender slab initialised in place serves as the pool
+// for large stream counts. It is not safe for concurrent use.
+type Sender struct {
+	pt           byte
+	frameSamples int
+	minDepth     int
+	maxDepth     int
+	depth        int
+	loss         int // smoothed fraction lost, Q12 (4096 = all packets lost)
+
+	history [MaxDepth]Frame // newest first; aliases caller payloads
+	nHist   int
+}
+
+// NewSender returns a Sender initialised with config.
+func NewSender(config SenderConfig) *Sender {
+	s := new(Sender)
+	s.Init(config)
+	return s
+}
+
+// Init (re)initialises s with config, dropping its history. The starting depth
+// is one redundant frame, clamped to [MinDepth, MaxDepth].
+func (s *Sender) Init(config SenderConfig) {
+	maxDepth := config.MaxDepth
+	if maxDepth <= 0 {
+		maxDepth = DefaultMaxAdaptiveDepth
+	}
+	maxDepth = min(maxDepth, MaxDepth)
+	minDepth := min(max(config.MinDepth, 0), maxDepth)
+	*s = Sender{
+		pt:           config.PayloadType,
+		frameSamples: config.FrameSamples,
+		minDepth:     minDepth,
+		maxDepth:     maxDepth,
+		depth:        min(max(1, minDepth), maxDepth),
+	}
+}
+
+// Depth returns the number of redundant frames the next packet may carry.
+func (s *Sender) Depth() int {
+	return s.depth
+}
+
+// EncodeAppend appends the RED payload carrying primary at timestamp, plus up
+// to Depth eligible earlier frames, to dst and returns the extended slice and
+// the redundant payload byte count. See BuildAppend for eligibility rules.
+//
+// primary is retained, not copied: the caller must leave its bytes unmodified
+// until MaxDepth (the configured ceiling) further frames have been encoded or
+// the Sender is reset. Reusing a pool of per-frame packet buffers that is at
+// least that deep satisfies this.
+func (s *Sender) EncodeAppend(dst, primary []byte, timestamp uint32) (out []byte, redundantBytes int) {
+	history, depth := s.history[:s.nHist], s.depth
+	if depth == 0 {
+		// Keep the RED envelope so the receiver's payload type still parses.
+		history, depth = nil, 1
+	}
+	pkt, redundantBytes := BuildAppend(dst[len(dst):], primary, timestamp, history, depth, s.frameSamples, s.pt)
+	if cap(dst)-len(dst) >= len(pkt) {
+		out = dst[:len(dst)+len(pkt)] // built in place
+	} else {
+		out = append(dst, pkt...)
+	}
+
+	if len(primary) > 0 {
+		if s.nHist < s.maxDepth {
+			s.nHist++
+		}
+		copy(s.history[1:s.nHist], s.history[:s.nHist-1])
+		s.history[0] = Frame{Timestamp: timestamp, Payload: primary}
+	}
+	return out, redundantBytes
+}
+
+// ReportFractionLost feeds a receiver-side loss measurement back into the
+// depth adaptation. fraction uses the RTCP receiver report scale: the share of
+// packets lost since the last report, times 256. The measurements are smoothed
+// and the depth follows the smoothed loss rate:
+//
+//	< 1%  MinDepth, < 5% 1, < 15% 2, < 30% 3, < 50% 4, otherwise 5
+//
+// clamped to [MinDepth, MaxDepth].
+func (s *Sender) ReportFractionLost(fraction uint8) {
+	f := int(fraction) << 4
+	if f > s.loss {
+		// React to loss bursts faster than to recovery.
+		s.loss = (s.loss + f + 1) >> 1
+	} else {
+		s.loss += (f - s.loss) >> 2
+	}
+	var depth int
+	switch l := s.loss >> 4; {
+	case l < 3:
+		depth = 0
+	case l < 13:
+		depth = 1
+	case l < 38:
+		depth = 2
+	case l < 77:
+		depth = 3
+	case l < 128:
+		depth = 4
+	default:
+		depth = 5
+	}
+	s.depth = min(max(depth, s.minDepth), s.maxDepth)
+}
+
+// Reset drops the retained history, e.g. after an RTP discontinuity. Depth and
+// loss state are kept.
+func (s *Sender) Reset() {
+	clear(s.history[:])
+	s.nHist = 0
+}
+
+// RecoverySource says how a Receiver recommends reconstructing a lost frame.
+type RecoverySource uint8
+
+const (
+	// RecoverRED: Recovery.Payload is the frame's redundant copy; decode it
+	// as a normal Opus packet.
+	RecoverRED RecoverySource = iota + 1
+
+	// RecoverLBRR: Recovery.Payload is the packet that followed the loss;
+	// decode its in-band FEC (LBRR) data, e.g. gopus Decoder.DecodeWithFEC
+	// with fec=true.
+	RecoverLBRR
+
+	// RecoverDRED: Recovery.Payload is a later packet whose Deep REDundancy
+	// covers the frame; decode it at Recovery.DREDOffset samples before the
+	// start of that packet.
+	RecoverDRED
+
+	// RecoverPLC: nothing covers the frame; run packet loss concealment.
+	RecoverPLC
+)
+
+// Recovery is one step of a recovery plan.
+type Recovery struct {
+	SequenceNumber uint16
+	Timestamp      uint32
+	Source         RecoverySource
+
+	// Payload aliases the received packet buffer (nil for RecoverPLC).
+	Payload []byte
+
+	// DREDOffset is the distance in samples from the start of the lost frame
+	// to the start of the packet carrying Payload (RecoverDRED only).
+	DREDOffset int
+}
+
+// ReceiverConfig configures a Receiver.
+type ReceiverConfig struct {
+	// PayloadType is the RTP payload type of the primary and redundant blocks.
+	PayloadType byte
+
+	// FrameSamples is the RTP timestamp increment per Opus frame.
+	FrameSamples int
+
+	// MaxGap is the longest run of missing packets that is planned; zero
+	// selects DefaultMaxRecoveryGap.
+	MaxGap int
+
+	// HasLBRR reports whether an Opus packet carries in-band FEC, for example
+	// gopus.PacketHasLBRR. Nil disables LBRR in plans.
+	HasLBRR func(packet []byte) bool
+
+	// DREDSamples reports how many samples before its own start a packet's
+	// DRED data reaches, or 0 if it carries none. Nil disables DRED in plans.
+	DREDSamples func(packet []byte) int
+}
+
+// Receiver is a per-stream RED depacketizer that turns each packet's gap in
+// the sequence into a single recovery plan. Every lost frame appears in the
+// plan exactly once, oldest first, with the cheapest source that covers it —
+// a RED copy, then the next packet's LBRR, then its DRED, then PLC — so no
+// frame is decoded twice from overlapping redundancy. Each packet is probed
+// for LBRR and DRED at most once.
+//
+// The zero value is unusable; call Init (or NewReceiver). A Receiver is not
+// safe for concurrent use.
+type Receiver struct {
+	cfg    ReceiverConfig
+	blocks []Block
+	plan   []Recovery
+
+	started  bool
+	lastSeq  uint16
+	expected uint32 // packets expected since the last FractionLost call
+	received uint32
+}
+
+// NewReceiver returns a Receiver initialised with config.
+func NewReceiver(config ReceiverConfig) *Receiver {
+	r := new(Receiver)
+	r.Init(config)
+	return r
+}
+
+// Init (re)initialises r with config and forgets the sequence state.
+func (r *Receiver) Init(config ReceiverConfig) {
+	if config.MaxGap <= 0 {
+		config.MaxGap = DefaultMaxRecoveryGap
+	}
+	*r = Receiver{
+		cfg:    config,
+		blocks: r.blocks[:0],
+		plan:   r.plan[:0],
+	}
+}
+
+// Receive parses the RED payload of the RTP packet with sequence number seq
+// and timestamp ts. It returns the primary Opus payload and the recovery plan
+// for the packets missing between the previous packet and this one, to be
+// executed before decoding primary.
+//
+// Late, duplicate and first packets, and gaps longer than MaxGap, produce an
+// empty plan. The returned slices alias buf and the Receiver's reused buffers
+// and are valid until the next Receive call. Steady-state calls do not
+// allocate.
+func (r *Receiver) Receive(buf []byte, seq uint16, ts uint32) (primary []byte, plan []Recovery, err error) {
+	primary, r.blocks, err = ParseInto(buf, r.cfg.PayloadType, r.blocks[:0])
+	if err != nil {
+		return nil, nil, err
+	}
+	r.plan = r.plan[:0]
+
+	if !r.started {
+		r.started = true
+		r.lastSeq = seq
+		r.expected++
+		r.received++
+		return primary, r.plan, nil
+	}
+	delta := int(int16(seq - r.lastSeq))
+	if delta <= 0 {
+		r.received++ // late or duplicate: counted, not planned
+		return primary, r.plan, nil
+	}
+	r.lastSeq = seq
+	r.expected += uint32(delta)
+	r.received++
+
+	missing := delta - 1
+	if missing == 0 || missing > r.cfg.MaxGap || r.cfg.FrameSamples <= 0 {
+		return primary, r.plan, nil
+	}
+
+	dredSamples := -1 // probed lazily, at most once
+	fs := r.cfg.FrameSamples
+	for lostAgo := missing; lostAgo >= 1; lostAgo-- {
+		rec := Recovery{
+			SequenceNumber: seq - uint16(lostAgo),
+			Timestamp:      ts - uint32(lostAgo*fs),
+			Source:         RecoverPLC,
+		}
+		if b := findBlock(r.blocks, lostAgo*fs); b != nil {
+			rec.Source, rec.Payload = RecoverRED, b
+		} else if lostAgo == 1 && r.cfg.HasLBRR != nil && r.cfg.HasLBRR(primary) {
+			rec.Source, rec.Payload = RecoverLBRR, primary
+		} else if r.cfg.DREDSamples != nil {
+			if dredSamples < 0 {
+				dredSamples = r.cfg.DREDSamples(primary)
+			}
+			if lostAgo*fs <= dredSamples {
+				rec.Source, rec.Payload, rec.DREDOffset = RecoverDRED, primary, lostAgo*fs
+			}
+		}
+		r.plan = append(r.plan, rec)
+	}
+	return primary, r.plan, nil
+}
+
+// findBlock returns the payload of the block at the given timestamp offset.
+func findBlock(blocks []Block, offset int) []byte {
+	for i := range blocks {
+		if blocks[i].TimestampOffset == offset {
+			return blocks[i].Payload
+		}
+	}
+	return nil
+}
+
+// FractionLost returns the share of packets lost since the previous call in
+// the RTCP receiver report scale (lost/expected × 256, saturated to 255), and
+// starts a new measurement interval. Feed it to the peer Sender's
+// ReportFractionLost.
+func (r *Receiver) FractionLost() uint8 {
+	expected, received := r.expected, r.received
+	r.expected, r.received = 0, 0
+	if expected == 0 || received >= expected {
+		return 0
+	}
+	return uint8(min((expected-received)*256/expected, 255))
+}
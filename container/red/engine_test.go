@@ -0,0 +1,215 @@
+package red_test
+
+import (
+	"bytes"
+	"testing"
+
+	"github.com/thesyncim/gopus/container/red"
+)
+
+// engineFrame returns a distinct payload for frame i.
+func engineFrame(i int) []byte {
+	return []byte{0xfc, byte(i), byte(i >> 8), 0x5a}
+}
+
+func TestSender_RetainsCallerBuffersAndAppends(t *testing.T) {
+	const fs = 960
+	s := red.NewSender(red.SenderConfig{PayloadType: opusPT, FrameSamples: fs, MinDepth: 2, MaxDepth: 2})
+	frames := make([][]byte, 4)
+	arena := make([]byte, 0, 1024)
+	var pkts [][]byte
+	for i := range frames {
+		frames[i] = engineFrame(i)
+		start := len(arena)
+		arena, _ = s.EncodeAppend(arena, frames[i], uint32(i*fs))
+		pkts = append(pkts, arena[start:])
+	}
+	// Each packet in the shared arena parses and carries up to two earlier
+	// frames, taken from the caller's buffers.
+	for i, pkt := range pkts {
+		primary, blocks, err := red.Parse(pkt, opusPT)
+		if err != nil {
+			t.Fatalf("packet %d: %v", i, err)
+		}
+		if !bytes.Equal(primary, frames[i]) {
+			t.Fatalf("packet %d: primary %x, want %x", i, primary, frames[i])
+		}
+		if want := min(i, 2); len(blocks) != want {
+			t.Fatalf("packet %d: %d blocks, want %d", i, len(blocks), want)
+		}
+		for _, b := range blocks {
+			ago := b.TimestampOffset / fs
+			if !bytes.Equal(b.Payload, frames[i-ago]) {
+				t.Fatalf("packet %d: block at %d frames = %x, want %x", i, ago, b.Payload, frames[i-ago])
+			}
+		}
+	}
+
+	// A small dst grows like append.
+	out, _ := s.EncodeAppend([]byte{1, 2}, engineFrame(9), 4*fs)
+	if out[0] != 1 || out[1] != 2 {
+		t.Fatal("EncodeAppend clobbered the existing dst prefix")
+	}
+	if _, _, err := red.Parse(out[2:], opusPT); err != nil {
+		t.Fatalf("grown packet: %v", err)
+	}
+}
+
+func TestSender_DepthAdaptsToLoss(t *testing.T) {
+	s := red.NewSender(red.SenderConfig{PayloadType: opusPT, FrameSamples: 960, MaxDepth: red.MaxDepth})
+	if s.Depth() != 1 {
+		t.Fatalf("initial depth = %d, want 1", s.Depth())
+	}
+	for range 8 {
+		s.ReportFractionLost(0)
+	}
+	if s.Depth() != 0 {
+		t.Fatalf("depth after clean reports = %d, want 0", s.Depth())
+	}
+	// With depth 0 the packet is still a RED envelope.
+	pkt, n := s.EncodeAppend(nil, engineFrame(1), 960)
+	if n != 0 || pkt[0] != opusPT {
+		t.Fatalf("depth-0 packet = %x, want primary-only RED envelope", pkt)
+	}
+
+	s.ReportFractionLost(77) // 30% burst
+	if s.Depth() < 2 {
+		t.Fatalf("depth after a 30%% loss report = %d, want >= 2", s.Depth())
+	}
+	for range 16 {
+		s.ReportFractionLost(200)
+	}
+	if s.Depth() != red.MaxDepth {
+		t.Fatalf("depth under heavy loss = %d, want %d", s.Depth(), red.MaxDepth)
+	}
+	for range 32 {
+		s.ReportFractionLost(0)
+	}
+	if s.Depth() != 0 {
+		t.Fatalf("depth after recovery = %d, want 0", s.Depth())
+	}
+
+	fixed := red.NewSender(red.SenderConfig{PayloadType: opusPT, FrameSamples: 960, MinDepth: 2, MaxDepth: 2})
+	fixed.ReportFractionLost(255)
+	fixed.ReportFractionLost(0)
+	if fixed.Depth() != 2 {
+		t.Fatalf("fixed depth = %d, want 2", fixed.Depth())
+	}
+}
+
+func TestReceiver_PlanCoversEveryGapOnce(t *testing.T) {
+	const fs = 960
+	s := red.NewSender(red.SenderConfig{PayloadType: opusPT, FrameSamples: fs, MinDepth: 2, MaxDepth: 2})
+	var lbrrCalls, dredCalls int
+	r := red.NewReceiver(red.ReceiverConfig{
+		PayloadType:  opusPT,
+		FrameSamples: fs,
+		HasLBRR: func(p []byte) bool {
+			lbrrCalls++
+			return true
+		},
+		DREDSamples: func(p []byte) int {
+			dredCalls++
+			return 4 * fs
+		},
+	})
+
+	var pkts [][]byte
+	for i := 0; i < 12; i++ {
+		pkt, _ := s.EncodeAppend(nil, engineFrame(i), uint32(i*fs))
+		pkts = append(pkts, pkt)
+	}
+	deliver := func(i int) []red.Recovery {
+		t.Helper()
+		primary, plan, err := r.Receive(pkts[i], uint16(1000+i), uint32(i*fs))
+		if err != nil {
+			t.Fatalf("Receive(%d): %v", i, err)
+		}
+		if !bytes.Equal(primary, engineFrame(i)) {
+			t.Fatalf("Receive(%d): wrong primary", i)
+		}
+		return append([]red.Recovery(nil), plan...)
+	}
+
+	if plan := deliver(0); len(plan) != 0 {
+		t.Fatalf("first packet plan = %v", plan)
+	}
+	// Lose 1..6 (six frames): packet 7 carries RED for 5 and 6, LBRR is
+	// superseded by RED, DRED covers 3 and 4, and 1 and 2 need PLC.
+	plan := deliver(7)
+	want := []red.RecoverySource{red.RecoverPLC, red.RecoverPLC, red.RecoverDRED, red.RecoverDRED, red.RecoverRED, red.RecoverRED}
+	if len(plan) != len(want) {
+		t.Fatalf("plan has %d steps, want %d", len(plan), len(want))
+	}
+	for k, rec := range plan {
+		lost := k + 1
+		if rec.Source != want[k] {
+			t.Errorf("frame %d: source %d, want %d", lost, rec.Source, want[k])
+		}
+		if rec.SequenceNumber != uint16(1000+lost) || rec.Timestamp != uint32(lost*fs) {
+			t.Errorf("frame %d: seq %d ts %d", lost, rec.SequenceNumber, rec.Timestamp)
+		}
+		switch rec.Source {
+		case red.RecoverRED:
+			if !bytes.Equal(rec.Payload, engineFrame(lost)) {
+				t.Errorf("frame %d: RED payload %x", lost, rec.Payload)
+			}
+		case red.RecoverDRED:
+			if rec.DREDOffset != (7-lost)*fs {
+				t.Errorf("frame %d: DRED offset %d", lost, rec.DREDOffset)
+			}
+		case red.RecoverPLC:
+			if rec.Payload != nil {
+				t.Errorf("frame %d: PLC step has a payload", lost)
+			}
+		}
+	}
+	if dredCalls != 1 || lbrrCalls != 0 {
+		t.Fatalf("probes: %d DRED, %d LBRR calls; want 1, 0", dredCalls, lbrrCalls)
+	}
+
+	// Lose 8: packet 9 carries its RED copy.
+	if plan := deliver(9); len(plan) != 1 || plan[0].Source != red.RecoverRED {
+		t.Fatalf("single loss plan = %+v", plan)
+	}
+	// A late packet yields no plan.
+	if plan := deliver(8); len(plan) != 0 {
+		t.Fatalf("late packet plan = %+v", plan)
+	}
+	// Ten packets expected (1000..1009), frames 1..6 never arrived.
+	if got := r.FractionLost(); got != uint8(6*256/10) {
+		t.Fatalf("FractionLost = %d, want %d", got, 6*256/10)
+	}
+	if got := r.FractionLost(); got != 0 {
+		t.Fatalf("FractionLost after reset = %d, want 0", got)
+	}
+}
+
+func TestReceiver_LBRRForLastFrame(t *testing.T) {
+	const fs = 960
+	r := red.NewReceiver(red.ReceiverConfig{
+		PayloadType:  opusPT,
+		FrameSamples: fs,
+		HasLBRR:      func([]byte) bool { return true },
+	})
+	prim := []byte{opusPT, 0x0b, 0x01}
+	if _, _, err := r.Receive(prim, 10, 10*fs); err != nil {
+		t.Fatal(err)
+	}
+	_, plan, err := r.Receive(prim, 13, 13*fs)
+	if err != nil {
+		t.Fatal(err)
+	}
+	want := []red.RecoverySource{red.RecoverPLC, red.RecoverLBRR}
+	if len(plan) != 2 || plan[0].Source != want[0] || plan[1].Source != want[1] {
+		t.Fatalf("plan = %+v, want sources %v", plan, want)
+	}
+	if !bytes.Equal(plan[1].Payload, prim[1:]) {
+		t.Fatalf("LBRR payload = %x, want the primary", plan[1].Payload)
+	}
+
+	// Gaps beyond MaxGap are a discontinuity.
+	if _, plan, _ := r.Receive(prim, 13+red.DefaultMaxRecoveryGap+2, 0); len(plan) != 0 {
+		t.Fatalf("discontinuity plan has %d steps", len(plan))
+	}
+}
@@ -29,6 +29,13 @@
 // Build, AppendHistory and FindRecovery remain as the underlying stateless
 // primitives.
 //
+// Sender and Receiver are the per-stream engine for gateways handling many
+// streams at once. Sender keeps the caller's frame buffers instead of copying
+// them, appends packets into a shared arena and adapts its redundancy depth to
+// reported loss. Receiver turns each sequence gap into one ordered recovery
+// plan that picks a single source per lost frame (RED, then LBRR, then DRED,
+// then PLC).
+//
 // Typical send path:
 //
 //	enc := red.NewEncoder(opusPT, frameSamples, depth)
@@ -28,6 +28,13 @@ type DecoderConfig struct {
 	// MaxPacketBytes caps the maximum Opus packet size in bytes.
 	// If zero, defaultMaxPacketBytes is used.
 	MaxPacketBytes int
+	// PCMSampleRate, when non-zero and different from SampleRate, is the rate
+	// of the PCM returned to the caller (8000-192000 Hz, e.g. 44100). The codec
+	// decodes at SampleRate and a polyphase resampler converts its output as
+	// it is written to the caller's buffer, adding about 0.7 ms of latency at
+	// 48 kHz. Output buffers are then sized in PCMSampleRate samples; packet
+	// durations and DRED offsets stay in SampleRate samples.
+	PCMSampleRate int
 }
 
 // DefaultDecoderConfig returns a config with default caps for the given stream format.
@@ -76,12 +83,15 @@ type Decoder struct {
 	lastDataLen        int32  // Length of last packet data
 	mainDecodeRng      uint32 // Final range from main decode (before any redundancy processing)
 	decodeGainQ8       int    // Output gain in Q8 dB (libopus OPUS_SET_GAIN semantics)
+	deferOutputGain    bool   // DecodeAccumulate folds the output gain into its mix gain
 	ignoreExtensions   bool   // libopus OPUS_SET_IGNORE_EXTENSIONS semantics
 	complexity         int32  // libopus decoder complexity, default 0
+	skipInaudibleDTX   bool   // DecodeAccumulate skips zero-gain DTX frames
 
 	// FEC (Forward Error Correction) state
-	// Stores LBRR data from the current packet for use by the next packet's FEC decode.
-	fecData       []byte    // Stored packet data containing LBRR for FEC recovery
+	// Tracks the LBRR data of the packet passed to DecodeWithFEC while it is
+	// being decoded.
+	fecData       []byte    // First frame of that packet, aliased (not copied)
 	fecMode       Mode      // Mode of the packet containing LBRR
 	fecBandwidth  Bandwidth // Bandwidth of the packet containing LBRR
 	fecStereo     bool      // Whether the packet was stereo
@@ -100,6 +110,7 @@ type Decoder struct {
 	decoderOSCEFields
 	decoderHD96kFields
 	decoderFixedFields
+	decoderPCMResampleFields
 
 	// Decoder-side DNN readiness mirrors the validated model families retained
 	// by OPUS_SET_DNN_BLOB so optional paths can stay dormant until they are real.
@@ -116,6 +127,9 @@ func NewDecoder(cfg DecoderConfig) (*Decoder, error) {
 	if cfg.Channels < 1 || cfg.Channels > 2 {
 		return nil, ErrInvalidChannels
 	}
+	if !validPCMSampleRate(cfg.PCMSampleRate, cfg.SampleRate) {
+		return nil, ErrInvalidSampleRate
+	}
 
 	maxPacketSamples := cfg.MaxPacketSamples
 	if maxPacketSamples == 0 {
@@ -165,7 +179,6 @@ func NewDecoder(cfg DecoderConfig) (*Decoder, error) {
 		prevMode:         ModeHybrid,               // Default for PLC until first decode
 		lastPacketMode:   ModeHybrid,
 		lastBandwidth:    BandwidthFullband,
-		fecData:          make([]byte, maxPacketBytes),
 	}
 	// Back the six fixed float32 decode work buffers with one contiguous arena.
 	pcmLen := maxPacketSamples * cfg.Channels
@@ -180,5 +193,11 @@ func NewDecoder(cfg DecoderConfig) (*Decoder, error) {
 	if cfg.SampleRate == 96000 {
 		init96kDecoder(d)
 	}
+	r, err := newPCMResampler(cfg.SampleRate, cfg.PCMSampleRate, cfg.Channels, maxPacketSamples)
+	if err != nil {
+		return nil, err
+	}
+	d.pcmResampler = r
+	d.pcmSampleRate = int32(cfg.PCMSampleRate)
 	return d, nil
 }
@@ -26,8 +26,8 @@ func (d *Decoder) decode96kFloat32(data []byte, pcm []float32) (int, error) {
 // decodeInt1696k decodes at 96 kHz into int16, routing through decode96kFloat32.
 func (d *Decoder) decodeInt1696k(data []byte, pcm []int16) (int, error) {
 	channels := int(d.channels)
-	needed := len(pcm)
-	scratch := make([]float32, needed)
+	d.ensureScratchPCM(len(pcm))
+	scratch := d.scratchPCM
 	n, err := d.decode96kFloat32(data, scratch)
 	if err != nil {
 		return 0, err
@@ -39,8 +39,8 @@ func (d *Decoder) decodeInt1696k(data []byte, pcm []int16) (int, error) {
 // decodeInt2496k decodes at 96 kHz into int32 (24-bit), routing through decode96kFloat32.
 func (d *Decoder) decodeInt2496k(data []byte, pcm []int32) (int, error) {
 	channels := int(d.channels)
-	needed := len(pcm)
-	scratch := make([]float32, needed)
+	d.ensureScratchPCM(len(pcm))
+	scratch := d.scratchPCM
 	n, err := d.decode96kFloat32(data, scratch)
 	if err != nil {
 		return 0, err
@@ -0,0 +1,125 @@
+package gopus
+
+// DecodeAccumulate decodes an Opus packet and mixes the result into bus:
+// bus[i] += gain * pcm[i] for every decoded sample, where pcm is what Decode
+// would have written. It is the per-stream step of a conference or game mixer,
+// and saves the intermediate per-stream buffer and the separate mix pass.
+//
+// data: Opus packet data, or nil for Packet Loss Concealment (PLC), as for
+// Decode; a concealed frame is mixed like a decoded one.
+// bus: interleaved mix buffer with the same layout and sizing rules as the
+// pcm argument of Decode. Only the first n*Channels() samples are touched.
+// gain: linear mix gain for this stream.
+//
+// The decoder's own output gain (SetGain) is folded into the mix gain, so the
+// decoded audio is scaled and accumulated in one vectorized pass over a
+// decoder-owned scratch buffer that stays cache-resident from one call to the
+// next. The result matches Decode followed by the same mix within float
+// rounding. SetSkipInaudibleDTX trades that match for not synthesizing DTX
+// comfort noise that would be mixed at zero gain.
+//
+// Returns the number of samples per channel mixed into bus, or an error; on
+// error bus is unchanged.
+func (d *Decoder) DecodeAccumulate(data []byte, bus []float32, gain float32) (int, error) {
+	channels := int(d.channels)
+	g := gain
+	if d.decodeGainQ8 != 0 {
+		g *= decodeGainLinear(d.decodeGainQ8)
+	}
+	d.deferOutputGain = true
+	defer func() { d.deferOutputGain = false }()
+
+	if d.pcmResampler != nil {
+		if err := d.decodeResampledScratch(data, len(bus), true, false); err != nil {
+			return 0, err
+		}
+		return d.emitResampledAccumulate(bus, g), nil
+	}
+
+	needed, err := d.accumulateScratchLen(data, len(bus))
+	if err != nil {
+		return 0, err
+	}
+	if g == 0 && d.skipInaudibleDTX && len(data) > 0 && len(data) <= 2 {
+		return d.skipDTXFrame(data, needed/channels), nil
+	}
+	d.ensureScratchPCM(needed)
+	n, err := d.decodeFloat32(data, d.scratchPCM, true)
+	if err != nil {
+		return 0, err
+	}
+	if g != 0 {
+		mixAccumulate(bus[:n*channels], d.scratchPCM[:n*channels], g)
+	}
+	return n, nil
+}
+
+// skipDTXFrame stands in for decoding the n-sample DTX packet data when its
+// output would be mixed at zero gain. The first skip after a decode resets
+// the decoder, so a later packet never resumes from concealment state that
+// skipped frames left stale.
+func (d *Decoder) skipDTXFrame(data []byte, n int) int {
+	if d.haveDecoded {
+		d.Reset()
+	}
+	d.lastDataLen = int32(len(data))
+	d.lastPacketDuration = int32(n)
+	return n
+}
+
+// accumulateScratchLen returns the scratch length DecodeAccumulate decodes
+// into for a bus of busLen samples. Concealment keeps the bus length, which
+// decodeFloat32 interprets exactly as Decode does; a packet is checked against
+// the bus up front so an undersized bus fails before any state changes.
+func (d *Decoder) accumulateScratchLen(data []byte, busLen int) (int, error) {
+	if len(data) == 0 {
+		return busLen, nil
+	}
+	if len(data) > d.maxPacketBytes {
+		return 0, ErrPacketTooLarge
+	}
+	toc, frameCount, err := packetFrameCount(data)
+	if err != nil {
+		return 0, err
+	}
+	frameSize := toc.FrameSize
+	if toc.Mode == ModeSILK || toc.Mode == ModeCELT || toc.Mode == ModeHybrid {
+		frameSize = packetTOCSamplesPerFrameAtRate(data[0], int(d.sampleRate))
+	}
+	totalSamples := frameSize * frameCount
+	if totalSamples > d.maxPacketSamples {
+		return 0, ErrPacketTooLarge
+	}
+	needed := totalSamples * int(d.channels)
+	if busLen < needed {
+		return 0, ErrBufferTooSmall
+	}
+	return needed, nil
+}
+
+// emitResampledAccumulate drains the PCM resampler into bus with gain g and
+// returns the samples per channel mixed.
+func (d *Decoder) emitResampledAccumulate(bus []float32, g float32) int {
+	var block [pcmResampleBlock]float32
+	channels := int(d.channels)
+	span := block[:len(block)/channels*channels]
+	out := 0
+	for {
+		k := d.pcmResampler.Emit(span[:min(len(span), len(bus)-out*channels)])
+		if k == 0 {
+			return out
+		}
+		if g != 0 {
+			mixAccumulate(bus[out*channels:(out+k)*channels], span[:k*channels], g)
+		}
+		out += k
+	}
+}
+
+// mixAccumulateGo is the portable mixAccumulate.
+func mixAccumulateGo(bus, src []float32, gain float32) {
+	bus = bus[:len(src)]
+	for i, v := range src {
+		bus[i] += gain * v
+	}
+}
@@ -0,0 +1,346 @@
+package gopus
+
+import (
+	"errors"
+	"math"
+	"testing"
+)
+
+// encodeAccumulateStream encodes frames 20 ms stereo packets of a tone pair
+// around freq, alternating encoder modes so SILK, Hybrid and CELT output
+// stages all feed the bus.
+func encodeAccumulateStream(tb testing.TB, freq float64, frames int) [][]byte {
+	tb.Helper()
+	enc, err := NewEncoder(EncoderConfig{SampleRate: 48000, Channels: 2, Application: ApplicationAudio})
+	if err != nil {
+		tb.Fatalf("NewEncoder: %v", err)
+	}
+	pcm := make([]float32, 960*2)
+	packets := make([][]byte, 0, frames)
+	modes := []EncoderMode{EncoderModeCELT, EncoderModeHybrid, EncoderModeSILK}
+	for f := 0; f < frames; f++ {
+		if f%8 == 0 {
+			if err := enc.SetMode(modes[(f/8)%len(modes)]); err != nil {
+				tb.Fatalf("SetMode: %v", err)
+			}
+		}
+		for i := 0; i < 960; i++ {
+			tm := float64(f*960+i) / 48000
+			pcm[2*i] = float32(0.25 * math.Sin(2*math.Pi*freq*tm))
+			pcm[2*i+1] = float32(0.2 * math.Sin(2*math.Pi*1.5*freq*tm+0.4))
+		}
+		pkt, err := enc.EncodeFloat32(pcm)
+		if err != nil {
+			tb.Fatalf("frame %d Encode: %v", f, err)
+		}
+		packets = append(packets, append([]byte(nil), pkt...))
+	}
+	return packets
+}
+
+// TestDecodeAccumulateMatchesDecodeThenMix checks DecodeAccumulate against
+// Decode followed by a scalar mix into a non-empty bus, across modes, losses,
+// a decoder output gain and the PCMSampleRate resampled path.
+func TestDecodeAccumulateMatchesDecodeThenMix(t *testing.T) {
+	packets := encodeAccumulateStream(t, 330, 24)
+	packets[5], packets[13], packets[14] = nil, nil, nil
+
+	for _, pcmRate := range []int{0, 44100} {
+		cfg := DefaultDecoderConfig(48000, 2)
+		cfg.PCMSampleRate = pcmRate
+		ref, err := NewDecoder(cfg)
+		if err != nil {
+			t.Fatalf("NewDecoder: %v", err)
+		}
+		dec, err := NewDecoder(cfg)
+		if err != nil {
+			t.Fatalf("NewDecoder: %v", err)
+		}
+		for _, d := range []*Decoder{ref, dec} {
+			if err := d.SetGain(-384); err != nil {
+				t.Fatalf("SetGain: %v", err)
+			}
+		}
+
+		frame := 960
+		if pcmRate != 0 {
+			frame = 882
+		}
+		pcm := make([]float32, frame*2)
+		want := make([]float32, frame*2)
+		got := make([]float32, frame*2)
+		const gain = 0.7
+		for p, pkt := range packets {
+			for i := range want {
+				want[i] = float32(math.Sin(float64(i+p) * 0.01))
+				got[i] = want[i]
+			}
+			n, err := ref.Decode(pkt, pcm)
+			if err != nil {
+				t.Fatalf("rate %d packet %d Decode: %v", pcmRate, p, err)
+			}
+			for i := 0; i < n*2; i++ {
+				want[i] += gain * pcm[i]
+			}
+			m, err := dec.DecodeAccumulate(pkt, got, gain)
+			if err != nil {
+				t.Fatalf("rate %d packet %d DecodeAccumulate: %v", pcmRate, p, err)
+			}
+			if m != n {
+				t.Fatalf("rate %d packet %d: mixed %d samples, Decode returned %d", pcmRate, p, m, n)
+			}
+			for i := range want {
+				if d := math.Abs(float64(got[i] - want[i])); d > 1e-5 {
+					t.Fatalf("rate %d packet %d sample %d: %v want %v", pcmRate, p, i, got[i], want[i])
+				}
+			}
+		}
+	}
+}
+
+func TestDecodeAccumulateBufferTooSmall(t *testing.T) {
+	packets := encodeAccumulateStream(t, 440, 1)
+	dec := mustNewTestDecoder(t, 48000, 2)
+	bus := make([]float32, 959*2)
+	for i := range bus {
+		bus[i] = 0.5
+	}
+	if _, err := dec.DecodeAccumulate(packets[0], bus, 1); !errors.Is(err, ErrBufferTooSmall) {
+		t.Fatalf("DecodeAccumulate into 959 samples err=%v, want ErrBufferTooSmall", err)
+	}
+	for i, v := range bus {
+		if v != 0.5 {
+			t.Fatalf("bus[%d]=%v changed on error", i, v)
+		}
+	}
+}
+
+func TestMixAccumulateMatchesGo(t *testing.T) {
+	for _, n := range []int{1, 15, 16, 17, 960, 1923} {
+		src := make([]float32, n)
+		got := make([]float32, n)
+		want := make([]float32, n)
+		for i := range src {
+			src[i] = float32(math.Sin(float64(i) * 0.37))
+			got[i] = float32(math.Cos(float64(i) * 1.13))
+			want[i] = got[i]
+		}
+		mixAccumulate(got, src, 0.3)
+		mixAccumulateGo(want, src, 0.3)
+		for i := range got {
+			if d := math.Abs(float64(got[i] - want[i])); d > 1e-6 {
+				t.Fatalf("n=%d sample %d: %v want %v", n, i, got[i], want[i])
+			}
+		}
+	}
+}
+
+// encodeDTXStream encodes frames 20 ms mono SILK wideband packets with DTX on:
+// a voiced tone for the first talk frames, digital silence afterwards, so the
+// tail is DTX packets with the encoder's periodic refresh frames.
+func encodeDTXStream(tb testing.TB, talk, frames int) [][]byte {
+	tb.Helper()
+	enc, err := NewEncoder(EncoderConfig{SampleRate: 48000, Channels: 1, Application: ApplicationVoIP})
+	if err != nil {
+		tb.Fatalf("NewEncoder: %v", err)
+	}
+	if err := enc.SetMode(EncoderModeSILK); err != nil {
+		tb.Fatalf("SetMode: %v", err)
+	}
+	if err := enc.SetBandwidth(BandwidthWideband); err != nil {
+		tb.Fatalf("SetBandwidth: %v", err)
+	}
+	if err := enc.SetBitrate(16000); err != nil {
+		tb.Fatalf("SetBitrate: %v", err)
+	}
+	enc.SetDTX(true)
+	pcm := make([]float32, 960)
+	packets := make([][]byte, 0, frames)
+	for f := 0; f < frames; f++ {
+		for i := range pcm {
+			pcm[i] = 0
+			if f < talk {
+				tm := float64(f*960+i) / 48000
+				pcm[i] = float32(0.25*math.Sin(2*math.Pi*180*tm) + 0.08*math.Sin(2*math.Pi*900*tm))
+			}
+		}
+		pkt, err := enc.EncodeFloat32(pcm)
+		if err != nil {
+			tb.Fatalf("frame %d Encode: %v", f, err)
+		}
+		packets = append(packets, append([]byte(nil), pkt...))
+	}
+	return packets
+}
+
+// TestDecodeAccumulateSkipInaudibleDTX checks that zero-gain DTX frames are
+// skipped without touching the bus while reporting the same duration and DTX
+// status as a decode, and that the stream then restarts exactly like a fresh
+// decoder.
+func TestDecodeAccumulateSkipInaudibleDTX(t *testing.T) {
+	packets := encodeDTXStream(t, 10, 40)
+	// Resume right after a DTX packet, which left the decoder reset.
+	resume := len(packets)
+	for len(packets[resume-1]) > 2 {
+		resume--
+	}
+	packets = append(packets[:resume], encodeAccumulateStream(t, 250, 6)...)
+
+	ref := mustNewTestDecoder(t, 48000, 1)
+	dec := mustNewTestDecoder(t, 48000, 1)
+	dec.SetSkipInaudibleDTX(true)
+	if !dec.SkipInaudibleDTX() || ref.SkipInaudibleDTX() {
+		t.Fatal("SkipInaudibleDTX does not reflect SetSkipInaudibleDTX")
+	}
+	var fresh *Decoder
+	pcm := make([]float32, 960)
+	bus := make([]float32, 960)
+	want := make([]float32, 960)
+	skipped := 0
+	for p, pkt := range packets {
+		gain := float32(1)
+		if p >= 10 && p < resume {
+			gain = 0
+		}
+		n, err := ref.Decode(pkt, pcm)
+		if err != nil {
+			t.Fatalf("packet %d Decode: %v", p, err)
+		}
+		if p == resume {
+			fresh = mustNewTestDecoder(t, 48000, 1)
+		}
+		if fresh != nil {
+			if n, err = fresh.Decode(pkt, want); err != nil {
+				t.Fatalf("packet %d fresh Decode: %v", p, err)
+			}
+		}
+		clear(bus)
+		m, err := dec.DecodeAccumulate(pkt, bus, gain)
+		if err != nil {
+			t.Fatalf("packet %d DecodeAccumulate: %v", p, err)
+		}
+		if m != n || dec.LastPacketDuration() != ref.LastPacketDuration() || dec.InDTX() != ref.InDTX() {
+			t.Fatalf("packet %d: mixed %d samples dtx=%v, Decode returned %d dtx=%v", p, m, dec.InDTX(), n, ref.InDTX())
+		}
+		if gain == 0 && dec.InDTX() {
+			skipped++
+		}
+		for i, v := range bus {
+			w := float32(0)
+			switch {
+			case fresh != nil:
+				w = want[i]
+			case gain != 0 && p < 10:
+				w = pcm[i]
+			}
+			if d := math.Abs(float64(v - w)); d > 1e-5 {
+				t.Fatalf("packet %d sample %d: %v want %v", p, i, v, w)
+			}
+		}
+	}
+	if skipped == 0 {
+		t.Fatal("no DTX frame was skipped")
+	}
+}
+
+// BenchmarkDecodeMix200MostlySilentStreams mixes 200 mono SILK streams into
+// one 20 ms bus per iteration, 8 of them talking and the rest in DTX. The
+// mixer mutes the silent streams; "decode" still synthesizes their comfort
+// noise, "skip_inaudible" enables SetSkipInaudibleDTX.
+func BenchmarkDecodeMix200MostlySilentStreams(b *testing.B) {
+	const (
+		streams = 200
+		talkers = 8
+		frames  = 60
+	)
+	talking := encodeDTXStream(b, frames, frames)
+	silent := encodeDTXStream(b, 10, frames+10)[10:]
+	bus := make([]float32, 960)
+	for _, skip := range []bool{false, true} {
+		name := "decode"
+		if skip {
+			name = "skip_inaudible"
+		}
+		b.Run(name, func(b *testing.B) {
+			decs := make([]*Decoder, streams)
+			for s := range decs {
+				d, err := NewDecoder(DefaultDecoderConfig(48000, 1))
+				if err != nil {
+					b.Fatalf("NewDecoder: %v", err)
+				}
+				d.SetSkipInaudibleDTX(skip)
+				decs[s] = d
+			}
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				clear(bus)
+				for s, d := range decs {
+					pkt, gain := silent[(i+s)%frames], float32(0)
+					if s < talkers {
+						pkt, gain = talking[(i+s)%frames], 0.125
+					}
+					if _, err := d.DecodeAccumulate(pkt, bus, gain); err != nil {
+						b.Fatal(err)
+					}
+				}
+			}
+		})
+	}
+}
+
+// BenchmarkDecodeMix32Streams mixes 32 independent stereo streams into one
+// 20 ms bus per iteration, either through Decode into a per-stream buffer and
+// a separate mix pass, or through DecodeAccumulate.
+func BenchmarkDecodeMix32Streams(b *testing.B) {
+	const streams = 32
+	packets := make([][][]byte, streams)
+	for s := range packets {
+		packets[s] = encodeAccumulateStream(b, 200+37*float64(s), 24)
+	}
+	newDecoders := func() []*Decoder {
+		decs := make([]*Decoder, streams)
+		for s := range decs {
+			d, err := NewDecoder(DefaultDecoderConfig(48000, 2))
+			if err != nil {
+				b.Fatalf("NewDecoder: %v", err)
+			}
+			decs[s] = d
+		}
+		return decs
+	}
+	bus := make([]float32, 960*2)
+
+	b.Run("decode_then_mix", func(b *testing.B) {
+		decs := newDecoders()
+		pcm := make([][]float32, streams)
+		for s := range pcm {
+			pcm[s] = make([]float32, 960*2)
+		}
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			clear(bus)
+			for s, d := range decs {
+				n, err := d.Decode(packets[s][i%24], pcm[s])
+				if err != nil {
+					b.Fatal(err)
+				}
+				for j, v := range pcm[s][:n*2] {
+					bus[j] += 0.125 * v
+				}
+			}
+		}
+	})
+	b.Run("accumulate", func(b *testing.B) {
+		decs := newDecoders()
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			clear(bus)
+			for s, d := range decs {
+				if _, err := d.DecodeAccumulate(packets[s][i%24], bus, 0.125); err != nil {
+					b.Fatal(err)
+				}
+			}
+		}
+	})
+}
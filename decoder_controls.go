@@ -25,6 +25,9 @@ func (d *Decoder) Reset() {
 	d.prevPacketStereo = false
 	d.haveDecoded = false
 	d.clearSoftClipMem()
+	if d.pcmResampler != nil {
+		d.pcmResampler.Reset()
+	}
 	d.clearDREDPayloadState()
 	d.resetDREDRuntimeState()
 	d.resetDRED48kNeuralBridge()
@@ -111,6 +114,27 @@ func (d *Decoder) IgnoreExtensions() bool {
 	return d.ignoreExtensions
 }
 
+// SetSkipInaudibleDTX lets DecodeAccumulate skip comfort-noise synthesis for
+// a DTX packet mixed at zero gain (after SetGain is folded in), so a mixer
+// pays almost nothing for silent participants it has muted or ducked to
+// silence. This is a gopus extension with no libopus counterpart; it is off
+// by default.
+//
+// A skipped frame still counts toward LastPacketDuration and InDTX, but the
+// concealment state is not advanced: the first skip of a gap resets the
+// decoder as Reset does, and the stream restarts from that fresh state on its
+// next decoded packet. Decode and the resampled (PCMSampleRate) path never
+// skip.
+func (d *Decoder) SetSkipInaudibleDTX(enabled bool) {
+	d.skipInaudibleDTX = enabled
+}
+
+// SkipInaudibleDTX reports whether DecodeAccumulate skips zero-gain DTX
+// frames.
+func (d *Decoder) SkipInaudibleDTX() bool {
+	return d.skipInaudibleDTX
+}
+
 // Pitch returns the most recent decoded pitch period.
 func (d *Decoder) Pitch() int {
 	if d.lastPacketMode == ModeCELT {
@@ -28,6 +28,9 @@ import (
 //   - Code 2: 2 different-sized frames
 //   - Code 3: Arbitrary number of frames (1-48)
 func (d *Decoder) Decode(data []byte, pcm []float32) (int, error) {
+	if d.pcmResampler != nil {
+		return d.decodeResampledFloat32(data, pcm)
+	}
 	if d.is96kHz() {
 		return d.decode96kFloat32(data, pcm)
 	}
@@ -162,12 +165,10 @@ func (d *Decoder) decodeFloat32(data []byte, pcm []float32, clearSoftClipOnPacke
 		return 0, ErrPacketTooLarge
 	}
 
-	tocValue, frameCount, err := packetFrameCount(data)
+	toc, frameCount, err := packetFrameCount(data)
 	if err != nil {
 		return 0, err
 	}
-	toc := &tocValue
-	frameCode := data[0] & 0x03
 	frameSize := toc.FrameSize
 	if toc.Mode == ModeSILK || toc.Mode == ModeCELT || toc.Mode == ModeHybrid {
 		frameSize = packetTOCSamplesPerFrameAtRate(data[0], sampleRate)
@@ -188,32 +189,15 @@ func (d *Decoder) decodeFloat32(data []byte, pcm []float32, clearSoftClipOnPacke
 		}
 	}
 
-	if frameCode == 0 {
-		// libopus opus_packet_parse_impl (src/opus.c): non-self-delimited last
-		// frame must not exceed 1275 bytes ("last_size > 1275 → OPUS_INVALID_PACKET").
-		// For code-0 the only frame fills all of data[1:].
-		if len(data)-1 > maxOpusFrameBytes {
-			return 0, ErrInvalidPacket
-		}
-		_, err := d.decodeOpusFrameIntoWithQEXT(
-			pcm,
-			data[1:],
-			frameSize,
-			frameSize,
-			toc.Mode,
-			toc.Bandwidth,
-			toc.Stereo,
-			nil,
-		)
-		if err != nil {
-			return 0, err
-		}
-		d.prevPacketStereo = toc.Stereo
-	} else {
-		_, err := d.decodeMultiFrameFloat32(pcm, data, toc, frameCode, frameSize)
-		if err != nil {
-			return 0, err
-		}
+	// libopus opus_packet_parse_impl (src/opus.c) frames the whole packet
+	// before any frame is decoded. The view is then shared with QEXT and DRED
+	// extension lookup so nothing re-walks the framing.
+	var view PacketView
+	if err := view.Parse(data); err != nil {
+		return 0, err
+	}
+	if _, err := d.decodePacketFramesFloat32(pcm, &view, frameSize); err != nil {
+		return 0, err
 	}
 
 	// OSCE BWE transition bookkeeping: when the current packet does not
@@ -246,7 +230,7 @@ func (d *Decoder) decodeFloat32(data []byte, pcm []float32, clearSoftClipOnPacke
 
 	if dredPossible {
 		if d.dredPayloadScannerActive() {
-			d.maybeCacheDREDPayload(data)
+			d.maybeCacheDREDPayload(&view)
 		}
 		if d.dredGoodPacketMarkerActive() {
 			if r := d.dredRecoveryState(); r != nil && d.dredNeuralModelsLoaded() {
@@ -262,18 +246,27 @@ func (d *Decoder) decodeFloat32(data []byte, pcm []float32, clearSoftClipOnPacke
 	return totalSamples, nil
 }
 
-func (d *Decoder) decodeMultiFrameFloat32(pcm []float32, data []byte, toc *TOC, frameCode byte, frameSize int) (int, error) {
+// decodePacketFramesFloat32 decodes every frame of a parsed packet into pcm
+// and returns the number of samples per channel written.
+func (d *Decoder) decodePacketFramesFloat32(pcm []float32, view *PacketView, frameSize int) (int, error) {
 	channels := int(d.channels)
-	offsetSamples := 0
+	toc := view.TOC()
 	var qextPayloads decoderQEXTPayloads
-	decodeFrame := func(frameIndex int, frameData []byte) error {
+	if extsupport.QEXT && !d.ignoreExtensions && toc.Mode != ModeSILK {
+		if padding := view.Padding(); len(padding) > 0 {
+			qextPayloads.collect(padding, view.FrameCount(), qextPacketExtensionID)
+		}
+	}
+
+	offsetSamples := 0
+	for i := range view.FrameCount() {
 		var qextPayload []byte
 		if extsupport.QEXT && !d.ignoreExtensions {
-			qextPayload = qextPayloads.frame(frameIndex)
+			qextPayload = qextPayloads.frame(i)
 		}
 		n, err := d.decodeOpusFrameIntoWithQEXT(
 			pcm[offsetSamples*channels:],
-			frameData,
+			view.Frame(i),
 			frameSize,
 			frameSize,
 			toc.Mode,
@@ -282,171 +275,11 @@ func (d *Decoder) decodeMultiFrameFloat32(pcm []float32, data []byte, toc *TOC,
 			qextPayload,
 		)
 		if err != nil {
-			return err
+			return 0, err
 		}
 		offsetSamples += n
 		d.prevPacketStereo = toc.Stereo
-		return nil
-	}
-
-	switch frameCode {
-	case 1:
-		frameDataLen := len(data) - 1
-		if frameDataLen%2 != 0 {
-			return 0, ErrInvalidPacket
-		}
-		frameLen := frameDataLen / 2
-		// libopus opus_packet_parse_impl (src/opus.c): the implicit (CBR) per-frame
-		// size is not coded, so it can exceed 1275; reject when last_size = len/2
-		// > 1275 ("last_size > 1275 → OPUS_INVALID_PACKET").
-		if frameLen > maxOpusFrameBytes {
-			return 0, ErrInvalidPacket
-		}
-		offset := 1
-		for i := range 2 {
-			if offset+frameLen > len(data) {
-				return 0, ErrInvalidPacket
-			}
-			if err := decodeFrame(i, data[offset:offset+frameLen]); err != nil {
-				return 0, err
-			}
-			offset += frameLen
-		}
-	case 2:
-		if len(data) < 2 {
-			return 0, ErrPacketTooShort
-		}
-		frame1Len, bytesRead, err := parseFrameLength(data, 1)
-		if err != nil {
-			return 0, err
-		}
-		headerLen := 1 + bytesRead
-		frame2Len := len(data) - headerLen - frame1Len
-		if frame2Len < 0 {
-			return 0, ErrInvalidPacket
-		}
-		if headerLen+frame1Len > len(data) {
-			return 0, ErrInvalidPacket
-		}
-		// libopus opus_packet_parse_impl (src/opus.c): non-self-delimited last
-		// frame must not exceed 1275 bytes ("last_size > 1275 → OPUS_INVALID_PACKET").
-		// For code-2 the last (second) frame is frame2Len.
-		if frame2Len > maxOpusFrameBytes {
-			return 0, ErrInvalidPacket
-		}
-		if err := decodeFrame(0, data[headerLen:headerLen+frame1Len]); err != nil {
-			return 0, err
-		}
-		offset := headerLen + frame1Len
-		if offset+frame2Len > len(data) {
-			return 0, ErrInvalidPacket
-		}
-		if err := decodeFrame(1, data[offset:offset+frame2Len]); err != nil {
-			return 0, err
-		}
-	case 3:
-		if len(data) < 2 {
-			return 0, ErrPacketTooShort
-		}
-		frameCountByte := data[1]
-		vbr := (frameCountByte & 0x80) != 0
-		hasPadding := (frameCountByte & 0x40) != 0
-		m := int(frameCountByte & 0x3F)
-		if m == 0 || m > 48 {
-			return 0, ErrInvalidFrameCount
-		}
-
-		offset := 2
-		padding := 0
-
-		if hasPadding {
-			for {
-				if offset >= len(data) {
-					return 0, ErrPacketTooShort
-				}
-				padByte := int(data[offset])
-				offset++
-				if padByte == 255 {
-					padding += 254
-				} else {
-					padding += padByte
-				}
-				if padByte < 255 {
-					break
-				}
-			}
-			if extsupport.QEXT && !d.ignoreExtensions && toc.Mode != ModeSILK {
-				if padding > len(data) {
-					return 0, ErrInvalidPacket
-				}
-				qextPayloads.collect(data[len(data)-padding:], m, qextPacketExtensionID)
-			}
-		}
-
-		if vbr {
-			var frameLens [48]int
-			for i := 0; i < m-1; i++ {
-				frameLen, bytesRead, err := parseFrameLength(data, offset)
-				if err != nil {
-					return 0, err
-				}
-				offset += bytesRead
-				frameLens[i] = frameLen
-			}
-			frameDataOffset := offset
-			for i := 0; i < m-1; i++ {
-				frameLen := frameLens[i]
-				if frameDataOffset+frameLen > len(data)-padding {
-					return 0, ErrInvalidPacket
-				}
-				if err := decodeFrame(i, data[frameDataOffset:frameDataOffset+frameLen]); err != nil {
-					return 0, err
-				}
-				frameDataOffset += frameLen
-			}
-			lastFrameLen := len(data) - frameDataOffset - padding
-			if lastFrameLen < 0 {
-				return 0, ErrInvalidPacket
-			}
-			if frameDataOffset+lastFrameLen > len(data)-padding {
-				return 0, ErrInvalidPacket
-			}
-			// libopus opus_packet_parse_impl (src/opus.c): the VBR last frame size
-			// is implicit (last_size), so it can exceed 1275; reject when
-			// last_size > 1275 ("last_size > 1275 → OPUS_INVALID_PACKET").
-			if lastFrameLen > maxOpusFrameBytes {
-				return 0, ErrInvalidPacket
-			}
-			if err := decodeFrame(m-1, data[frameDataOffset:frameDataOffset+lastFrameLen]); err != nil {
-				return 0, err
-			}
-		} else {
-			frameDataLen := len(data) - offset - padding
-			if frameDataLen < 0 {
-				return 0, ErrInvalidPacket
-			}
-			if frameDataLen%m != 0 {
-				return 0, ErrInvalidPacket
-			}
-			frameLen := frameDataLen / m
-			// libopus opus_packet_parse_impl (src/opus.c): for the implicit CBR
-			// framing the per-frame size (applied to all frames) is not coded, so
-			// it can exceed 1275; reject when last_size = len/count > 1275.
-			if frameLen > maxOpusFrameBytes {
-				return 0, ErrInvalidPacket
-			}
-			for i := range m {
-				if offset+frameLen > len(data)-padding {
-					return 0, ErrInvalidPacket
-				}
-				if err := decodeFrame(i, data[offset:offset+frameLen]); err != nil {
-					return 0, err
-				}
-				offset += frameLen
-			}
-		}
 	}
-
 	return offsetSamples, nil
 }
 
@@ -459,6 +292,13 @@ func (d *Decoder) DecodeWithFEC(data []byte, pcm []float32, fec bool) (int, erro
 	if !fec {
 		return d.Decode(data, pcm)
 	}
+	if d.pcmResampler != nil {
+		return d.decodeResampledFEC(data, pcm)
+	}
+	return d.decodeWithFEC(data, pcm)
+}
+
+func (d *Decoder) decodeWithFEC(data []byte, pcm []float32) (int, error) {
 	// At 96 kHz, FEC uses the same routing as regular decode (PLC path).
 	// SILK/Hybrid FEC is not supported at 96 kHz (no SILK resampler path).
 	if d.is96kHz() {
@@ -473,13 +313,11 @@ func (d *Decoder) DecodeWithFEC(data []byte, pcm []float32, fec bool) (int, erro
 		// full frame structure here so DecodeWithFEC rejects the same packets as
 		// Decode (e.g. an odd-length code-1 packet) rather than running FEC/PLC on
 		// a structurally invalid bitstream.
-		if _, err := ParsePacket(data); err != nil {
-			return 0, err
-		}
-		toc, frameCount, err := packetFrameCount(data)
-		if err != nil {
+		var view PacketView
+		if err := view.Parse(data); err != nil {
 			return 0, err
 		}
+		toc, frameCount := view.TOC(), view.FrameCount()
 		requestedFrameSize, err := d.requestedOutputFrameSize(len(pcm))
 		if err != nil {
 			return 0, err
@@ -507,11 +345,16 @@ func (d *Decoder) DecodeWithFEC(data []byte, pcm []float32, fec bool) (int, erro
 		d.lastPacketMode = toc.Mode
 
 		if toc.Mode == ModeSILK || toc.Mode == ModeHybrid {
-			firstFrameData, err := extractFirstFramePayload(data, toc)
-			if err != nil {
-				return 0, err
+			firstFrameData := view.Frame(0)
+			if len(firstFrameData) == 0 && toc.FrameCode != 0 {
+				// Only a code-0 (DTX) packet may carry an empty first frame;
+				// see extractFirstFramePayload.
+				if len(data) == 1 {
+					return 0, ErrPacketTooShort
+				}
+				return 0, ErrInvalidPacket
 			}
-			if !packetHasLBRR(firstFrameData, toc) {
+			if !view.HasLBRR() {
 				d.clearFECState()
 				if extsupport.DREDRuntime && d.dredCachedPayloadActive() {
 					return d.decodePLCForFECWithState(pcm, requestedFrameSize, frameSize, toc.Mode, toc.Bandwidth, toc.Stereo)
@@ -537,6 +380,9 @@ func (d *Decoder) DecodeWithFEC(data []byte, pcm []float32, fec bool) (int, erro
 
 // DecodeInt16 decodes an Opus packet into int16 PCM samples.
 func (d *Decoder) DecodeInt16(data []byte, pcm []int16) (int, error) {
+	if d.pcmResampler != nil {
+		return d.decodeResampledInt16(data, pcm)
+	}
 	if d.is96kHz() {
 		return d.decodeInt1696k(data, pcm)
 	}
@@ -618,6 +464,9 @@ func (d *Decoder) DecodeInt16(data []byte, pcm []int16) (int, error) {
 //
 // Returns the number of samples per channel decoded, or an error.
 func (d *Decoder) DecodeInt24(data []byte, pcm []int32) (int, error) {
+	if d.pcmResampler != nil {
+		return d.decodeResampledInt24(data, pcm)
+	}
 	if d.is96kHz() {
 		return d.decodeInt2496k(data, pcm)
 	}
@@ -711,6 +560,9 @@ func (d *Decoder) DecodeInt24Slice(data []byte) ([]int32, error) {
 		}
 		frameSize = fs * frameCount
 	}
+	if d.pcmResampler != nil {
+		frameSize = d.pcmResampler.OutputLen(frameSize)
+	}
 	pcm := make([]int32, frameSize*channels)
 	n, err := d.DecodeInt24(data, pcm)
 	if err != nil {
@@ -729,9 +581,7 @@ func float32ToInt24Slice(dst []int32, src []float32, n, channels int) {
 	if total <= 0 {
 		return
 	}
-	for i := 0; i < total; i++ {
-		dst[i] = float32ToInt24(src[i])
-	}
+	convertFloat32ToInt24(dst, src, total)
 }
 
 func (d *Decoder) ensureScratchPCM(needed int) {
@@ -399,6 +399,8 @@ func (d *Decoder) setDREDDecoderBlob(blob *dnnblob.Blob) {
 			p.dredModelLoaded = true
 		}
 	}
+	// Never extend a lazily decoded prefix with a different model.
+	p.dredProcess.Restart()
 	if !p.dredModelLoaded {
 		d.clearDREDPayloadState()
 		p.dredData = nil
@@ -510,12 +512,12 @@ func (d *Decoder) ensureDREDNeuralConcealmentRuntime() bool {
 	return true
 }
 
-func (d *Decoder) maybeCacheDREDPayload(packet []byte) {
+func (d *Decoder) maybeCacheDREDPayload(view *PacketView) {
 	p := d.dredPayloadState()
-	if p == nil || !p.dredModelLoaded || d.ignoreExtensions || len(packet) == 0 {
+	if p == nil || !p.dredModelLoaded || d.ignoreExtensions || view.FrameCount() == 0 {
 		return
 	}
-	payload, frameOffset, ok, err := findDREDPayload(packet)
+	payload, frameOffset, ok, err := findDREDPayloadInView(view)
 	if err != nil || !ok {
 		return
 	}
@@ -531,11 +533,15 @@ func (d *Decoder) maybeCacheDREDPayload(packet []byte) {
 		return
 	}
 	minFeatureFrames := 2 * internaldred.NumRedundancyFrames
+	// Only the entropy decode runs per packet. The RDOVAE feature decode is
+	// deferred to queueCachedDREDRecovery, which runs it over just the
+	// latents a concealment actually reads, so loss-free streams never pay
+	// for it.
+	p.dredProcess.Restart()
 	if _, err := p.dredDecoded.Decode(payload, frameOffset, minFeatureFrames); err != nil {
 		d.invalidateDREDPayloadState()
 		return
 	}
-	p.dredModel.DecodeAllWithProcessor(&p.dredProcess, p.dredDecoded.Features[:], p.dredDecoded.State[:], p.dredDecoded.Latents[:], p.dredDecoded.NbLatents)
 }
 
 func (d *Decoder) cachedDREDMaxAvailableSamples(maxDredSamples int) int {
@@ -605,7 +611,14 @@ func (d *Decoder) queueCachedDREDRecovery(maxDredSamples, decodeOffsetSamples, f
 	if r.dredBlend == 0 {
 		initFrames = 2
 	}
-	return internaldred.QueueProcessedFeaturesWithInitFrames(&r.dredPLC, d.cachedDREDResult(maxDredSamples), &p.dredDecoded, decodeOffsetSamples, frameSizeSamples, initFrames)
+	result := d.cachedDREDResult(maxDredSamples)
+	window := internaldred.ProcessedFeatureWindow(result, &p.dredDecoded, decodeOffsetSamples, frameSizeSamples, initFrames)
+	if need := window.LatentsNeeded(); need > p.dredProcess.DecodedLatents() {
+		// Extend the packet's decoded prefix; later concealment frames of
+		// the same gap reuse it and only decode the deeper latents.
+		p.dredModel.DecodePrefixWithProcessor(&p.dredProcess, p.dredDecoded.Features[:], p.dredDecoded.State[:], p.dredDecoded.Latents[:], need)
+	}
+	return internaldred.QueueProcessedFeaturesWithInitFrames(&r.dredPLC, result, &p.dredDecoded, decodeOffsetSamples, frameSizeSamples, initFrames)
 }
 
 func (d *Decoder) finishActiveDREDRecovery(frameSizeSamples int) {
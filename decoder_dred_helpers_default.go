@@ -95,7 +95,7 @@ func (d *Decoder) beginDREDRawMonoGoodFrameCapture(_ Mode) func() {
 	return func() {}
 }
 
-func (d *Decoder) maybeCacheDREDPayload(_ []byte) {}
+func (d *Decoder) maybeCacheDREDPayload(_ *PacketView) {}
 
 func (d *Decoder) markDREDConcealed() {}
 
@@ -0,0 +1,106 @@
+//go:build gopus_dred || gopus_osce
+
+package gopus
+
+import (
+	"fmt"
+	"testing"
+
+	"github.com/thesyncim/gopus/internal/dnnblob"
+	encpkg "github.com/thesyncim/gopus/internal/encoder"
+)
+
+// BenchmarkDecoderCachedDREDLoss measures decoder CPU per received packet on
+// the cached DRED path across loss rates and DRED depths. With the RDOVAE
+// feature decode deferred to concealment, the 0% loss cost should stay flat
+// as the DRED duration grows.
+func BenchmarkDecoderCachedDREDLoss(b *testing.B) {
+	encoderBlob, err := probeLibopusEncoderNeuralModelBlob()
+	if err != nil {
+		b.Skipf("libopus encoder neural model helper unavailable: %v", err)
+	}
+	dredBlob, err := probeLibopusDREDModelBlob()
+	if err != nil {
+		b.Skipf("libopus DRED model helper unavailable: %v", err)
+	}
+
+	for _, durationMs := range []int{100, 500, 1000} {
+		packets := encodeDREDLossBenchPackets(b, encoderBlob, durationMs/10)
+		for _, lossPct := range []int{0, 5, 20} {
+			b.Run(fmt.Sprintf("dred=%dms/loss=%d%%", durationMs, lossPct), func(b *testing.B) {
+				dec, err := NewDecoder(DefaultDecoderConfig(dredQualitySampleRate, dredQualityChannels))
+				if err != nil {
+					b.Fatalf("NewDecoder error: %v", err)
+				}
+				setDecoderComplexityForLibopusDREDParityTest(b, dec)
+				blob, err := dnnblob.Clone(dredBlob)
+				if err != nil {
+					b.Fatalf("dnnblob.Clone error: %v", err)
+				}
+				dec.setDREDDecoderBlob(blob)
+
+				pcm := make([]float32, dec.maxPacketSamples*dredQualityChannels)
+				received := 0
+				b.ReportAllocs()
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					for frame, packet := range packets {
+						// Deterministic spread of lossPct% of the frames.
+						if frame > 0 && (frame*lossPct)%100 < lossPct {
+							packet = nil
+						} else {
+							received++
+						}
+						if _, err := dec.Decode(packet, pcm); err != nil {
+							b.Fatalf("Decode(frame=%d) error: %v", frame, err)
+						}
+					}
+				}
+				b.ReportMetric(float64(b.Elapsed().Nanoseconds())/float64(max(received, 1)), "ns/received-packet")
+			})
+		}
+	}
+}
+
+func encodeDREDLossBenchPackets(b *testing.B, encoderBlob []byte, duration int) [][]byte {
+	b.Helper()
+
+	enc, err := NewEncoder(EncoderConfig{
+		SampleRate:  dredQualitySampleRate,
+		Channels:    dredQualityChannels,
+		Application: ApplicationVoIP,
+	})
+	if err != nil {
+		b.Fatalf("NewEncoder error: %v", err)
+	}
+	if err := enc.SetFrameSize(dredQualityFrameSize); err != nil {
+		b.Fatalf("SetFrameSize error: %v", err)
+	}
+	if err := enc.SetBitrate(48000); err != nil {
+		b.Fatalf("SetBitrate error: %v", err)
+	}
+	if err := enc.SetPacketLoss(20); err != nil {
+		b.Fatalf("SetPacketLoss error: %v", err)
+	}
+	if err := enc.SetDNNBlob(encoderBlob); err != nil {
+		b.Fatalf("SetDNNBlob encoder error: %v", err)
+	}
+	if err := enc.SetDREDDuration(duration); err != nil {
+		b.Fatalf("SetDREDDuration(%d) error: %v", duration, err)
+	}
+	enc.enc.SetMode(encpkg.ModeCELT)
+
+	const frames = 100
+	packets := make([][]byte, 0, frames)
+	pcm := make([]float32, dredQualityFrameSize*dredQualityChannels)
+	packet := make([]byte, maxPacketBytesPerStream)
+	for frame := range frames {
+		fillDREDQualitySpeechFrame(pcm, frame)
+		n, err := enc.Encode(pcm, packet)
+		if err != nil {
+			b.Fatalf("Encode(frame=%d) error: %v", frame, err)
+		}
+		packets = append(packets, append([]byte(nil), packet[:n]...))
+	}
+	return packets
+}
@@ -293,18 +293,15 @@ func packetHasLBRR(firstFrameData []byte, toc TOC) bool {
 }
 
 // storeFECData prepares the current packet's first-frame LBRR payload for one
-// provided-packet decode_fec call.
+// provided-packet decode_fec call. The payload is aliased, not copied:
+// DecodeWithFEC consumes it before returning and clearFECState drops the
+// reference, so the caller's packet only has to outlive that call.
 func (d *Decoder) storeFECData(data []byte, toc TOC, frameCount, frameSize int) {
 	if !packetHasLBRR(data, toc) {
 		d.clearFECState()
 		return
 	}
-	if cap(d.fecData) < len(data) {
-		d.fecData = make([]byte, len(data))
-	} else {
-		d.fecData = d.fecData[:len(data)]
-	}
-	copy(d.fecData, data)
+	d.fecData = data
 
 	d.fecMode = toc.Mode
 	d.fecBandwidth = toc.Bandwidth
@@ -411,7 +408,7 @@ func (d *Decoder) clearFECState() {
 	d.hasFEC = false
 	d.fecFrameSize = 0
 	d.fecFrameCount = 0
-	d.fecData = d.fecData[:0]
+	d.fecData = nil
 	d.fecMode = ModeHybrid
 	d.fecBandwidth = BandwidthFullband
 	d.fecStereo = false
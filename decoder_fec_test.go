@@ -117,48 +117,35 @@ func TestDecodeWithFEC_SILKNoLBRRDoesNotStoreFEC(t *testing.T) {
 	t.Log("DecodeWithFEC correctly left FEC state clear for SILK without LBRR")
 }
 
-func TestStoreFECData_ReusesBackingBuffer(t *testing.T) {
+func TestStoreFECData_AliasesPacket(t *testing.T) {
 	dec, err := NewDecoder(DefaultDecoderConfig(48000, 1))
 	if err != nil {
 		t.Fatalf("NewDecoder error: %v", err)
 	}
 
-	initialCap := cap(dec.fecData)
-	if initialCap == 0 {
-		t.Fatal("expected preallocated fecData backing buffer")
-	}
-
 	toc := TOC{
 		Mode:      ModeSILK,
 		Bandwidth: BandwidthWideband,
 		Stereo:    false,
 	}
 
-	packetSmall := make([]byte, 32)
-	packetLarge := make([]byte, 512)
-	for i := range packetSmall {
-		packetSmall[i] = byte(i)
-	}
-	for i := range packetLarge {
-		packetLarge[i] = byte(255 - (i % 255))
-	}
-	packetSmall[0] |= 0x40
-	packetLarge[0] |= 0x40
-
-	dec.storeFECData(packetSmall, toc, 1, 960)
-	if cap(dec.fecData) != initialCap {
-		t.Fatalf("fecData cap changed after small packet: got %d want %d", cap(dec.fecData), initialCap)
+	packet := make([]byte, 512)
+	for i := range packet {
+		packet[i] = byte(255 - (i % 255))
 	}
+	packet[0] |= 0x40
 
-	dec.storeFECData(packetLarge, toc, 1, 960)
-	if cap(dec.fecData) != initialCap {
-		t.Fatalf("fecData cap changed after large packet: got %d want %d", cap(dec.fecData), initialCap)
+	dec.storeFECData(packet, toc, 1, 960)
+	if !dec.hasFEC {
+		t.Fatal("hasFEC should be set for a packet with LBRR")
 	}
-	if len(dec.fecData) != len(packetLarge) {
-		t.Fatalf("fecData len = %d, want %d", len(dec.fecData), len(packetLarge))
+	if len(dec.fecData) != len(packet) || &dec.fecData[0] != &packet[0] {
+		t.Fatal("fecData should alias the packet instead of copying it")
 	}
-	if dec.fecData[0] != packetLarge[0] || dec.fecData[len(dec.fecData)-1] != packetLarge[len(packetLarge)-1] {
-		t.Fatal("fecData content mismatch after copy")
+
+	dec.clearFECState()
+	if dec.fecData != nil {
+		t.Fatal("clearFECState should drop the reference to the caller's packet")
 	}
 }
 
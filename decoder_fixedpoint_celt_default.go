@@ -2,7 +2,10 @@
 
 package gopus
 
-import "github.com/thesyncim/gopus/internal/celt"
+import (
+	"github.com/thesyncim/gopus/internal/celt"
+	"github.com/thesyncim/gopus/internal/silk"
+)
 
 // celtDecodeFixedAPIRate is a no-op in the default (float) build: it never
 // handles the CELT-only decode, so the caller falls through to the float CELT
@@ -29,6 +32,11 @@ func (d *Decoder) finishFixedHybrid() error
 func (d *Decoder) armFixedHybridLost(_ int, _ bool) bool { return false }
 func (d *Decoder) finishFixedHybridLost(_ int) bool      { return false }
 
+// armFixedSILK / finishFixedSILK are no-ops in the default build: SILK-only
+// frames always use the float conversion there.
+func (d *Decoder) armFixedSILK(_ silk.Bandwidth, _ int, _, _ bool) bool { return false }
+func (d *Decoder) finishFixedSILK(_ int, _ bool) bool                   { return false }
+
 // The integer Hybrid redundancy / transition helpers are no-ops in the default
 // build; the int16/int24 wrappers there always use the float conversion for
 // redundancy / transition frames.
@@ -0,0 +1,41 @@
+//go:build gopus_fixed_point
+
+package gopus
+
+import (
+	"fmt"
+	"testing"
+)
+
+// BenchmarkDecoderInt16FixedCELT decodes fullband CELT packets end to end
+// through the integer decoder, one sub-benchmark per frame size so each MDCT
+// shift (and its FFT size) is covered.
+func BenchmarkDecoderInt16FixedCELT(b *testing.B) {
+	for _, channels := range []int{1, 2} {
+		for _, frameSize := range []int{960, 480, 240, 120} {
+			b.Run(fmt.Sprintf("%dch/%d", channels, frameSize), func(b *testing.B) {
+				stream := encodeFixedModeSequence(b, EncoderModeCELT, BandwidthFullband, channels, frameSize, 16)
+				dec, err := NewDecoder(DefaultDecoderConfig(48000, channels))
+				if err != nil {
+					b.Fatalf("NewDecoder: %v", err)
+				}
+				pcm := make([]int16, frameSize*channels)
+				integer := 0
+				b.SetBytes(int64(2 * len(pcm) * len(stream)))
+				b.ReportAllocs()
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					for _, pkt := range stream {
+						if _, err := dec.DecodeInt16(pkt, pcm); err != nil {
+							b.Fatal(err)
+						}
+						if dec.fixedAllHandled {
+							integer++
+						}
+					}
+				}
+				b.ReportMetric(float64(integer)/float64(b.N), "integer-frames/op")
+			})
+		}
+	}
+}
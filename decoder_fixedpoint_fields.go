@@ -102,4 +102,13 @@ type decoderFixedFields struct {
 	// channel count for the in-flight lost hybrid frame.
 	fixedHybridPLCStereo   bool
 	fixedHybridPLCChannels int
+
+	// fixedSILKInt16 receives the resampled int16 SILK output (or concealment)
+	// of the in-flight SILK-only frame, interleaved at the API rate;
+	// fixedSILKRes is its opus_res (INT16TORES) view.
+	fixedSILKInt16 []int16
+	fixedSILKRes   []int32
+	// fixedSILKApplied counts the SILK-only frames emitted through the integer
+	// path. Like fixedRedundancyApplied it is a diagnostic for the parity gates.
+	fixedSILKApplied int
 }
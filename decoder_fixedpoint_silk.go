@@ -0,0 +1,76 @@
+//go:build gopus_fixed_point
+
+package gopus
+
+import "github.com/thesyncim/gopus/internal/silk"
+
+// armFixedSILK arms the integer FIXED_POINT output capture for a SILK-only
+// frame of the in-flight DecodeInt16 / DecodeInt24 packet. gopus' SILK decoder
+// is already integer (silk_decode_core, silk_PLC and the int16 silk_resampler);
+// capturing its resampled int16 output lets the int16/int24 wrappers emit it
+// directly (int16 as is, int24 as INT16TORES: int16 << RES_SHIFT), exactly as
+// the FIXED_POINT opus_decode_frame does, without the float32 round trip.
+//
+// decodeSize is the per-channel API-rate sample count the SILK decoder runs for
+// (max(frameSize, F10)); lost selects the PLC capture. It returns false, and the
+// caller marks the packet unhandled, when there is no active integer packet,
+// when the API rate is below the SILK internal rate (the downsampler has no
+// int16 output), or for the stereo->mono / mono->stereo concealment and
+// stereo->mono decode paths, which do not capture.
+func (d *Decoder) armFixedSILK(silkBW silk.Bandwidth, decodeSize int, lost, silkStereo bool) bool {
+	if !d.fixedPacketActive {
+		return false
+	}
+	if int(d.sampleRate) < silk.GetBandwidthConfig(silkBW).SampleRate {
+		return false
+	}
+	channels := int(d.channels)
+	if silkStereo && channels == 1 {
+		return false
+	}
+	if lost && !silkStereo && channels == 2 {
+		return false
+	}
+	n := decodeSize * channels
+	if cap(d.fixedSILKInt16) < n {
+		d.fixedSILKInt16 = make([]int16, n)
+	}
+	d.fixedSILKInt16 = d.fixedSILKInt16[:n]
+	if lost {
+		d.silkDecoder.ArmPLCLowbandCapture(d.fixedSILKInt16)
+	} else {
+		d.silkDecoder.ArmOutputCapture(d.fixedSILKInt16)
+	}
+	return true
+}
+
+// finishFixedSILK disarms the capture armed by armFixedSILK and appends the
+// frame's first frameSize*channels captured samples to the integer packet
+// accumulation. It must run after every armed decode, including a failed one,
+// and returns false when the decoder did not fill the frame.
+func (d *Decoder) finishFixedSILK(frameSize int, lost bool) bool {
+	var filled int
+	if lost {
+		filled = d.silkDecoder.PLCLowbandCaptured()
+		d.silkDecoder.ArmPLCLowbandCapture(nil)
+	} else {
+		filled = d.silkDecoder.OutputCaptured()
+		d.silkDecoder.ArmOutputCapture(nil)
+	}
+	needed := frameSize * int(d.channels)
+	if filled < needed || len(d.fixedSILKInt16) < needed {
+		return false
+	}
+	if cap(d.fixedSILKRes) < needed {
+		d.fixedSILKRes = make([]int32, needed)
+	}
+	res := d.fixedSILKRes[:needed]
+	int16Out := d.fixedSILKInt16[:needed]
+	// INT16TORES(a) = SHL32(EXTEND32(a), RES_SHIFT); RES_SHIFT == 8.
+	for i, s := range int16Out {
+		res[i] = int32(s) << 8
+	}
+	d.appendFixedOutput(int16Out, res)
+	d.fixedSILKApplied++
+	return true
+}
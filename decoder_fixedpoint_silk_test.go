@@ -0,0 +1,234 @@
+//go:build gopus_fixed_point
+
+package gopus
+
+import (
+	"fmt"
+	"math"
+	"testing"
+
+	"github.com/thesyncim/gopus/internal/libopustest"
+)
+
+// encodeFixedModeSequence encodes frames packets of a two-tone signal with the
+// encoder forced to mode at bandwidth bw.
+func encodeFixedModeSequence(tb testing.TB, mode EncoderMode, bw Bandwidth, channels, frameSize, frames int) [][]byte {
+	tb.Helper()
+	const sampleRate = 48000
+	enc, err := NewEncoder(EncoderConfig{
+		SampleRate:  sampleRate,
+		Channels:    channels,
+		Application: ApplicationVoIP,
+	})
+	if err != nil {
+		tb.Fatalf("NewEncoder: %v", err)
+	}
+	bitrate := 64000 * channels
+	if mode == EncoderModeSILK {
+		bitrate = 24000 * channels
+	}
+	if err := enc.SetMode(mode); err != nil {
+		tb.Fatalf("SetMode: %v", err)
+	}
+	if err := enc.SetFrameSize(frameSize); err != nil {
+		tb.Fatalf("SetFrameSize: %v", err)
+	}
+	if err := enc.SetBandwidth(bw); err != nil {
+		tb.Fatalf("SetBandwidth: %v", err)
+	}
+	if err := enc.SetBitrate(bitrate); err != nil {
+		tb.Fatalf("SetBitrate: %v", err)
+	}
+	if err := enc.SetInBandFEC(InBandFECDisabled); err != nil {
+		tb.Fatalf("SetInBandFEC: %v", err)
+	}
+	if channels == 2 {
+		if err := enc.SetForceChannels(2); err != nil {
+			tb.Fatalf("SetForceChannels: %v", err)
+		}
+	}
+
+	packets := make([][]byte, 0, frames)
+	pcm := make([]float32, frameSize*channels)
+	for f := 0; f < frames; f++ {
+		for i := 0; i < frameSize; i++ {
+			tm := float64(f*frameSize+i) / sampleRate
+			pcm[i*channels] = 0.24*float32(math.Sin(2*math.Pi*220*tm)) +
+				0.12*float32(math.Sin(2*math.Pi*1300*tm+0.17))
+			if channels == 2 {
+				pcm[i*channels+1] = 0.21*float32(math.Sin(2*math.Pi*330*tm+0.09)) +
+					0.10*float32(math.Sin(2*math.Pi*1700*tm+0.31))
+			}
+		}
+		pkt, err := enc.EncodeFloat32(pcm)
+		if err != nil {
+			tb.Fatalf("frame %d Encode: %v", f, err)
+		}
+		packets = append(packets, append([]byte(nil), pkt...))
+	}
+	return packets
+}
+
+// TestDecoderFixedPointSILKIntegerPath checks that SILK-only frames, received
+// and concealed, are emitted through the integer capture (fixedSILKApplied) and
+// that the result equals the float decode quantized the way the float fallback
+// would. The SILK decoder is integer, so the two must agree sample for sample;
+// TestDecoderFixedPointSILKPLCParity pins both against the FIXED_POINT oracle.
+func TestDecoderFixedPointSILKIntegerPath(t *testing.T) {
+	cases := []struct {
+		rate, channels int
+		bw             Bandwidth
+		integer        bool
+	}{
+		{48000, 1, BandwidthWideband, true},
+		{48000, 2, BandwidthWideband, true},
+		{48000, 1, BandwidthNarrowband, true},
+		{24000, 2, BandwidthMediumband, true},
+		{16000, 1, BandwidthWideband, true},
+		// Below the SILK internal rate the float downsampler has no int16
+		// output, so the frame declines the integer path.
+		{8000, 1, BandwidthWideband, false},
+	}
+	for _, c := range cases {
+		t.Run(fmt.Sprintf("%dHz_%dch_bw%d", c.rate, c.channels, c.bw), func(t *testing.T) {
+			packets := encodeFixedModeSequence(t, EncoderModeSILK, c.bw, c.channels, 960, 8)
+			if toc := ParseTOC(packets[0][0]); toc.Mode != ModeSILK {
+				t.Skipf("encoder produced mode %v, want SILK", toc.Mode)
+			}
+			// Drop two packets mid-stream to cover the SILK PLC capture.
+			packets[4], packets[5] = nil, nil
+
+			frameSize := 960 * c.rate / 48000
+			decF := mustNewTestDecoder(t, c.rate, c.channels)
+			dec16 := mustNewTestDecoder(t, c.rate, c.channels)
+			dec24 := mustNewTestDecoder(t, c.rate, c.channels)
+			bufF := make([]float32, frameSize*c.channels)
+			want16 := make([]int16, frameSize*c.channels)
+			want24 := make([]int32, frameSize*c.channels)
+			got16 := make([]int16, frameSize*c.channels)
+			got24 := make([]int32, frameSize*c.channels)
+			for p, pkt := range packets {
+				n, err := decF.Decode(pkt, bufF)
+				if err != nil {
+					t.Fatalf("packet %d Decode: %v", p, err)
+				}
+				if _, err := dec16.DecodeInt16(pkt, got16); err != nil {
+					t.Fatalf("packet %d DecodeInt16: %v", p, err)
+				}
+				if _, err := dec24.DecodeInt24(pkt, got24); err != nil {
+					t.Fatalf("packet %d DecodeInt24: %v", p, err)
+				}
+				float32ToInt16NoSoftClip(want16, bufF, n, c.channels)
+				float32ToInt24Slice(want24, bufF, n, c.channels)
+				for i := 0; i < n*c.channels; i++ {
+					if got16[i] != want16[i] || got24[i] != want24[i] {
+						t.Fatalf("packet %d sample %d: int16=%d int24=%d, want %d %d",
+							p, i, got16[i], got24[i], want16[i], want24[i])
+					}
+				}
+			}
+			if got := dec16.fixedSILKApplied > 0; got != c.integer {
+				t.Fatalf("integer SILK frames=%d, want integer path %v", dec16.fixedSILKApplied, c.integer)
+			}
+			if c.integer && dec16.fixedSILKApplied != len(packets) {
+				t.Fatalf("integer SILK frames=%d, want %d", dec16.fixedSILKApplied, len(packets))
+			}
+		})
+	}
+}
+
+// TestDecoderFixedPointSILKPLCParity gates SILK-only decode with losses through
+// the integer path against the FIXED_POINT opus_decode / opus_decode24 oracle.
+func TestDecoderFixedPointSILKPLCParity(t *testing.T) {
+	libopustest.RequireOracle(t)
+
+	const sampleRate = 48000
+	for _, channels := range []int{1, 2} {
+		t.Run(fmt.Sprintf("%dch", channels), func(t *testing.T) {
+			packets := encodeFixedModeSequence(t, EncoderModeSILK, BandwidthWideband, channels, 960, 10)
+			packets[3], packets[6], packets[7] = nil, nil, nil
+
+			refInt16, err := decodeWithLibopusFixedInt16(sampleRate, channels, 960, packets)
+			if err != nil {
+				libopustest.HelperUnavailable(t, "fixed reference decode int16", err)
+				return
+			}
+			refInt24, err := decodeWithLibopusFixedInt24(sampleRate, channels, 960, packets)
+			if err != nil {
+				libopustest.HelperUnavailable(t, "fixed reference decode int24", err)
+				return
+			}
+
+			dec16 := mustNewTestDecoder(t, sampleRate, channels)
+			dec24 := mustNewTestDecoder(t, sampleRate, channels)
+			var got16, got24 []int32
+			for p, pkt := range packets {
+				o16 := make([]int16, 960*channels)
+				if _, err := dec16.DecodeInt16(pkt, o16); err != nil {
+					t.Fatalf("packet %d DecodeInt16: %v", p, err)
+				}
+				got16 = append(got16, int16ToInt32(o16)...)
+				o24 := make([]int32, 960*channels)
+				if _, err := dec24.DecodeInt24(pkt, o24); err != nil {
+					t.Fatalf("packet %d DecodeInt24: %v", p, err)
+				}
+				got24 = append(got24, o24...)
+			}
+			if dec16.fixedSILKApplied != len(packets) {
+				t.Fatalf("integer SILK frames=%d, want %d", dec16.fixedSILKApplied, len(packets))
+			}
+			assertFixedExact(t, "int16", got16, int16ToInt32(refInt16))
+			assertFixedExact(t, "int24", got24, refInt24)
+		})
+	}
+}
+
+// BenchmarkDecoderInt16MixedModes decodes an interleaved SILK / Hybrid / CELT
+// packet stream with periodic losses through DecodeInt16. integer-frames/op
+// reports how many packets per iteration bypassed the float conversion.
+func BenchmarkDecoderInt16MixedModes(b *testing.B) {
+	const frameSize = 960
+	for _, channels := range []int{1, 2} {
+		b.Run(fmt.Sprintf("%dch", channels), func(b *testing.B) {
+			silkPkts := encodeFixedModeSequence(b, EncoderModeSILK, BandwidthWideband, channels, frameSize, 16)
+			hybridPkts := encodeFixedModeSequence(b, EncoderModeHybrid, BandwidthFullband, channels, frameSize, 16)
+			celtPkts := encodeFixedModeSequence(b, EncoderModeCELT, BandwidthFullband, channels, frameSize, 16)
+			var stream [][]byte
+			for i := 0; i < 16; i++ {
+				var pkt []byte
+				switch (i / 4) % 3 {
+				case 0:
+					pkt = silkPkts[i]
+				case 1:
+					pkt = hybridPkts[i]
+				default:
+					pkt = celtPkts[i]
+				}
+				if i%7 == 6 {
+					pkt = nil
+				}
+				stream = append(stream, pkt)
+			}
+
+			dec, err := NewDecoder(DefaultDecoderConfig(48000, channels))
+			if err != nil {
+				b.Fatalf("NewDecoder: %v", err)
+			}
+			pcm := make([]int16, frameSize*channels)
+			integer := 0
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				for _, pkt := range stream {
+					if _, err := dec.DecodeInt16(pkt, pcm); err != nil {
+						b.Fatal(err)
+					}
+					if dec.fixedAllHandled {
+						integer++
+					}
+				}
+			}
+			b.ReportMetric(float64(integer)/float64(b.N), "integer-frames/op")
+		})
+	}
+}
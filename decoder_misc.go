@@ -34,7 +34,7 @@ func decodeGainLinear(gainQ8 int) float32 {
 }
 
 func (d *Decoder) applyOutputGain(samples []float32) {
-	if d.decodeGainQ8 == 0 || len(samples) == 0 {
+	if d.decodeGainQ8 == 0 || d.deferOutputGain || len(samples) == 0 {
 		return
 	}
 	g := decodeGainLinear(d.decodeGainQ8)
@@ -507,9 +507,6 @@ func (d *Decoder) decodeOpusFrameIntoWithStatePolicyAndQEXT(
 		}
 
 	case ModeSILK:
-		// SILK output is not produced by the integer CELT path; the int16/int24
-		// wrappers must use the float conversion for this packet.
-		d.markFixedUnhandled()
 		if d.haveDecoded && d.prevMode == ModeCELT {
 			d.silkDecoder.Reset()
 		}
@@ -525,6 +522,19 @@ func (d *Decoder) decodeOpusFrameIntoWithStatePolicyAndQEXT(
 
 		silkDecodeSize := max(frameSize, F10)
 
+		// Under -tags gopus_fixed_point with an active integer-output packet,
+		// capture the SILK decoder's resampled int16 output so DecodeInt16 /
+		// DecodeInt24 emit it directly (INT16TORES for int24), as the FIXED_POINT
+		// opus_decode_frame does. The OSCE post-processing rewrites the float
+		// output after SILK, so it keeps the float conversion.
+		fixedSILKArmed := false
+		if !extsupport.QEXT && !(extsupport.OSCERuntime && data != nil) {
+			fixedSILKArmed = d.armFixedSILK(silkBW, silkDecodeSize, data == nil, packetStereoLocal)
+		}
+		if !fixedSILKArmed {
+			d.markFixedUnhandled()
+		}
+
 		var silkSamples int
 		var err error
 		if data != nil {
@@ -619,6 +629,9 @@ func (d *Decoder) decodeOpusFrameIntoWithStatePolicyAndQEXT(
 				}
 			}
 		}
+		if fixedSILKArmed && !d.finishFixedSILK(frameSize, data == nil) {
+			d.markFixedUnhandled()
+		}
 		if err != nil {
 			return 0, err
 		}
@@ -751,6 +764,9 @@ func (d *Decoder) decodeOpusFrameIntoWithStatePolicyAndQEXT(
 	if mode != ModeSILK && data == nil {
 		// No extra work for PLC in CELT/Hybrid modes.
 	} else if d.haveDecoded && mode == ModeSILK && d.prevMode == ModeHybrid && !(redundancy && celtToSilk && d.prevRedundancy) {
+		// The Hybrid->SILK CELT fade-out frame is only decoded by the float CELT
+		// decoder; the int16/int24 wrappers use the float conversion.
+		d.markFixedUnhandled()
 		samples, err := d.decodeCELTFrameToAPIScratch(celtSilenceFrame2B[:], F2_5, packetStereoLocal)
 		if err != nil {
 			return 0, err
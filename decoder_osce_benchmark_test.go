@@ -0,0 +1,106 @@
+//go:build gopus_osce
+
+package gopus
+
+import (
+	"math"
+	"testing"
+
+	"github.com/thesyncim/gopus/internal/libopustest"
+)
+
+// encodeOSCEBenchPackets encodes frames 20 ms mono SILK wideband packets of a
+// voiced two-formant signal, the input the LACE/NoLACE postfilter and the BWE
+// stage act on.
+func encodeOSCEBenchPackets(tb testing.TB, frames int) [][]byte {
+	tb.Helper()
+	enc, err := NewEncoder(EncoderConfig{SampleRate: 48000, Channels: 1, Application: ApplicationVoIP})
+	if err != nil {
+		tb.Fatalf("NewEncoder: %v", err)
+	}
+	if err := enc.SetMode(EncoderModeSILK); err != nil {
+		tb.Fatalf("SetMode: %v", err)
+	}
+	if err := enc.SetBandwidth(BandwidthWideband); err != nil {
+		tb.Fatalf("SetBandwidth: %v", err)
+	}
+	if err := enc.SetBitrate(20000); err != nil {
+		tb.Fatalf("SetBitrate: %v", err)
+	}
+	pcm := make([]float32, 960)
+	packets := make([][]byte, 0, frames)
+	for f := 0; f < frames; f++ {
+		for i := range pcm {
+			tm := float64(f*960+i) / 48000
+			pitch := 140 + 30*math.Sin(2*math.Pi*0.7*tm)
+			pcm[i] = float32((0.25*math.Sin(2*math.Pi*pitch*tm) + 0.1*math.Sin(2*math.Pi*3*pitch*tm)) *
+				(0.6 + 0.4*math.Sin(2*math.Pi*3*tm)))
+		}
+		pkt, err := enc.EncodeFloat32(pcm)
+		if err != nil {
+			tb.Fatalf("frame %d Encode: %v", f, err)
+		}
+		packets = append(packets, append([]byte(nil), pkt...))
+	}
+	return packets
+}
+
+// BenchmarkDecoderOSCE measures per-stream decode cost of 20 ms SILK wideband
+// packets with each OSCE stage armed: plain decode, the LACE and NoLACE
+// postfilters, the BWE upsampler, and NoLACE followed by BWE. It skips when
+// the libopus model extractors cannot be built on this host.
+func BenchmarkDecoderOSCE(b *testing.B) {
+	coreBlob, err := probeLibopusDecoderNeuralModelBlob()
+	if err != nil {
+		libopustest.HelperUnavailable(b, "decoder neural model", err)
+	}
+	laceBlob, err := probeLibopusOSCELACEModelBlob()
+	if err != nil {
+		libopustest.HelperUnavailable(b, "OSCE LACE model blob", err)
+	}
+	bweBlob, err := probeLibopusOSCEBWEModelBlob()
+	if err != nil {
+		libopustest.HelperUnavailable(b, "OSCE BWE model blob", err)
+	}
+	merged := append(append(append([]byte(nil), coreBlob...), laceBlob...), bweBlob...)
+	packets := encodeOSCEBenchPackets(b, 50)
+
+	for _, tc := range []struct {
+		name       string
+		complexity int
+		lace, bwe  bool
+	}{
+		{name: "plain", complexity: 5},
+		{name: "lace", complexity: 6, lace: true},
+		{name: "nolace", complexity: 7, lace: true},
+		{name: "bwe", complexity: 4, bwe: true},
+		{name: "nolace_bwe", complexity: 10, lace: true, bwe: true},
+	} {
+		b.Run(tc.name, func(b *testing.B) {
+			dec, err := NewDecoder(DefaultDecoderConfig(48000, 1))
+			if err != nil {
+				b.Fatal(err)
+			}
+			if err := dec.SetComplexity(tc.complexity); err != nil {
+				b.Fatal(err)
+			}
+			if err := dec.SetOSCELACE(tc.lace); err != nil {
+				b.Fatal(err)
+			}
+			if err := dec.SetOSCEBWE(tc.bwe); err != nil {
+				b.Fatal(err)
+			}
+			if err := dec.SetDNNBlob(merged); err != nil {
+				b.Fatal(err)
+			}
+			pcm := make([]float32, 960)
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				if _, err := dec.Decode(packets[i%len(packets)], pcm); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
@@ -0,0 +1,190 @@
+package gopus
+
+import "github.com/thesyncim/gopus/internal/silk"
+
+// pcmResampleBlock is the interleaved float32 block the int16/int24 wrappers
+// emit through on the resampled path. It stays on the stack, so the resampler
+// output is converted while still in L1 rather than via a full-frame buffer.
+const pcmResampleBlock = 512
+
+// decoderPCMResampleFields holds the arbitrary-rate output stage selected by
+// DecoderConfig.PCMSampleRate. The codec runs at sampleRate; pcmResampler
+// converts its output to pcmSampleRate as it is written to the caller's
+// buffer.
+type decoderPCMResampleFields struct {
+	pcmResampler  *silk.PolyphaseResampler
+	pcmSampleRate int32
+}
+
+// validPCMSampleRate reports whether rate is usable as a PCM boundary rate for
+// a codec running at codecRate.
+func validPCMSampleRate(rate, codecRate int) bool {
+	return rate == 0 || rate == codecRate || (rate >= 8000 && rate <= 192000)
+}
+
+// newPCMResampler returns the boundary resampler from inRate to outRate, or
+// nil when the rates match or the PCM rate (either one) is unset. maxBlock is
+// the largest block per channel loaded at once.
+func newPCMResampler(inRate, outRate, channels, maxBlock int) (*silk.PolyphaseResampler, error) {
+	if inRate == 0 || outRate == 0 || outRate == inRate {
+		return nil, nil
+	}
+	r, err := silk.NewPolyphaseResampler(inRate, outRate, channels, maxBlock)
+	if err != nil {
+		return nil, ErrInvalidSampleRate
+	}
+	return r, nil
+}
+
+// resampledCodecFrameSize returns the codec-rate samples per channel to decode
+// for a packet (or, with data nil, a concealment frame) whose resampled output
+// must fit in pcmLen interleaved samples.
+//
+// Concealment covers one packet duration, as opus_demo drives PLC, shortened
+// to a whole number of 2.5 ms steps when the caller's buffer holds less.
+func (d *Decoder) resampledCodecFrameSize(data []byte, pcmLen int) (int, error) {
+	channels := int(d.channels)
+	r := d.pcmResampler
+	if len(data) == 0 {
+		total := int(d.lastPacketDuration)
+		if total <= 0 {
+			total = int(d.lastFrameSize)
+		}
+		quantum := int(d.sampleRate) / 400
+		total = min(total, r.MaxInputLen(pcmLen/channels)/quantum*quantum)
+		if total <= 0 {
+			return 0, ErrBufferTooSmall
+		}
+		return total, nil
+	}
+
+	if len(data) > d.maxPacketBytes {
+		return 0, ErrPacketTooLarge
+	}
+	toc, frameCount, err := packetFrameCount(data)
+	if err != nil {
+		return 0, err
+	}
+	frameSize := toc.FrameSize
+	if toc.Mode == ModeSILK || toc.Mode == ModeCELT || toc.Mode == ModeHybrid {
+		frameSize = packetTOCSamplesPerFrameAtRate(data[0], int(d.sampleRate))
+	}
+	total := frameSize * frameCount
+	if total > d.maxPacketSamples {
+		return 0, ErrPacketTooLarge
+	}
+	if r.OutputLen(total)*channels > pcmLen {
+		return 0, ErrBufferTooSmall
+	}
+	return total, nil
+}
+
+// decodeResampledScratch decodes data at the codec rate into d.scratchPCM and
+// loads the result into the PCM resampler; the caller then emits the resampled
+// output into its buffer. softClip applies the int16 soft clip to decoded
+// packets at the codec rate, before the FIR, as the direct DecodeInt16 path
+// does.
+func (d *Decoder) decodeResampledScratch(data []byte, pcmLen int, clearSoftClipOnPacket, softClip bool) error {
+	total, err := d.resampledCodecFrameSize(data, pcmLen)
+	if err != nil {
+		return err
+	}
+	channels := int(d.channels)
+	d.ensureScratchPCM(total * channels)
+	n, err := d.decodeFloat32(data, d.scratchPCM, clearSoftClipOnPacket)
+	if err != nil {
+		return err
+	}
+	if softClip && len(data) > 0 {
+		opusPCMSoftClip(d.scratchPCM[:n*channels], n, channels, d.softClipMem[:])
+	}
+	d.pcmResampler.Load(d.scratchPCM[:n*channels])
+	return nil
+}
+
+// decodeResampledFloat32 is Decode on the resampled path.
+func (d *Decoder) decodeResampledFloat32(data []byte, pcm []float32) (int, error) {
+	if err := d.decodeResampledScratch(data, len(pcm), true, false); err != nil {
+		return 0, err
+	}
+	return d.pcmResampler.Emit(pcm), nil
+}
+
+// decodeResampledInt16 is DecodeInt16 on the resampled path. The FIR output
+// of a soft-clipped signal can ring marginally past full scale; the int16
+// conversion saturates it.
+func (d *Decoder) decodeResampledInt16(data []byte, pcm []int16) (int, error) {
+	if err := d.decodeResampledScratch(data, len(pcm), false, true); err != nil {
+		return 0, err
+	}
+	return d.emitResampledInt16(pcm), nil
+}
+
+// decodeResampledInt24 is DecodeInt24 on the resampled path.
+func (d *Decoder) decodeResampledInt24(data []byte, pcm []int32) (int, error) {
+	if err := d.decodeResampledScratch(data, len(pcm), false, false); err != nil {
+		return 0, err
+	}
+	return d.emitResampledInt24(pcm), nil
+}
+
+// emitResampledInt16 drains the PCM resampler into pcm as int16 and returns
+// the samples per channel written.
+func (d *Decoder) emitResampledInt16(pcm []int16) int {
+	var block [pcmResampleBlock]float32
+	channels := int(d.channels)
+	span := block[:len(block)/channels*channels]
+	out := 0
+	for {
+		k := d.pcmResampler.Emit(span[:min(len(span), len(pcm)-out*channels)])
+		if k == 0 {
+			return out
+		}
+		convertFloat32ToInt16NoSoftClipUnit(pcm[out*channels:], span[:k*channels], k*channels)
+		out += k
+	}
+}
+
+// emitResampledInt24 drains the PCM resampler into pcm as right-justified
+// 24-bit samples and returns the samples per channel written.
+func (d *Decoder) emitResampledInt24(pcm []int32) int {
+	var block [pcmResampleBlock]float32
+	channels := int(d.channels)
+	span := block[:len(block)/channels*channels]
+	out := 0
+	for {
+		k := d.pcmResampler.Emit(span[:min(len(span), len(pcm)-out*channels)])
+		if k == 0 {
+			return out
+		}
+		convertFloat32ToInt24(pcm[out*channels:], span[:k*channels], k*channels)
+		out += k
+	}
+}
+
+// PCMSampleRate returns the sample rate of the PCM exchanged with the caller:
+// DecoderConfig.PCMSampleRate when set, otherwise SampleRate.
+func (d *Decoder) PCMSampleRate() int {
+	if d.pcmResampler != nil {
+		return int(d.pcmSampleRate)
+	}
+	return d.SampleRate()
+}
+
+// decodeResampledFEC is DecodeWithFEC(fec=true) on the resampled path. The
+// recovered frame is sized from the codec-rate equivalent of len(pcm).
+func (d *Decoder) decodeResampledFEC(data []byte, pcm []float32) (int, error) {
+	channels := int(d.channels)
+	quantum := int(d.sampleRate) / 400
+	frameSize := d.pcmResampler.MaxInputLen(len(pcm)/channels) / quantum * quantum
+	if frameSize <= 0 {
+		return 0, ErrBufferTooSmall
+	}
+	d.ensureScratchPCM(min(frameSize, d.maxPacketSamples) * channels)
+	n, err := d.decodeWithFEC(data, d.scratchPCM)
+	if err != nil {
+		return 0, err
+	}
+	d.pcmResampler.Load(d.scratchPCM[:n*channels])
+	return d.pcmResampler.Emit(pcm), nil
+}
@@ -314,10 +314,39 @@ func (d *DREDDecoder) Process(src, dst *DRED) error {
 
 // DecodeDRED decodes a processed standalone DRED payload into pcm using the
 // receiver Decoder state as the concealment context.
+//
+// With DecoderConfig.PCMSampleRate set, dredOffsetSamples and frameSizeSamples
+// are codec-rate (SampleRate) counts and pcm receives the resampled frame.
 func (d *Decoder) DecodeDRED(dred *DRED, dredOffsetSamples int, pcm []float32, frameSizeSamples int) (int, error) {
+	if d.pcmResampler != nil {
+		if err := d.decodeResampledDRED(dred, dredOffsetSamples, len(pcm), frameSizeSamples); err != nil {
+			return 0, err
+		}
+		return d.pcmResampler.Emit(pcm), nil
+	}
 	return d.decodeExplicitDREDFloat(dred, dredOffsetSamples, pcm, frameSizeSamples)
 }
 
+// decodeResampledDRED decodes a DRED frame at the codec rate into
+// d.scratchPCM and loads it into the PCM resampler, after checking that the
+// resampled frame fits in pcmLen interleaved samples.
+func (d *Decoder) decodeResampledDRED(dred *DRED, dredOffsetSamples, pcmLen, frameSizeSamples int) error {
+	if frameSizeSamples <= 0 {
+		return ErrInvalidArgument
+	}
+	channels := int(d.channels)
+	if d.pcmResampler.OutputLen(frameSizeSamples)*channels > pcmLen {
+		return ErrBufferTooSmall
+	}
+	d.ensureScratchPCM(frameSizeSamples * channels)
+	n, err := d.decodeExplicitDREDFloat(dred, dredOffsetSamples, d.scratchPCM, frameSizeSamples)
+	if err != nil {
+		return err
+	}
+	d.pcmResampler.Load(d.scratchPCM[:n*channels])
+	return nil
+}
+
 // DecodeDREDInt24 decodes a processed standalone DRED payload into 24-bit PCM
 // samples stored in int32, using the receiver Decoder state as the concealment
 // context. Each element carries a signed 24-bit value in the range
@@ -328,6 +357,12 @@ func (d *Decoder) DecodeDRED(dred *DRED, dredOffsetSamples int, pcm []float32, f
 // pcm must hold at least frameSizeSamples*channels elements.
 // Returns the number of samples per channel decoded, or an error.
 func (d *Decoder) DecodeDREDInt24(dred *DRED, dredOffsetSamples int, pcm []int32, frameSizeSamples int) (int, error) {
+	if d.pcmResampler != nil {
+		if err := d.decodeResampledDRED(dred, dredOffsetSamples, len(pcm), frameSizeSamples); err != nil {
+			return 0, err
+		}
+		return d.emitResampledInt24(pcm), nil
+	}
 	if frameSizeSamples <= 0 {
 		return 0, ErrInvalidArgument
 	}
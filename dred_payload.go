@@ -126,6 +126,16 @@ func findDREDPayload(packet []byte) (payload []byte, frameOffset int, ok bool, e
 	if err != nil {
 		return nil, 0, false, err
 	}
+	return findDREDPayloadInPadding(toc, paddingFrameCount, padding)
+}
+
+// findDREDPayloadInView is findDREDPayload for a packet the decoder has
+// already parsed.
+func findDREDPayloadInView(view *PacketView) (payload []byte, frameOffset int, ok bool, err error) {
+	return findDREDPayloadInPadding(view.TOC(), view.FrameCount(), view.Padding())
+}
+
+func findDREDPayloadInPadding(toc TOC, paddingFrameCount int, padding []byte) (payload []byte, frameOffset int, ok bool, err error) {
 	if len(padding) == 0 || paddingFrameCount <= 0 {
 		return nil, 0, false, nil
 	}
@@ -2,6 +2,8 @@ package gopus
 
 const maxPacketBytesPerStream = 4000
 
+// copyEncodedPacket places packet at the start of data and returns its length.
+// A packet that was already assembled in place in data is not copied.
 func copyEncodedPacket(packet, data []byte) (int, error) {
 	if packet == nil {
 		return 0, nil
@@ -9,6 +11,9 @@ func copyEncodedPacket(packet, data []byte) (int, error) {
 	if len(packet) > len(data) {
 		return 0, ErrBufferTooSmall
 	}
+	if len(packet) > 0 && &packet[0] == &data[0] {
+		return len(packet), nil
+	}
 	copy(data, packet)
 	return len(packet), nil
 }
@@ -101,6 +101,13 @@ type EncoderConfig struct {
 	Channels int
 	// Application hints the encoder for optimization.
 	Application Application
+	// PCMSampleRate, when non-zero and different from SampleRate, is the rate
+	// of the PCM passed to Encode (8000-192000 Hz, e.g. 44100). A polyphase
+	// resampler converts each frame to SampleRate as it is loaded, adding
+	// about 0.7 ms of latency at 48 kHz. Frames are then sized in
+	// PCMSampleRate samples and must map to a whole codec frame: at 44.1 kHz,
+	// 441, 882, 1764 or 2646 samples (10, 20, 40 or 60 ms) per channel.
+	PCMSampleRate int
 }
 
 // Encoder encodes PCM audio samples into Opus packets.
@@ -131,6 +138,7 @@ type Encoder struct {
 	scratchPCM32 []float32 // int16 to float32 conversion buffer
 	dnnBlob      *dnnblob.Blob
 	encoderHD96kFields
+	encoderPCMResampleFields
 }
 
 // NewEncoder creates a new Opus encoder.
@@ -146,6 +154,9 @@ func NewEncoder(cfg EncoderConfig) (*Encoder, error) {
 	if !validApplication(cfg.Application) {
 		return nil, ErrInvalidApplication
 	}
+	if !validPCMSampleRate(cfg.PCMSampleRate, cfg.SampleRate) {
+		return nil, ErrInvalidSampleRate
+	}
 
 	// Under gopus_qext, 96 kHz requests route through the 48 kHz internal
 	// pipeline with 2:1 decimation at the input boundary.
@@ -181,5 +192,12 @@ func NewEncoder(cfg EncoderConfig) (*Encoder, error) {
 		init96kEncoder(enc)
 	}
 
+	r, err := newPCMResampler(cfg.PCMSampleRate, cfg.SampleRate, cfg.Channels, maxSamples/cfg.Channels*cfg.PCMSampleRate/cfg.SampleRate+1)
+	if err != nil {
+		return nil, err
+	}
+	enc.pcmResampler = r
+	enc.pcmSampleRate = int32(cfg.PCMSampleRate)
+
 	return enc, nil
 }
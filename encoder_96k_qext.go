@@ -68,13 +68,7 @@ func (e *Encoder) checkAndDownsample96k(pcm []float32) ([]float32, int, error) {
 
 	// Decimate 2:1: average each pair of input samples per channel.
 	// This matches a simple anti-aliased 2:1 downsample.
-	for i := 0; i < frameSize48; i++ {
-		for c := 0; c < channels; c++ {
-			a := pcm[(2*i)*channels+c]
-			b := pcm[(2*i+1)*channels+c]
-			dst[i*channels+c] = (a + b) * 0.5
-		}
-	}
+	decimate2x(dst, pcm, channels)
 	return dst, frameSize48, nil
 }
 
@@ -158,6 +158,23 @@ func (e *Encoder) InDTX() bool {
 	return e.enc.InDTX()
 }
 
+// SetDTXFastPath enables the DTX silence fast path.
+//
+// With DTX enabled and the encoder already in DTX, a frame of digital silence
+// that will be suppressed anyway skips analysis and SILK/CELT coding and costs
+// little more than the silence check. The periodic refresh packets and the
+// first frame of activity are coded in full. The skipped frames do not advance
+// the codec memories, so the refresh and resume packets are not byte-identical
+// to libopus; the fast path is off by default.
+func (e *Encoder) SetDTXFastPath(enabled bool) {
+	e.enc.SetDTXFastPath(enabled)
+}
+
+// DTXFastPath reports whether the DTX silence fast path is enabled.
+func (e *Encoder) DTXFastPath() bool {
+	return e.enc.DTXFastPath()
+}
+
 // VADActivity returns the current VAD speech activity level in Q8 (0-255).
 func (e *Encoder) VADActivity() int {
 	return e.enc.GetVADActivity()
@@ -188,6 +205,15 @@ func (e *Encoder) SetFrameSize(samples int) error {
 	// At 96 kHz API rate, frame sizes are in 96 kHz samples (2x the 48 kHz size).
 	// Convert to the 48 kHz internal frame size before validation. At sub-48 kHz
 	// native rates the frame size is already in native (internal) samples.
+	// With a PCMSampleRate boundary, samples are PCM-rate and must map to a
+	// whole codec-rate frame.
+	if e.pcmResampler != nil {
+		scaled := samples * int(e.sampleRate)
+		if scaled%int(e.pcmSampleRate) != 0 {
+			return ErrInvalidFrameSize
+		}
+		samples = scaled / int(e.pcmSampleRate)
+	}
 	internal := samples
 	if e.is96kHz() {
 		internal = samples / 2
@@ -211,8 +237,14 @@ func (e *Encoder) internalSampleRate() int {
 }
 
 // FrameSize returns the current frame size in samples at the API sample rate.
-// At 96 kHz, this is 2x the 48 kHz internal frame size.
+// At 96 kHz, this is 2x the 48 kHz internal frame size. With
+// EncoderConfig.PCMSampleRate set it is in PCM-rate samples, rounded down when
+// the frame is not a whole number of them.
 func (e *Encoder) FrameSize() int {
+	if e.pcmResampler != nil {
+		n, _ := e.pcmFrameSize()
+		return n
+	}
 	return e.apiFrameSize()
 }
 
@@ -222,6 +254,9 @@ func (e *Encoder) Reset() {
 	// e.enc.Reset() sets the encoder's first-frame flag, so SetApplication's
 	// FirstFrameCoded() gate is released; no separate wrapper flag is needed.
 	e.enc.Reset()
+	if e.pcmResampler != nil {
+		e.pcmResampler.Reset()
+	}
 }
 
 // Channels returns the number of audio channels (1 or 2).
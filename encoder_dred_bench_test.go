@@ -0,0 +1,62 @@
+//go:build gopus_dred || gopus_osce
+
+package gopus
+
+import (
+	"fmt"
+	"math"
+	"testing"
+)
+
+// BenchmarkEncoderDREDOverhead measures the encoder cost of DRED per 20 ms
+// frame of 48 kHz stereo: the same encode with DRED off and at two DRED
+// depths. The difference to dred=off is the per-frame DRED overhead (16 kHz
+// conversion, LPCNet analysis, RDOVAE encode and latent coding).
+func BenchmarkEncoderDREDOverhead(b *testing.B) {
+	encoderBlob, err := probeLibopusEncoderNeuralModelBlob()
+	if err != nil {
+		b.Skipf("libopus encoder neural model helper unavailable: %v", err)
+	}
+	const frameSize, channels = 960, 2
+	pcm := make([][]float32, 50)
+	for f := range pcm {
+		pcm[f] = make([]float32, frameSize*channels)
+		for i := 0; i < frameSize; i++ {
+			tm := float64(f*frameSize+i) / 48000
+			pitch := 150 + 40*math.Sin(2*math.Pi*0.9*tm)
+			v := 0.3 * math.Sin(2*math.Pi*pitch*tm) * (0.6 + 0.4*math.Sin(2*math.Pi*4*tm))
+			pcm[f][2*i] = float32(v)
+			pcm[f][2*i+1] = float32(0.8 * v)
+		}
+	}
+	for _, duration := range []int{0, 10, 100} {
+		b.Run(fmt.Sprintf("dred=%dms", duration*10), func(b *testing.B) {
+			enc, err := NewEncoder(EncoderConfig{SampleRate: 48000, Channels: channels, Application: ApplicationVoIP})
+			if err != nil {
+				b.Fatalf("NewEncoder error: %v", err)
+			}
+			if err := enc.SetBitrate(64000); err != nil {
+				b.Fatalf("SetBitrate error: %v", err)
+			}
+			if duration > 0 {
+				if err := enc.SetPacketLoss(20); err != nil {
+					b.Fatalf("SetPacketLoss error: %v", err)
+				}
+				if err := enc.SetDNNBlob(encoderBlob); err != nil {
+					b.Fatalf("SetDNNBlob error: %v", err)
+				}
+				if err := enc.SetDREDDuration(duration); err != nil {
+					b.Fatalf("SetDREDDuration(%d) error: %v", duration, err)
+				}
+			}
+			packet := make([]byte, maxPacketBytesPerStream)
+			b.ReportAllocs()
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				if _, err := enc.Encode(pcm[i%len(pcm)], packet); err != nil {
+					b.Fatalf("Encode error: %v", err)
+				}
+			}
+		})
+	}
+}
@@ -11,6 +11,18 @@ package gopus
 //
 // Buffer sizing: 4000 bytes is sufficient for any Opus packet.
 func (e *Encoder) Encode(pcm []float32, data []byte) (int, error) {
+	if e.pcmResampler != nil {
+		if err := e.checkResampledFrame(len(pcm), data); err != nil {
+			return 0, err
+		}
+		e.pcmResampler.Load(pcm)
+		return e.encodeResampled(data)
+	}
+	return e.encodeFloat32(pcm, data)
+}
+
+// encodeFloat32 encodes one frame of float32 PCM at the codec sample rate.
+func (e *Encoder) encodeFloat32(pcm []float32, data []byte) (int, error) {
 	if e.is96kHz() {
 		return e.encode96k(pcm, data)
 	}
@@ -29,7 +41,7 @@ func (e *Encoder) Encode(pcm []float32, data []byte) (int, error) {
 	}
 	inputSamples := frameSize * channels
 
-	packet, err := e.enc.EncodeFloat32WithAnalysisMaxBytes(pcm[:inputSamples], frameSize, pcm, len(data))
+	packet, err := e.enc.EncodeFloat32WithAnalysisInto(pcm[:inputSamples], frameSize, pcm, len(data), data)
 	if err != nil {
 		return 0, err
 	}
@@ -60,7 +72,7 @@ func (e *Encoder) encode96k(pcm []float32, data []byte) (int, error) {
 	}
 	inputSamples := frameSize * int(e.channels)
 
-	packet, err := e.enc.EncodeFloat32WithAnalysisMaxBytes(pcm48[:inputSamples], frameSize, pcm48, len(data))
+	packet, err := e.enc.EncodeFloat32WithAnalysisInto(pcm48[:inputSamples], frameSize, pcm48, len(data), data)
 	if err != nil {
 		return 0, err
 	}
@@ -77,15 +89,20 @@ func (e *Encoder) encode96k(pcm []float32, data []byte) (int, error) {
 //
 // The samples are converted from int16 by dividing by 32768.
 func (e *Encoder) EncodeInt16(pcm []int16, data []byte) (int, error) {
+	if e.pcmResampler != nil {
+		if err := e.checkResampledFrame(len(pcm), data); err != nil {
+			return 0, err
+		}
+		e.pcmResampler.LoadInt16(pcm)
+		return e.encodeResampled(data)
+	}
 	expected := e.apiFrameSize() * int(e.channels)
 	if len(pcm) != expected {
 		return 0, ErrInvalidFrameSize
 	}
 
 	pcm32 := e.scratchPCM32[:len(pcm)]
-	for i, v := range pcm {
-		pcm32[i] = float32(v) / 32768.0
-	}
+	convertInt16ToFloat32(pcm32, pcm)
 	return e.Encode(pcm32, data)
 }
 
@@ -101,6 +118,13 @@ func (e *Encoder) EncodeInt16(pcm []int16, data []byte) (int, error) {
 // containers with numeric range [-8388608, 8388607]. Left-shifted 24-in-32
 // input will be mis-scaled.
 func (e *Encoder) EncodeInt24(pcm []int32, data []byte) (int, error) {
+	if e.pcmResampler != nil {
+		if err := e.checkResampledFrame(len(pcm), data); err != nil {
+			return 0, err
+		}
+		e.pcmResampler.LoadInt24(pcm)
+		return e.encodeResampled(data)
+	}
 	channels := int(e.channels)
 	expected := e.apiFrameSize() * channels
 	if len(pcm) != expected {
@@ -111,9 +135,7 @@ func (e *Encoder) EncodeInt24(pcm []int32, data []byte) (int, error) {
 	}
 
 	pcm32 := e.scratchPCM32[:len(pcm)]
-	for i, v := range pcm {
-		pcm32[i] = float32(v) / 8388608.0
-	}
+	convertInt24ToFloat32(pcm32, pcm)
 
 	if e.is96kHz() {
 		return e.encode96k(pcm32, data)
@@ -126,7 +148,7 @@ func (e *Encoder) EncodeInt24(pcm []int32, data []byte) (int, error) {
 	}
 	inputSamples := frameSize * channels
 
-	packet, err := e.enc.EncodeFloat32WithAnalysisMaxBytes(pcm32[:inputSamples], frameSize, pcm32, len(data))
+	packet, err := e.enc.EncodeFloat32WithAnalysisInto(pcm32[:inputSamples], frameSize, pcm32, len(data), data)
 	if err != nil {
 		return 0, err
 	}
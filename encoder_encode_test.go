@@ -1,6 +1,7 @@
 package gopus
 
 import (
+	"bytes"
 	"fmt"
 	"math"
 	"testing"
@@ -380,3 +381,50 @@ func TestEncoder_Lookahead(t *testing.T) {
 		assertLookaheadUpdatesBeforeEncode(t, enc.Lookahead, enc.SetApplication)
 	})
 }
+
+func TestEncoder_Encode_AssemblesPacketInPlace(t *testing.T) {
+	for _, frameSize := range []int{960, 2880} {
+		t.Run(fmt.Sprintf("frame=%d", frameSize), func(t *testing.T) {
+			newEnc := func() *Encoder {
+				enc, err := NewEncoder(EncoderConfig{SampleRate: 48000, Channels: 2, Application: ApplicationAudio})
+				if err != nil {
+					t.Fatalf("NewEncoder error: %v", err)
+				}
+				if err := enc.SetFrameSize(frameSize); err != nil {
+					t.Fatalf("SetFrameSize error: %v", err)
+				}
+				if err := enc.SetBitrate(256000); err != nil {
+					t.Fatalf("SetBitrate error: %v", err)
+				}
+				return enc
+			}
+			inPlace, owned := newEnc(), newEnc()
+
+			// Long packets grow the internal packet buffer past the 4000-byte
+			// budget on the first frame; a slightly larger caller buffer then
+			// takes over as the assembly target from the second frame on.
+			const maxDataBytes = 4000
+			pcm := make([]float32, frameSize*2)
+			data := make([]byte, 4096)
+			for frame := range 6 {
+				for i := range pcm {
+					pcm[i] = float32(0.4 * math.Sin(float64(frame*frameSize+i)*0.031))
+				}
+				packet, err := inPlace.enc.EncodeFloat32WithAnalysisInto(pcm, frameSize, pcm, maxDataBytes, data)
+				if err != nil {
+					t.Fatalf("frame %d: EncodeFloat32WithAnalysisInto error: %v", frame, err)
+				}
+				if frame > 0 && (len(packet) == 0 || &packet[0] != &data[0]) {
+					t.Fatalf("frame %d: packet was not assembled in the caller buffer", frame)
+				}
+				want, err := owned.enc.EncodeFloat32WithAnalysisMaxBytes(pcm, frameSize, pcm, maxDataBytes)
+				if err != nil {
+					t.Fatalf("frame %d: EncodeFloat32WithAnalysisMaxBytes error: %v", frame, err)
+				}
+				if !bytes.Equal(packet, want) {
+					t.Fatalf("frame %d: in-place packet differs (%d vs %d bytes)", frame, len(packet), len(want))
+				}
+			}
+		})
+	}
+}
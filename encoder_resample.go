@@ -0,0 +1,52 @@
+package gopus
+
+import "github.com/thesyncim/gopus/internal/silk"
+
+// encoderPCMResampleFields holds the arbitrary-rate input stage selected by
+// EncoderConfig.PCMSampleRate. Caller PCM at pcmSampleRate is loaded into
+// pcmResampler and emitted at the codec rate straight into scratchPCM32, the
+// buffer the encode path reads.
+type encoderPCMResampleFields struct {
+	pcmResampler  *silk.PolyphaseResampler
+	pcmSampleRate int32
+}
+
+// pcmFrameSize returns the current frame size in PCM-rate samples per channel
+// and whether it is a whole number of them. 2.5 and 5 ms frames at 44.1 kHz,
+// for example, are not.
+func (e *Encoder) pcmFrameSize() (int, bool) {
+	n := e.apiFrameSize() * int(e.pcmSampleRate)
+	return n / int(e.sampleRate), n%int(e.sampleRate) == 0
+}
+
+// checkResampledFrame validates a PCM-rate frame of n interleaved samples and
+// the output buffer before the caller loads the frame into the resampler.
+func (e *Encoder) checkResampledFrame(n int, data []byte) error {
+	frameSize, exact := e.pcmFrameSize()
+	if !exact || n != frameSize*int(e.channels) {
+		return ErrInvalidFrameSize
+	}
+	if len(data) == 0 {
+		return ErrBufferTooSmall
+	}
+	return nil
+}
+
+// encodeResampled emits the codec-rate frame for the PCM just loaded into the
+// resampler and encodes it. The frame length maps exactly onto the codec
+// frame, so the resampler phase returns to the same point every frame and
+// emits exactly apiFrameSize samples.
+func (e *Encoder) encodeResampled(data []byte) (int, error) {
+	pcm := e.scratchPCM32[:e.apiFrameSize()*int(e.channels)]
+	e.pcmResampler.Emit(pcm)
+	return e.encodeFloat32(pcm, data)
+}
+
+// PCMSampleRate returns the sample rate of the PCM accepted from the caller:
+// EncoderConfig.PCMSampleRate when set, otherwise SampleRate.
+func (e *Encoder) PCMSampleRate() int {
+	if e.pcmResampler != nil {
+		return int(e.pcmSampleRate)
+	}
+	return e.SampleRate()
+}
@@ -98,6 +98,10 @@ var (
 	// ErrNilPacketSink indicates a nil PacketSink was supplied to NewWriter.
 	ErrNilPacketSink = errors.New("gopus: nil packet sink")
 
+	// ErrNotSeekable indicates Reader.SeekSample was called on a Reader whose
+	// PacketReader does not implement PacketSeeker.
+	ErrNotSeekable = errors.New("gopus: packet source is not seekable")
+
 	// ErrInvalidGain indicates an invalid decoder gain value.
 	// Valid range is -32768 to 32767 (Q8 dB).
 	ErrInvalidGain = errors.New("gopus: invalid gain (must be -32768 to 32767)")
@@ -0,0 +1,21 @@
+//go:build amd64 && !purego
+
+package celt
+
+import "github.com/thesyncim/gopus/internal/cpufeat"
+
+// celtAbsSumUsesAVX runs the whole blocks of absSumSig (8 accumulators) and
+// l1MetricNorm (16 accumulators) through AVX. Each YMM lane is one of the
+// scalar accumulators and takes the same elements in the same order, so the
+// sums are bit-identical to the scalar loops (TestAbsSumBlocksAVXBitExact).
+var celtAbsSumUsesAVX = cpufeat.AMD64.HasAVX2
+
+// absSumBlocks8AVX adds |x[8b+k]| into acc[k] for b < blocks.
+//
+//go:noescape
+func absSumBlocks8AVX(x []float32, blocks int, acc *[8]float32)
+
+// absSumBlocks16AVX adds |x[16b+k]| into acc[k] for b < blocks.
+//
+//go:noescape
+func absSumBlocks16AVX(x []float32, blocks int, acc *[16]float32)
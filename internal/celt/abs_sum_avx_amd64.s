@@ -0,0 +1,57 @@
+//go:build amd64 && !purego
+
+#include "textflag.h"
+
+// func absSumBlocks8AVX(x []float32, blocks int, acc *[8]float32)
+TEXT ·absSumBlocks8AVX(SB), NOSPLIT, $0-40
+	MOVQ x_base+0(FP), SI
+	MOVQ blocks+24(FP), CX
+	MOVQ acc+32(FP), DI
+
+	VMOVUPS  (DI), Y0
+	VPCMPEQD Y15, Y15, Y15
+	VPSRLD   $1, Y15, Y15 // 0x7fffffff: clear the sign bit
+
+	TESTQ CX, CX
+	JLE   abs8_store
+
+abs8_loop:
+	VANDPS (SI), Y15, Y1
+	VADDPS Y1, Y0, Y0
+	ADDQ   $32, SI
+	DECQ   CX
+	JNZ    abs8_loop
+
+abs8_store:
+	VMOVUPS Y0, (DI)
+	VZEROUPPER
+	RET
+
+// func absSumBlocks16AVX(x []float32, blocks int, acc *[16]float32)
+TEXT ·absSumBlocks16AVX(SB), NOSPLIT, $0-40
+	MOVQ x_base+0(FP), SI
+	MOVQ blocks+24(FP), CX
+	MOVQ acc+32(FP), DI
+
+	VMOVUPS  (DI), Y0
+	VMOVUPS  32(DI), Y1
+	VPCMPEQD Y15, Y15, Y15
+	VPSRLD   $1, Y15, Y15
+
+	TESTQ CX, CX
+	JLE   abs16_store
+
+abs16_loop:
+	VANDPS (SI), Y15, Y2
+	VANDPS 32(SI), Y15, Y3
+	VADDPS Y2, Y0, Y0
+	VADDPS Y3, Y1, Y1
+	ADDQ   $64, SI
+	DECQ   CX
+	JNZ    abs16_loop
+
+abs16_store:
+	VMOVUPS Y0, (DI)
+	VMOVUPS Y1, 32(DI)
+	VZEROUPPER
+	RET
@@ -0,0 +1,28 @@
+//go:build !amd64 || purego
+
+package celt
+
+// celtAbsSumUsesAVX is false off amd64; the scalar accumulator loops run.
+const celtAbsSumUsesAVX = false
+
+// absSumBlocks8AVX is never called off amd64 (guarded by celtAbsSumUsesAVX);
+// the stub mirrors the per-lane accumulation.
+func absSumBlocks8AVX(x []float32, blocks int, acc *[8]float32) {
+	for i, v := range x[:8*blocks] {
+		if v < 0 {
+			v = -v
+		}
+		acc[i&7] += v
+	}
+}
+
+// absSumBlocks16AVX is never called off amd64 (guarded by celtAbsSumUsesAVX);
+// the stub mirrors the per-lane accumulation.
+func absSumBlocks16AVX(x []float32, blocks int, acc *[16]float32) {
+	for i, v := range x[:16*blocks] {
+		if v < 0 {
+			v = -v
+		}
+		acc[i&15] += v
+	}
+}
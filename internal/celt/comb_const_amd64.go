@@ -0,0 +1,17 @@
+//go:build amd64 && !purego
+
+package celt
+
+// combNoFMAUsesSIMD enables the SSE constant-gain comb body used by the HD96k
+// comb filters. amd64 never contracts, so the separate multiplies and adds
+// per lane match the noFMA32Mul scalar tails bit-for-bit
+// (TestCombFilterConstNoFMABitExact).
+const combNoFMAUsesSIMD = true
+
+// combFilterConstNoFMABlocks runs blocks*4 steps of the constant-gain comb
+// body with every product rounded before its add. delay follows the
+// combFilterConstNeon layout: delay[i] pairs dst[i] after the four leading
+// taps.
+//
+//go:noescape
+func combFilterConstNoFMABlocks(dst, delay []float32, g10, g11, g12 float32, blocks int)
@@ -0,0 +1,53 @@
+//go:build amd64 && !purego
+
+#include "textflag.h"
+
+// func combFilterConstNoFMABlocks(dst, delay []float32, g10, g11, g12 float32, blocks int)
+//
+// Per output i (delay starting at &delay[i-4] relative to dst[i]):
+//
+//	dst[i] = round(round(round(dst[i] + round(g10*delay[i-2]))
+//	         + round(g11*(delay[i-1]+delay[i-3])))
+//	         + round(g12*(delay[i]+delay[i-4])))
+//
+// The shifted tap vectors are unaligned loads at 4-byte offsets. The comb
+// period is at least combFilterMinPeriod, so a 4-wide block never reads a
+// lane stored by the same block.
+TEXT ·combFilterConstNoFMABlocks(SB), NOSPLIT, $0-72
+	MOVQ   dst_base+0(FP), DI
+	MOVQ   delay_base+24(FP), SI
+	MOVSS  g10+48(FP), X8
+	SHUFPS $0x00, X8, X8
+	MOVSS  g11+52(FP), X9
+	SHUFPS $0x00, X9, X9
+	MOVSS  g12+56(FP), X10
+	SHUFPS $0x00, X10, X10
+	MOVQ   blocks+64(FP), CX
+
+	TESTQ CX, CX
+	JLE   comb_done
+
+comb_loop:
+	MOVUPS 4(SI), X0  // delay[i-3..i]   (minus1)
+	MOVUPS 12(SI), X1 // delay[i-1..i+2] (plus1)
+	ADDPS  X0, X1
+	MOVUPS (SI), X2   // delay[i-4..i-1] (minus2)
+	MOVUPS 16(SI), X3 // delay[i..i+3]   (plus2)
+	ADDPS  X2, X3
+	MOVUPS 8(SI), X4  // delay[i-2..i+1] (center)
+	MULPS  X8, X4
+	MOVUPS (DI), X5
+	ADDPS  X4, X5
+	MULPS  X9, X1
+	ADDPS  X1, X5
+	MULPS  X10, X3
+	ADDPS  X3, X5
+	MOVUPS X5, (DI)
+
+	ADDQ $16, SI
+	ADDQ $16, DI
+	DECQ CX
+	JNZ  comb_loop
+
+comb_done:
+	RET
@@ -10,3 +10,10 @@ const combUsesNeon = true
 
 //go:noescape
 func combFilterConstNeon(dst, delay []float32, g10, g11, g12 float32, blocks int)
+
+// combNoFMAUsesSIMD enables the vectorized non-contracted comb body used by
+// the HD96k comb filters.
+const combNoFMAUsesSIMD = true
+
+//go:noescape
+func combFilterConstNoFMABlocks(dst, delay []float32, g10, g11, g12 float32, blocks int)
@@ -56,3 +56,52 @@ comb_loop:
 
 comb_done:
 	RET
+
+// func combFilterConstNoFMABlocks(dst, delay []float32, g10, g11, g12 float32, blocks int)
+//
+// combFilterConstNeon without contraction: every product rounds on its own
+// before its add (FMUL then FADD), matching the noFMA32Mul comb tails of the
+// HD96k postfilter and prefilter bit-for-bit on every target.
+TEXT ·combFilterConstNoFMABlocks(SB), NOSPLIT, $0-72
+	MOVD  dst_base+0(FP), R0
+	MOVD  delay_base+24(FP), R1
+	FMOVS g10+48(FP), F16
+	FMOVS g11+52(FP), F17
+	FMOVS g12+56(FP), F18
+	MOVD  blocks+64(FP), R2
+
+	CBZ R2, nofma_done
+
+	VDUP V16.S[0], V16.S4
+	VDUP V17.S[0], V17.S4
+	VDUP V18.S[0], V18.S4
+
+	VLD1.P 16(R1), [V0.S4]
+
+nofma_loop:
+	VLD1 (R1), [V1.S4] // delay[i..i+3]
+	ADD  $16, R1
+
+	VEXT $4, V1.B16, V0.B16, V2.B16  // delay[i-3..i]   (minus1)
+	VEXT $8, V1.B16, V0.B16, V3.B16  // delay[i-2..i+1] (center)
+	VEXT $12, V1.B16, V0.B16, V4.B16 // delay[i-1..i+2] (plus1)
+
+	WORD $0x4E22D485 // FADD V5.4S, V4.4S, V2.4S (plus1+minus1)
+	WORD $0x4E20D426 // FADD V6.4S, V1.4S, V0.4S (plus2+minus2)
+
+	VLD1 (R0), [V7.S4]
+	WORD $0x6E30DC63 // FMUL V3.4S, V3.4S, V16.4S
+	WORD $0x4E23D4E7 // FADD V7.4S, V7.4S, V3.4S
+	WORD $0x6E31DCA5 // FMUL V5.4S, V5.4S, V17.4S
+	WORD $0x4E25D4E7 // FADD V7.4S, V7.4S, V5.4S
+	WORD $0x6E32DCC6 // FMUL V6.4S, V6.4S, V18.4S
+	WORD $0x4E26D4E7 // FADD V7.4S, V7.4S, V6.4S
+	VST1.P [V7.S4], 16(R0)
+
+	VMOV V1.B16, V0.B16
+
+	SUBS $1, R2
+	BNE  nofma_loop
+
+nofma_done:
+	RET
@@ -0,0 +1,19 @@
+//go:build (!amd64 && !arm64) || purego
+
+package celt
+
+// combNoFMAUsesSIMD is false on the generic and purego builds; the HD96k comb
+// tails keep their scalar loops there.
+const combNoFMAUsesSIMD = false
+
+// combFilterConstNoFMABlocks is never called without SIMD (guarded by
+// combNoFMAUsesSIMD); the stub keeps the package building on all targets.
+func combFilterConstNoFMABlocks(dst, delay []float32, g10, g11, g12 float32, blocks int) {
+	for j := 0; j < 4*blocks; j++ {
+		t := dst[j]
+		t += noFMA32Mul(g10, delay[j+2])
+		t += noFMA32Mul(g11, delay[j+3]+delay[j+1])
+		t += noFMA32Mul(g12, delay[j+4]+delay[j])
+		dst[j] = t
+	}
+}
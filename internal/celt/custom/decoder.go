@@ -69,12 +69,16 @@ func NewDecoder(mode *CustomMode, channels int) (*CustomDecoder, error) {
 	// Non-standard modes OUTSIDE that family (e.g. 48000/640, NbEBands=19) have a
 	// genuinely custom band layout. They drive the same overlap/scale/de-emphasis
 	// machinery PLUS the per-mode band tables (edges, widths, logN, allocVectors,
-	// pulse cache) installed via EnablePerModeTables.
+	// pulse cache), shared from the mode when NewMode built them.
 	if mode.InScaledBandFamily() {
 		dec.EnableScaledCustomMode(mode.Fs, mode.Overlap, mode.ShortMdctSize, mode.EffEBands, mode.Preemph)
 	} else if !mode.isStandard {
 		dec.EnableScaledCustomMode(mode.Fs, mode.Overlap, mode.ShortMdctSize, mode.EffEBands, mode.Preemph)
-		dec.EnablePerModeTables(mode.NbEBands, mode.ShortMdctSize, mode.EBands, mode.LogN, mode.AllocVectors, mode.CacheIndex, mode.CacheBits, mode.CacheCaps)
+		if mode.tables != nil {
+			dec.UseModeTables(mode.tables)
+		} else {
+			dec.EnablePerModeTables(mode.NbEBands, mode.ShortMdctSize, mode.EBands, mode.LogN, mode.AllocVectors, mode.CacheIndex, mode.CacheBits, mode.CacheCaps)
+		}
 	}
 	return cd, nil
 }
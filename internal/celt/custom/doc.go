@@ -12,6 +12,8 @@
 // This package mirrors the libopus opus_custom.h API:
 //
 //	NewMode(Fs, frameSize int) (*CustomMode, error)
+//	AcquireMode(Fs, frameSize int) (*CustomMode, error) // shared, ref-counted
+//	mode.Release()
 //	NewEncoder(mode *CustomMode, channels int) (*CustomEncoder, error)
 //	NewDecoder(mode *CustomMode, channels int) (*CustomDecoder, error)
 //
@@ -103,13 +103,17 @@ func NewEncoder(mode *CustomMode, channels int) (*CustomEncoder, error) {
 	// Non-standard modes OUTSIDE that family (e.g. 48000/640, NbEBands=19) have a
 	// genuinely custom band layout. They drive the same overlap/scale/pre-emphasis
 	// machinery PLUS the per-mode band tables (edges, widths, logN, allocVectors,
-	// pulse cache) installed via EnablePerModeTables. This mirrors the symmetric
-	// decode wiring in NewDecoder.
+	// pulse cache), shared from the mode when NewMode built them. This mirrors
+	// the symmetric decode wiring in NewDecoder.
 	if mode.InScaledBandFamily() {
 		ce.enc.EnableScaledCustomMode(mode.Fs, mode.Overlap, mode.ShortMdctSize, mode.EffEBands, mode.Preemph)
 	} else if !mode.isStandard {
 		ce.enc.EnableScaledCustomMode(mode.Fs, mode.Overlap, mode.ShortMdctSize, mode.EffEBands, mode.Preemph)
-		ce.enc.EnablePerModeTables(mode.NbEBands, mode.ShortMdctSize, mode.EBands, mode.LogN, mode.AllocVectors, mode.CacheIndex, mode.CacheBits, mode.CacheCaps)
+		if mode.tables != nil {
+			ce.enc.UseModeTables(mode.tables)
+		} else {
+			ce.enc.EnablePerModeTables(mode.NbEBands, mode.ShortMdctSize, mode.EBands, mode.LogN, mode.AllocVectors, mode.CacheIndex, mode.CacheBits, mode.CacheCaps)
+		}
 	}
 	return ce, nil
 }
@@ -97,7 +97,9 @@ const maxBands5ms = 21
 //
 // It mirrors libopus CELTMode as exposed through opus_custom.h, but is a pure
 // Go value rather than an opaque pointer. Callers must keep the mode alive for
-// as long as any encoder or decoder created from it is in use.
+// as long as any encoder or decoder created from it is in use, and should
+// Release it afterwards. AcquireMode hands out one shared, read-only mode per
+// (Fs, frame_size) instead of building a new one.
 //
 // Reference: libopus celt/modes.h CELTMode, celt/modes.c opus_custom_mode_create().
 type CustomMode struct {
@@ -130,6 +132,17 @@ type CustomMode struct {
 	// modes (48 kHz, 120/240/480/960 samples). Standard modes can be encoded
 	// and decoded with byte-exact libopus parity using the existing celt package.
 	isStandard bool
+	// tables is the celt form of the per-mode band tables, built once here and
+	// shared by every encoder and decoder of a genuinely custom layout (nil for
+	// standard and scaled-family modes).
+	tables *celt.ModeTables
+	// retained is true while the mode holds a reference on the shared celt
+	// MDCT twiddles, FFT states and window for its sizes (see Release).
+	retained bool
+	// cached marks a mode handed out by AcquireMode; refs counts its holders.
+	// refs and retained are guarded by modeCache.mu.
+	cached bool
+	refs   int
 }
 
 // NewMode creates a CustomMode for the given sample rate and frame size.
@@ -244,6 +257,17 @@ func NewMode(fs, frameSize int) (*CustomMode, error) {
 	// Reference: libopus celt/rate.c compute_pulse_cache(mode, maxLM).
 	computePulseCache(mode)
 
+	// Non-standard modes run MDCT/FFT/window sizes without a static table.
+	// Build their celt-side tables once for every session of this mode; they
+	// are dropped again by Release (opus_custom_mode_destroy).
+	if !mode.isStandard && mode.nativeSupported() {
+		if !mode.InScaledBandFamily() {
+			mode.tables = celt.NewModeTables(mode.NbEBands, mode.ShortMdctSize, mode.EBands, mode.LogN, mode.AllocVectors, mode.CacheIndex, mode.CacheBits, mode.CacheCaps)
+		}
+		celt.RetainCustomTransforms(frameSize, maxLM, overlap)
+		mode.retained = true
+	}
+
 	return mode, nil
 }
 
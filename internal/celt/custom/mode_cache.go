@@ -0,0 +1,82 @@
+//go:build gopus_custom_modes
+
+package custom
+
+import (
+	"sync"
+
+	"github.com/thesyncim/gopus/internal/celt"
+)
+
+// modeKey identifies a CustomMode in the process-wide mode cache.
+type modeKey struct {
+	fs        int
+	frameSize int
+}
+
+// modeCache holds one shared CustomMode per (Fs, frame_size) for as long as
+// any AcquireMode holder keeps it. The mutex also guards the refs and retained
+// fields of every CustomMode.
+var modeCache struct {
+	mu    sync.Mutex
+	modes map[modeKey]*CustomMode
+}
+
+// AcquireMode returns the shared CustomMode for (fs, frameSize), creating it
+// with NewMode on first use. Every caller gets the same immutable mode, so its
+// band layout, logN, allocation vectors, pulse cache, MDCT twiddles and window
+// exist once per process however many encoders and decoders run on it. The
+// mode's fields must be treated as read-only.
+//
+// Each successful AcquireMode must be balanced by one Release; the tables are
+// freed when the last holder releases the mode. It is safe for concurrent use.
+func AcquireMode(fs, frameSize int) (*CustomMode, error) {
+	key := modeKey{fs: fs, frameSize: frameSize}
+	modeCache.mu.Lock()
+	defer modeCache.mu.Unlock()
+	if m := modeCache.modes[key]; m != nil {
+		m.refs++
+		return m, nil
+	}
+	m, err := NewMode(fs, frameSize)
+	if err != nil {
+		return nil, err
+	}
+	m.cached = true
+	m.refs = 1
+	if modeCache.modes == nil {
+		modeCache.modes = make(map[modeKey]*CustomMode)
+	}
+	modeCache.modes[key] = m
+	return m, nil
+}
+
+// Release drops a reference on the mode, mirroring opus_custom_mode_destroy().
+// A mode from NewMode frees its shared transform tables at once; a mode from
+// AcquireMode frees them, and leaves the cache, when its last holder releases
+// it. Encoders and decoders still running on a freed mode keep working but
+// rebuild the transform tables per frame. Releasing a nil or already freed
+// mode is a no-op.
+//
+// Reference: libopus celt/modes.c opus_custom_mode_destroy().
+func (m *CustomMode) Release() {
+	if m == nil {
+		return
+	}
+	modeCache.mu.Lock()
+	defer modeCache.mu.Unlock()
+	if m.cached {
+		if m.refs <= 0 {
+			return
+		}
+		m.refs--
+		if m.refs > 0 {
+			return
+		}
+		delete(modeCache.modes, modeKey{fs: m.Fs, frameSize: m.FrameSize})
+	}
+	if m.retained {
+		celt.ReleaseCustomTransforms(m.FrameSize, m.MaxLM, m.Overlap)
+		m.retained = false
+	}
+}
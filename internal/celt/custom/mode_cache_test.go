@@ -0,0 +1,246 @@
+//go:build gopus_custom_modes
+
+package custom_test
+
+import (
+	"math"
+	"sync"
+	"testing"
+
+	"github.com/thesyncim/gopus/internal/celt/custom"
+)
+
+// runCustomStream encodes and decodes frames stereo frames of a two-tone
+// signal through a fresh encoder/decoder pair on mode.
+func runCustomStream(t *testing.T, mode *custom.CustomMode, frames int) ([][]byte, []float32) {
+	t.Helper()
+	enc, err := custom.NewEncoder(mode, 2)
+	if err != nil {
+		t.Fatalf("NewEncoder: %v", err)
+	}
+	dec, err := custom.NewDecoder(mode, 2)
+	if err != nil {
+		t.Fatalf("NewDecoder: %v", err)
+	}
+	n := mode.FrameSize
+	var packets [][]byte
+	var out []float32
+	for f := 0; f < frames; f++ {
+		pcm := make([]float32, 2*n)
+		for i := 0; i < n; i++ {
+			tm := float64(f*n+i) / float64(mode.Fs)
+			pcm[2*i] = float32(0.4 * math.Sin(2*math.Pi*330*tm))
+			pcm[2*i+1] = float32(0.3 * math.Sin(2*math.Pi*1250*tm))
+		}
+		pkt, err := enc.EncodeFloat(pcm, 120)
+		if err != nil {
+			t.Fatalf("frame %d EncodeFloat: %v", f, err)
+		}
+		pcmOut, err := dec.DecodeFloat(pkt, n)
+		if err != nil {
+			t.Fatalf("frame %d DecodeFloat: %v", f, err)
+		}
+		packets = append(packets, append([]byte(nil), pkt...))
+		out = append(out, pcmOut...)
+	}
+	return packets, out
+}
+
+// TestAcquireModeShared checks that AcquireMode hands out one mode per
+// (Fs, frame_size) until its last holder releases it.
+func TestAcquireModeShared(t *testing.T) {
+	a, err := custom.AcquireMode(48000, 640)
+	if err != nil {
+		t.Fatalf("AcquireMode: %v", err)
+	}
+	b, err := custom.AcquireMode(48000, 640)
+	if err != nil {
+		t.Fatalf("AcquireMode: %v", err)
+	}
+	if a != b {
+		t.Fatal("AcquireMode(48000, 640) returned two modes")
+	}
+	if c, err := custom.AcquireMode(24000, 480); err != nil || c == a {
+		t.Fatalf("AcquireMode(24000, 480) = %p, %v; want a distinct mode", c, err)
+	} else {
+		c.Release()
+	}
+	a.Release()
+	if c, _ := custom.AcquireMode(48000, 640); c != a {
+		t.Fatal("mode left the cache while still held")
+	} else {
+		c.Release()
+	}
+	b.Release()
+	b.Release() // already freed: no-op
+	c, err := custom.AcquireMode(48000, 640)
+	if err != nil {
+		t.Fatalf("AcquireMode: %v", err)
+	}
+	defer c.Release()
+	if c == a {
+		t.Fatal("released mode was handed out again")
+	}
+	if _, err := custom.AcquireMode(48000, 41); err != custom.ErrBadArg {
+		t.Fatalf("AcquireMode(48000, 41) err = %v, want ErrBadArg", err)
+	}
+}
+
+// TestAcquireModeMatchesPrivateTables checks that sessions on a shared mode
+// produce the same packets and PCM as sessions on a released private mode,
+// which rebuild their transform tables every frame.
+func TestAcquireModeMatchesPrivateTables(t *testing.T) {
+	for _, tc := range []struct{ fs, frameSize int }{
+		{48000, 960}, // standard
+		{24000, 480}, // scaled-band family
+		{48000, 640}, // custom band layout
+		{16000, 200},
+	} {
+		private, err := custom.NewMode(tc.fs, tc.frameSize)
+		if err != nil {
+			t.Fatalf("%d/%d NewMode: %v", tc.fs, tc.frameSize, err)
+		}
+		private.Release()
+		wantPkts, wantPCM := runCustomStream(t, private, 12)
+
+		shared, err := custom.AcquireMode(tc.fs, tc.frameSize)
+		if err != nil {
+			t.Fatalf("%d/%d AcquireMode: %v", tc.fs, tc.frameSize, err)
+		}
+		gotPkts, gotPCM := runCustomStream(t, shared, 12)
+		shared.Release()
+
+		for f := range wantPkts {
+			if string(gotPkts[f]) != string(wantPkts[f]) {
+				t.Fatalf("%d/%d frame %d: shared-mode packet differs", tc.fs, tc.frameSize, f)
+			}
+		}
+		for i := range wantPCM {
+			if math.Float32bits(gotPCM[i]) != math.Float32bits(wantPCM[i]) {
+				t.Fatalf("%d/%d sample %d: %v want %v", tc.fs, tc.frameSize, i, gotPCM[i], wantPCM[i])
+			}
+		}
+	}
+}
+
+// TestAcquireModeConcurrent runs sessions that acquire, use and release the
+// same modes from many goroutines; run with -race.
+func TestAcquireModeConcurrent(t *testing.T) {
+	var wg sync.WaitGroup
+	for g := 0; g < 16; g++ {
+		wg.Add(1)
+		go func(g int) {
+			defer wg.Done()
+			frameSize := []int{640, 400}[g%2]
+			for i := 0; i < 8; i++ {
+				mode, err := custom.AcquireMode(48000, frameSize)
+				if err != nil {
+					t.Errorf("AcquireMode: %v", err)
+					return
+				}
+				enc, err := custom.NewEncoder(mode, 1)
+				if err != nil {
+					t.Errorf("NewEncoder: %v", err)
+					return
+				}
+				dec, err := custom.NewDecoder(mode, 1)
+				if err != nil {
+					t.Errorf("NewDecoder: %v", err)
+					return
+				}
+				pkt, err := enc.EncodeFloat(generateSine(440, 48000, frameSize), 80)
+				if err != nil {
+					t.Errorf("EncodeFloat: %v", err)
+					return
+				}
+				if _, err := dec.DecodeFloat(pkt, frameSize); err != nil {
+					t.Errorf("DecodeFloat: %v", err)
+					return
+				}
+				mode.Release()
+			}
+		}(g)
+	}
+	wg.Wait()
+}
+
+// BenchmarkModeCreate compares building a private 48000/640 mode per session
+// with acquiring the shared one while another session keeps it alive.
+func BenchmarkModeCreate(b *testing.B) {
+	b.Run("new_mode", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			mode, err := custom.NewMode(48000, 640)
+			if err != nil {
+				b.Fatal(err)
+			}
+			mode.Release()
+		}
+	})
+	b.Run("acquire_shared", func(b *testing.B) {
+		held, err := custom.AcquireMode(48000, 640)
+		if err != nil {
+			b.Fatal(err)
+		}
+		defer held.Release()
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			mode, err := custom.AcquireMode(48000, 640)
+			if err != nil {
+				b.Fatal(err)
+			}
+			mode.Release()
+		}
+	})
+}
+
+// BenchmarkSessionMemory reports the bytes allocated per mono 48000/640
+// session (mode, encoder, decoder and one frame each way) with a private mode
+// per session and with the shared mode. B/op is the per-session footprint.
+func BenchmarkSessionMemory(b *testing.B) {
+	pcm := generateSine(440, 48000, 640)
+	session := func(b *testing.B, mode *custom.CustomMode) {
+		enc, err := custom.NewEncoder(mode, 1)
+		if err != nil {
+			b.Fatal(err)
+		}
+		dec, err := custom.NewDecoder(mode, 1)
+		if err != nil {
+			b.Fatal(err)
+		}
+		pkt, err := enc.EncodeFloat(pcm, 80)
+		if err != nil {
+			b.Fatal(err)
+		}
+		if _, err := dec.DecodeFloat(pkt, 640); err != nil {
+			b.Fatal(err)
+		}
+	}
+	b.Run("private_mode", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			mode, err := custom.NewMode(48000, 640)
+			if err != nil {
+				b.Fatal(err)
+			}
+			session(b, mode)
+			mode.Release()
+		}
+	})
+	b.Run("shared_mode", func(b *testing.B) {
+		held, err := custom.AcquireMode(48000, 640)
+		if err != nil {
+			b.Fatal(err)
+		}
+		defer held.Release()
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			mode, err := custom.AcquireMode(48000, 640)
+			if err != nil {
+				b.Fatal(err)
+			}
+			session(b, mode)
+			mode.Release()
+		}
+	})
+}
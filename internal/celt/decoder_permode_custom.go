@@ -0,0 +1,37 @@
+//go:build gopus_custom_modes
+
+package celt
+
+// ModeTables is an immutable, shareable set of per-mode band tables for a
+// non-standard Opus Custom layout (see perModeTables). One value built from a
+// mode can be installed on any number of encoders and decoders.
+type ModeTables struct {
+	pm *perModeTables
+}
+
+// NewModeTables converts the libopus-exact CELTMode members into a shareable
+// ModeTables. It returns nil when the band layout is empty. The arguments are
+// those of EnablePerModeTables; the cache slices are referenced, not copied.
+func NewModeTables(nbEBands, scaleBase int, eBands []int16, logN []int16, allocVectors []uint8, cacheIndex []int16, cacheBits, cacheCaps []uint8) *ModeTables {
+	pm := buildPerModeTables(nbEBands, scaleBase, eBands, logN, allocVectors, cacheIndex, cacheBits, cacheCaps)
+	if pm == nil {
+		return nil
+	}
+	return &ModeTables{pm: pm}
+}
+
+// UseModeTables installs shared per-mode tables on the decoder. It is the
+// sharing counterpart of EnablePerModeTables; a nil t is ignored.
+func (d *Decoder) UseModeTables(t *ModeTables) {
+	if t != nil {
+		d.perMode = t.pm
+	}
+}
+
+// UseModeTables installs shared per-mode tables on the encoder. It is the
+// sharing counterpart of EnablePerModeTables; a nil t is ignored.
+func (e *Encoder) UseModeTables(t *ModeTables) {
+	if t != nil {
+		e.perMode = t.pm
+	}
+}
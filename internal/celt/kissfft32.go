@@ -79,6 +79,12 @@ func getKissFFTState(nfft int) *kissFFTState {
 	case 480:
 		return kissFFTState480
 	default:
+		if st := hd96kKissFFTState(nfft); st != nil {
+			return st
+		}
+		if st := customKissFFTState(nfft); st != nil {
+			return st
+		}
 		// Keep uncommon/test-only sizes working without global mutable caches.
 		return newKissFFTState(nfft)
 	}
@@ -234,3 +234,21 @@ func TestKissFFT32_VsDft32(t *testing.T) {
 		})
 	}
 }
+
+// assertKissStateEqual checks that the shared nfft-point KISS-FFT state is
+// cached across calls and matches a freshly built state.
+func assertKissStateEqual(t *testing.T, nfft int) {
+	t.Helper()
+	st, fresh := getKissFFTState(nfft), newKissFFTState(nfft)
+	if st != getKissFFTState(nfft) {
+		t.Fatalf("nfft=%d state is rebuilt per call", nfft)
+	}
+	if len(st.w) != len(fresh.w) || len(st.bitrev) != len(fresh.bitrev) {
+		t.Fatalf("nfft=%d state shape differs", nfft)
+	}
+	for i := range fresh.w {
+		if st.w[i] != fresh.w[i] || st.bitrev[i] != fresh.bitrev[i] {
+			t.Fatalf("nfft=%d state differs at %d", nfft, i)
+		}
+	}
+}
@@ -47,6 +47,12 @@ func getMDCTTrigF32(n int) []float32 {
 	case 1920:
 		return mdctTrig1920F32Static[:]
 	default:
+		if trig := hd96kMDCTTrigF32(n); trig != nil {
+			return trig
+		}
+		if trig := customMDCTTrigF32(n); trig != nil {
+			return trig
+		}
 		return buildMDCTTrigF32(n)
 	}
 }
@@ -194,6 +200,18 @@ func imdctOverlapWithPrevScratchF32Output32[S ~float32](spectrum []float32, prev
 		if mdctUseFMALikeMixEnabled && limit > 0 {
 			imdctTDACWindowFMA32(outF32, outF32, windowF32, yp1, xp1, xp1, wp2, limit)
 		} else {
+			// Whole 4-step blocks go to the non-fused SSE kernel while the
+			// forward and backward write ranges stay disjoint.
+			if mdctUseTwiddleSSE && limit >= 4 && yp1+limit <= xp1-limit+1 {
+				blocks := limit >> 2
+				imdctTDACWindowSSE(outF32, outF32, windowF32, yp1, xp1, xp1, wp2, blocks)
+				done := 4 * blocks
+				limit -= done
+				yp1 += done
+				xp1 -= done
+				wp1 += done
+				wp2 -= done
+			}
 			for range limit {
 				x1 := outF32[xp1]
 				x2 := outF32[yp1]
@@ -255,6 +273,18 @@ func imdctInPlaceScratchF32Spectrum(spectrum []float32, out []float32, blockStar
 		if mdctUseFMALikeMixEnabled && limit > 0 {
 			imdctTDACWindowFMA32(out, buf, windowF32, yp1, xp1, xp1-start, wp2, limit)
 		} else {
+			// Whole 4-step blocks go to the non-fused SSE kernel while the
+			// forward and backward write ranges stay disjoint.
+			if mdctUseTwiddleSSE && limit >= 4 && yp1+limit <= xp1-limit+1 {
+				blocks := limit >> 2
+				imdctTDACWindowSSE(out, buf, windowF32, yp1, xp1, xp1-start, wp2, blocks)
+				done := 4 * blocks
+				limit -= done
+				yp1 += done
+				xp1 -= done
+				wp1 += done
+				wp2 -= done
+			}
 			for range limit {
 				bufIdx := xp1 - start
 				x1 := buf[bufIdx]
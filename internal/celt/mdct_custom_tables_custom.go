@@ -0,0 +1,155 @@
+//go:build gopus_custom_modes
+
+package celt
+
+import (
+	"sync"
+	"sync/atomic"
+)
+
+// Non-standard Opus Custom modes run MDCT lengths, KISS-FFT sizes and overlap
+// windows that have no static 48 kHz table, so the per-frame transforms would
+// rebuild them on every call. The custom plumbing retains them here while a
+// mode is alive: the tables are built once per size, shared by every encoder
+// and decoder of every live mode, and dropped when the last mode using a size
+// is released. Lookups are lock-free (an atomic snapshot of immutable maps) so
+// concurrent sessions never contend on the hot path.
+
+type customTransformTables struct {
+	trig   map[int][]float32
+	fft    map[int]*kissFFTState
+	window map[int][]float32
+}
+
+var customTransforms struct {
+	mu         sync.Mutex
+	trigRefs   map[int]int
+	fftRefs    map[int]int
+	windowRefs map[int]int
+	tables     atomic.Pointer[customTransformTables]
+}
+
+// customMDCTLengths returns the MDCT lengths (2*N) a mode with the given frame
+// size and maxLM runs: one per LM, from the short block up to the full frame.
+func customMDCTLengths(frameSize, maxLM int) []int {
+	lengths := make([]int, 0, maxLM+1)
+	for lm := 0; lm <= maxLM; lm++ {
+		if n := 2 * (frameSize >> lm); n > 0 {
+			lengths = append(lengths, n)
+		}
+	}
+	return lengths
+}
+
+// RetainCustomTransforms takes a reference on the shared MDCT twiddles,
+// KISS-FFT states and overlap window of a custom mode (frameSize, maxLM,
+// overlap), building any that are not yet live. Every call must be balanced by
+// one ReleaseCustomTransforms with the same arguments.
+func RetainCustomTransforms(frameSize, maxLM, overlap int) {
+	customTransforms.mu.Lock()
+	defer customTransforms.mu.Unlock()
+	cur := customTransforms.tables.Load()
+	next := cloneCustomTransformTables(cur)
+	if customTransforms.trigRefs == nil {
+		customTransforms.trigRefs = make(map[int]int)
+		customTransforms.fftRefs = make(map[int]int)
+		customTransforms.windowRefs = make(map[int]int)
+	}
+	for _, n := range customMDCTLengths(frameSize, maxLM) {
+		if customTransforms.trigRefs[n]++; customTransforms.trigRefs[n] == 1 {
+			next.trig[n] = buildMDCTTrigF32(n)
+		}
+		if customTransforms.fftRefs[n/4]++; customTransforms.fftRefs[n/4] == 1 {
+			next.fft[n/4] = newKissFFTState(n / 4)
+		}
+	}
+	if overlap > 0 {
+		if customTransforms.windowRefs[overlap]++; customTransforms.windowRefs[overlap] == 1 {
+			window := make([]float32, overlap)
+			for i := range window {
+				window[i] = VorbisWindow(i, overlap)
+			}
+			next.window[overlap] = window
+		}
+	}
+	customTransforms.tables.Store(next)
+}
+
+// ReleaseCustomTransforms drops a reference taken by RetainCustomTransforms.
+// Tables whose last reference goes away are unpublished; transforms that still
+// run at those sizes fall back to building them per call.
+func ReleaseCustomTransforms(frameSize, maxLM, overlap int) {
+	customTransforms.mu.Lock()
+	defer customTransforms.mu.Unlock()
+	next := cloneCustomTransformTables(customTransforms.tables.Load())
+	release := func(refs map[int]int, size int) bool {
+		if refs[size] <= 0 {
+			return false
+		}
+		refs[size]--
+		if refs[size] > 0 {
+			return false
+		}
+		delete(refs, size)
+		return true
+	}
+	for _, n := range customMDCTLengths(frameSize, maxLM) {
+		if release(customTransforms.trigRefs, n) {
+			delete(next.trig, n)
+		}
+		if release(customTransforms.fftRefs, n/4) {
+			delete(next.fft, n/4)
+		}
+	}
+	if overlap > 0 && release(customTransforms.windowRefs, overlap) {
+		delete(next.window, overlap)
+	}
+	customTransforms.tables.Store(next)
+}
+
+func cloneCustomTransformTables(cur *customTransformTables) *customTransformTables {
+	next := &customTransformTables{
+		trig:   make(map[int][]float32),
+		fft:    make(map[int]*kissFFTState),
+		window: make(map[int][]float32),
+	}
+	if cur != nil {
+		for k, v := range cur.trig {
+			next.trig[k] = v
+		}
+		for k, v := range cur.fft {
+			next.fft[k] = v
+		}
+		for k, v := range cur.window {
+			next.window[k] = v
+		}
+	}
+	return next
+}
+
+// customMDCTTrigF32 returns the retained twiddle segment for a custom MDCT
+// length, or nil when no live mode uses it.
+func customMDCTTrigF32(n int) []float32 {
+	if t := customTransforms.tables.Load(); t != nil {
+		return t.trig[n]
+	}
+	return nil
+}
+
+// customKissFFTState returns the retained KISS-FFT state for a custom FFT
+// length, or nil when no live mode uses it.
+func customKissFFTState(nfft int) *kissFFTState {
+	if t := customTransforms.tables.Load(); t != nil {
+		return t.fft[nfft]
+	}
+	return nil
+}
+
+// customWindowF32 returns the retained overlap window for a custom overlap,
+// or nil when no live mode uses it.
+func customWindowF32(overlap int) []float32 {
+	if t := customTransforms.tables.Load(); t != nil {
+		return t.window[overlap]
+	}
+	return nil
+}
@@ -0,0 +1,15 @@
+//go:build !gopus_custom_modes
+
+package celt
+
+func customMDCTTrigF32(int) []float32 {
+	return nil
+}
+
+func customKissFFTState(int) *kissFFTState {
+	return nil
+}
+
+func customWindowF32(int) []float32 {
+	return nil
+}
@@ -0,0 +1,55 @@
+//go:build gopus_custom_modes
+
+package celt
+
+import (
+	"math"
+	"testing"
+)
+
+// TestCustomTransformTablesMatchBuilt retains the transforms of a 48000/640
+// custom mode (maxLM 3, overlap 80) twice and checks that the shared tables
+// match freshly built ones, survive the first release and are unpublished by
+// the last.
+func TestCustomTransformTablesMatchBuilt(t *testing.T) {
+	const frameSize, maxLM, overlap = 640, 3, 80
+	lengths := []int{1280, 640, 320, 160}
+	RetainCustomTransforms(frameSize, maxLM, overlap)
+	RetainCustomTransforms(frameSize, maxLM, overlap)
+
+	for _, n := range lengths {
+		want, got := buildMDCTTrigF32(n), getMDCTTrigF32(n)
+		if len(got) != len(want) {
+			t.Fatalf("n=%d: len(trig) = %d, want %d", n, len(got), len(want))
+		}
+		for i := range want {
+			if math.Float32bits(got[i]) != math.Float32bits(want[i]) {
+				t.Fatalf("n=%d: trig[%d] = %v, want %v", n, i, got[i], want[i])
+			}
+		}
+		assertKissStateEqual(t, n/4)
+	}
+	window := GetWindowBufferF32(overlap)
+	for i, w := range window {
+		if v := VorbisWindow(i, overlap); math.Float32bits(w) != math.Float32bits(v) {
+			t.Fatalf("window[%d] = %v, want %v", i, w, v)
+		}
+	}
+	if &window[0] != &GetWindowBufferF32(overlap)[0] {
+		t.Fatal("overlap=80 window is rebuilt per call")
+	}
+
+	ReleaseCustomTransforms(frameSize, maxLM, overlap)
+	if customMDCTTrigF32(1280) == nil || customWindowF32(overlap) == nil {
+		t.Fatal("tables dropped while still retained")
+	}
+	ReleaseCustomTransforms(frameSize, maxLM, overlap)
+	for _, n := range lengths {
+		if customMDCTTrigF32(n) != nil || customKissFFTState(n/4) != nil {
+			t.Fatalf("n=%d: tables still published after the last release", n)
+		}
+	}
+	if customWindowF32(overlap) != nil {
+		t.Fatal("window still published after the last release")
+	}
+}
@@ -466,6 +466,22 @@ func mdctForwardOverlapF32Scratch(samples []float32, overlap int, coeffs []float
 				wp2 -= 2
 			}
 		} else {
+			// Leading windowed fold: whole 4-wide blocks go to the non-fused
+			// SSE kernel under the NEON fold's read bounds.
+			if lead := limit1 - i; mdctUseTwiddleSSE && lead >= 4 {
+				blocks := lead >> 2
+				done := blocks * 4
+				if xp2-n2-2*done+2 >= 0 && wp2-2*done+2 >= 0 &&
+					xp1+n2+2*done-1 < len(samples) && xp2+1 < len(samples) &&
+					wp1+2*done-1 < len(window) && wp2+1 < len(window) {
+					mdctFold1StoreSSE(fftStage, bitrev, samples, window, trig, i, n4, n2, xp1, xp2, wp1, wp2, blocks, preScale)
+					i += done
+					xp1 += 2 * done
+					xp2 -= 2 * done
+					wp1 += 2 * done
+					wp2 -= 2 * done
+				}
+			}
 			for ; i < limit1; i++ {
 				re := mdctMulAddMixEncode(float32(samples[xp1+n2]), float32(samples[xp2]), window[wp2], window[wp1])
 				im := mdctMulSubMixEncode(float32(samples[xp1]), float32(samples[xp2-n2]), window[wp1], window[wp2])
@@ -480,6 +496,18 @@ func mdctForwardOverlapF32Scratch(samples []float32, overlap int, coeffs []float
 
 			wp1 = 0
 			wp2 = overlap - 1
+			// Same blocked treatment as the NEON middle fold, with the
+			// non-fused SSE kernel and the same read bounds.
+			if mid := n4 - limit1 - i; mdctUseTwiddleSSE && mid >= 4 {
+				blocks := mid >> 2
+				done := blocks * 4
+				if xp2-2*done+2 >= 0 && xp2+1 < len(samples) && xp1+2*done-1 < len(samples) {
+					mdctMidFoldStoreSSE(fftStage, bitrev, samples, trig, i, n4, xp1, xp2, blocks, preScale)
+					i += done
+					xp1 += 2 * done
+					xp2 -= 2 * done
+				}
+			}
 			for ; i < n4-limit1; i++ {
 				re := float32(samples[xp2])
 				im := float32(samples[xp1])
@@ -490,6 +518,21 @@ func mdctForwardOverlapF32Scratch(samples []float32, overlap int, coeffs []float
 				xp2 -= 2
 			}
 
+			// Trailing windowed fold, same blocked SSE treatment.
+			if tail := n4 - i; mdctUseTwiddleSSE && tail >= 4 {
+				blocks := tail >> 2
+				done := blocks * 4
+				if xp2-2*done+2 >= 0 && wp2-2*done+2 >= 0 && xp1-n2 >= 0 &&
+					xp1+2*done-1 < len(samples) && xp2+n2+1 < len(samples) &&
+					wp1+2*done-1 < len(window) && wp2+1 < len(window) {
+					mdctFold3StoreSSE(fftStage, bitrev, samples, window, trig, i, n4, n2, xp1, xp2, wp1, wp2, blocks, preScale)
+					i += done
+					xp1 += 2 * done
+					xp2 -= 2 * done
+					wp1 += 2 * done
+					wp2 -= 2 * done
+				}
+			}
 			for ; i < n4; i++ {
 				re := mdctMulSubMixAlt(float32(samples[xp2]), float32(samples[xp1-n2]), window[wp2], window[wp1])
 				im := mdctMulAddMixEncode(float32(samples[xp1]), float32(samples[xp2+n2]), window[wp2], window[wp1])
@@ -587,13 +630,22 @@ func mdctForwardOverlapF32Scratch(samples []float32, overlap int, coeffs []float
 		hi := n2 - 1
 		i = 0
 		// Mirror 4-wide block pairs tile both coefficient ends contiguously;
-		// the NEON kernel runs them with the exact scalar op sequence
+		// the NEON and SSE kernels run them with the exact scalar op sequence
 		// (bit-identical per element), and the scalar loop finishes the
-		// n4%8 middle. QEXT moves the scale here, so that build keeps the
-		// scalar loop.
-		if mdctUsePostTwiddleNeon && !mdctQEXTScalePlacement {
+		// n4%8 middle. QEXT moves the scale here, so that build hands the
+		// kernels twiddles with the scale pre-applied; lengths without a
+		// cached scaled table keep the scalar loop.
+		postTrig := trig
+		if mdctQEXTScalePlacement {
+			postTrig = mdctQEXTPostTrig(n)
+		}
+		if (mdctUsePostTwiddleNeon || mdctUseTwiddleSSE) && postTrig != nil {
 			if pairBlocks := n4 >> 3; pairBlocks > 0 {
-				mdctPostTwiddleNeon(coeffs, fftStage, trig, n2, n4, pairBlocks)
+				if mdctUsePostTwiddleNeon {
+					mdctPostTwiddleNeon(coeffs, fftStage, postTrig, n2, n4, pairBlocks)
+				} else {
+					mdctPostTwiddleSSE(coeffs, fftStage, postTrig, n2, n4, pairBlocks)
+				}
 				i = 4 * pairBlocks
 				lo += 2 * i
 				hi -= 2 * i
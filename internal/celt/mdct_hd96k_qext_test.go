@@ -166,3 +166,32 @@ func TestHD96kMDCTMatchesLibopusQEXT(t *testing.T) {
 		checkHD96kMDCT(t, "inverse_transient", got, want)
 	})
 }
+
+// TestHD96kCachedTablesMatchBuilt pins the cached 3840-point twiddles, the
+// shared nfft=960 KISS-FFT state and the scaled post-rotation twiddles to
+// freshly built tables bit-for-bit.
+func TestHD96kCachedTablesMatchBuilt(t *testing.T) {
+	want := buildMDCTTrigF32(3840)
+	got := getMDCTTrigF32(3840)
+	if len(got) != len(want) {
+		t.Fatalf("len(trig) = %d, want %d", len(got), len(want))
+	}
+	for i := range want {
+		if math.Float32bits(got[i]) != math.Float32bits(want[i]) {
+			t.Fatalf("trig[%d] = %v, want %v", i, got[i], want[i])
+		}
+	}
+
+	assertKissStateEqual(t, 960)
+
+	for _, n := range []int{240, 480, 960, 1920, 3840} {
+		scale := float32(1.0) / float32(n/4)
+		trig := getMDCTTrigF32(n)
+		scaled := mdctQEXTPostTrig(n)
+		for i := range trig {
+			if w := trig[i] * scale; math.Float32bits(scaled[i]) != math.Float32bits(w) {
+				t.Fatalf("n=%d: scaled trig[%d] = %v, want %v", n, i, scaled[i], w)
+			}
+		}
+	}
+}
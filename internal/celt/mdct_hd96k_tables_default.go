@@ -0,0 +1,11 @@
+//go:build !gopus_qext
+
+package celt
+
+func hd96kMDCTTrigF32(int) []float32 {
+	return nil
+}
+
+func hd96kKissFFTState(int) *kissFFTState {
+	return nil
+}
@@ -0,0 +1,36 @@
+//go:build gopus_qext
+
+package celt
+
+import "sync"
+
+// The native 96 kHz mode runs a 3840-point long-block MDCT whose twiddle
+// segment and nfft=960 KISS-FFT state fall outside the static 48 kHz tables.
+// Serve them from the HD96k mode table and a lazily built shared state so the
+// per-frame transforms stop rebuilding them.
+
+var (
+	kissFFTState960Once sync.Once
+	kissFFTState960     *kissFFTState
+)
+
+// hd96kMDCTTrigF32 returns the cached twiddle segment for the HD96k MDCT
+// lengths that have no static table, or nil.
+func hd96kMDCTTrigF32(n int) []float32 {
+	if n == 3840 {
+		return hd96kMdctTrig[:n/2]
+	}
+	return nil
+}
+
+// hd96kKissFFTState returns the shared KISS-FFT state for the HD96k FFT
+// lengths that have no static state, or nil.
+func hd96kKissFFTState(nfft int) *kissFFTState {
+	if nfft != 960 {
+		return nil
+	}
+	kissFFTState960Once.Do(func() {
+		kissFFTState960 = newKissFFTState(960)
+	})
+	return kissFFTState960
+}
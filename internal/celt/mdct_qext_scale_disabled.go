@@ -6,3 +6,8 @@ package celt
 // MDCT folds the 1/nfft FFT scale into the pre-rotation and uses raw twiddles in
 // the post-rotation, matching the non-QEXT clt_mdct_forward().
 const mdctQEXTScalePlacement = false
+
+// mdctQEXTPostTrig is only consulted under mdctQEXTScalePlacement.
+func mdctQEXTPostTrig(int) []float32 {
+	return nil
+}
@@ -2,6 +2,8 @@
 
 package celt
 
+import "sync"
+
 // mdctQEXTScalePlacement selects the ENABLE_QEXT forward-MDCT scale placement.
 //
 // In a QEXT libopus build, clt_mdct_forward() does NOT fold the 1/nfft FFT scale
@@ -12,3 +14,44 @@ package celt
 // short transform), so the gopus_qext build must mirror the QEXT placement to
 // stay byte-exact with the QEXT oracle.
 const mdctQEXTScalePlacement = true
+
+// mdctQEXTPostTrigCache holds the scaled post-rotation twiddles for the CELT
+// MDCT lengths 240, 480, 960, 1920 and 3840 (the HD96k long block).
+var mdctQEXTPostTrigCache [5]struct {
+	once sync.Once
+	trig []float32
+}
+
+// mdctQEXTPostTrig returns the n-point MDCT twiddle segment with the 1/(n/4)
+// FFT scale already applied, rounded per entry exactly like the scalar
+// post-rotation's t0 = trig[i]*scale. Feeding it to the post-twiddle SIMD
+// kernels keeps them bit-identical under the QEXT scale placement. Lengths
+// outside the CELT modes return nil and keep the scalar loop.
+func mdctQEXTPostTrig(n int) []float32 {
+	var idx int
+	switch n {
+	case 240:
+		idx = 0
+	case 480:
+		idx = 1
+	case 960:
+		idx = 2
+	case 1920:
+		idx = 3
+	case 3840:
+		idx = 4
+	default:
+		return nil
+	}
+	c := &mdctQEXTPostTrigCache[idx]
+	c.once.Do(func() {
+		trig := getMDCTTrigF32(n)
+		scale := float32(1.0) / float32(n/4)
+		scaled := make([]float32, len(trig))
+		for i, t := range trig {
+			scaled[i] = t * scale
+		}
+		c.trig = scaled
+	})
+	return c.trig
+}
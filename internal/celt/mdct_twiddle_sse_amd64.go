@@ -0,0 +1,45 @@
+//go:build amd64 && !purego
+
+package celt
+
+// mdctUseTwiddleSSE enables the SSE forward-MDCT fold and post-twiddle
+// kernels and the IMDCT TDAC kernel on amd64. amd64 runs the non-fused
+// mdctStoreDirectStage and mix sequences; the kernels issue the same separate
+// multiplies, adds and subtracts per lane, so they are bit-identical to the
+// scalar loops (TestMDCTMidFoldStoreSSEBitExact, TestMDCTFoldStoreSSEBitExact,
+// TestMDCTPostTwiddleSSEBitExact, TestIMDCTTDACWindowSSEBitExact).
+const mdctUseTwiddleSSE = true
+
+// mdctMidFoldStoreSSE writes blocks*4 outputs of the forward-MDCT middle fold
+// with the non-fused mdctStoreDirectStage arithmetic: dst[bitrev[i0+j]] gets
+// the pre-twiddled, scaled (re, im) pair built from samples[xp2-2j] (re) and
+// samples[xp1+2j] (im) with twiddles trig[i0+j] and trig[n4+i0+j]. It reads
+// samples[xp2-2*done+2 : xp2+2] and samples[xp1 : xp1+2*done].
+//
+//go:noescape
+func mdctMidFoldStoreSSE(dst []kissCpx, bitrev []int, samples []float32, trig []float32, i0, n4, xp1, xp2, blocks int, preScale float32)
+
+// mdctPostTwiddleSSE runs pairBlocks mirrored 4-wide blocks of the
+// forward-MDCT post-twiddle, the same tiling as mdctPostTwiddleNeon.
+//
+//go:noescape
+func mdctPostTwiddleSSE(coeffs []float32, fftStage []kissCpx, trig []float32, n2, n4, pairBlocks int)
+
+// mdctFold1StoreSSE writes blocks*4 outputs of the forward-MDCT leading
+// windowed fold with the non-fused mix and store arithmetic, the same
+// geometry and read bounds as mdctFold1StoreNeon.
+//
+//go:noescape
+func mdctFold1StoreSSE(dst []kissCpx, bitrev []int, samples []float32, window []float32, trig []float32, i0, n4, n2, xp1, xp2, wp1, wp2, blocks int, preScale float32)
+
+// mdctFold3StoreSSE is the trailing-fold counterpart of mdctFold1StoreSSE.
+//
+//go:noescape
+func mdctFold3StoreSSE(dst []kissCpx, bitrev []int, samples []float32, window []float32, trig []float32, i0, n4, n2, xp1, xp2, wp1, wp2, blocks int, preScale float32)
+
+// imdctTDACWindowSSE runs blocks*4 steps of the non-fused IMDCT TDAC
+// overlap-add (the mdctMulSubMix/mdctMulAddMix scalar loop). The caller keeps
+// the forward and backward write ranges disjoint.
+//
+//go:noescape
+func imdctTDACWindowSSE(out, xsrc, window []float32, yOut0, xOut0, xSrc0, wBwd0, blocks int)
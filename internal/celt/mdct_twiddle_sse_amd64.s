@@ -0,0 +1,413 @@
+//go:build amd64 && !purego
+
+#include "textflag.h"
+
+// func mdctMidFoldStoreSSE(dst []kissCpx, bitrev []int, samples []float32, trig []float32, i0, n4, xp1, xp2, blocks int, preScale float32)
+//
+// Per lane j of each 4-wide block (re = samples[xp2-2j], im = samples[xp1+2j],
+// t0 = trig[i0+j], t1 = trig[n4+i0+j]):
+//
+//	yr = round(re*t0) - round(im*t1)
+//	yi = round(im*t0) + round(re*t1)
+//	dst[bitrev[i0+j]] = (yr*preScale, yi*preScale)
+//
+// im takes the even lanes of samples[xp1 : xp1+8]; re takes the even lanes of
+// samples[xp2-6 : xp2+2] in reverse. The scaled pairs are zipped and stored
+// to their four bit-reversed slots with MOVLPS/MOVHPS.
+TEXT ·mdctMidFoldStoreSSE(SB), NOSPLIT, $0-140
+	MOVQ  dst_base+0(FP), DI
+	MOVQ  bitrev_base+24(FP), SI
+	MOVQ  samples_base+48(FP), AX
+	MOVQ  trig_base+72(FP), BX
+	MOVQ  i0+96(FP), CX
+	MOVQ  n4+104(FP), DX
+	MOVQ  xp1+112(FP), R8
+	MOVQ  xp2+120(FP), R9
+	MOVQ  blocks+128(FP), R10
+	MOVSS preScale+136(FP), X15
+	SHUFPS $0x00, X15, X15
+
+	TESTQ R10, R10
+	JLE   mid_done
+
+	LEAQ (BX)(CX*4), R11   // &trig[i0]
+	LEAQ (R11)(DX*4), R12  // &trig[n4+i0]
+	LEAQ (SI)(CX*8), SI    // &bitrev[i0]
+	LEAQ (AX)(R8*4), R8    // &samples[xp1]
+	LEAQ -24(AX)(R9*4), R9 // &samples[xp2-6]
+
+mid_loop:
+	MOVUPS (R8), X0
+	MOVUPS 16(R8), X1
+	SHUFPS $0x88, X1, X0 // im
+	MOVUPS (R9), X2
+	MOVUPS 16(R9), X1
+	SHUFPS $0x22, X2, X1 // re
+	MOVUPS (R11), X2     // t0
+	MOVUPS (R12), X3     // t1
+
+	MOVAPS X1, X4
+	MULPS  X2, X4
+	MOVAPS X0, X5
+	MULPS  X3, X5
+	SUBPS  X5, X4 // yr
+	MULPS  X2, X0
+	MULPS  X3, X1
+	ADDPS  X1, X0 // yi
+	MULPS  X15, X4
+	MULPS  X15, X0
+
+	MOVAPS   X4, X6
+	UNPCKLPS X0, X4
+	UNPCKHPS X0, X6
+	MOVQ     0(SI), R13
+	MOVLPS   X4, (DI)(R13*8)
+	MOVQ     8(SI), R13
+	MOVHPS   X4, (DI)(R13*8)
+	MOVQ     16(SI), R13
+	MOVLPS   X6, (DI)(R13*8)
+	MOVQ     24(SI), R13
+	MOVHPS   X6, (DI)(R13*8)
+
+	ADDQ $32, R8
+	SUBQ $32, R9
+	ADDQ $16, R11
+	ADDQ $16, R12
+	ADDQ $32, SI
+	DECQ R10
+	JNZ  mid_loop
+
+mid_done:
+	RET
+
+// func mdctPostTwiddleSSE(coeffs []float32, fftStage []kissCpx, trig []float32, n2, n4, pairBlocks int)
+//
+// Same mirror-pair tiling and per-element arithmetic as mdctPostTwiddleNeon:
+//
+//	yr = round(im*trig[n4+i]) - round(re*trig[i])
+//	yi = round(re*trig[n4+i]) + round(im*trig[i])
+//	coeffs[2i] = yr; coeffs[n2-1-2i] = yi
+//
+// A forward block at i and a mirror block at n4-4-i are computed together;
+// zipping each block's yr with the other's reversed yi fills coeffs[2i..2i+7]
+// and coeffs[2(n4-4-i)..2(n4-4-i)+7] contiguously.
+TEXT ·mdctPostTwiddleSSE(SB), NOSPLIT, $0-96
+	MOVQ coeffs_base+0(FP), DI
+	MOVQ fftStage_base+24(FP), SI
+	MOVQ trig_base+48(FP), BX
+	MOVQ n2+72(FP), R8
+	MOVQ n4+80(FP), DX
+	MOVQ pairBlocks+88(FP), CX
+
+	TESTQ CX, CX
+	JLE   ptw_done
+
+	LEAQ (BX)(DX*4), R9       // &trig[n4]
+	LEAQ -32(SI)(DX*8), R10   // &fftStage[n4-4]
+	LEAQ -16(BX)(DX*4), R11   // &trig[n4-4]
+	LEAQ -16(R9)(DX*4), R12   // &trig[2*n4-4]
+	LEAQ -32(DI)(R8*4), R13   // &coeffs[n2-8]
+
+ptw_loop:
+	// Forward block: yrA in X5, yiA in X0.
+	MOVUPS (SI), X0
+	MOVUPS 16(SI), X1
+	MOVAPS X0, X2
+	SHUFPS $0x88, X1, X0 // re
+	SHUFPS $0xDD, X1, X2 // im
+	MOVUPS (BX), X3      // t0
+	MOVUPS (R9), X4      // t1
+	MOVAPS X2, X5
+	MULPS  X4, X5
+	MOVAPS X0, X6
+	MULPS  X3, X6
+	SUBPS  X6, X5
+	MULPS  X4, X0
+	MULPS  X3, X2
+	ADDPS  X2, X0
+
+	// Mirror block: yrJ in X9, yiJ in X1.
+	MOVUPS (R10), X1
+	MOVUPS 16(R10), X7
+	MOVAPS X1, X8
+	SHUFPS $0x88, X7, X1 // re
+	SHUFPS $0xDD, X7, X8 // im
+	MOVUPS (R11), X3
+	MOVUPS (R12), X4
+	MOVAPS X8, X9
+	MULPS  X4, X9
+	MOVAPS X1, X10
+	MULPS  X3, X10
+	SUBPS  X10, X9
+	MULPS  X4, X1
+	MULPS  X3, X8
+	ADDPS  X8, X1
+
+	SHUFPS $0x1B, X1, X1
+	SHUFPS $0x1B, X0, X0
+
+	MOVAPS   X5, X2
+	UNPCKLPS X1, X5
+	UNPCKHPS X1, X2
+	MOVUPS   X5, (DI)
+	MOVUPS   X2, 16(DI)
+	MOVAPS   X9, X2
+	UNPCKLPS X0, X9
+	UNPCKHPS X0, X2
+	MOVUPS   X9, (R13)
+	MOVUPS   X2, 16(R13)
+
+	ADDQ $32, SI
+	ADDQ $16, BX
+	ADDQ $16, R9
+	ADDQ $32, DI
+	SUBQ $32, R10
+	SUBQ $16, R11
+	SUBQ $16, R12
+	SUBQ $32, R13
+	DECQ CX
+	JNZ  ptw_loop
+
+ptw_done:
+	RET
+
+// Even lanes of a float32 stream: ascending from ptr (ptr[0], ptr[2], ptr[4],
+// ptr[6]) or descending from ptr+6 (ptr[6], ptr[4], ptr[2], ptr[0]). Both
+// read ptr[0:8].
+#define LOAD_EVEN_ASC(ptr, dst, tmp) \
+	MOVUPS (ptr), dst    \
+	MOVUPS 16(ptr), tmp  \
+	SHUFPS $0x88, tmp, dst
+
+#define LOAD_EVEN_DESC(ptr, dst, tmp) \
+	MOVUPS (ptr), tmp    \
+	MOVUPS 16(ptr), dst  \
+	SHUFPS $0x22, tmp, dst
+
+// Pre-twiddle the folded (re in X1, im in X0) lanes with trig[i]/trig[n4+i]
+// at BX/(BX)(DX*4), scale by X15 and store to dst[bitrev[i..i+3]] (SI).
+#define FOLD_TWIDDLE_STORE \
+	MOVUPS   (BX), X2        \
+	MOVUPS   (BX)(DX*4), X3  \
+	MOVAPS   X1, X4          \
+	MULPS    X2, X4          \
+	MOVAPS   X0, X5          \
+	MULPS    X3, X5          \
+	SUBPS    X5, X4          \
+	MULPS    X2, X0          \
+	MULPS    X3, X1          \
+	ADDPS    X1, X0          \
+	MULPS    X15, X4         \
+	MULPS    X15, X0         \
+	MOVAPS   X4, X6          \
+	UNPCKLPS X0, X4          \
+	UNPCKHPS X0, X6          \
+	MOVQ     0(SI), AX       \
+	MOVLPS   X4, (DI)(AX*8)  \
+	MOVQ     8(SI), AX       \
+	MOVHPS   X4, (DI)(AX*8)  \
+	MOVQ     16(SI), AX      \
+	MOVLPS   X6, (DI)(AX*8)  \
+	MOVQ     24(SI), AX      \
+	MOVHPS   X6, (DI)(AX*8)
+
+// func mdctFold1StoreSSE(dst []kissCpx, bitrev []int, samples []float32, window []float32, trig []float32, i0, n4, n2, xp1, xp2, wp1, wp2, blocks int, preScale float32)
+//
+// Leading windowed fold, per lane j (steps of 2 through samples and window):
+//
+//	re = round(samples[xp1+n2+2j]*window[wp2-2j]) + round(samples[xp2-2j]*window[wp1+2j])
+//	im = round(samples[xp1+2j]*window[wp1+2j]) - round(samples[xp2-n2-2j]*window[wp2-2j])
+//
+// then the mdctMidFoldStoreSSE pre-twiddle, scale and bit-reversed store.
+TEXT ·mdctFold1StoreSSE(SB), NOSPLIT, $0-188
+	MOVQ   dst_base+0(FP), DI
+	MOVQ   bitrev_base+24(FP), SI
+	MOVQ   samples_base+48(FP), AX
+	MOVQ   xp1+144(FP), R8
+	MOVQ   xp2+152(FP), R11
+	MOVQ   n2+136(FP), CX
+	LEAQ   (AX)(R8*4), R8      // &samples[xp1]
+	LEAQ   -24(AX)(R11*4), R11 // &samples[xp2-6]
+	SHLQ   $2, CX
+	LEAQ   (R8)(CX*1), R10     // &samples[xp1+n2]
+	MOVQ   R11, R9
+	SUBQ   CX, R9              // &samples[xp2-n2-6]
+	MOVQ   window_base+72(FP), AX
+	MOVQ   wp1+160(FP), R12
+	MOVQ   wp2+168(FP), R13
+	LEAQ   (AX)(R12*4), R12    // &window[wp1]
+	LEAQ   -24(AX)(R13*4), R13 // &window[wp2-6]
+	MOVQ   trig_base+96(FP), BX
+	MOVQ   i0+120(FP), AX
+	LEAQ   (BX)(AX*4), BX      // &trig[i0]
+	LEAQ   (SI)(AX*8), SI      // &bitrev[i0]
+	MOVQ   n4+128(FP), DX
+	MOVQ   blocks+176(FP), CX
+	MOVSS  preScale+184(FP), X15
+	SHUFPS $0x00, X15, X15
+
+	TESTQ CX, CX
+	JLE   fold1_done
+
+fold1_loop:
+	LOAD_EVEN_ASC(R8, X0, X1)  // samples[xp1+2j]
+	LOAD_EVEN_DESC(R9, X2, X1) // samples[xp2-n2-2j]
+	LOAD_EVEN_ASC(R10, X3, X1) // samples[xp1+n2+2j]
+	LOAD_EVEN_DESC(R11, X5, X1) // samples[xp2-2j]
+	LOAD_EVEN_ASC(R12, X6, X1) // window[wp1+2j]
+	LOAD_EVEN_DESC(R13, X7, X1) // window[wp2-2j]
+
+	MULPS X7, X3
+	MULPS X6, X5
+	ADDPS X5, X3 // re
+	MULPS X6, X0
+	MULPS X7, X2
+	SUBPS X2, X0 // im
+	MOVAPS X3, X1
+
+	FOLD_TWIDDLE_STORE
+
+	ADDQ $32, R8
+	SUBQ $32, R9
+	ADDQ $32, R10
+	SUBQ $32, R11
+	ADDQ $32, R12
+	SUBQ $32, R13
+	ADDQ $16, BX
+	ADDQ $32, SI
+	DECQ CX
+	JNZ  fold1_loop
+
+fold1_done:
+	RET
+
+// func mdctFold3StoreSSE(dst []kissCpx, bitrev []int, samples []float32, window []float32, trig []float32, i0, n4, n2, xp1, xp2, wp1, wp2, blocks int, preScale float32)
+//
+// Trailing windowed fold, per lane j:
+//
+//	re = round(samples[xp2-2j]*window[wp2-2j]) - round(samples[xp1-n2+2j]*window[wp1+2j])
+//	im = round(samples[xp1+2j]*window[wp2-2j]) + round(samples[xp2+n2-2j]*window[wp1+2j])
+//
+// then the same pre-twiddle, scale and bit-reversed store.
+TEXT ·mdctFold3StoreSSE(SB), NOSPLIT, $0-188
+	MOVQ   dst_base+0(FP), DI
+	MOVQ   bitrev_base+24(FP), SI
+	MOVQ   samples_base+48(FP), AX
+	MOVQ   xp1+144(FP), R10
+	MOVQ   xp2+152(FP), R8
+	MOVQ   n2+136(FP), CX
+	LEAQ   (AX)(R10*4), R10   // &samples[xp1]
+	LEAQ   -24(AX)(R8*4), R8  // &samples[xp2-6]
+	SHLQ   $2, CX
+	MOVQ   R10, R9
+	SUBQ   CX, R9             // &samples[xp1-n2]
+	LEAQ   (R8)(CX*1), R11    // &samples[xp2+n2-6]
+	MOVQ   window_base+72(FP), AX
+	MOVQ   wp1+160(FP), R12
+	MOVQ   wp2+168(FP), R13
+	LEAQ   (AX)(R12*4), R12    // &window[wp1]
+	LEAQ   -24(AX)(R13*4), R13 // &window[wp2-6]
+	MOVQ   trig_base+96(FP), BX
+	MOVQ   i0+120(FP), AX
+	LEAQ   (BX)(AX*4), BX      // &trig[i0]
+	LEAQ   (SI)(AX*8), SI      // &bitrev[i0]
+	MOVQ   n4+128(FP), DX
+	MOVQ   blocks+176(FP), CX
+	MOVSS  preScale+184(FP), X15
+	SHUFPS $0x00, X15, X15
+
+	TESTQ CX, CX
+	JLE   fold3_done
+
+fold3_loop:
+	LOAD_EVEN_DESC(R8, X3, X1)  // samples[xp2-2j]
+	LOAD_EVEN_ASC(R9, X2, X1)   // samples[xp1-n2+2j]
+	LOAD_EVEN_ASC(R10, X0, X1)  // samples[xp1+2j]
+	LOAD_EVEN_DESC(R11, X5, X1) // samples[xp2+n2-2j]
+	LOAD_EVEN_ASC(R12, X6, X1)  // window[wp1+2j]
+	LOAD_EVEN_DESC(R13, X7, X1) // window[wp2-2j]
+
+	MULPS X7, X3
+	MULPS X6, X2
+	SUBPS X2, X3 // re
+	MULPS X7, X0
+	MULPS X6, X5
+	ADDPS X5, X0 // im
+	MOVAPS X3, X1
+
+	FOLD_TWIDDLE_STORE
+
+	SUBQ $32, R8
+	ADDQ $32, R9
+	ADDQ $32, R10
+	SUBQ $32, R11
+	ADDQ $32, R12
+	SUBQ $32, R13
+	ADDQ $16, BX
+	ADDQ $32, SI
+	DECQ CX
+	JNZ  fold3_loop
+
+fold3_done:
+	RET
+
+// func imdctTDACWindowSSE(out, xsrc, window []float32, yOut0, xOut0, xSrc0, wBwd0, blocks int)
+//
+// Non-fused IMDCT TDAC overlap-add over blocks*4 steps i:
+//
+//	x1 = xsrc[xSrc0-i]; x2 = out[yOut0+i]; w1 = window[i]; w2 = window[wBwd0-i]
+//	out[yOut0+i] = round(x2*w2) - round(x1*w1)
+//	out[xOut0-i] = round(x2*w1) + round(x1*w2)
+//
+// The descending streams load and store reversed 4-groups. The caller keeps
+// the forward and backward write ranges disjoint, so a block never reads a
+// lane another block wrote.
+TEXT ·imdctTDACWindowSSE(SB), NOSPLIT, $0-112
+	MOVQ out_base+0(FP), DI
+	MOVQ xsrc_base+24(FP), SI
+	MOVQ window_base+48(FP), BX
+	MOVQ yOut0+72(FP), AX
+	MOVQ xOut0+80(FP), CX
+	MOVQ xSrc0+88(FP), DX
+	MOVQ wBwd0+96(FP), R8
+	MOVQ blocks+104(FP), R9
+
+	TESTQ R9, R9
+	JLE   tdac_done
+
+	LEAQ (DI)(AX*4), R10    // &out[yOut0]
+	LEAQ -12(DI)(CX*4), R11 // &out[xOut0-3]
+	LEAQ -12(SI)(DX*4), R12 // &xsrc[xSrc0-3]
+	LEAQ -12(BX)(R8*4), R13 // &window[wBwd0-3]
+
+tdac_loop:
+	MOVUPS (R12), X0
+	SHUFPS $0x1B, X0, X0 // x1
+	MOVUPS (R10), X1     // x2
+	MOVUPS (BX), X2      // w1
+	MOVUPS (R13), X3
+	SHUFPS $0x1B, X3, X3 // w2
+
+	MOVAPS X1, X4
+	MULPS  X3, X4
+	MOVAPS X0, X5
+	MULPS  X2, X5
+	SUBPS  X5, X4 // x2*w2 - x1*w1
+	MULPS  X2, X1
+	MULPS  X3, X0
+	ADDPS  X0, X1 // x2*w1 + x1*w2
+
+	MOVUPS X4, (R10)
+	SHUFPS $0x1B, X1, X1
+	MOVUPS X1, (R11)
+
+	ADDQ $16, R10
+	SUBQ $16, R11
+	SUBQ $16, R12
+	ADDQ $16, BX
+	SUBQ $16, R13
+	DECQ R9
+	JNZ  tdac_loop
+
+tdac_done:
+	RET
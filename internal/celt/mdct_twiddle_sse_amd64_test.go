@@ -0,0 +1,241 @@
+//go:build amd64 && !purego
+
+package celt
+
+import (
+	"math"
+	"math/rand"
+	"testing"
+)
+
+// TestMDCTMidFoldStoreSSEBitExact checks the SSE middle-fold kernel against
+// the scalar mdctStoreDirectStage sequence bit-for-bit over the real mode
+// geometries and randomized off-grid shapes.
+func TestMDCTMidFoldStoreSSEBitExact(t *testing.T) {
+	rng := rand.New(rand.NewSource(43))
+	type shape struct {
+		n4, i0, xp1, xp2, blocks int
+	}
+	var shapes []shape
+	for _, n4 := range []int{60, 120, 240} {
+		shapes = append(shapes, shape{n4: n4, i0: 30, xp1: 120, xp2: 2*n4 - 1, blocks: (n4 - 60) >> 2})
+	}
+	for k := 0; k < 20; k++ {
+		n4 := 8 + rng.Intn(64)*4
+		blocks := 1 + rng.Intn(n4/4)
+		shapes = append(shapes, shape{
+			n4: n4, i0: rng.Intn(n4 - 4*blocks + 1), xp1: rng.Intn(8),
+			xp2: 8*blocks - 2 + rng.Intn(16), blocks: blocks,
+		})
+	}
+
+	for si, s := range shapes {
+		done := 4 * s.blocks
+		samples := make([]float32, max(s.xp1+2*done, s.xp2+2))
+		for i := range samples {
+			samples[i] = float32(rng.NormFloat64())
+		}
+		trig := make([]float32, 2*s.n4)
+		for i := range trig {
+			trig[i] = float32(rng.NormFloat64())
+		}
+		bitrev := rng.Perm(s.n4)
+		preScale := float32(1.0) / float32(s.n4)
+
+		got := make([]kissCpx, s.n4)
+		want := make([]kissCpx, s.n4)
+		for j := 0; j < done; j++ {
+			mdctStoreDirectStage(want, bitrev[s.i0+j], preScale, samples[s.xp2-2*j], samples[s.xp1+2*j], trig[s.i0+j], trig[s.n4+s.i0+j])
+		}
+		mdctMidFoldStoreSSE(got, bitrev, samples, trig, s.i0, s.n4, s.xp1, s.xp2, s.blocks, preScale)
+		for k := range want {
+			if math.Float32bits(got[k].r) != math.Float32bits(want[k].r) ||
+				math.Float32bits(got[k].i) != math.Float32bits(want[k].i) {
+				t.Fatalf("shape %d (%+v): dst[%d] = %v, want %v", si, s, k, got[k], want[k])
+			}
+		}
+	}
+}
+
+// TestMDCTFoldStoreSSEBitExact checks both windowed-fold SSE kernels against
+// the scalar mix + store sequence bit-for-bit over the 48 kHz and HD96k
+// overlaps.
+func TestMDCTFoldStoreSSEBitExact(t *testing.T) {
+	rng := rand.New(rand.NewSource(49))
+	for _, overlap := range []int{120, 240} {
+		limit1 := (overlap + 3) >> 2
+		for _, n4 := range []int{limit1, 2 * limit1, 240, 960} {
+			n2 := 2 * n4
+			samples := make([]float32, n2+overlap)
+			for i := range samples {
+				samples[i] = float32(rng.NormFloat64())
+			}
+			window := make([]float32, overlap)
+			for i := range window {
+				window[i] = rng.Float32()
+			}
+			trig := make([]float32, n2)
+			for i := range trig {
+				trig[i] = float32(rng.NormFloat64())
+			}
+			bitrev := rng.Perm(n4)
+			preScale := float32(1.0) / float32(n4)
+
+			for _, blocks := range []int{1, limit1 / 4} {
+				i0, xp1, xp2, wp1, wp2 := 0, overlap/2, n2-1+overlap/2, overlap/2, overlap/2-1
+				got := make([]kissCpx, n4)
+				want := make([]kissCpx, n4)
+				for j := 0; j < 4*blocks; j++ {
+					re := mdctMulAddMixEncode(samples[xp1+n2+2*j], samples[xp2-2*j], window[wp2-2*j], window[wp1+2*j])
+					im := mdctMulSubMixEncode(samples[xp1+2*j], samples[xp2-n2-2*j], window[wp1+2*j], window[wp2-2*j])
+					mdctStoreDirectStage(want, bitrev[i0+j], preScale, re, im, trig[i0+j], trig[n4+i0+j])
+				}
+				mdctFold1StoreSSE(got, bitrev, samples, window, trig, i0, n4, n2, xp1, xp2, wp1, wp2, blocks, preScale)
+				compareFoldCpx(t, "fold1", overlap, n4, blocks, got, want)
+
+				if n4 < 2*limit1 {
+					continue
+				}
+				i0 = n4 - limit1
+				xp1, xp2, wp1, wp2 = overlap/2+2*i0, n2-1+overlap/2-2*i0, 0, overlap-1
+				got = make([]kissCpx, n4)
+				want = make([]kissCpx, n4)
+				for j := 0; j < 4*blocks; j++ {
+					re := mdctMulSubMixAlt(samples[xp2-2*j], samples[xp1-n2+2*j], window[wp2-2*j], window[wp1+2*j])
+					im := mdctMulAddMixEncode(samples[xp1+2*j], samples[xp2+n2-2*j], window[wp2-2*j], window[wp1+2*j])
+					mdctStoreDirectStage(want, bitrev[i0+j], preScale, re, im, trig[i0+j], trig[n4+i0+j])
+				}
+				mdctFold3StoreSSE(got, bitrev, samples, window, trig, i0, n4, n2, xp1, xp2, wp1, wp2, blocks, preScale)
+				compareFoldCpx(t, "fold3", overlap, n4, blocks, got, want)
+			}
+		}
+	}
+}
+
+func compareFoldCpx(t *testing.T, name string, overlap, n4, blocks int, got, want []kissCpx) {
+	t.Helper()
+	for k := range want {
+		if math.Float32bits(got[k].r) != math.Float32bits(want[k].r) ||
+			math.Float32bits(got[k].i) != math.Float32bits(want[k].i) {
+			t.Fatalf("%s overlap=%d n4=%d blocks=%d: dst[%d] = %v, want %v", name, overlap, n4, blocks, k, got[k], want[k])
+		}
+	}
+}
+
+// TestIMDCTTDACWindowSSEBitExact pins the SSE TDAC kernel to the non-fused
+// scalar overlap-add, both in-buffer and from a separate source.
+func TestIMDCTTDACWindowSSEBitExact(t *testing.T) {
+	rng := rand.New(rand.NewSource(51))
+	for _, overlap := range []int{8, 16, 120, 240} {
+		blocks := overlap / 8
+		window := make([]float32, overlap)
+		for i := range window {
+			window[i] = rng.Float32()
+		}
+		for _, inBuffer := range []bool{true, false} {
+			got := make([]float32, overlap+6)
+			for i := range got {
+				got[i] = float32(rng.NormFloat64())
+			}
+			xsrc := got
+			yOut0, xOut0, xSrc0 := 3, 3+overlap-1, 3+overlap-1
+			if !inBuffer {
+				xsrc = make([]float32, overlap)
+				for i := range xsrc {
+					xsrc[i] = float32(rng.NormFloat64())
+				}
+				xSrc0 = overlap - 1
+			}
+			want := append([]float32(nil), got...)
+			wantSrc := want
+			if !inBuffer {
+				wantSrc = xsrc
+			}
+			for i := 0; i < 4*blocks; i++ {
+				x1 := wantSrc[xSrc0-i]
+				x2 := want[yOut0+i]
+				want[yOut0+i] = mdctMulSubMix(x2, x1, window[overlap-1-i], window[i])
+				want[xOut0-i] = mdctMulAddMix(x2, x1, window[i], window[overlap-1-i])
+			}
+			imdctTDACWindowSSE(got, xsrc, window, yOut0, xOut0, xSrc0, overlap-1, blocks)
+			for k := range want {
+				if math.Float32bits(got[k]) != math.Float32bits(want[k]) {
+					t.Fatalf("overlap=%d inBuffer=%v: out[%d] = %08x, want %08x",
+						overlap, inBuffer, k, math.Float32bits(got[k]), math.Float32bits(want[k]))
+				}
+			}
+		}
+	}
+}
+
+// TestMDCTPostTwiddleSSEBitExact pins the mirror-pair SSE post-twiddle to the
+// scalar loop bit-for-bit across the production n4 sizes.
+func TestMDCTPostTwiddleSSEBitExact(t *testing.T) {
+	rng := rand.New(rand.NewSource(47))
+	for _, n4 := range []int{8, 16, 24, 30, 60, 120, 240} {
+		n2 := 2 * n4
+		pairBlocks := n4 >> 3
+		stage := make([]kissCpx, n4)
+		for i := range stage {
+			stage[i] = kissCpx{float32(rng.NormFloat64()), float32(rng.NormFloat64())}
+		}
+		trig := make([]float32, n2)
+		for i := range trig {
+			trig[i] = float32(rng.NormFloat64())
+		}
+		got := make([]float32, n2)
+		want := make([]float32, n2)
+		for i := 0; i < 4*pairBlocks; i++ {
+			j := n4 - 1 - i
+			want[2*i] = mdctMul(stage[i].i, trig[n4+i]) - mdctMul(stage[i].r, trig[i])
+			want[n2-1-2*i] = mdctMul(stage[i].r, trig[n4+i]) + mdctMul(stage[i].i, trig[i])
+			want[2*j] = mdctMul(stage[j].i, trig[n4+j]) - mdctMul(stage[j].r, trig[j])
+			want[n2-1-2*j] = mdctMul(stage[j].r, trig[n4+j]) + mdctMul(stage[j].i, trig[j])
+		}
+		mdctPostTwiddleSSE(got, stage, trig, n2, n4, pairBlocks)
+		for k := range want {
+			if math.Float32bits(got[k]) != math.Float32bits(want[k]) {
+				t.Fatalf("n4=%d: coeffs[%d] = %08x, want %08x", n4, k, math.Float32bits(got[k]), math.Float32bits(want[k]))
+			}
+		}
+	}
+}
+
+// TestAbsSumBlocksAVXBitExact checks the AVX abs-sum blocks against the
+// per-lane scalar accumulation, including signed zeros and a lane carrying
+// negative values only.
+func TestAbsSumBlocksAVXBitExact(t *testing.T) {
+	rng := rand.New(rand.NewSource(53))
+	for _, blocks := range []int{1, 2, 7, 60} {
+		x := make([]float32, 16*blocks)
+		for i := range x {
+			x[i] = float32(rng.NormFloat64())
+		}
+		x[0] = float32(math.Copysign(0, -1))
+		for i := 3; i < len(x); i += 16 {
+			x[i] = -float32(math.Abs(float64(x[i])))
+		}
+		var want8, got8 [8]float32
+		var want16, got16 [16]float32
+		for i, v := range x {
+			if v < 0 {
+				v = -v
+			}
+			if i < 8*blocks {
+				want8[i&7] += v
+			}
+			want16[i&15] += v
+		}
+		if !celtAbsSumUsesAVX {
+			t.Skip("AVX2 not available")
+		}
+		absSumBlocks8AVX(x, blocks, &got8)
+		absSumBlocks16AVX(x, blocks, &got16)
+		for k := range want16 {
+			if math.Float32bits(got16[k]) != math.Float32bits(want16[k]) ||
+				(k < 8 && math.Float32bits(got8[k]) != math.Float32bits(want8[k])) {
+				t.Fatalf("blocks=%d lane %d: got %v/%v want %v/%v", blocks, k, got8[k&7], got16[k], want8[k&7], want16[k])
+			}
+		}
+	}
+}
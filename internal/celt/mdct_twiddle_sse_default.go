@@ -0,0 +1,58 @@
+//go:build !amd64 || purego
+
+package celt
+
+// mdctUseTwiddleSSE is false off amd64; the scalar forward-MDCT loops run
+// there (and remain the byte-exact purego oracle path).
+const mdctUseTwiddleSSE = false
+
+// mdctMidFoldStoreSSE is never called off amd64 (guarded by
+// mdctUseTwiddleSSE); the stub keeps the package building on all targets.
+func mdctMidFoldStoreSSE(dst []kissCpx, bitrev []int, samples []float32, trig []float32, i0, n4, xp1, xp2, blocks int, preScale float32) {
+	for j := 0; j < 4*blocks; j++ {
+		mdctStoreDirectStage(dst, bitrev[i0+j], preScale, samples[xp2-2*j], samples[xp1+2*j], trig[i0+j], trig[n4+i0+j])
+	}
+}
+
+// mdctPostTwiddleSSE is never called off amd64 (guarded by
+// mdctUseTwiddleSSE); the stub keeps the package building on all targets.
+func mdctPostTwiddleSSE(coeffs []float32, fftStage []kissCpx, trig []float32, n2, n4, pairBlocks int) {
+	for i := 0; i < 4*pairBlocks; i++ {
+		j := n4 - 1 - i
+		coeffs[2*i] = mdctMul(fftStage[i].i, trig[n4+i]) - mdctMul(fftStage[i].r, trig[i])
+		coeffs[n2-1-2*i] = mdctMul(fftStage[i].r, trig[n4+i]) + mdctMul(fftStage[i].i, trig[i])
+		coeffs[2*j] = mdctMul(fftStage[j].i, trig[n4+j]) - mdctMul(fftStage[j].r, trig[j])
+		coeffs[n2-1-2*j] = mdctMul(fftStage[j].r, trig[n4+j]) + mdctMul(fftStage[j].i, trig[j])
+	}
+}
+
+// mdctFold1StoreSSE is never called off amd64 (guarded by
+// mdctUseTwiddleSSE); the stub keeps the package building on all targets.
+func mdctFold1StoreSSE(dst []kissCpx, bitrev []int, samples []float32, window []float32, trig []float32, i0, n4, n2, xp1, xp2, wp1, wp2, blocks int, preScale float32) {
+	for j := 0; j < 4*blocks; j++ {
+		re := mdctMulAddMixEncode(samples[xp1+n2+2*j], samples[xp2-2*j], window[wp2-2*j], window[wp1+2*j])
+		im := mdctMulSubMixEncode(samples[xp1+2*j], samples[xp2-n2-2*j], window[wp1+2*j], window[wp2-2*j])
+		mdctStoreDirectStage(dst, bitrev[i0+j], preScale, re, im, trig[i0+j], trig[n4+i0+j])
+	}
+}
+
+// mdctFold3StoreSSE is never called off amd64 (guarded by
+// mdctUseTwiddleSSE); the stub keeps the package building on all targets.
+func mdctFold3StoreSSE(dst []kissCpx, bitrev []int, samples []float32, window []float32, trig []float32, i0, n4, n2, xp1, xp2, wp1, wp2, blocks int, preScale float32) {
+	for j := 0; j < 4*blocks; j++ {
+		re := mdctMulSubMixAlt(samples[xp2-2*j], samples[xp1-n2+2*j], window[wp2-2*j], window[wp1+2*j])
+		im := mdctMulAddMixEncode(samples[xp1+2*j], samples[xp2+n2-2*j], window[wp2-2*j], window[wp1+2*j])
+		mdctStoreDirectStage(dst, bitrev[i0+j], preScale, re, im, trig[i0+j], trig[n4+i0+j])
+	}
+}
+
+// imdctTDACWindowSSE is never called off amd64 (guarded by
+// mdctUseTwiddleSSE); the stub keeps the package building on all targets.
+func imdctTDACWindowSSE(out, xsrc, window []float32, yOut0, xOut0, xSrc0, wBwd0, blocks int) {
+	for i := 0; i < 4*blocks; i++ {
+		x1 := xsrc[xSrc0-i]
+		x2 := out[yOut0+i]
+		out[yOut0+i] = mdctMulSubMix(x2, x1, window[wBwd0-i], window[i])
+		out[xOut0-i] = mdctMulAddMix(x2, x1, window[i], window[wBwd0-i])
+	}
+}
@@ -169,15 +169,18 @@ func combFilterQEXTFloat32(tl []float32, pos, t0, t1, n int, g0, g1 float32, tap
 	newWindow := ensureFloat32Slice(&scratch.window, overlap2)
 	// phase buffer: COMBFILTER_MAXPERIOD history + n2 samples.
 	phase := ensureFloat32Slice(&scratch.phase, combFilterMaxPeriod+n2)
+	// The comb taps reach at most max(t0,t1)+2 samples back, so only that much
+	// of each phase's history needs splitting out.
+	first := hd96kCombPhaseFirst(t0, t1)
 
 	for s := 0; s < 2; s++ {
 		for i := 0; i < overlap2; i++ {
 			newWindow[i] = window[2*i+s]
 		}
 		// mem_buf[i] = x[2*i+s - 2*MAXPERIOD], x indexed from pos.
-		for i := 0; i < combFilterMaxPeriod+n2; i++ {
-			srcIdx := pos + 2*i + s - hd96kCombHistory
-			phase[i] = tl[srcIdx]
+		src := tl[pos+s-hd96kCombHistory:]
+		for i := first; i < combFilterMaxPeriod+n2; i++ {
+			phase[i] = src[2*i]
 		}
 		combFilterScalarFloat32(phase, combFilterMaxPeriod, t0, t1, n2, g0, g1, tapset0, tapset1, newWindow, overlap2)
 		for i := 0; i < n2; i++ {
@@ -186,6 +189,12 @@ func combFilterQEXTFloat32(tl []float32, pos, t0, t1, n int, g0, g1 float32, tap
 	}
 }
 
+// hd96kCombPhaseFirst returns the first phase-buffer index the comb filter
+// reads for periods t0 and t1 (history starts at combFilterMaxPeriod).
+func hd96kCombPhaseFirst(t0, t1 int) int {
+	return max(combFilterMaxPeriod-max(t0, t1)-2, 0)
+}
+
 // combFilterScalarFloat32 is a direct transliteration of libopus comb_filter
 // (the float, non-qext core) operating on a single contiguous buffer where buf
 // holds `history` samples of context before the `n` samples to be filtered in
@@ -254,6 +263,13 @@ func combFilterScalarFloat32(buf []float32, history, t0, t1, n int, g0, g1 float
 	}
 	// Constant-filter tail (libopus comb_filter_const): rolling taps x1..x4
 	// carry over from the overlap loop. SHL32(.,1) is a no-op in the float build.
+	// Whole 4-wide blocks run in place on the SIMD kernel; the taps it reads
+	// are final by then because the period is at least combFilterMinPeriod.
+	if blocks := (n - i) >> 2; combNoFMAUsesSIMD && blocks > 0 {
+		combFilterConstNoFMABlocks(buf[history+i:history+i+4*blocks], buf[history+i-t1-2:], g10, g11, g12, blocks)
+		i += 4 * blocks
+		x1, x2, x3, x4 = x(i-t1+1), x(i-t1), x(i-t1-1), x(i-t1-2)
+	}
 	for ; i < n; i++ {
 		x0 := x(i - t1 + 2)
 		t := x(i)
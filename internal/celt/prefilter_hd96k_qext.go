@@ -44,17 +44,29 @@ func combFilterWithInputSigQEXT(dst, src []celtSig, start, t0, t1, n int, g0, g1
 		return
 	}
 
-	newWindow := make([]float32, overlap2)
-	phaseIn := make([]float32, combFilterMaxPeriod+n2)
-	phaseOut := make([]float32, n2)
+	// Native frames keep n2 <= 960, so the phase buffers live on the stack.
+	var windowBuf [120]float32
+	var phaseInBuf [combFilterMaxPeriod + 960]float32
+	var phaseOutBuf [960]float32
+	var newWindow, phaseIn, phaseOut []float32
+	if overlap2 <= len(windowBuf) && n2 <= len(phaseOutBuf) {
+		newWindow, phaseIn, phaseOut = windowBuf[:overlap2], phaseInBuf[:combFilterMaxPeriod+n2], phaseOutBuf[:n2]
+	} else {
+		newWindow = make([]float32, overlap2)
+		phaseIn = make([]float32, combFilterMaxPeriod+n2)
+		phaseOut = make([]float32, n2)
+	}
+	first := hd96kCombPhaseFirst(t0, t1)
 
 	for s := 0; s < 2; s++ {
 		for i := 0; i < overlap2; i++ {
 			newWindow[i] = window[2*i+s]
 		}
-		// mem_buf[i] = x[2*i+s - 2*COMBFILTER_MAXPERIOD], x indexed from start.
-		for i := 0; i < combFilterMaxPeriod+n2; i++ {
-			phaseIn[i] = float32(src[start+2*i+s-hd96kCombHistory])
+		// mem_buf[i] = x[2*i+s - 2*COMBFILTER_MAXPERIOD], x indexed from start;
+		// only the history the taps reach is split out.
+		phaseSrc := src[start+s-hd96kCombHistory:]
+		for i := first; i < combFilterMaxPeriod+n2; i++ {
+			phaseIn[i] = float32(phaseSrc[2*i])
 		}
 		combFilterScalarFloat32Out(phaseOut, phaseIn, combFilterMaxPeriod, t0, t1, n2, g0, g1, tapset0, tapset1, newWindow, overlap2)
 		for i := 0; i < n2; i++ {
@@ -136,6 +148,13 @@ func combFilterScalarFloat32Out(out, in []float32, history, t0, t1, n int, g0, g
 	}
 	// Constant-filter tail (libopus comb_filter_const): rolling taps x1..x4
 	// carry over from the overlap loop. SHL32(.,1) is a no-op in the float build.
+	// Whole 4-wide blocks run on the SIMD kernel over a copy of the input.
+	if blocks := (n - i) >> 2; combNoFMAUsesSIMD && blocks > 0 {
+		copy(out[i:i+4*blocks], in[history+i:])
+		combFilterConstNoFMABlocks(out[i:i+4*blocks], in[history+i-t1-2:], g10, g11, g12, blocks)
+		i += 4 * blocks
+		x1, x2, x3, x4 = x(i-t1+1), x(i-t1), x(i-t1-1), x(i-t1-2)
+	}
 	for ; i < n; i++ {
 		x0 := x(i - t1 + 2)
 		t := x(i)
@@ -60,6 +60,12 @@ func absSumSig(x []celtSig) opusVal32 {
 	// Eight independent accumulators: 8 ops/4 dispatch = 2 cycles per 8-element
 	// block, matching the FADD latency so no stall between iterations.
 	var a0, a1, a2, a3, a4, a5, a6, a7 float32
+	if blocks := len(x) >> 3; celtAbsSumUsesAVX && blocks > 0 {
+		var acc [8]float32
+		absSumBlocks8AVX(x, blocks, &acc)
+		a0, a1, a2, a3, a4, a5, a6, a7 = acc[0], acc[1], acc[2], acc[3], acc[4], acc[5], acc[6], acc[7]
+		x = x[8*blocks:]
+	}
 	for len(x) >= 8 {
 		v0, v1, v2, v3 := x[0], x[1], x[2], x[3]
 		v4, v5, v6, v7 := x[4], x[5], x[6], x[7]
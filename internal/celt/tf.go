@@ -218,6 +218,13 @@ func l1MetricNorm(tmp []celtNorm, N int, LM int, bias float32) float32 {
 		buf := tmp[:n]
 		var a0, a1, a2, a3, a4, a5, a6, a7 float32
 		var a8, a9, a10, a11, a12, a13, a14, a15 float32
+		if blocks := len(buf) >> 4; celtAbsSumUsesAVX && blocks > 0 {
+			var acc [16]float32
+			absSumBlocks16AVX(buf, blocks, &acc)
+			a0, a1, a2, a3, a4, a5, a6, a7 = acc[0], acc[1], acc[2], acc[3], acc[4], acc[5], acc[6], acc[7]
+			a8, a9, a10, a11, a12, a13, a14, a15 = acc[8], acc[9], acc[10], acc[11], acc[12], acc[13], acc[14], acc[15]
+			buf = buf[16*blocks:]
+		}
 		for len(buf) >= 16 {
 			v0, v1, v2, v3 := buf[0], buf[1], buf[2], buf[3]
 			v4, v5, v6, v7 := buf[4], buf[5], buf[6], buf[7]
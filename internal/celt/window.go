@@ -71,7 +71,8 @@ func GetWindowBuffer(overlap int) []float32 {
 }
 
 // GetWindowBufferF32 returns the precomputed float32 window buffer for the given overlap size.
-// Returns a freshly computed float32 buffer for non-standard sizes.
+// Non-standard sizes return the window retained by a live Opus Custom mode,
+// or a freshly computed float32 buffer.
 func GetWindowBufferF32(overlap int) []float32 {
 	switch overlap {
 	case 120:
@@ -83,6 +84,9 @@ func GetWindowBufferF32(overlap int) []float32 {
 	case 960:
 		return windowBuffer960F32[:]
 	default:
+		if window := customWindowF32(overlap); window != nil {
+			return window
+		}
 		window := make([]float32, overlap)
 		for i := range overlap {
 			window[i] = VorbisWindow(i, overlap)
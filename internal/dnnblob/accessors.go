@@ -85,6 +85,13 @@ func (v Int8View) At(i int) int8 {
 	return int8(v.data[i])
 }
 
+// Bytes returns the int8 payload as raw bytes for vector kernels that
+// sign-extend it themselves. The slice aliases the blob and must not be
+// modified.
+func (v Int8View) Bytes() []byte {
+	return v.data
+}
+
 // Fill copies the view into dst and returns the number of values written.
 func (v Int8View) Fill(dst []int8) int {
 	n := min(len(v.data), len(dst))
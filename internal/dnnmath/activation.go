@@ -1,7 +1,9 @@
-// Package dnnmath provides the activation, exponent and input-quantization
-// kernels libopus' neural-network code (DRED, OSCE) relies on. Each kernel keeps
-// a scalar path that mirrors the generic libopus build and, on arm64, a NEON
-// path matching the SIMD reference so the DNN output is bit-exact per tier.
+// Package dnnmath provides the activation, exponent, input-quantization and
+// adaptive-filter cross-correlation kernels libopus' neural-network code (DRED,
+// OSCE) relies on. Each kernel keeps a scalar path that mirrors the generic
+// libopus build and, on arm64, a NEON path matching the SIMD reference so the
+// DNN output is bit-exact per tier. amd64 AVX paths only vectorise across
+// independent outputs, leaving each output's arithmetic unchanged.
 package dnnmath
 
 import (
@@ -0,0 +1,25 @@
+package dnnmath
+
+// Xcorr sets out[i] = sum_k kernel[k]*x[i+k] for i < len(out), accumulating
+// each output from zero over the taps in order. It is the cross-correlation
+// at the core of libopus `adaconv_process_frame` and `adacomb_process_frame`
+// (dnn/nndsp.c); x must hold len(out)+len(kernel)-1 values. On amd64 whole
+// blocks of eight outputs run through AVX with the same per-output summation,
+// so the result does not depend on the path taken.
+func Xcorr(out, kernel, x []float32) {
+	n := len(out)
+	i := 0
+	if xcorrUsesAVX && len(kernel) > 0 && n >= 8 {
+		blocks := n / 8
+		_ = x[8*blocks+len(kernel)-2]
+		xcorrBlocksAVX(out, kernel, x, blocks)
+		i = 8 * blocks
+	}
+	for ; i < n; i++ {
+		var sum float32
+		for k, c := range kernel {
+			sum += c * x[i+k]
+		}
+		out[i] = sum
+	}
+}
@@ -0,0 +1,17 @@
+//go:build amd64 && !purego
+
+package dnnmath
+
+import "github.com/thesyncim/gopus/internal/cpufeat"
+
+// xcorrUsesAVX runs whole blocks of eight Xcorr outputs through AVX. Each YMM
+// lane is one output and accumulates the taps in the scalar order with a
+// separate multiply and add, so the result is bit-identical to the scalar
+// loop and to the non-fused amd64 libopus build (TestXcorrMatchesScalar).
+var xcorrUsesAVX = cpufeat.AMD64.HasAVX2
+
+// xcorrBlocksAVX sets out[i] = sum_k kernel[k]*x[i+k] for i < 8*blocks.
+// kernel must be non-empty and x must hold 8*blocks+len(kernel)-1 values.
+//
+//go:noescape
+func xcorrBlocksAVX(out, kernel, x []float32, blocks int)
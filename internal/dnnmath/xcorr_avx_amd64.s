@@ -0,0 +1,64 @@
+//go:build amd64 && !purego
+
+#include "textflag.h"
+
+// func xcorrBlocksAVX(out, kernel, x []float32, blocks int)
+//
+// Two blocks (16 outputs) run per pass so two independent add chains hide the
+// VADDPS latency; every lane still sums its taps strictly in kernel order.
+TEXT ·xcorrBlocksAVX(SB), NOSPLIT, $0-80
+	MOVQ out_base+0(FP), DI
+	MOVQ kernel_base+24(FP), R8
+	MOVQ kernel_len+32(FP), R9
+	MOVQ x_base+48(FP), SI
+	MOVQ blocks+72(FP), CX
+
+xcorr_pair:
+	CMPQ CX, $2
+	JLT  xcorr_single
+	VXORPS Y0, Y0, Y0
+	VXORPS Y1, Y1, Y1
+	MOVQ   R8, AX
+	MOVQ   SI, BX
+	MOVQ   R9, DX
+
+xcorr_pair_tap:
+	VBROADCASTSS (AX), Y2
+	VMULPS       (BX), Y2, Y3
+	VMULPS       32(BX), Y2, Y4
+	VADDPS       Y3, Y0, Y0
+	VADDPS       Y4, Y1, Y1
+	ADDQ         $4, AX
+	ADDQ         $4, BX
+	DECQ         DX
+	JNZ          xcorr_pair_tap
+
+	VMOVUPS Y0, (DI)
+	VMOVUPS Y1, 32(DI)
+	ADDQ    $64, DI
+	ADDQ    $64, SI
+	SUBQ    $2, CX
+	JMP     xcorr_pair
+
+xcorr_single:
+	TESTQ CX, CX
+	JLE   xcorr_done
+	VXORPS Y0, Y0, Y0
+	MOVQ   R8, AX
+	MOVQ   SI, BX
+	MOVQ   R9, DX
+
+xcorr_single_tap:
+	VBROADCASTSS (AX), Y2
+	VMULPS       (BX), Y2, Y3
+	VADDPS       Y3, Y0, Y0
+	ADDQ         $4, AX
+	ADDQ         $4, BX
+	DECQ         DX
+	JNZ          xcorr_single_tap
+
+	VMOVUPS Y0, (DI)
+
+xcorr_done:
+	VZEROUPPER
+	RET
@@ -0,0 +1,18 @@
+//go:build !amd64 || purego
+
+package dnnmath
+
+// xcorrUsesAVX is false off amd64; Xcorr runs its scalar loop.
+const xcorrUsesAVX = false
+
+// xcorrBlocksAVX is never called off amd64 (guarded by xcorrUsesAVX); the
+// stub mirrors the per-lane accumulation.
+func xcorrBlocksAVX(out, kernel, x []float32, blocks int) {
+	for i := range out[:8*blocks] {
+		var sum float32
+		for k, c := range kernel {
+			sum += c * x[i+k]
+		}
+		out[i] = sum
+	}
+}
@@ -0,0 +1,52 @@
+package dnnmath
+
+import (
+	"math"
+	"math/rand"
+	"testing"
+)
+
+// TestXcorrMatchesScalar checks Xcorr bit-for-bit against the scalar
+// adaconv/adacomb loop for the OSCE kernel sizes and frame lengths, including
+// outputs left over after the eight-wide blocks.
+func TestXcorrMatchesScalar(t *testing.T) {
+	rng := rand.New(rand.NewSource(0x0C5E))
+	for _, kernelSize := range []int{1, 15, 16, 32} {
+		for _, n := range []int{0, 7, 8, 40, 80, 85, 120, 240} {
+			kernel := make([]float32, kernelSize)
+			x := make([]float32, n+kernelSize-1)
+			for i := range kernel {
+				kernel[i] = float32(rng.NormFloat64())
+			}
+			for i := range x {
+				x[i] = float32(rng.NormFloat64() * 1e3)
+			}
+			got := make([]float32, n)
+			Xcorr(got, kernel, x)
+			for i := range got {
+				var want float32
+				for k := range kernel {
+					want += kernel[k] * x[i+k]
+				}
+				if math.Float32bits(got[i]) != math.Float32bits(want) {
+					t.Fatalf("kernel %d n %d out[%d]=%v want %v", kernelSize, n, i, got[i], want)
+				}
+			}
+		}
+	}
+}
+
+func BenchmarkXcorr(b *testing.B) {
+	kernel := make([]float32, 16)
+	x := make([]float32, 240+15)
+	for i := range x {
+		x[i] = float32(i%37) * 0.01
+	}
+	for i := range kernel {
+		kernel[i] = float32(i) * 0.1
+	}
+	out := make([]float32, 240)
+	for i := 0; i < b.N; i++ {
+		Xcorr(out, kernel, x)
+	}
+}
@@ -121,40 +121,67 @@ func dred16kDownmixSampleFloat32(in []float32, idx, channels, up int) float32 {
 	return float32(dredFloatToInt16(0.5*float32(up)*(l+r))) + dredVerySmall
 }
 
+// dredFilterZeroStuffedTo16kFloat32 runs libopus filter_df2t over the
+// up-times zero-stuffed downmix and keeps every keepEvery-th output, as
+// dred_convert_to_16k does. The filter is recursive, so every step still has to
+// run, but it is driven per input sample instead of per work sample: the
+// stuffed zero steps skip the downmix and drop their b*x terms, the filter
+// state stays in registers for the whole call, and discarded outputs are never
+// stored. Each step's arithmetic is otherwise that of filter_df2t, so the
+// output matches the direct form bit for bit whenever the state is non-zero
+// (dropping a 0*b term can only flip the sign of an exact zero).
 func dredFilterZeroStuffedTo16kFloat32(dst []float32, in []float32, channels, up, workLen, keepEvery int, spec dred16kFilterSpec, mem *[ResamplingOrder + 1]float32) int {
-	if mem == nil || keepEvery <= 0 {
+	if mem == nil || keepEvery <= 0 || up <= 0 || (workLen+keepEvery-1)/keepEvery != len(dst) {
 		return 0
 	}
-	out := 0
-	for i := range workLen {
-		xi := float32(0)
-		if i%up == 0 {
-			xi = dred16kDownmixSampleFloat32(in, i/up, channels, up)
-		}
-		yi := dredFilterDF2TStep(xi, spec, mem)
-		if i%keepEvery == 0 {
-			if out >= len(dst) {
-				return 0
-			}
+	inLen := workLen / up
+	b0, b, a := spec.b0, spec.b, spec.a
+	m0, m1, m2, m3 := mem[0], mem[1], mem[2], mem[3]
+	m4, m5, m6, m7, m8 := mem[4], mem[5], mem[6], mem[7], mem[8]
+	out, phase := 0, 0
+	for i := range inLen {
+		xi := dred16kDownmixSampleFloat32(in, i, channels, up)
+		yi := xi*b0 + m0
+		nyi := -yi
+		m0 = m1 + b[0]*xi + a[0]*nyi
+		m1 = m2 + b[1]*xi + a[1]*nyi
+		m2 = m3 + b[2]*xi + a[2]*nyi
+		m3 = m4 + b[3]*xi + a[3]*nyi
+		m4 = m5 + b[4]*xi + a[4]*nyi
+		m5 = m6 + b[5]*xi + a[5]*nyi
+		m6 = m7 + b[6]*xi + a[6]*nyi
+		m7 = m8 + b[7]*xi + a[7]*nyi
+		if phase == 0 {
 			dst[out] = yi
 			out++
 		}
+		if phase++; phase == keepEvery {
+			phase = 0
+		}
+		for s := 1; s < up; s++ {
+			nyi := -m0
+			if phase == 0 {
+				dst[out] = m0
+				out++
+			}
+			if phase++; phase == keepEvery {
+				phase = 0
+			}
+			m0 = m1 + a[0]*nyi
+			m1 = m2 + a[1]*nyi
+			m2 = m3 + a[2]*nyi
+			m3 = m4 + a[3]*nyi
+			m4 = m5 + a[4]*nyi
+			m5 = m6 + a[5]*nyi
+			m6 = m7 + a[6]*nyi
+			m7 = m8 + a[7]*nyi
+		}
 	}
-	if out != len(dst) {
-		return 0
-	}
+	mem[0], mem[1], mem[2], mem[3] = m0, m1, m2, m3
+	mem[4], mem[5], mem[6], mem[7] = m4, m5, m6, m7
 	return out
 }
 
-func dredFilterDF2TStep(xi float32, spec dred16kFilterSpec, mem *[ResamplingOrder + 1]float32) float32 {
-	yi := xi*spec.b0 + mem[0]
-	nyi := -yi
-	for j := range ResamplingOrder {
-		mem[j] = mem[j+1] + spec.b[j]*xi + spec.a[j]*nyi
-	}
-	return yi
-}
-
 func dredFloatToInt16(v float32) int16 {
 	return opusmath.Float32ToInt16(v)
 }
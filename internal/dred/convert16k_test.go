@@ -1,6 +1,7 @@
 package dred
 
 import (
+	"fmt"
 	"math"
 	"testing"
 
@@ -75,3 +76,90 @@ func TestDREDFloatToInt16MatchesLibopusFLOAT2INT16(t *testing.T) {
 		}
 	}
 }
+
+// convertTo16kDirectForm is the zero-stuff, filter-every-sample, then-decimate
+// form of libopus dred_convert_to_16k that ConvertTo16kMonoFloat32 replaces.
+func convertTo16kDirectForm(in []float32, mem *[ResamplingOrder + 1]float32, sampleRate, channels int) []float32 {
+	up, _ := dred16kUpsampleFactor(sampleRate)
+	spec, keepEvery := dred48k24kTo16kFilter, 3
+	switch sampleRate {
+	case 12000:
+		spec = dred12kTo16kFilter
+	case 8000:
+		spec, keepEvery = dred8kTo16kFilter, 1
+	}
+	inLen := len(in) / channels
+	var out []float32
+	for i := 0; i < up*inLen; i++ {
+		xi := float32(0)
+		if i%up == 0 {
+			xi = dred16kDownmixSampleFloat32(in, i/up, channels, up)
+		}
+		yi := xi*spec.b0 + mem[0]
+		nyi := -yi
+		for j := 0; j < ResamplingOrder; j++ {
+			mem[j] = mem[j+1] + spec.b[j]*xi + spec.a[j]*nyi
+		}
+		if i%keepEvery == 0 {
+			out = append(out, yi)
+		}
+	}
+	return out
+}
+
+// TestConvertTo16kMonoFloat32MatchesDirectForm checks the per-input-sample
+// decimator bit-for-bit against the direct form across calls, including a
+// silent stretch and full-scale clipping.
+func TestConvertTo16kMonoFloat32MatchesDirectForm(t *testing.T) {
+	for _, sampleRate := range []int{8000, 12000, 24000, 48000} {
+		for _, channels := range []int{1, 2} {
+			var gotMem, wantMem [ResamplingOrder + 1]float32
+			n := sampleRate / 100
+			in := make([]float32, n*channels)
+			got := make([]float32, 160)
+			for call := 0; call < 6; call++ {
+				for i := range in {
+					tm := float64(call*len(in)+i) / float64(sampleRate*channels)
+					switch call {
+					case 2:
+						in[i] = 0
+					case 4:
+						in[i] = float32(1.3 * math.Sin(2*math.Pi*97*tm))
+					default:
+						in[i] = float32(0.4*math.Sin(2*math.Pi*310*tm) + 0.2*math.Sin(2*math.Pi*2900*tm+float64(i%2)))
+					}
+				}
+				want := convertTo16kDirectForm(in, &wantMem, sampleRate, channels)
+				if k := ConvertTo16kMonoFloat32(got, &gotMem, in, sampleRate, channels); k != len(want) {
+					t.Fatalf("%d Hz %dch call %d: n=%d want %d", sampleRate, channels, call, k, len(want))
+				}
+				for i := range want {
+					if math.Float32bits(got[i]) != math.Float32bits(want[i]) {
+						t.Fatalf("%d Hz %dch call %d: out[%d]=%v want %v", sampleRate, channels, call, i, got[i], want[i])
+					}
+				}
+				if gotMem != wantMem {
+					t.Fatalf("%d Hz %dch call %d: filter state %v want %v", sampleRate, channels, call, gotMem, wantMem)
+				}
+			}
+		}
+	}
+}
+
+func BenchmarkConvertTo16kMonoFloat32(b *testing.B) {
+	for _, tc := range []struct{ sampleRate, channels int }{{48000, 2}, {24000, 1}, {12000, 1}} {
+		b.Run(fmt.Sprintf("%dHz_%dch", tc.sampleRate, tc.channels), func(b *testing.B) {
+			n := tc.sampleRate / 100
+			in := make([]float32, n*tc.channels)
+			for i := range in {
+				in[i] = float32(0.3 * math.Sin(float64(i)*0.05))
+			}
+			var mem [ResamplingOrder + 1]float32
+			out := make([]float32, 160)
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				ConvertTo16kMonoFloat32(out, &mem, in, tc.sampleRate, tc.channels)
+			}
+		})
+	}
+}
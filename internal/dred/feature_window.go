@@ -65,6 +65,18 @@ func (w FeatureWindow) FillFeatureOffsets(dst []int32) int {
 	return n
 }
 
+// LatentsNeeded returns how many leading latents must have been run through
+// the RDOVAE decoder for every recoverable feature frame in the window to be
+// populated. Each latent yields four feature frames, newest first, and the
+// deepest frame the window probes is FeatureOffsetBase.
+func (w FeatureWindow) LatentsNeeded() int {
+	deepest := min(w.FeatureOffsetBase, w.MaxFeatureIndex)
+	if w.NeededFeatureFrames <= 0 || deepest < 0 {
+		return 0
+	}
+	return deepest/4 + 1
+}
+
 func floorDiv(num, den int) int {
 	if den <= 0 {
 		return 0
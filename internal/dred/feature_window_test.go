@@ -93,3 +93,22 @@ func TestResultFeatureWindowMissingPositiveAndNegative(t *testing.T) {
 		t.Fatalf("FillFeatureOffsets=%v want %v", got, want)
 	}
 }
+
+func TestFeatureWindowLatentsNeeded(t *testing.T) {
+	cases := []struct {
+		window FeatureWindow
+		want   int
+	}{
+		{FeatureWindow{NeededFeatureFrames: 2, FeatureOffsetBase: -1, MaxFeatureIndex: 15}, 0},
+		{FeatureWindow{NeededFeatureFrames: 2, FeatureOffsetBase: 1, MaxFeatureIndex: -1}, 0},
+		{FeatureWindow{NeededFeatureFrames: 2, FeatureOffsetBase: 3, MaxFeatureIndex: 15}, 1},
+		{FeatureWindow{NeededFeatureFrames: 4, FeatureOffsetBase: 4, MaxFeatureIndex: 15}, 2},
+		{FeatureWindow{NeededFeatureFrames: 4, FeatureOffsetBase: 40, MaxFeatureIndex: 15}, 4},
+		{FeatureWindow{NeededFeatureFrames: 0, FeatureOffsetBase: 8, MaxFeatureIndex: 15}, 0},
+	}
+	for _, tc := range cases {
+		if got := tc.window.LatentsNeeded(); got != tc.want {
+			t.Fatalf("LatentsNeeded(%+v)=%d want %d", tc.window, got, tc.want)
+		}
+	}
+}
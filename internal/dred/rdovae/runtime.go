@@ -48,6 +48,7 @@ type runtimeScratch struct {
 type Processor struct {
 	state   decoderState
 	scratch runtimeScratch
+	latents int // leading latents decoded since the last initStates
 }
 
 func (p *Processor) reset() {
@@ -66,24 +67,56 @@ func (m *Decoder) DecodeAll(dst, state, latents []float32, nbLatents int) int {
 // DecodeAllWithProcessor mirrors libopus DRED_rdovae_decode_all() and reuses
 // the caller-owned processor state/scratch when provided.
 func (m *Decoder) DecodeAllWithProcessor(processor *Processor, dst, state, latents []float32, nbLatents int) int {
-	if m == nil || nbLatents <= 0 {
-		return 0
-	}
-
 	var local Processor
 	if processor == nil {
 		processor = &local
 	}
-	processor.reset()
-	m.initStates(&processor.state, state, &processor.scratch)
+	processor.Restart()
+	return m.DecodePrefixWithProcessor(processor, dst, state, latents, nbLatents)
+}
+
+// Restart discards the processor's decode progress so the next
+// DecodePrefixWithProcessor call re-initialises it from the packet state.
+func (p *Processor) Restart() {
+	if p == nil {
+		return
+	}
+	p.latents = 0
+}
+
+// DecodedLatents returns how many leading latents the processor has decoded
+// since it was last restarted.
+func (p *Processor) DecodedLatents() int {
+	if p == nil {
+		return 0
+	}
+	return p.latents
+}
+
+// DecodePrefixWithProcessor runs DRED_rdovae_decode_all() incrementally: it
+// extends the processor's decoded prefix to the first nbLatents latents,
+// writing only the newly decoded feature frames into dst at their
+// DecodeAll positions. The decoder is recurrent from the newest latent
+// backwards, so splitting one packet's decode across calls is bit-exact with
+// a single DecodeAll as long as state, latents and dst are unchanged between
+// calls. It returns the number of floats written.
+func (m *Decoder) DecodePrefixWithProcessor(processor *Processor, dst, state, latents []float32, nbLatents int) int {
+	if m == nil || processor == nil || nbLatents <= processor.latents {
+		return 0
+	}
+	if processor.latents == 0 {
+		processor.reset()
+		m.initStates(&processor.state, state, &processor.scratch)
+	}
 
 	written := 0
-	for i := range nbLatents {
-		out := dst[written : written+OutputOutSize]
+	for i := processor.latents; i < nbLatents; i++ {
+		out := dst[i*OutputOutSize : (i+1)*OutputOutSize]
 		in := latents[i*latentStride : (i+1)*latentStride]
 		m.decodeQFrame(&processor.state, &processor.scratch, out, in)
 		written += OutputOutSize
 	}
+	processor.latents = nbLatents
 	return written
 }
 
@@ -1,6 +1,7 @@
 package rdovae
 
 import (
+	"encoding/binary"
 	"math"
 	"testing"
 
@@ -63,6 +64,96 @@ func TestDecodeAllDoesNotAllocate(t *testing.T) {
 	}
 }
 
+func TestDecodePrefixMatchesDecodeAll(t *testing.T) {
+	blob, err := dnnblob.Clone(buildPatternedDecoderTestBlob())
+	if err != nil {
+		t.Fatalf("Clone error: %v", err)
+	}
+	model, err := LoadDecoder(blob)
+	if err != nil {
+		t.Fatalf("LoadDecoder error: %v", err)
+	}
+
+	const nbLatents = 6
+	state := make([]float32, StateDim)
+	latents := make([]float32, nbLatents*latentStride)
+	for i := range state {
+		state[i] = float32(i%7-3) / 4
+	}
+	for i := range latents {
+		latents[i] = float32(i%11-5) / 8
+	}
+
+	want := make([]float32, nbLatents*OutputOutSize)
+	if n := model.DecodeAll(want, state, latents, nbLatents); n != len(want) {
+		t.Fatalf("DecodeAll count=%d want %d", n, len(want))
+	}
+	nonZero := false
+	for _, v := range want {
+		nonZero = nonZero || v != 0
+	}
+	if !nonZero {
+		t.Fatal("patterned test model produced all-zero features")
+	}
+
+	got := make([]float32, len(want))
+	var processor Processor
+	written, deepest := 0, 0
+	for _, prefix := range []int{1, 1, 3, 2, 6, 4} {
+		written += model.DecodePrefixWithProcessor(&processor, got, state, latents, prefix)
+		deepest = max(deepest, prefix)
+		if processor.DecodedLatents() != deepest {
+			t.Fatalf("DecodedLatents=%d want %d", processor.DecodedLatents(), deepest)
+		}
+	}
+	if written != len(want) {
+		t.Fatalf("DecodePrefix wrote %d floats want %d", written, len(want))
+	}
+	for i := range want {
+		if math.Float32bits(got[i]) != math.Float32bits(want[i]) {
+			t.Fatalf("features[%d]=%v want %v", i, got[i], want[i])
+		}
+	}
+
+	// Restart re-initialises from the packet state on the next call.
+	processor.Restart()
+	clear(got)
+	if n := model.DecodePrefixWithProcessor(&processor, got, state, latents, 2); n != 2*OutputOutSize {
+		t.Fatalf("DecodePrefix after Restart count=%d want %d", n, 2*OutputOutSize)
+	}
+	for i := range 2 * OutputOutSize {
+		if math.Float32bits(got[i]) != math.Float32bits(want[i]) {
+			t.Fatalf("restarted features[%d]=%v want %v", i, got[i], want[i])
+		}
+	}
+}
+
+// buildPatternedDecoderTestBlob fills the test decoder blob's float and int8
+// records with small deterministic values so every layer contributes.
+func buildPatternedDecoderTestBlob() []byte {
+	raw := buildDecoderTestBlob()
+	const headerSize = 64
+	for off := 0; off+headerSize <= len(raw); {
+		typ := int32(binary.LittleEndian.Uint32(raw[off+8 : off+12]))
+		size := int(binary.LittleEndian.Uint32(raw[off+12 : off+16]))
+		block := int(binary.LittleEndian.Uint32(raw[off+16 : off+20]))
+		payload := raw[off+headerSize : off+headerSize+size]
+		switch typ {
+		case dnnblob.TypeFloat:
+			for i := 0; i+4 <= len(payload); i += 4 {
+				v := float32((i/4)%13-6) / 64
+				binary.LittleEndian.PutUint32(payload[i:], math.Float32bits(v))
+			}
+		case dnnblob.TypeInt8:
+			for i := range payload {
+				payload[i] = byte(int8(i%9 - 4))
+			}
+		}
+		off += headerSize + block
+	}
+	return raw
+}
+
 func TestComputeActivationUsesLibopusVectorTail(t *testing.T) {
 	input := []float32{-0.75}
 
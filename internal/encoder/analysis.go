@@ -396,6 +396,12 @@ func silkResamplerDown2HPStereo(s []float32, out []float32, in []float32, scale
 }
 
 func isDigitalSilence32(pcm []float32) bool {
+	if silenceUsesAVX {
+		if nonZeroBlocksAVX(pcm) {
+			return false
+		}
+		pcm = pcm[len(pcm)&^7:]
+	}
 	for i := range pcm {
 		if pcm[i] != 0 {
 			return false
@@ -107,6 +107,10 @@ func gemmAccumF32(out []float32, weights []float32, rows, cols, colStride int, x
 	_ = out[rows-1]
 	_ = x[cols-1]
 	_ = weights[(cols-1)*colStride+rows-1]
+	if analysisMLPUseAVX && (rows == 24 || rows == 32) {
+		gemmAccumRowsAVX(out[:rows], weights, x, rows/8, cols, colStride)
+		return
+	}
 	switch rows {
 	case 2:
 		o0 := out[0]
@@ -242,6 +246,15 @@ func gemmAccumF32Rows24Pair(out0, out1 []float32, weights []float32, cols, colSt
 	_ = out1[23]
 	_ = x[cols-1]
 	_ = weights[(cols-1)*colStride+47]
+	if analysisMLPUseAVX {
+		var acc [48]float32
+		copy(acc[:24], out0[:24])
+		copy(acc[24:], out1[:24])
+		gemmAccumRowsAVX(acc[:], weights, x, 6, cols, colStride)
+		copy(out0[:24], acc[:24])
+		copy(out1[:24], acc[24:])
+		return
+	}
 	a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23 := out0[0], out0[1], out0[2], out0[3], out0[4], out0[5], out0[6], out0[7], out0[8], out0[9], out0[10], out0[11], out0[12], out0[13], out0[14], out0[15], out0[16], out0[17], out0[18], out0[19], out0[20], out0[21], out0[22], out0[23]
 	b0, b1, b2, b3, b4, b5, b6, b7, b8, b9, b10, b11, b12, b13, b14, b15, b16, b17, b18, b19, b20, b21, b22, b23 := out1[0], out1[1], out1[2], out1[3], out1[4], out1[5], out1[6], out1[7], out1[8], out1[9], out1[10], out1[11], out1[12], out1[13], out1[14], out1[15], out1[16], out1[17], out1[18], out1[19], out1[20], out1[21], out1[22], out1[23]
 	for j := range cols {
@@ -319,6 +332,17 @@ func gemmAccumF32Rows24Triple(out0, out1, out2 []float32, weights []float32, col
 	_ = out2[23]
 	_ = x[cols-1]
 	_ = weights[(cols-1)*colStride+71]
+	if analysisMLPUseAVX {
+		var acc [72]float32
+		copy(acc[:24], out0[:24])
+		copy(acc[24:48], out1[:24])
+		copy(acc[48:], out2[:24])
+		gemmAccumRowsAVX(acc[:], weights, x, 9, cols, colStride)
+		copy(out0[:24], acc[:24])
+		copy(out1[:24], acc[24:48])
+		copy(out2[:24], acc[48:])
+		return
+	}
 	a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14, a15, a16, a17, a18, a19, a20, a21, a22, a23 := out0[0], out0[1], out0[2], out0[3], out0[4], out0[5], out0[6], out0[7], out0[8], out0[9], out0[10], out0[11], out0[12], out0[13], out0[14], out0[15], out0[16], out0[17], out0[18], out0[19], out0[20], out0[21], out0[22], out0[23]
 	b0, b1, b2, b3, b4, b5, b6, b7, b8, b9, b10, b11, b12, b13, b14, b15, b16, b17, b18, b19, b20, b21, b22, b23 := out1[0], out1[1], out1[2], out1[3], out1[4], out1[5], out1[6], out1[7], out1[8], out1[9], out1[10], out1[11], out1[12], out1[13], out1[14], out1[15], out1[16], out1[17], out1[18], out1[19], out1[20], out1[21], out1[22], out1[23]
 	c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11, c12, c13, c14, c15, c16, c17, c18, c19, c20, c21, c22, c23 := out2[0], out2[1], out2[2], out2[3], out2[4], out2[5], out2[6], out2[7], out2[8], out2[9], out2[10], out2[11], out2[12], out2[13], out2[14], out2[15], out2[16], out2[17], out2[18], out2[19], out2[20], out2[21], out2[22], out2[23]
@@ -0,0 +1,17 @@
+//go:build amd64 && !purego
+
+package encoder
+
+import "github.com/thesyncim/gopus/internal/cpufeat"
+
+// analysisMLPUseAVX routes the 24- and 32-row analysis MLP GEMMs through
+// gemmAccumRowsAVX. Each YMM lane carries one output row and accumulates with
+// a separate multiply and add, the same two roundings as the scalar loops, so
+// the tonality features are bit-identical with and without AVX.
+var analysisMLPUseAVX = cpufeat.AMD64.HasAVX2
+
+// gemmAccumRowsAVX adds weights[j*colStride+i]*x[j] over j < cols into
+// acc[i] for the groups*8 rows of acc. groups must be 3, 4, 6 or 9.
+//
+//go:noescape
+func gemmAccumRowsAVX(acc, weights, x []float32, groups, cols, colStride int)
@@ -0,0 +1,140 @@
+//go:build amd64 && !purego
+
+#include "textflag.h"
+
+// GEMM_COL adds the product of the eight weights at off(R8) and the
+// broadcast input in Y15 to acc, multiplying and adding separately.
+#define GEMM_COL(off, acc) \
+	VMULPS off(R8), Y15, Y14; \
+	VADDPS Y14, acc, acc
+
+// func gemmAccumRowsAVX(acc, weights, x []float32, groups, cols, colStride int)
+TEXT ·gemmAccumRowsAVX(SB), NOSPLIT, $0-96
+	MOVQ acc_base+0(FP), DI
+	MOVQ weights_base+24(FP), R8
+	MOVQ x_base+48(FP), SI
+	MOVQ groups+72(FP), AX
+	MOVQ cols+80(FP), CX
+	MOVQ colStride+88(FP), DX
+	SHLQ $2, DX
+	TESTQ CX, CX
+	JLE  done
+
+	CMPQ AX, $3
+	JEQ  rows24
+	CMPQ AX, $4
+	JEQ  rows32
+	CMPQ AX, $6
+	JEQ  rows48
+	CMPQ AX, $9
+	JEQ  rows72
+	JMP  done
+
+rows24:
+	VMOVUPS 0(DI), Y0
+	VMOVUPS 32(DI), Y1
+	VMOVUPS 64(DI), Y2
+
+loop24:
+	VBROADCASTSS (SI), Y15
+	GEMM_COL(0, Y0)
+	GEMM_COL(32, Y1)
+	GEMM_COL(64, Y2)
+	ADDQ $4, SI
+	ADDQ DX, R8
+	DECQ CX
+	JNZ  loop24
+	VMOVUPS Y0, 0(DI)
+	VMOVUPS Y1, 32(DI)
+	VMOVUPS Y2, 64(DI)
+	JMP  done
+
+rows32:
+	VMOVUPS 0(DI), Y0
+	VMOVUPS 32(DI), Y1
+	VMOVUPS 64(DI), Y2
+	VMOVUPS 96(DI), Y3
+
+loop32:
+	VBROADCASTSS (SI), Y15
+	GEMM_COL(0, Y0)
+	GEMM_COL(32, Y1)
+	GEMM_COL(64, Y2)
+	GEMM_COL(96, Y3)
+	ADDQ $4, SI
+	ADDQ DX, R8
+	DECQ CX
+	JNZ  loop32
+	VMOVUPS Y0, 0(DI)
+	VMOVUPS Y1, 32(DI)
+	VMOVUPS Y2, 64(DI)
+	VMOVUPS Y3, 96(DI)
+	JMP  done
+
+rows48:
+	VMOVUPS 0(DI), Y0
+	VMOVUPS 32(DI), Y1
+	VMOVUPS 64(DI), Y2
+	VMOVUPS 96(DI), Y3
+	VMOVUPS 128(DI), Y4
+	VMOVUPS 160(DI), Y5
+
+loop48:
+	VBROADCASTSS (SI), Y15
+	GEMM_COL(0, Y0)
+	GEMM_COL(32, Y1)
+	GEMM_COL(64, Y2)
+	GEMM_COL(96, Y3)
+	GEMM_COL(128, Y4)
+	GEMM_COL(160, Y5)
+	ADDQ $4, SI
+	ADDQ DX, R8
+	DECQ CX
+	JNZ  loop48
+	VMOVUPS Y0, 0(DI)
+	VMOVUPS Y1, 32(DI)
+	VMOVUPS Y2, 64(DI)
+	VMOVUPS Y3, 96(DI)
+	VMOVUPS Y4, 128(DI)
+	VMOVUPS Y5, 160(DI)
+	JMP  done
+
+rows72:
+	VMOVUPS 0(DI), Y0
+	VMOVUPS 32(DI), Y1
+	VMOVUPS 64(DI), Y2
+	VMOVUPS 96(DI), Y3
+	VMOVUPS 128(DI), Y4
+	VMOVUPS 160(DI), Y5
+	VMOVUPS 192(DI), Y6
+	VMOVUPS 224(DI), Y7
+	VMOVUPS 256(DI), Y8
+
+loop72:
+	VBROADCASTSS (SI), Y15
+	GEMM_COL(0, Y0)
+	GEMM_COL(32, Y1)
+	GEMM_COL(64, Y2)
+	GEMM_COL(96, Y3)
+	GEMM_COL(128, Y4)
+	GEMM_COL(160, Y5)
+	GEMM_COL(192, Y6)
+	GEMM_COL(224, Y7)
+	GEMM_COL(256, Y8)
+	ADDQ $4, SI
+	ADDQ DX, R8
+	DECQ CX
+	JNZ  loop72
+	VMOVUPS Y0, 0(DI)
+	VMOVUPS Y1, 32(DI)
+	VMOVUPS Y2, 64(DI)
+	VMOVUPS Y3, 96(DI)
+	VMOVUPS Y4, 128(DI)
+	VMOVUPS Y5, 160(DI)
+	VMOVUPS Y6, 192(DI)
+	VMOVUPS Y7, 224(DI)
+	VMOVUPS Y8, 256(DI)
+
+done:
+	VZEROUPPER
+	RET
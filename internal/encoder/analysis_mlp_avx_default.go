@@ -0,0 +1,19 @@
+//go:build !amd64 || purego
+
+package encoder
+
+// analysisMLPUseAVX is false off amd64; the unrolled scalar GEMMs run instead.
+const analysisMLPUseAVX = false
+
+// gemmAccumRowsAVX is never called off amd64 (guarded by analysisMLPUseAVX);
+// the stub keeps the package building and mirrors the per-lane sequence.
+func gemmAccumRowsAVX(acc, weights, x []float32, groups, cols, colStride int) {
+	rows := 8 * groups
+	for j := 0; j < cols; j++ {
+		xj := x[j]
+		w := weights[j*colStride : j*colStride+rows]
+		for i := 0; i < rows; i++ {
+			acc[i] += w[i] * xj
+		}
+	}
+}
@@ -118,3 +118,34 @@ func TestGemmAccumF32Rows24TripleMatchesSeparatePasses(t *testing.T) {
 		t.Fatal("rows24 triple mismatch")
 	}
 }
+
+// TestGemmAccumRowsAVXMatchesGenericReference pins every row-group shape of
+// the AVX kernel to the per-row scalar accumulation bit-for-bit.
+func TestGemmAccumRowsAVXMatchesGenericReference(t *testing.T) {
+	rng := rand.New(rand.NewSource(43))
+	for _, groups := range []int{3, 4, 6, 9} {
+		rows := 8 * groups
+		for _, cols := range []int{1, 24, 25, 32} {
+			stride := rows + rng.Intn(9)
+			got := make([]float32, rows)
+			want := make([]float32, rows)
+			weights := make([]float32, cols*stride)
+			input := make([]float32, cols)
+			for i := range got {
+				got[i] = rng.Float32()*2 - 1
+				want[i] = got[i]
+			}
+			for i := range weights {
+				weights[i] = rng.Float32()*2 - 1
+			}
+			for i := range input {
+				input[i] = rng.Float32()*2 - 1
+			}
+			gemmAccumRowsAVX(got, weights, input, groups, cols, stride)
+			gemmAccumF32GenericReference(want, weights, rows, cols, stride, input)
+			if !reflect.DeepEqual(got, want) {
+				t.Fatalf("groups=%d cols=%d stride=%d mismatch", groups, cols, stride)
+			}
+		}
+	}
+}
@@ -84,6 +84,12 @@ func isDigitalSilenceRes(pcm []opusRes, lsbDepth int32) bool {
 	}
 	threshold := opusVal16(1.0 / opusVal16(int32(1)<<uint(lsbDepth)))
 
+	if silenceUsesAVX {
+		if absAboveBlocksAVX(pcm, threshold) {
+			return false
+		}
+		pcm = pcm[len(pcm)&^7:]
+	}
 	for _, v := range pcm {
 		if v > threshold || v < -threshold {
 			return false
@@ -283,6 +289,54 @@ func (e *Encoder) subframeDTXSuppress(mode Mode, subVADPCM []opusRes, subFrameSi
 	return e.decideDTXSuppress(activity, subFrameSize)
 }
 
+// SetDTXFastPath enables the DTX silence fast path. Once DTX is established, a
+// digitally silent frame that would be suppressed again skips tonality
+// analysis, mode decision and the SILK/CELT encode, and only advances the DTX
+// state. The periodic refresh frames and every non-silent frame still take the
+// full path. The skipped frames leave the codec memories where the silence that
+// established DTX put them, so later packets are not byte-identical to libopus;
+// the control is off by default.
+func (e *Encoder) SetDTXFastPath(enabled bool) {
+	e.dtxFastPath = enabled
+}
+
+// DTXFastPath reports whether the DTX silence fast path is enabled.
+func (e *Encoder) DTXFastPath() bool {
+	return e.dtxFastPath
+}
+
+// dtxFastPathReady reports whether a digitally silent frame can take
+// encodeDTXFastPath: the previous frame was a DTX continuation, this one would
+// be suppressed as well rather than sent as the MAX_CONSECUTIVE_DTX refresh,
+// and nothing else consumes the frame (no DRED latents, no buffered input, no
+// per-sub-frame DTX decision, no low-space packet).
+func (e *Encoder) dtxFastPathReady(frameSize, maxDataBytes int) bool {
+	if !e.dtxFastPath || !e.dtxEnabled || e.dtx == nil || !e.dtx.inDTXMode {
+		return false
+	}
+	if e.dredEncodingActive() || len(e.inputBuffer) != 0 || e.isMultiFramePacket(e.intMode, frameSize) {
+		return false
+	}
+	if _, _, low := e.lowSpaceBudget(frameSize, maxDataBytes); low {
+		return false
+	}
+	maxDTXMsQ1 := int32((NBSpeechFramesBeforeDTX + MaxConsecutiveDTX) * 20 * 2)
+	return e.dtx.noActivityMsQ1+e.frameSizeMsQ1(frameSize) <= maxDTXMsQ1
+}
+
+// encodeDTXFastPath emits the DTX continuation for a digitally silent frame
+// accepted by dtxFastPathReady. It records the digital-silence VAD decision
+// and runs decide_dtx_mode exactly as the full path would for the frame, then
+// builds the TOC-only packet for the mode of the last coded frame.
+func (e *Encoder) encodeDTXFastPath(frameSize int) ([]byte, error) {
+	e.lastOpusVADProb = 0
+	e.lastOpusVADValid = true
+	e.lastOpusVADActive = false
+	e.decideDTXSuppress(false, frameSize)
+	e.finalRange = 0
+	return e.buildDTXPacketForMode(frameSize, e.intMode)
+}
+
 // InDTX returns whether the encoder is currently in DTX mode.
 // This matches OPUS_GET_IN_DTX from libopus.
 func (e *Encoder) InDTX() bool {
@@ -0,0 +1,172 @@
+package encoder
+
+import (
+	"bytes"
+	"fmt"
+	"math"
+	"math/rand"
+	"testing"
+
+	"github.com/thesyncim/gopus/types"
+)
+
+// dtxFastPathFrame returns frame f of a speech / silence / speech sequence:
+// a two-tone signal before silenceStart and from silenceEnd on, digital
+// silence in between.
+func dtxFastPathFrame(f, frameSize, channels, silenceStart, silenceEnd int) []float32 {
+	pcm := make([]float32, frameSize*channels)
+	if f >= silenceStart && f < silenceEnd {
+		return pcm
+	}
+	for i := 0; i < frameSize; i++ {
+		tm := float64(f*frameSize+i) / 48000
+		v := float32(0.3*math.Sin(2*math.Pi*220*tm) + 0.1*math.Sin(2*math.Pi*1330*tm))
+		for c := 0; c < channels; c++ {
+			pcm[i*channels+c] = v
+		}
+	}
+	return pcm
+}
+
+// TestDTXFastPathKeepsDTXCadence runs the same speech / silence / speech
+// sequence through the full path and the DTX fast path. Packets must match
+// byte for byte until the fast path first fires; after that the DTX
+// continuation and refresh cadence, every TOC-only packet and InDTX must
+// match, and the skipped frames must not run the tonality analysis.
+func TestDTXFastPathKeepsDTXCadence(t *testing.T) {
+	const (
+		frames       = 120
+		silenceStart = 20
+		silenceEnd   = 100
+	)
+	for _, tc := range []struct {
+		mode     Mode
+		bw       types.Bandwidth
+		channels int
+	}{
+		{ModeSILK, types.BandwidthWideband, 1},
+		{ModeHybrid, types.BandwidthSuperwideband, 1},
+		{ModeCELT, types.BandwidthFullband, 2},
+		{ModeAuto, types.BandwidthFullband, 1},
+	} {
+		t.Run(fmt.Sprintf("%v-%dch", tc.mode, tc.channels), func(t *testing.T) {
+			full := NewEncoder(48000, tc.channels)
+			fast := NewEncoder(48000, tc.channels)
+			for _, enc := range []*Encoder{full, fast} {
+				enc.SetMode(tc.mode)
+				enc.SetBandwidth(tc.bw)
+				enc.SetBitrate(32000)
+				enc.SetDTX(true)
+			}
+			fast.SetDTXFastPath(true)
+			if !fast.DTXFastPath() || full.DTXFastPath() {
+				t.Fatal("DTXFastPath does not reflect SetDTXFastPath")
+			}
+
+			skipped := 0
+			diverged := false
+			for f := 0; f < frames; f++ {
+				pcm := dtxFastPathFrame(f, 960, tc.channels, silenceStart, silenceEnd)
+				want, err := full.Encode(pcm, 960)
+				if err != nil {
+					t.Fatalf("frame %d full Encode: %v", f, err)
+				}
+				want = append([]byte(nil), want...)
+				writePos := int32(-1)
+				if fast.analyzer != nil {
+					writePos = fast.analyzer.WritePos
+				}
+				fastReady := f >= silenceStart && f < silenceEnd && fast.dtxFastPathReady(960, maxSilkPacketBytes)
+				got, err := fast.Encode(pcm, 960)
+				if err != nil {
+					t.Fatalf("frame %d fast Encode: %v", f, err)
+				}
+				if fastReady {
+					skipped++
+					diverged = true
+					if fast.analyzer != nil && fast.analyzer.WritePos != writePos {
+						t.Fatalf("frame %d: skipped frame advanced the analysis", f)
+					}
+				}
+				if !diverged && !bytes.Equal(got, want) {
+					t.Fatalf("frame %d: fast path changed a packet before DTX was established", f)
+				}
+				if (len(got) == 1) != (len(want) == 1) || got[0] != want[0] {
+					t.Fatalf("frame %d: fast path packet len=%d toc=%#x, full path len=%d toc=%#x",
+						f, len(got), got[0], len(want), want[0])
+				}
+				if fast.InDTX() != full.InDTX() || fast.dtx.noActivityMsQ1 != full.dtx.noActivityMsQ1 {
+					t.Fatalf("frame %d: DTX state diverged", f)
+				}
+				if f >= silenceEnd && len(got) <= 1 {
+					t.Fatalf("frame %d: fast path did not resume coding", f)
+				}
+			}
+			if skipped == 0 {
+				t.Fatal("fast path never fired")
+			}
+		})
+	}
+}
+
+// TestDigitalSilenceScansMatchScalar checks the block scans behind
+// isDigitalSilenceRes and isDigitalSilence32 against the scalar tests on
+// lengths around the block sizes, with a single outlier at every position.
+func TestDigitalSilenceScansMatchScalar(t *testing.T) {
+	const lsbDepth = 16
+	threshold := float32(1.0 / float32(int32(1)<<lsbDepth))
+	scalarRes := func(x []float32) bool {
+		for _, v := range x {
+			if v > threshold || v < -threshold {
+				return false
+			}
+		}
+		return true
+	}
+	scalar32 := func(x []float32) bool {
+		for _, v := range x {
+			if v != 0 {
+				return false
+			}
+		}
+		return true
+	}
+	outliers := []float32{
+		threshold, -threshold, math.Nextafter32(threshold, 1), -math.Nextafter32(threshold, 1),
+		float32(math.Copysign(0, -1)), float32(math.NaN()), float32(math.Inf(-1)), 1e-30, 0.5,
+	}
+	rng := rand.New(rand.NewSource(45))
+	for _, n := range []int{0, 1, 7, 8, 9, 31, 32, 33, 63, 100, 960, 1920} {
+		x := make([]float32, n)
+		for i := range x {
+			x[i] = (rng.Float32()*2 - 1) * threshold
+		}
+		if got, want := isDigitalSilenceRes(x, lsbDepth), scalarRes(x); got != want {
+			t.Fatalf("n=%d: isDigitalSilenceRes = %v, want %v", n, got, want)
+		}
+		for pos := 0; pos < n; pos++ {
+			for _, v := range outliers {
+				saved := x[pos]
+				x[pos] = v
+				if got, want := isDigitalSilenceRes(x, lsbDepth), scalarRes(x); got != want {
+					t.Fatalf("n=%d x[%d]=%v: isDigitalSilenceRes = %v, want %v", n, pos, v, got, want)
+				}
+				x[pos] = saved
+			}
+		}
+
+		z := make([]float32, n)
+		if !isDigitalSilence32(z) {
+			t.Fatalf("n=%d: zeros not silent", n)
+		}
+		for pos := 0; pos < n; pos++ {
+			for _, v := range outliers {
+				z[pos] = v
+				if got, want := isDigitalSilence32(z), scalar32(z); got != want {
+					t.Fatalf("n=%d z[%d]=%v: isDigitalSilence32 = %v, want %v", n, pos, v, got, want)
+				}
+				z[pos] = 0
+			}
+		}
+	}
+}
@@ -166,8 +166,11 @@ type Encoder struct {
 	// DTX (Discontinuous Transmission) controls
 	dtxEnabled bool
 	dtx        *dtxState
-	rng        uint32 // RNG for comfort noise
-	finalRange uint32
+	// dtxFastPath lets digitally silent frames skip analysis and core coding
+	// once DTX is established (see encodeDTXFastPath).
+	dtxFastPath bool
+	rng         uint32 // RNG for comfort noise
+	finalRange  uint32
 	// hybridFinalRange stores the libopus final range for the last hybrid frame,
 	// including any CELT transition redundancy range.
 	hybridFinalRange uint32
@@ -907,6 +910,32 @@ func (e *Encoder) EncodeFloat32WithAnalysisMaxBytes(pcm []float32, frameSize int
 	return e.EncodeWithAnalysisMaxBytes(pcm, frameSize, analysisPCM, maxDataBytes)
 }
 
+// EncodeFloat32WithAnalysisInto is EncodeFloat32WithAnalysisMaxBytes that
+// assembles the packet directly in out, the way libopus writes into the
+// caller's data buffer. When out is at least as long as the internal packet
+// buffer it stands in for that buffer for the duration of the call, and the
+// returned packet is a prefix of out; otherwise, or when a path builds its
+// packet elsewhere, the packet is returned in internal storage as usual and the
+// caller must copy it. Bytes of out past the returned packet may be clobbered.
+//
+// The packet budget is still maxDataBytes, so the output is bit-identical to
+// EncodeFloat32WithAnalysisMaxBytes.
+func (e *Encoder) EncodeFloat32WithAnalysisInto(pcm []float32, frameSize int, analysisPCM []float32, maxDataBytes int, out []byte) ([]byte, error) {
+	saved := e.scratchPacket
+	if cap(saved) == 0 || len(out) < cap(saved) {
+		return e.EncodeWithAnalysisMaxBytes(pcm, frameSize, analysisPCM, maxDataBytes)
+	}
+	// Keep len and cap identical to the internal buffer: the DRED budget and
+	// ensurePacketScratch growth read them.
+	e.scratchPacket = out[:len(saved):cap(saved)]
+	packet, err := e.EncodeWithAnalysisMaxBytes(pcm, frameSize, analysisPCM, maxDataBytes)
+	if cap(e.scratchPacket) == cap(saved) && &e.scratchPacket[:1][0] == &out[0] {
+		e.scratchPacket = saved
+	}
+	// else a long packet grew the buffer; keep the fresh one as the new scratch.
+	return packet, err
+}
+
 // EncodeWithAnalysis encodes the selected frame while allowing analysis to see
 // a larger caller frame, matching libopus expert-frame-duration handling.
 func (e *Encoder) EncodeWithAnalysis(pcm []float32, frameSize int, analysisPCM []float32) ([]byte, error) {
@@ -997,6 +1026,9 @@ func (e *Encoder) encodeOpusResWithAnalysisMaxBytes(inputPCM []opusRes, frameSiz
 	isSilence := isDigitalSilenceRes(inputPCM, e.lsbDepth)
 	e.hasCELTPrefill = false
 	e.clearFixedCELTUsed()
+	if isSilence && e.dtxFastPathReady(frameSize, maxDataBytes) {
+		return e.encodeDTXFastPath(frameSize)
+	}
 	defer func() {
 		e.analysisReadBakSet = false
 		e.celtForceIntra = false
@@ -1040,35 +1072,11 @@ func (e *Encoder) encodeOpusResWithAnalysisMaxBytes(inputPCM []opusRes, frameSiz
 		lookaheadSlice = e.inputBuffer[frameEnd:samplesNeeded]
 	}
 
-	// libopus "too little space" fast path (opus_encoder.c:1340). The resolved
-	// bitrate is already in e.bitrate; derive the CBR-clamped budget and effective
-	// bitrate, then emit a minimal TOC-only packet when neither the byte budget
-	// nor the bitrate can support a real encode. This mirrors the per-stream
-	// curr_max squeeze the multistream encoder applies to high-channel layouts.
-	frameRate := sampleRate / frameSize
-	if frameRate <= 0 {
-		frameRate = 1
-	}
-	cbrMaxDataBytes := maxDataBytes
-	effBitrate := int(e.bitrate)
-	if e.bitrateMode == ModeCBR {
-		cbrBytes := min((bitrateToBitsFs(int(e.bitrate), sampleRate, frameSize)+4)/8, maxDataBytes)
-		effBitrate = bitsToBitrateFs(cbrBytes*8, sampleRate, frameSize)
-		if cbrBytes < 1 {
-			cbrBytes = 1
-		}
-		cbrMaxDataBytes = cbrBytes
-	}
-	if e.dredEncodingActive() {
-		if plan, ok := e.computeDREDEmissionPlan(frameSize); ok {
-			effBitrate -= int(plan.bitrate)
-			if effBitrate < 0 {
-				effBitrate = 0
-			}
-		}
-	}
-	if cbrMaxDataBytes < 3 || effBitrate < 3*frameRate*8 ||
-		(frameRate < 50 && (cbrMaxDataBytes*frameRate < 300 || effBitrate < 2400)) {
+	// libopus "too little space" fast path (opus_encoder.c:1340): emit a minimal
+	// TOC-only packet when neither the byte budget nor the bitrate can support a
+	// real encode. This mirrors the per-stream curr_max squeeze the multistream
+	// encoder applies to high-channel layouts.
+	if cbrMaxDataBytes, effBitrate, low := e.lowSpaceBudget(frameSize, maxDataBytes); low {
 		pkt, err := e.emitLowSpacePacket(frameSize, maxDataBytes, cbrMaxDataBytes, effBitrate)
 		if err != nil {
 			return nil, err
@@ -1519,6 +1527,39 @@ func (e *Encoder) encodeOpusResWithAnalysisMaxBytes(inputPCM []opusRes, frameSiz
 	return packet, nil
 }
 
+// lowSpaceBudget derives the CBR-clamped byte budget and effective bitrate of
+// the libopus "too little space" check (opus_encoder.c:1340) from the resolved
+// bitrate already in e.bitrate, and reports whether the frame must take the
+// emitLowSpacePacket path.
+func (e *Encoder) lowSpaceBudget(frameSize, maxDataBytes int) (cbrMaxDataBytes, effBitrate int, low bool) {
+	sampleRate := int(e.sampleRate)
+	frameRate := sampleRate / frameSize
+	if frameRate <= 0 {
+		frameRate = 1
+	}
+	cbrMaxDataBytes = maxDataBytes
+	effBitrate = int(e.bitrate)
+	if e.bitrateMode == ModeCBR {
+		cbrBytes := min((bitrateToBitsFs(int(e.bitrate), sampleRate, frameSize)+4)/8, maxDataBytes)
+		effBitrate = bitsToBitrateFs(cbrBytes*8, sampleRate, frameSize)
+		if cbrBytes < 1 {
+			cbrBytes = 1
+		}
+		cbrMaxDataBytes = cbrBytes
+	}
+	if e.dredEncodingActive() {
+		if plan, ok := e.computeDREDEmissionPlan(frameSize); ok {
+			effBitrate -= int(plan.bitrate)
+			if effBitrate < 0 {
+				effBitrate = 0
+			}
+		}
+	}
+	low = cbrMaxDataBytes < 3 || effBitrate < 3*frameRate*8 ||
+		(frameRate < 50 && (cbrMaxDataBytes*frameRate < 300 || effBitrate < 2400))
+	return cbrMaxDataBytes, effBitrate, low
+}
+
 // emitLowSpacePacket reproduces the libopus opus_encoder.c "too little space to
 // do something useful" fast path (lines 1340-1406). When the per-frame byte
 // budget or bitrate is too small to run a real encode, libopus emits a minimal
@@ -0,0 +1,22 @@
+//go:build amd64 && !purego
+
+package encoder
+
+import "github.com/thesyncim/gopus/internal/cpufeat"
+
+// silenceUsesAVX runs the digital-silence scans over whole blocks of eight
+// samples with AVX. The lane compares use the same ordered/unordered
+// predicates as the scalar tests, so NaN samples classify identically.
+var silenceUsesAVX = cpufeat.AMD64.HasAVX2
+
+// absAboveBlocksAVX reports whether |x[i]| > threshold for any i below
+// 8*(len(x)/8). NaN samples never exceed the threshold.
+//
+//go:noescape
+func absAboveBlocksAVX(x []float32, threshold float32) bool
+
+// nonZeroBlocksAVX reports whether x[i] != 0 for any i below 8*(len(x)/8).
+// NaN samples count as non-zero.
+//
+//go:noescape
+func nonZeroBlocksAVX(x []float32) bool
@@ -0,0 +1,110 @@
+//go:build amd64 && !purego
+
+#include "textflag.h"
+
+// Both scans test four 8-sample blocks per pass: each block is ANDed with Y14
+// (the abs mask, or all ones), compared lane-wise against Y15 and the masks
+// ORed, stopping at the first pass that sets any lane. The caller scans the
+// len(x)%8 tail.
+
+// func absAboveBlocksAVX(x []float32, threshold float32) bool
+TEXT ·absAboveBlocksAVX(SB), NOSPLIT, $0-33
+	MOVQ         x_base+0(FP), SI
+	MOVQ         x_len+8(FP), CX
+	VBROADCASTSS threshold+24(FP), Y15
+	MOVL         $0x7fffffff, AX
+	MOVQ         AX, X14
+	VPBROADCASTD X14, Y14
+
+	// GT_OQ (0x1e) is false for NaN lanes, like v > threshold.
+
+quad:
+	CMPQ   CX, $32
+	JLT    single
+	VANDPS (SI), Y14, Y0
+	VANDPS 32(SI), Y14, Y1
+	VANDPS 64(SI), Y14, Y2
+	VANDPS 96(SI), Y14, Y3
+	VCMPPS $0x1e, Y15, Y0, Y0
+	VCMPPS $0x1e, Y15, Y1, Y1
+	VCMPPS $0x1e, Y15, Y2, Y2
+	VCMPPS $0x1e, Y15, Y3, Y3
+	VORPS  Y1, Y0, Y0
+	VORPS  Y3, Y2, Y2
+	VORPS  Y2, Y0, Y0
+	VPTEST Y0, Y0
+	JNE    found
+	ADDQ   $128, SI
+	SUBQ   $32, CX
+	JMP    quad
+
+single:
+	CMPQ   CX, $8
+	JLT    none
+	VANDPS (SI), Y14, Y0
+	VCMPPS $0x1e, Y15, Y0, Y0
+	VPTEST Y0, Y0
+	JNE    found
+	ADDQ   $32, SI
+	SUBQ   $8, CX
+	JMP    single
+
+found:
+	VZEROUPPER
+	MOVB $1, ret+32(FP)
+	RET
+
+none:
+	VZEROUPPER
+	MOVB $0, ret+32(FP)
+	RET
+
+// func nonZeroBlocksAVX(x []float32) bool
+TEXT ·nonZeroBlocksAVX(SB), NOSPLIT, $0-25
+	MOVQ     x_base+0(FP), SI
+	MOVQ     x_len+8(FP), CX
+	VXORPS   Y15, Y15, Y15
+	VPCMPEQD Y14, Y14, Y14
+
+	// NEQ_UQ (0x04) is true for NaN lanes, like v != 0.
+
+quad:
+	CMPQ   CX, $32
+	JLT    single
+	VANDPS (SI), Y14, Y0
+	VANDPS 32(SI), Y14, Y1
+	VANDPS 64(SI), Y14, Y2
+	VANDPS 96(SI), Y14, Y3
+	VCMPPS $0x04, Y15, Y0, Y0
+	VCMPPS $0x04, Y15, Y1, Y1
+	VCMPPS $0x04, Y15, Y2, Y2
+	VCMPPS $0x04, Y15, Y3, Y3
+	VORPS  Y1, Y0, Y0
+	VORPS  Y3, Y2, Y2
+	VORPS  Y2, Y0, Y0
+	VPTEST Y0, Y0
+	JNE    found
+	ADDQ   $128, SI
+	SUBQ   $32, CX
+	JMP    quad
+
+single:
+	CMPQ   CX, $8
+	JLT    none
+	VANDPS (SI), Y14, Y0
+	VCMPPS $0x04, Y15, Y0, Y0
+	VPTEST Y0, Y0
+	JNE    found
+	ADDQ   $32, SI
+	SUBQ   $8, CX
+	JMP    single
+
+found:
+	VZEROUPPER
+	MOVB $1, ret+24(FP)
+	RET
+
+none:
+	VZEROUPPER
+	MOVB $0, ret+24(FP)
+	RET
@@ -0,0 +1,27 @@
+//go:build !amd64 || purego
+
+package encoder
+
+// silenceUsesAVX is false off amd64; the digital-silence scans run scalar.
+const silenceUsesAVX = false
+
+// absAboveBlocksAVX is never called off amd64 (guarded by silenceUsesAVX);
+// the stub mirrors the block coverage of the amd64 kernel.
+func absAboveBlocksAVX(x []float32, threshold float32) bool {
+	for _, v := range x[:len(x)&^7] {
+		if v > threshold || v < -threshold {
+			return true
+		}
+	}
+	return false
+}
+
+// nonZeroBlocksAVX is never called off amd64 (guarded by silenceUsesAVX).
+func nonZeroBlocksAVX(x []float32) bool {
+	for _, v := range x[:len(x)&^7] {
+		if v != 0 {
+			return true
+		}
+	}
+	return false
+}
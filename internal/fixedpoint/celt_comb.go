@@ -71,13 +71,21 @@ func saturateSig(x int32) int32 {
 // index of the first processed sample. The processed output is written to
 // y[base .. base+N-1]. T is the pitch period, g10/g11/g12 the three tap gains
 // (int16 Q15 coefficients). y and x may alias (in-place) as in libopus.
+//
+// For T >= COMBFILTER_MINPERIOD the leading blocks run in a vector kernel where
+// one is available; a block never reads a sample another lane writes, so the
+// result is identical to the scalar loop, including in place.
 func CombFilterConst(y, x []int32, base, t, n int, g10, g11, g12 int16) {
-	// x4..x1 prime the tap delay line at x[base-T-2 .. base-T+1].
-	x4 := x[base-t-2]
-	x3 := x[base-t-1]
-	x2 := x[base-t]
-	x1 := x[base-t+1]
-	for i := 0; i < n; i++ {
+	i := 0
+	if t >= combFilterMinPeriod {
+		i = combFilterConstVector(y[base:], x[base:], x[base-t-2:], n, g10, g11, g12)
+	}
+	// x4..x1 prime the tap delay line at x[base+i-T-2 .. base+i-T+1].
+	x4 := x[base+i-t-2]
+	x3 := x[base+i-t-1]
+	x2 := x[base+i-t]
+	x1 := x[base+i-t+1]
+	for ; i < n; i++ {
 		x0 := x[base+i-t+2]
 		v := x[base+i] +
 			mult16x32q15(g10, x2) +
@@ -110,8 +118,7 @@ func CombFilter(y, x []int32, base, t0, t1, n int, g0, g1 int16, tapset0, tapset
 		return
 	}
 	// When the gain is zero, T0 and/or T1 may be zero; clamp to the minimum
-	// period to avoid processing garbage history (COMBFILTER_MINPERIOD = 15).
-	const combFilterMinPeriod = 15
+	// period to avoid processing garbage history.
 	if t0 < combFilterMinPeriod {
 		t0 = combFilterMinPeriod
 	}
@@ -229,7 +236,9 @@ func combFilterPF(y []int32, yOff int, x []int32, xOff, t0, t1, n int, g0, g1 in
 		return
 	}
 
-	// Constant-gain tail.
+	// Constant-gain tail; y and x are distinct here, so the vector kernel
+	// applies without the in-place ordering argument.
+	i += combFilterConstVector(y[yOff+i:], x[xOff+i:], x[xOff+i-t1-2:], n-i, g10, g11, g12)
 	cx4 := x[xOff+i-t1-2]
 	cx3 := x[xOff+i-t1-1]
 	cx2 := x[xOff+i-t1]
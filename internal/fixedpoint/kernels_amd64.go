@@ -0,0 +1,95 @@
+//go:build gopus_fixed_point && amd64 && !purego
+
+package fixedpoint
+
+import "github.com/thesyncim/gopus/internal/cpufeat"
+
+// fixedUseAVX2 gates the AVX2 integer kernels. Each kernel is bit-identical to
+// the scalar loop it replaces, so the choice only affects speed.
+var fixedUseAVX2 = cpufeat.AMD64.HasAVX2
+
+//go:noescape
+func combFilterConstBlocksAVX2(dst, src, delay []int32, g10, g11, g12 int32, blocks int)
+
+//go:noescape
+func kfBfly4M1PairsAVX2(fout []FFTCpx, pairs int)
+
+//go:noescape
+func kfBfly2GroupsAVX2(fout []FFTCpx, groups int)
+
+//go:noescape
+func kfBfly4TwAVX2(fout []FFTCpx, tw []FFTTwiddle, fstride, m, n, mm int)
+
+//go:noescape
+func imdctPreRotateAVX2(y, in []int32, trig []int16, n4, preShift, blocks int)
+
+//go:noescape
+func imdctPostRotateAVX2(y []int32, cpx []FFTCpx, trig []int16, n4, postShift, blocks int)
+
+// combFilterConstVector runs the leading multiple of 8 samples of
+// CombFilterConst and returns how many it processed.
+func combFilterConstVector(dst, src, delay []int32, n int, g10, g11, g12 int16) int {
+	blocks := n / 8
+	if !fixedUseAVX2 || blocks == 0 {
+		return 0
+	}
+	done := 8 * blocks
+	combFilterConstBlocksAVX2(dst[:done], src[:done], delay[:done+4],
+		int32(g10), int32(g11), int32(g12), blocks)
+	return done
+}
+
+// kfBfly4M1Vector runs the leading even number of groups of the degenerate
+// radix-4 butterfly over fout (4 complex samples per group) and returns how
+// many groups it processed.
+func kfBfly4M1Vector(fout []FFTCpx, groups int) int {
+	pairs := groups / 2
+	if !fixedUseAVX2 || pairs == 0 {
+		return 0
+	}
+	kfBfly4M1PairsAVX2(fout[:8*pairs], pairs)
+	return 2 * pairs
+}
+
+// kfBfly2Vector runs the leading groups of the m == 4 radix-2 butterfly over
+// fout (8 complex samples per group) and returns how many it processed.
+func kfBfly2Vector(fout []FFTCpx, groups int) int {
+	if !fixedUseAVX2 || groups == 0 {
+		return 0
+	}
+	kfBfly2GroupsAVX2(fout[:8*groups], groups)
+	return groups
+}
+
+// kfBfly4TwVector runs the whole twiddled radix-4 butterfly when m is a
+// multiple of 4 and reports whether it did.
+func kfBfly4TwVector(fout []FFTCpx, tw []FFTTwiddle, fstride, m, n, mm int) bool {
+	if !fixedUseAVX2 || m%4 != 0 {
+		return false
+	}
+	kfBfly4TwAVX2(fout, tw, fstride, m, n, mm)
+	return true
+}
+
+// imdctPreRotateVector pre-rotates the leading multiple of 8 bins of a
+// unit-stride backward MDCT into y in natural order and returns how many it
+// processed.
+func imdctPreRotateVector(y, in []int32, trig []int16, n4, preShift int) int {
+	blocks := n4 / 8
+	if !fixedUseAVX2 || blocks == 0 {
+		return 0
+	}
+	imdctPreRotateAVX2(y[:16*blocks], in[:2*n4], trig[:2*n4], n4, preShift, blocks)
+	return 8 * blocks
+}
+
+// imdctPostRotateVector post-rotates matching multiples of 8 bins from both
+// ends of the backward MDCT and returns how many it took from each end.
+func imdctPostRotateVector(y []int32, cpx []FFTCpx, trig []int16, n4, postShift int) int {
+	blocks := n4 / 16
+	if !fixedUseAVX2 || blocks == 0 {
+		return 0
+	}
+	imdctPostRotateAVX2(y[:2*n4], cpx[:n4], trig[:2*n4], n4, postShift, blocks)
+	return 8 * blocks
+}
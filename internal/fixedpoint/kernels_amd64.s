@@ -0,0 +1,514 @@
+//go:build gopus_fixed_point && amd64 && !purego
+
+#include "textflag.h"
+
+// {0, 1, 2, 3}: twiddle index ramp for the gathered radix-4 twiddles.
+GLOBL fixedKernelRamp4<>(SB), RODATA|NOPTR, $16
+DATA fixedKernelRamp4<>+0(SB)/4, $0
+DATA fixedKernelRamp4<>+4(SB)/4, $1
+DATA fixedKernelRamp4<>+8(SB)/4, $2
+DATA fixedKernelRamp4<>+12(SB)/4, $3
+
+// VPERMD index reversing 8 dwords.
+GLOBL fixedKernelRev8<>(SB), RODATA|NOPTR, $32
+DATA fixedKernelRev8<>+0(SB)/4, $7
+DATA fixedKernelRev8<>+4(SB)/4, $6
+DATA fixedKernelRev8<>+8(SB)/4, $5
+DATA fixedKernelRev8<>+12(SB)/4, $4
+DATA fixedKernelRev8<>+16(SB)/4, $3
+DATA fixedKernelRev8<>+20(SB)/4, $2
+DATA fixedKernelRev8<>+24(SB)/4, $1
+DATA fixedKernelRev8<>+28(SB)/4, $0
+
+// VPERMD index turning VSHUFPS $0xdd output {o0,o1,o4,o5,o2,o3,o6,o7} into
+// {o7,...,o0}.
+GLOBL fixedKernelOddRev8<>(SB), RODATA|NOPTR, $32
+DATA fixedKernelOddRev8<>+0(SB)/4, $7
+DATA fixedKernelOddRev8<>+4(SB)/4, $6
+DATA fixedKernelOddRev8<>+8(SB)/4, $3
+DATA fixedKernelOddRev8<>+12(SB)/4, $2
+DATA fixedKernelOddRev8<>+16(SB)/4, $5
+DATA fixedKernelOddRev8<>+20(SB)/4, $4
+DATA fixedKernelOddRev8<>+24(SB)/4, $1
+DATA fixedKernelOddRev8<>+28(SB)/4, $0
+
+// MULT16_32_Q15 on 8 int32 lanes: R = int32((int64(g) * int64(V)) >> 15).
+// VPMULDQ forms the exact 64-bit products of the even lanes; the odd lanes
+// are shifted down, multiplied, and shifted back so that their high dword
+// holds bits 15..46 of the product. Only the low 32 bits of the shifted
+// product survive, so the logical 64-bit shifts match the arithmetic shift of
+// the scalar form.
+#define MULT16_32_Q15_8(G, V, R, T) \
+	VPMULDQ  G, V, R;             \
+	VPSRLQ   $32, V, T;           \
+	VPMULDQ  G, T, T;             \
+	VPSRLQ   $15, R, R;           \
+	VPSLLQ   $17, T, T;           \
+	VPBLENDD $0xaa, T, R, R
+
+// MULT16_32_Q15 with a per-lane gain: as MULT16_32_Q15_8, but the odd lanes
+// take their gain from GH = G >> 32 (64-bit shift).
+#define MULT16_32_Q15_8X(G, GH, V, R, T) \
+	VPMULDQ  G, V, R;                   \
+	VPSRLQ   $32, V, T;                 \
+	VPMULDQ  GH, T, T;                  \
+	VPSRLQ   $15, R, R;                 \
+	VPSLLQ   $17, T, T;                 \
+	VPBLENDD $0xaa, T, R, R
+
+// func combFilterConstBlocksAVX2(dst, src, delay []int32, g10, g11, g12 int32, blocks int)
+//
+// Runs blocks*8 steps of the FIXED_POINT constant-gain comb filter. Per output
+// i, with delay[i..i+4] = x[i-T-2..i-T+2]:
+//
+//	dst[i] = SATURATE(src[i] + MULT16_32_Q15(g10, x[i-T])
+//	                         + MULT16_32_Q15(g11, x[i-T+1]+x[i-T-1])
+//	                         + MULT16_32_Q15(g12, x[i-T+2]+x[i-T-2]) - 1, SIG_SAT)
+//
+// with int32 wraparound, bit-identical to comb_filter_const_c. dst may alias
+// src; the caller guarantees T >= 15, so an 8-wide block only reads delay
+// samples that earlier blocks have already written.
+TEXT ·combFilterConstBlocksAVX2(SB), NOSPLIT, $0-96
+	MOVQ dst_base+0(FP), DI
+	MOVQ src_base+24(FP), SI
+	MOVQ delay_base+48(FP), DX
+	MOVQ blocks+88(FP), CX
+
+	MOVL         g10+72(FP), AX
+	VMOVD        AX, X13
+	VPBROADCASTD X13, Y13
+	MOVL         g11+76(FP), AX
+	VMOVD        AX, X14
+	VPBROADCASTD X14, Y14
+	MOVL         g12+80(FP), AX
+	VMOVD        AX, X15
+	VPBROADCASTD X15, Y15
+	MOVL         $536870911, AX
+	VMOVD        AX, X12
+	VPBROADCASTD X12, Y12 // SIG_SAT
+	MOVL         $-536870911, AX
+	VMOVD        AX, X11
+	VPBROADCASTD X11, Y11 // -SIG_SAT
+	MOVL         $1, AX
+	VMOVD        AX, X10
+	VPBROADCASTD X10, Y10 // bias
+
+	TESTQ CX, CX
+	JZ    comb_done
+
+comb_loop8:
+	VMOVDQU (DX), Y0   // x[i-T-2]
+	VMOVDQU 4(DX), Y1  // x[i-T-1]
+	VMOVDQU 8(DX), Y2  // x[i-T]
+	VMOVDQU 12(DX), Y3 // x[i-T+1]
+	VMOVDQU 16(DX), Y4 // x[i-T+2]
+	VPADDD  Y1, Y3, Y5
+	VPADDD  Y0, Y4, Y6
+	VMOVDQU (SI), Y7
+
+	MULT16_32_Q15_8(Y13, Y2, Y8, Y9)
+	VPADDD Y8, Y7, Y7
+	MULT16_32_Q15_8(Y14, Y5, Y8, Y9)
+	VPADDD Y8, Y7, Y7
+	MULT16_32_Q15_8(Y15, Y6, Y8, Y9)
+	VPADDD Y8, Y7, Y7
+
+	VPSUBD  Y10, Y7, Y7
+	VPMINSD Y12, Y7, Y7
+	VPMAXSD Y11, Y7, Y7
+	VMOVDQU Y7, (DI)
+
+	ADDQ $32, DX
+	ADDQ $32, SI
+	ADDQ $32, DI
+	DECQ CX
+	JNZ  comb_loop8
+
+comb_done:
+	VZEROUPPER
+	RET
+
+// func kfBfly4M1PairsAVX2(fout []FFTCpx, pairs int)
+//
+// Runs the degenerate (m == 1, all twiddles one) radix-4 KISS-FFT butterfly
+// over pairs*2 consecutive groups of 4 complex samples. Each 128-bit lane holds
+// one group: the low lane group 2k, the high lane group 2k+1. With A = {f0, f1}
+// and B = {f2, f3}, A+B = {f0+f2, f1+f3} and A-B = {f0-f2, f1-f3}, from which
+//
+//	f0' = (f0+f2) + (f1+f3)            f2' = (f0+f2) - (f1+f3)
+//	f1' = (f0-f2) + j'(f1-f3)          f3' = (f0-f2) - j'(f1-f3)
+//
+// where j'(r, i) = (i, -r). All adds wrap like the *_ovflw scalar helpers.
+TEXT ·kfBfly4M1PairsAVX2(SB), NOSPLIT, $0-32
+	MOVQ fout_base+0(FP), DI
+	MOVQ pairs+24(FP), CX
+
+	MOVQ         $0xffffffff00000001, AX
+	MOVQ         AX, X15
+	VPBROADCASTQ X15, Y15 // {1, -1} sign pattern for j'
+
+	TESTQ CX, CX
+	JZ    bfly4_done
+
+bfly4_loop:
+	VMOVDQU    (DI), Y0
+	VMOVDQU    32(DI), Y1
+	VPERM2I128 $0x20, Y1, Y0, Y2 // {f0, f1} of both groups
+	VPERM2I128 $0x31, Y1, Y0, Y3 // {f2, f3} of both groups
+
+	VPADDD Y3, Y2, Y4 // {a0, s1}
+	VPSUBD Y3, Y2, Y5 // {s0, d1}
+
+	VPSHUFD $0x4e, Y4, Y6 // {s1, a0}
+	VPADDD  Y6, Y4, Y7    // low qword f0'
+	VPSUBD  Y6, Y4, Y8    // low qword f2'
+
+	VPSHUFD $0xbb, Y5, Y6 // {d1.i, d1.r, ...}
+	VPSIGND Y15, Y6, Y6   // j'(d1)
+	VPADDD  Y6, Y5, Y9    // low qword f1'
+	VPSUBD  Y6, Y5, Y6    // low qword f3'
+
+	VPUNPCKLQDQ Y9, Y7, Y7 // {f0', f1'}
+	VPUNPCKLQDQ Y6, Y8, Y8 // {f2', f3'}
+
+	VPERM2I128 $0x20, Y8, Y7, Y0
+	VPERM2I128 $0x31, Y8, Y7, Y1
+	VMOVDQU    Y0, (DI)
+	VMOVDQU    Y1, 32(DI)
+
+	ADDQ $64, DI
+	DECQ CX
+	JNZ  bfly4_loop
+
+bfly4_done:
+	VZEROUPPER
+	RET
+
+// func kfBfly2GroupsAVX2(fout []FFTCpx, groups int)
+//
+// Runs the m == 4 radix-2 KISS-FFT butterfly over groups of 8 complex samples,
+// A = fout[0:4] and B = fout[4:8]. One register holds all of B; the per-k
+// twiddle t_k(B_k) is built lane-wise from B, its pair swap Bs and
+// S = B+Bs, D = B-Bs:
+//
+//	t0 = ( B.r,  B.i)        t1 = tw*( S.r,  D.i)
+//	t2 = (Bs.r, -Bs.i)       t3 = tw*(-D.r, -S.i)
+//
+// then A' = A + t and B' = A - t. Negation and adds wrap like the scalar
+// *_ovflw helpers, and the tw products are MULT16_32_Q15.
+TEXT ·kfBfly2GroupsAVX2(SB), NOSPLIT, $0-32
+	MOVQ fout_base+0(FP), DI
+	MOVQ groups+24(FP), CX
+
+	MOVL         $23170, AX
+	VMOVD        AX, X15
+	VPBROADCASTD X15, Y15 // tw
+	MOVL         $1, AX
+	VMOVD        AX, X14
+	VPBROADCASTD X14, Y14
+	VPCMPEQD     Y13, Y13, Y13
+	VPBLENDD     $0xe0, Y13, Y14, Y14 // {1, 1, 1, 1, 1, -1, -1, -1}
+
+	TESTQ CX, CX
+	JZ    bfly2_done
+
+bfly2_loop:
+	VMOVDQU (DI), Y0   // A
+	VMOVDQU 32(DI), Y1 // B
+
+	VPSHUFD $0xb1, Y1, Y2 // Bs
+	VPADDD  Y2, Y1, Y3    // S
+	VPSUBD  Y2, Y1, Y4    // D
+
+	VPBLENDD $0x84, Y3, Y1, Y5 // S.r of k=1, S.i of k=3
+	VPBLENDD $0x48, Y4, Y5, Y5 // D.i of k=1, D.r of k=3
+	VPBLENDD $0x30, Y2, Y5, Y5 // Bs for k=2
+	VPSIGND  Y14, Y5, Y5
+
+	MULT16_32_Q15_8(Y15, Y5, Y6, Y7)
+	VPBLENDD $0xcc, Y6, Y5, Y5 // k=1 and k=3 take the tw products
+
+	VPADDD  Y5, Y0, Y6
+	VPSUBD  Y5, Y0, Y7
+	VMOVDQU Y6, (DI)
+	VMOVDQU Y7, 32(DI)
+
+	ADDQ $64, DI
+	DECQ CX
+	JNZ  bfly2_loop
+
+bfly2_done:
+	VZEROUPPER
+	RET
+
+// Loads the four twiddles tw[IDX[0..3]] and spreads them as {t0, t0, t1, t1 |
+// t2, t2, t3, t3}, each dword still a packed (r, i) int16 pair.
+#define TWLOAD4(IDX, MASK, WX, W) \
+	VPCMPEQD   MASK, MASK, MASK;     \
+	VPGATHERDD MASK, (SI)(IDX*4), WX; \
+	VPMOVZXDQ  WX, W;                \
+	VPSHUFD    $0xa0, W, W
+
+// C_MUL of 4 complex samples F by the spread twiddles W (clobbered):
+// OUT = {F.r*w.r - F.i*w.i, F.r*w.i + F.i*w.r} with each product S_MUL.
+#define CMUL4(F, W, OUT, A, B, T) \
+	VPSLLD   $16, W, A;                  \
+	VPSRAD   $16, A, A;                  \
+	VPSRAD   $16, W, W;                  \
+	MULT16_32_Q15_8(A, F, OUT, T);       \
+	MULT16_32_Q15_8(W, F, B, T);         \
+	VPSHUFD  $0xb1, B, B;                \
+	VPSUBD   B, OUT, A;                  \
+	VPADDD   B, OUT, OUT;                \
+	VPBLENDD $0x55, A, OUT, OUT
+
+// func kfBfly4TwAVX2(fout []FFTCpx, tw []FFTTwiddle, fstride, m, n, mm int)
+//
+// Runs the twiddled (m > 1, m a multiple of 4) radix-4 KISS-FFT butterfly,
+// four consecutive j per iteration. The twiddles tw[j*fstride],
+// tw[2*j*fstride] and tw[3*j*fstride] are gathered and both halves of each
+// product are taken with MULT16_32_Q15, so every output matches kf_bfly4
+// exactly, including int32 wraparound.
+TEXT ·kfBfly4TwAVX2(SB), NOSPLIT, $0-80
+	MOVQ fout_base+0(FP), DI
+	MOVQ tw_base+24(FP), SI
+	MOVQ fstride+48(FP), AX
+	MOVQ m+56(FP), R8
+	MOVQ n+64(FP), CX
+	MOVQ mm+72(FP), DX
+
+	MOVQ  R8, R11
+	SHRQ  $2, R11     // j blocks per group
+	SHLQ  $3, R8      // m legs in bytes
+	LEAQ  (R8)(R8*2), R10 // 3m in bytes
+	SHLQ  $3, DX      // mm in bytes
+
+	VMOVD        AX, X12
+	VPBROADCASTD X12, X12
+	VPMULLD      fixedKernelRamp4<>(SB), X12, X13 // {0, 1, 2, 3} * fstride
+	VPSLLD       $2, X12, X12                      // 4 * fstride
+
+	TESTQ CX, CX
+	JZ    bfly4tw_done
+
+bfly4tw_group:
+	MOVQ    DI, BX
+	MOVQ    R11, R9
+	VMOVDQA X13, X11 // tw1 indices for j = 0..3
+
+bfly4tw_loop:
+	VPADDD X11, X11, X10 // tw2 indices
+	VPADDD X11, X10, X9  // tw3 indices
+
+	VMOVDQU (BX)(R8*1), Y3
+	TWLOAD4(X11, X8, X4, Y4)
+	CMUL4(Y3, Y4, Y0, Y5, Y6, Y7) // s0
+
+	VMOVDQU (BX)(R8*2), Y3
+	TWLOAD4(X10, X8, X4, Y4)
+	CMUL4(Y3, Y4, Y1, Y5, Y6, Y7) // s1
+
+	VMOVDQU (BX)(R10*1), Y3
+	TWLOAD4(X9, X8, X4, Y4)
+	CMUL4(Y3, Y4, Y2, Y5, Y6, Y7) // s2
+
+	VMOVDQU (BX), Y3
+	VPSUBD  Y1, Y3, Y4 // s5 = F0 - s1
+	VPADDD  Y1, Y3, Y3 // F0 + s1
+	VPADDD  Y2, Y0, Y5 // s3 = s0 + s2
+	VPSUBD  Y2, Y0, Y6 // s4 = s0 - s2
+	VPSUBD  Y5, Y3, Y7
+	VPADDD  Y5, Y3, Y3
+	VMOVDQU Y7, (BX)(R8*2)
+	VMOVDQU Y3, (BX)
+
+	VPSHUFD  $0xb1, Y6, Y6     // {s4.i, s4.r}
+	VPADDD   Y6, Y4, Y0        // s5 + j'(s4) in the real lanes
+	VPSUBD   Y6, Y4, Y1
+	VPBLENDD $0xaa, Y1, Y0, Y2 // {s5.r + s4.i, s5.i - s4.r}
+	VPBLENDD $0xaa, Y0, Y1, Y5 // {s5.r - s4.i, s5.i + s4.r}
+	VMOVDQU  Y2, (BX)(R8*1)
+	VMOVDQU  Y5, (BX)(R10*1)
+
+	VPADDD X12, X11, X11
+	ADDQ   $32, BX
+	DECQ   R9
+	JNZ    bfly4tw_loop
+
+	ADDQ DX, DI
+	DECQ CX
+	JNZ  bfly4tw_group
+
+bfly4tw_done:
+	VZEROUPPER
+	RET
+
+// Splits 8 interleaved complex values {c.r, c.i} in LO, HI into EV = {c.r}
+// and OD = {c.i}, in order.
+#define DEINTERLEAVE8(LO, HI, EV, OD) \
+	VSHUFPS $0x88, HI, LO, EV;            \
+	VSHUFPS $0xdd, HI, LO, OD;            \
+	VPERMQ  $0xd8, EV, EV;                \
+	VPERMQ  $0xd8, OD, OD
+
+// Loads 8 Q15 trig values as int32 lanes in T, with T >> 32 in TH.
+#define TRIG8(ADDR, T, TH) \
+	VPMOVSXWD ADDR, T;      \
+	VPSRLQ    $32, T, TH
+
+// Interleaves 8 values of EV and OD and stores them as 16 dwords at ADDR.
+#define INTERLEAVE8_STORE(EV, OD, ADDR, OFF, LO, HI) \
+	VPUNPCKLDQ OD, EV, LO;                           \
+	VPUNPCKHDQ OD, EV, HI;                           \
+	VPERM2I128 $0x20, HI, LO, EV;                    \
+	VPERM2I128 $0x31, HI, LO, OD;                    \
+	VMOVDQU    EV, OFF(ADDR);                        \
+	VMOVDQU    OD, 32+OFF(ADDR)
+
+// func imdctPreRotateAVX2(y, in []int32, trig []int16, n4, preShift, blocks int)
+//
+// Runs blocks*8 bins of the FIXED_POINT clt_mdct_backward pre-rotation with a
+// unit input stride, in natural (not bit-reversed) order:
+//
+//	x1 = SHL32(in[2i], preShift)      x2 = SHL32(in[N2-1-2i], preShift)
+//	y[2i]   = S_MUL(x1, t[i]) - S_MUL(x2, t[N4+i])
+//	y[2i+1] = S_MUL(x2, t[i]) + S_MUL(x1, t[N4+i])
+//
+// x1 is the even half of 16 samples from the front, x2 the reversed odd half
+// of 16 samples from the back.
+TEXT ·imdctPreRotateAVX2(SB), NOSPLIT, $0-96
+	MOVQ y_base+0(FP), DI
+	MOVQ in_base+24(FP), SI
+	MOVQ in_len+32(FP), DX
+	MOVQ trig_base+48(FP), BX
+	MOVQ n4+72(FP), R8
+	MOVQ preShift+80(FP), AX
+	MOVQ blocks+88(FP), CX
+
+	LEAQ -64(SI)(DX*4), DX // back block: in[N2-16-2i ..]
+	LEAQ (BX)(R8*2), R8    // t[N4+i]
+	MOVQ AX, X14
+	VMOVDQU fixedKernelOddRev8<>(SB), Y15
+
+	TESTQ CX, CX
+	JZ    prerot_done
+
+prerot_loop:
+	VMOVDQU (SI), Y0
+	VMOVDQU 32(SI), Y1
+	DEINTERLEAVE8(Y0, Y1, Y2, Y3) // Y2 = x1
+	VMOVDQU (DX), Y0
+	VMOVDQU 32(DX), Y1
+	VSHUFPS $0xdd, Y1, Y0, Y3
+	VPERMD  Y3, Y15, Y3 // x2
+	VPSLLD  X14, Y2, Y2
+	VPSLLD  X14, Y3, Y3
+
+	TRIG8((BX), Y4, Y5)
+	TRIG8((R8), Y6, Y7)
+
+	MULT16_32_Q15_8X(Y4, Y5, Y3, Y8, Y9)  // S_MUL(x2, t0)
+	MULT16_32_Q15_8X(Y6, Y7, Y2, Y10, Y9) // S_MUL(x1, t1)
+	VPADDD Y10, Y8, Y11                    // yr
+	MULT16_32_Q15_8X(Y4, Y5, Y2, Y8, Y9)  // S_MUL(x1, t0)
+	MULT16_32_Q15_8X(Y6, Y7, Y3, Y10, Y9) // S_MUL(x2, t1)
+	VPSUBD Y10, Y8, Y12                    // yi
+
+	INTERLEAVE8_STORE(Y12, Y11, DI, 0, Y0, Y1)
+
+	ADDQ $64, SI
+	SUBQ $64, DX
+	ADDQ $16, BX
+	ADDQ $16, R8
+	ADDQ $64, DI
+	DECQ CX
+	JNZ  prerot_loop
+
+prerot_done:
+	VZEROUPPER
+	RET
+
+// Post-rotates 8 bins: RE/IM in, YR/YI out; T0/T0H and T1/T1H are the trig
+// lanes. Clobbers P and T.
+#define POSTROT8(RE, IM, T0, T0H, T1, T1H, YR, YI, P, T) \
+	MULT16_32_Q15_8X(T0, T0H, RE, P, T);                  \
+	MULT16_32_Q15_8X(T1, T1H, IM, YR, T);                 \
+	VPADDD  YR, P, YR;                                    \
+	MULT16_32_Q15_8X(T1, T1H, RE, P, T);                  \
+	MULT16_32_Q15_8X(T0, T0H, IM, YI, T);                 \
+	VPSUBD  YI, P, YI;                                    \
+	VPADDD  Y14, YR, YR;                                  \
+	VPADDD  Y14, YI, YI;                                  \
+	VPSRAD  X13, YR, YR;                                  \
+	VPSRAD  X13, YI, YI
+
+// func imdctPostRotateAVX2(y []int32, cpx []FFTCpx, trig []int16, n4, postShift, blocks int)
+//
+// Runs blocks*8 bins from each end of the FIXED_POINT clt_mdct_backward
+// post-rotation. Bin k (re = cpx[k].i, im = cpx[k].r) gives
+//
+//	yr = PSHR32_ovflw(S_MUL(re, t[k]) + S_MUL(im, t[N4+k]), postShift)
+//	yi = PSHR32_ovflw(S_MUL(re, t[N4+k]) - S_MUL(im, t[k]), postShift)
+//
+// stored at y[2k] and y[N2-1-2k]. Each iteration takes the 8 front bins and
+// the 8 mirrored back bins, so every store is a whole run of pairs.
+TEXT ·imdctPostRotateAVX2(SB), NOSPLIT, $0-96
+	MOVQ y_base+0(FP), DI
+	MOVQ cpx_base+24(FP), SI
+	MOVQ trig_base+48(FP), BX
+	MOVQ n4+72(FP), R8
+	MOVQ postShift+80(FP), CX
+	MOVQ blocks+88(FP), R9
+
+	LEAQ -8(R8), DX
+	LEAQ (DI)(DX*8), R10 // y[2kb], kb = N4-8
+	LEAQ (SI)(DX*8), R11 // cpx[kb]
+	LEAQ (BX)(DX*2), R12 // t[kb]
+	LEAQ (BX)(R8*2), R13 // t[N4+k]
+	LEAQ (R12)(R8*2), R14 // t[N4+kb]
+
+	MOVQ         CX, X13
+	MOVL         $1, AX
+	SHLL         CX, AX
+	SHRL         $1, AX
+	VMOVD        AX, X14
+	VPBROADCASTD X14, Y14 // rounding bias
+	VMOVDQU      fixedKernelRev8<>(SB), Y15
+
+	TESTQ R9, R9
+	JZ    postrot_done
+
+postrot_loop:
+	VMOVDQU (SI), Y0
+	VMOVDQU 32(SI), Y1
+	DEINTERLEAVE8(Y0, Y1, Y2, Y3) // Y2 = im, Y3 = re
+	TRIG8((BX), Y4, Y5)
+	TRIG8((R13), Y6, Y7)
+	POSTROT8(Y3, Y2, Y4, Y5, Y6, Y7, Y10, Y11, Y8, Y9) // front yr, yi
+
+	VMOVDQU (R11), Y0
+	VMOVDQU 32(R11), Y1
+	DEINTERLEAVE8(Y0, Y1, Y2, Y3)
+	TRIG8((R12), Y4, Y5)
+	TRIG8((R14), Y6, Y7)
+	POSTROT8(Y3, Y2, Y4, Y5, Y6, Y7, Y12, Y0, Y8, Y9) // back yr, yi
+
+	VPERMD Y0, Y15, Y0   // back yi reversed pairs with the front bins
+	VPERMD Y11, Y15, Y11 // front yi reversed pairs with the back bins
+	INTERLEAVE8_STORE(Y10, Y0, DI, 0, Y1, Y2)
+	INTERLEAVE8_STORE(Y12, Y11, R10, 0, Y1, Y2)
+
+	ADDQ $64, SI
+	SUBQ $64, R11
+	ADDQ $16, BX
+	ADDQ $16, R13
+	SUBQ $16, R12
+	SUBQ $16, R14
+	ADDQ $64, DI
+	SUBQ $64, R10
+	DECQ R9
+	JNZ  postrot_loop
+
+postrot_done:
+	VZEROUPPER
+	RET
@@ -0,0 +1,87 @@
+//go:build gopus_fixed_point && arm64 && !purego
+
+package fixedpoint
+
+//go:noescape
+func combFilterConstBlocksNeon(dst, src, delay []int32, g10, g11, g12 int32, blocks int)
+
+//go:noescape
+func kfBfly4M1GroupsNeon(fout []FFTCpx, groups int)
+
+//go:noescape
+func kfBfly2GroupsNeon(fout []FFTCpx, groups int)
+
+//go:noescape
+func kfBfly4TwNeon(fout []FFTCpx, tw []FFTTwiddle, fstride, m, n, mm int)
+
+//go:noescape
+func imdctPreRotateNeon(y, in []int32, trig []int16, n4, preShift, blocks int)
+
+//go:noescape
+func imdctPostRotateNeon(y []int32, cpx []FFTCpx, trig []int16, n4, postShift, blocks int)
+
+// combFilterConstVector runs the leading multiple of 4 samples of
+// CombFilterConst with the NEON kernel and returns how many it processed.
+func combFilterConstVector(dst, src, delay []int32, n int, g10, g11, g12 int16) int {
+	blocks := n / 4
+	if blocks == 0 {
+		return 0
+	}
+	done := 4 * blocks
+	combFilterConstBlocksNeon(dst[:done], src[:done], delay[:done+4],
+		int32(g10), int32(g11), int32(g12), blocks)
+	return done
+}
+
+// kfBfly4M1Vector runs every group of the degenerate radix-4 butterfly over
+// fout (4 complex samples per group) with the NEON kernel.
+func kfBfly4M1Vector(fout []FFTCpx, groups int) int {
+	if groups == 0 {
+		return 0
+	}
+	kfBfly4M1GroupsNeon(fout[:4*groups], groups)
+	return groups
+}
+
+// kfBfly2Vector runs every group of the m == 4 radix-2 butterfly over fout
+// (8 complex samples per group) with the NEON kernel.
+func kfBfly2Vector(fout []FFTCpx, groups int) int {
+	if groups == 0 {
+		return 0
+	}
+	kfBfly2GroupsNeon(fout[:8*groups], groups)
+	return groups
+}
+
+// kfBfly4TwVector runs the whole twiddled radix-4 butterfly when m is even
+// and reports whether it did.
+func kfBfly4TwVector(fout []FFTCpx, tw []FFTTwiddle, fstride, m, n, mm int) bool {
+	if m%2 != 0 {
+		return false
+	}
+	kfBfly4TwNeon(fout, tw, fstride, m, n, mm)
+	return true
+}
+
+// imdctPreRotateVector pre-rotates the leading multiple of 4 bins of a
+// unit-stride backward MDCT into y in natural order and returns how many it
+// processed.
+func imdctPreRotateVector(y, in []int32, trig []int16, n4, preShift int) int {
+	blocks := n4 / 4
+	if blocks == 0 {
+		return 0
+	}
+	imdctPreRotateNeon(y[:8*blocks], in[:2*n4], trig[:2*n4], n4, preShift, blocks)
+	return 4 * blocks
+}
+
+// imdctPostRotateVector post-rotates matching multiples of 4 bins from both
+// ends of the backward MDCT and returns how many it took from each end.
+func imdctPostRotateVector(y []int32, cpx []FFTCpx, trig []int16, n4, postShift int) int {
+	blocks := n4 / 8
+	if blocks == 0 {
+		return 0
+	}
+	imdctPostRotateNeon(y[:2*n4], cpx[:n4], trig[:2*n4], n4, postShift, blocks)
+	return 4 * blocks
+}
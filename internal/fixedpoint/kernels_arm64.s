@@ -0,0 +1,520 @@
+//go:build gopus_fixed_point && arm64 && !purego
+
+#include "textflag.h"
+
+// func combFilterConstBlocksNeon(dst, src, delay []int32, g10, g11, g12 int32, blocks int)
+//
+// Runs blocks*4 steps of the FIXED_POINT constant-gain comb filter. Per output
+// i, with delay[i..i+4] = x[i-T-2..i-T+2]:
+//
+//	dst[i] = SATURATE(src[i] + MULT16_32_Q15(g10, x[i-T])
+//	                         + MULT16_32_Q15(g11, x[i-T+1]+x[i-T-1])
+//	                         + MULT16_32_Q15(g12, x[i-T+2]+x[i-T-2]) - 1, SIG_SAT)
+//
+// MULT16_32_Q15 is SMULL/SMULL2 into exact 64-bit products followed by SHRN
+// #15, which keeps bits 15..46 — the int32 truncation of the scalar int64
+// shift. Adds wrap like the scalar int32 arithmetic. dst may alias src; the
+// caller guarantees T >= 15, so a 4-wide block only reads delay samples that
+// earlier blocks have already written.
+TEXT ·combFilterConstBlocksNeon(SB), NOSPLIT, $0-96
+	MOVD dst_base+0(FP), R0
+	MOVD src_base+24(FP), R1
+	MOVD delay_base+48(FP), R2
+	MOVW g10+72(FP), R3
+	MOVW g11+76(FP), R4
+	MOVW g12+80(FP), R5
+	MOVD blocks+88(FP), R6
+
+	CBZ R6, comb_done
+
+	VDUP R3, V16.S4
+	VDUP R4, V17.S4
+	VDUP R5, V18.S4
+	MOVW $536870911, R3
+	VDUP R3, V19.S4 // SIG_SAT
+	MOVW $-536870911, R3
+	VDUP R3, V20.S4 // -SIG_SAT
+	MOVW $1, R3
+	VDUP R3, V21.S4 // bias
+
+comb_loop:
+	VLD1 (R2), [V0.S4] // x[i-T-2]
+	ADD  $4, R2, R3
+	VLD1 (R3), [V1.S4] // x[i-T-1]
+	ADD  $8, R2, R3
+	VLD1 (R3), [V2.S4] // x[i-T]
+	ADD  $12, R2, R3
+	VLD1 (R3), [V3.S4] // x[i-T+1]
+	ADD  $16, R2, R3
+	VLD1 (R3), [V4.S4] // x[i-T+2]
+	VLD1 (R1), [V7.S4]
+
+	WORD $0x4EA18465 // ADD V5.4S, V3.4S, V1.4S
+	WORD $0x4EA08486 // ADD V6.4S, V4.4S, V0.4S
+
+	WORD $0x0EB0C056 // SMULL  V22.2D, V2.2S, V16.2S
+	WORD $0x4EB0C057 // SMULL2 V23.2D, V2.4S, V16.4S
+	WORD $0x0F3186D8 // SHRN   V24.2S, V22.2D, #15
+	WORD $0x4F3186F8 // SHRN2  V24.4S, V23.2D, #15
+	WORD $0x0EB1C0B6 // SMULL  V22.2D, V5.2S, V17.2S
+	WORD $0x4EB1C0B7 // SMULL2 V23.2D, V5.4S, V17.4S
+	WORD $0x0F3186D9 // SHRN   V25.2S, V22.2D, #15
+	WORD $0x4F3186F9 // SHRN2  V25.4S, V23.2D, #15
+	WORD $0x0EB2C0D6 // SMULL  V22.2D, V6.2S, V18.2S
+	WORD $0x4EB2C0D7 // SMULL2 V23.2D, V6.4S, V18.4S
+	WORD $0x0F3186DA // SHRN   V26.2S, V22.2D, #15
+	WORD $0x4F3186FA // SHRN2  V26.4S, V23.2D, #15
+
+	WORD $0x4EB884E7 // ADD  V7.4S, V7.4S, V24.4S
+	WORD $0x4EB984E7 // ADD  V7.4S, V7.4S, V25.4S
+	WORD $0x4EBA84E7 // ADD  V7.4S, V7.4S, V26.4S
+	WORD $0x6EB584E7 // SUB  V7.4S, V7.4S, V21.4S
+	WORD $0x4EB36CE7 // SMIN V7.4S, V7.4S, V19.4S
+	WORD $0x4EB464E7 // SMAX V7.4S, V7.4S, V20.4S
+
+	VST1 [V7.S4], (R0)
+
+	ADD  $16, R0
+	ADD  $16, R1
+	ADD  $16, R2
+	SUBS $1, R6
+	BNE  comb_loop
+
+comb_done:
+	RET
+
+// func kfBfly4M1GroupsNeon(fout []FFTCpx, groups int)
+//
+// Runs the degenerate (m == 1) radix-4 KISS-FFT butterfly, one group of four
+// complex samples per iteration. With F = {f0, f1} and G = {f2, f3}:
+//
+//	a = F + G = {f0+f2, f1+f3}      d = F - G = {s0, d1}
+//	f0' = a.lo + a.hi               f2' = a.lo - a.hi
+//	f1' = s0 + {d1.i, -d1.r}        f3' = s0 - {d1.i, -d1.r}
+//
+// All adds wrap like the scalar *_ovflw helpers; the sign flip is a wrapping
+// MUL by {1, -1}.
+TEXT ·kfBfly4M1GroupsNeon(SB), NOSPLIT, $0-32
+	MOVD fout_base+0(FP), R0
+	MOVD groups+24(FP), R1
+
+	CBZ R1, bfly4m1_done
+
+	MOVW $1, R2
+	VDUP R2, V16.S4
+	MOVW $-1, R2
+	VMOV R2, V16.S[1]
+	VMOV R2, V16.S[3] // {1, -1, 1, -1}
+
+bfly4m1_loop:
+	VLD1 (R0), [V0.S4, V1.S4]
+
+	WORD $0x4EA18402 // ADD    V2.4S, V0.4S, V1.4S
+	WORD $0x6EA18403 // SUB    V3.4S, V0.4S, V1.4S
+	WORD $0x6E024044 // EXT    V4.16B, V2.16B, V2.16B, #8
+	WORD $0x4EA48445 // ADD    V5.4S, V2.4S, V4.4S (f0')
+	WORD $0x6EA48446 // SUB    V6.4S, V2.4S, V4.4S (f2')
+	WORD $0x6E034067 // EXT    V7.16B, V3.16B, V3.16B, #8
+	WORD $0x4EA008E7 // REV64  V7.4S, V7.4S
+	WORD $0x4EB09CE7 // MUL    V7.4S, V7.4S, V16.4S
+	WORD $0x4EA78471 // ADD    V17.4S, V3.4S, V7.4S (f1')
+	WORD $0x6EA78472 // SUB    V18.4S, V3.4S, V7.4S (f3')
+	WORD $0x4ED138A0 // ZIP1   V0.2D, V5.2D, V17.2D
+	WORD $0x4ED238C1 // ZIP1   V1.2D, V6.2D, V18.2D
+
+	VST1 [V0.S4, V1.S4], (R0)
+
+	ADD  $32, R0
+	SUBS $1, R1
+	BNE  bfly4m1_loop
+
+bfly4m1_done:
+	RET
+
+// func kfBfly2GroupsNeon(fout []FFTCpx, groups int)
+//
+// Runs the m == 4 radix-2 KISS-FFT butterfly over groups of 8 complex samples,
+// A = fout[0:4] and B = fout[4:8]. The twiddled inputs t_k are built lane-wise
+// from B and its pair swap Bs:
+//
+//	t0 = B0                        t1 = tw*{b1.r + b1.i, b1.i - b1.r}
+//	t2 = {b2.i, -b2.r}             t3 = tw*{b3.i - b3.r, -b3.r - b3.i}
+//
+// with wrapping MLA/MUL/MLS against 0/±1 lane constants, and only the upper
+// halves (k = 1, 3) go through the SMULL2/SHRN MULT16_32_Q15. Then A' = A + t
+// and B' = A - t.
+TEXT ·kfBfly2GroupsNeon(SB), NOSPLIT, $0-32
+	MOVD fout_base+0(FP), R0
+	MOVD groups+24(FP), R1
+
+	CBZ R1, bfly2_done
+
+	MOVW $23170, R2
+	VDUP R2, V16.S4 // tw
+	MOVW $1, R2
+	VDUP R2, V17.S4
+	VDUP R2, V19.S4
+	MOVW $-1, R2
+	VMOV R2, V17.S[1]
+	VMOV R2, V17.S[3] // {1, -1, 1, -1}
+	VDUP R2, V18.S4
+	MOVW $1, R2
+	VMOV R2, V18.S[2]
+	MOVD $0, R2
+	VMOV R2, V18.D[0] // {0, 0, 1, -1}
+	VMOV R2, V19.D[0] // {0, 0, 1, 1}
+
+bfly2_loop:
+	VLD1 (R0), [V0.S4, V1.S4, V2.S4, V3.S4]
+
+	WORD $0x4EA00844 // REV64  V4.4S, V2.4S
+	WORD $0x4EA21C45 // MOV    V5.16B, V2.16B
+	WORD $0x4EB29485 // MLA    V5.4S, V4.4S, V18.4S
+	WORD $0x4EB0C0A6 // SMULL2 V6.2D, V5.4S, V16.4S
+	WORD $0x0F3184C6 // SHRN   V6.2S, V6.2D, #15
+	WORD $0x4EC638A5 // ZIP1   V5.2D, V5.2D, V6.2D (t0, t1)
+	WORD $0x4EA00867 // REV64  V7.4S, V3.4S
+	WORD $0x4EB19CE7 // MUL    V7.4S, V7.4S, V17.4S
+	WORD $0x6EB39467 // MLS    V7.4S, V3.4S, V19.4S
+	WORD $0x4EB0C0E6 // SMULL2 V6.2D, V7.4S, V16.4S
+	WORD $0x0F3184C6 // SHRN   V6.2S, V6.2D, #15
+	WORD $0x4EC638E7 // ZIP1   V7.2D, V7.2D, V6.2D (t2, t3)
+	WORD $0x4EA58414 // ADD    V20.4S, V0.4S, V5.4S
+	WORD $0x4EA78435 // ADD    V21.4S, V1.4S, V7.4S
+	WORD $0x6EA58416 // SUB    V22.4S, V0.4S, V5.4S
+	WORD $0x6EA78437 // SUB    V23.4S, V1.4S, V7.4S
+
+	VST1 [V20.S4, V21.S4, V22.S4, V23.S4], (R0)
+
+	ADD  $64, R0
+	SUBS $1, R1
+	BNE  bfly2_loop
+
+bfly2_done:
+	RET
+
+// func kfBfly4TwNeon(fout []FFTCpx, tw []FFTTwiddle, fstride, m, n, mm int)
+//
+// Runs the twiddled (m > 1, m even) radix-4 KISS-FFT butterfly, two
+// consecutive j per iteration. The packed int16 twiddles are inserted lane by
+// lane, widened with SHL/SSHR, and each C_MUL half is an SMULL/SMULL2/SHRN
+// MULT16_32_Q15, so every output matches kf_bfly4 exactly, including int32
+// wraparound.
+TEXT ·kfBfly4TwNeon(SB), NOSPLIT, $0-80
+	MOVD fout_base+0(FP), R0
+	MOVD tw_base+24(FP), R1
+	MOVD fstride+48(FP), R2
+	MOVD m+56(FP), R3
+	MOVD n+64(FP), R4
+	MOVD mm+72(FP), R5
+
+	CBZ R4, bfly4tw_done
+
+	LSL $3, R3, R6  // m legs in bytes
+	ADD R6, R6, R7  // 2m
+	ADD R6, R7, R8  // 3m
+	LSL $3, R5, R5  // mm in bytes
+	LSL $2, R2, R2  // tw1 step per j in bytes
+	ADD R2, R2, R9  // tw2 step
+	ADD R2, R9, R10 // tw3 step
+
+	MOVW $1, R12
+	VDUP R12, V30.S4
+	VDUP R12, V31.S4
+	MOVW $-1, R12
+	VMOV R12, V30.S[0]
+	VMOV R12, V30.S[2] // {-1, 1, -1, 1}
+	VMOV R12, V31.S[1]
+	VMOV R12, V31.S[3] // {1, -1, 1, -1}
+
+bfly4tw_group:
+	MOVD R0, R11
+	LSR  $1, R3, R12
+	MOVD $0, R13 // tw1 offset
+	MOVD $0, R14 // tw2 offset
+	MOVD $0, R15 // tw3 offset
+
+bfly4tw_loop:
+	ADD   R1, R13, R16
+	MOVWU (R16), R17
+	VMOV  R17, V4.S[0]
+	ADD   R2, R16
+	MOVWU (R16), R17
+	VMOV  R17, V4.S[1]
+	ADD   R1, R14, R16
+	MOVWU (R16), R17
+	VMOV  R17, V5.S[0]
+	ADD   R9, R16
+	MOVWU (R16), R17
+	VMOV  R17, V5.S[1]
+	ADD   R1, R15, R16
+	MOVWU (R16), R17
+	VMOV  R17, V6.S[0]
+	ADD   R10, R16
+	MOVWU (R16), R17
+	VMOV  R17, V6.S[1]
+	ADD   R9, R13
+	ADD   R9<<1, R14
+	ADD   R10<<1, R15
+
+	ADD  R11, R6, R19
+	ADD  R11, R7, R20
+	ADD  R11, R8, R21
+	VLD1 (R11), [V0.S4]
+	VLD1 (R19), [V1.S4]
+	VLD1 (R20), [V2.S4]
+	VLD1 (R21), [V3.S4]
+
+	WORD $0x4E843884 // ZIP1   V4.4S, V4.4S, V4.4S (s0)
+	WORD $0x4F305487 // SHL    V7.4S, V4.4S, #16
+	WORD $0x4F3004E7 // SSHR   V7.4S, V7.4S, #16
+	WORD $0x4F300484 // SSHR   V4.4S, V4.4S, #16
+	WORD $0x0EA7C038 // SMULL  V24.2D, V1.2S, V7.2S
+	WORD $0x4EA7C039 // SMULL2 V25.2D, V1.4S, V7.4S
+	WORD $0x0F318708 // SHRN   V8.2S, V24.2D, #15
+	WORD $0x4F318728 // SHRN2  V8.4S, V25.2D, #15
+	WORD $0x0EA4C038 // SMULL  V24.2D, V1.2S, V4.2S
+	WORD $0x4EA4C039 // SMULL2 V25.2D, V1.4S, V4.4S
+	WORD $0x0F31871B // SHRN   V27.2S, V24.2D, #15
+	WORD $0x4F31873B // SHRN2  V27.4S, V25.2D, #15
+	WORD $0x4EA00B7B // REV64  V27.4S, V27.4S
+	WORD $0x4EBE9768 // MLA    V8.4S, V27.4S, V30.4S
+	WORD $0x4E8538A5 // ZIP1   V5.4S, V5.4S, V5.4S (s1)
+	WORD $0x4F3054A7 // SHL    V7.4S, V5.4S, #16
+	WORD $0x4F3004E7 // SSHR   V7.4S, V7.4S, #16
+	WORD $0x4F3004A5 // SSHR   V5.4S, V5.4S, #16
+	WORD $0x0EA7C058 // SMULL  V24.2D, V2.2S, V7.2S
+	WORD $0x4EA7C059 // SMULL2 V25.2D, V2.4S, V7.4S
+	WORD $0x0F318709 // SHRN   V9.2S, V24.2D, #15
+	WORD $0x4F318729 // SHRN2  V9.4S, V25.2D, #15
+	WORD $0x0EA5C058 // SMULL  V24.2D, V2.2S, V5.2S
+	WORD $0x4EA5C059 // SMULL2 V25.2D, V2.4S, V5.4S
+	WORD $0x0F31871B // SHRN   V27.2S, V24.2D, #15
+	WORD $0x4F31873B // SHRN2  V27.4S, V25.2D, #15
+	WORD $0x4EA00B7B // REV64  V27.4S, V27.4S
+	WORD $0x4EBE9769 // MLA    V9.4S, V27.4S, V30.4S
+	WORD $0x4E8638C6 // ZIP1   V6.4S, V6.4S, V6.4S (s2)
+	WORD $0x4F3054C7 // SHL    V7.4S, V6.4S, #16
+	WORD $0x4F3004E7 // SSHR   V7.4S, V7.4S, #16
+	WORD $0x4F3004C6 // SSHR   V6.4S, V6.4S, #16
+	WORD $0x0EA7C078 // SMULL  V24.2D, V3.2S, V7.2S
+	WORD $0x4EA7C079 // SMULL2 V25.2D, V3.4S, V7.4S
+	WORD $0x0F31870A // SHRN   V10.2S, V24.2D, #15
+	WORD $0x4F31872A // SHRN2  V10.4S, V25.2D, #15
+	WORD $0x0EA6C078 // SMULL  V24.2D, V3.2S, V6.2S
+	WORD $0x4EA6C079 // SMULL2 V25.2D, V3.4S, V6.4S
+	WORD $0x0F31871B // SHRN   V27.2S, V24.2D, #15
+	WORD $0x4F31873B // SHRN2  V27.4S, V25.2D, #15
+	WORD $0x4EA00B7B // REV64  V27.4S, V27.4S
+	WORD $0x4EBE976A // MLA    V10.4S, V27.4S, V30.4S
+
+	WORD $0x6EA9840B // SUB    V11.4S, V0.4S, V9.4S (s5)
+	WORD $0x4EA98400 // ADD    V0.4S, V0.4S, V9.4S
+	WORD $0x4EAA850C // ADD    V12.4S, V8.4S, V10.4S (s3)
+	WORD $0x6EAA850D // SUB    V13.4S, V8.4S, V10.4S (s4)
+	WORD $0x6EAC840E // SUB    V14.4S, V0.4S, V12.4S
+	WORD $0x4EAC8400 // ADD    V0.4S, V0.4S, V12.4S
+	WORD $0x4EA009AD // REV64  V13.4S, V13.4S
+	WORD $0x4EBF9DAD // MUL    V13.4S, V13.4S, V31.4S
+	WORD $0x4EAD856F // ADD    V15.4S, V11.4S, V13.4S
+	WORD $0x6EAD856B // SUB    V11.4S, V11.4S, V13.4S
+
+	VST1 [V0.S4], (R11)
+	VST1 [V15.S4], (R19)
+	VST1 [V14.S4], (R20)
+	VST1 [V11.S4], (R21)
+
+	ADD  $16, R11
+	SUBS $1, R12
+	BNE  bfly4tw_loop
+
+	ADD  R5, R0
+	SUBS $1, R4
+	BNE  bfly4tw_group
+
+bfly4tw_done:
+	RET
+
+// func imdctPreRotateNeon(y, in []int32, trig []int16, n4, preShift, blocks int)
+//
+// Runs blocks*4 bins of the FIXED_POINT clt_mdct_backward pre-rotation with a
+// unit input stride, in natural (not bit-reversed) order:
+//
+//	x1 = SHL32(in[2i], preShift)      x2 = SHL32(in[N2-1-2i], preShift)
+//	y[2i]   = S_MUL(x1, t[i]) - S_MUL(x2, t[N4+i])
+//	y[2i+1] = S_MUL(x2, t[i]) + S_MUL(x1, t[N4+i])
+//
+// LD2 splits the even x1 from the front and the odd x2 from the back, which
+// REV64/EXT put back in bin order; ST2 re-interleaves the result.
+TEXT ·imdctPreRotateNeon(SB), NOSPLIT, $0-96
+	MOVD y_base+0(FP), R0
+	MOVD in_base+24(FP), R1
+	MOVD in_len+32(FP), R2
+	MOVD trig_base+48(FP), R3
+	MOVD n4+72(FP), R4
+	MOVD preShift+80(FP), R5
+	MOVD blocks+88(FP), R6
+
+	CBZ R6, prerot_done
+
+	ADD  R2<<2, R1, R2
+	SUB  $32, R2       // back block: in[N2-8-2i ..]
+	ADD  R4<<1, R3, R4 // t[N4+i]
+	VDUP R5, V16.S4
+
+prerot_loop:
+	VLD2 (R1), [V0.S4, V1.S4]
+	VLD2 (R2), [V2.S4, V3.S4]
+	VLD1 (R3), [V4.H4]
+	VLD1 (R4), [V5.H4]
+
+	WORD $0x4EA00863 // REV64  V3.4S, V3.4S
+	WORD $0x6E034063 // EXT    V3.16B, V3.16B, V3.16B, #8 (x2)
+	WORD $0x4EB04400 // SSHL   V0.4S, V0.4S, V16.4S
+	WORD $0x4EB04463 // SSHL   V3.4S, V3.4S, V16.4S
+	WORD $0x0F10A484 // SXTL   V4.4S, V4.4H
+	WORD $0x0F10A4A5 // SXTL   V5.4S, V5.4H
+	WORD $0x0EA4C078 // SMULL  V24.2D, V3.2S, V4.2S
+	WORD $0x4EA4C079 // SMULL2 V25.2D, V3.4S, V4.4S
+	WORD $0x0F318706 // SHRN   V6.2S, V24.2D, #15
+	WORD $0x4F318726 // SHRN2  V6.4S, V25.2D, #15
+	WORD $0x0EA5C018 // SMULL  V24.2D, V0.2S, V5.2S
+	WORD $0x4EA5C019 // SMULL2 V25.2D, V0.4S, V5.4S
+	WORD $0x0F318707 // SHRN   V7.2S, V24.2D, #15
+	WORD $0x4F318727 // SHRN2  V7.4S, V25.2D, #15
+	WORD $0x4EA784D5 // ADD    V21.4S, V6.4S, V7.4S (yr)
+	WORD $0x0EA4C018 // SMULL  V24.2D, V0.2S, V4.2S
+	WORD $0x4EA4C019 // SMULL2 V25.2D, V0.4S, V4.4S
+	WORD $0x0F318706 // SHRN   V6.2S, V24.2D, #15
+	WORD $0x4F318726 // SHRN2  V6.4S, V25.2D, #15
+	WORD $0x0EA5C078 // SMULL  V24.2D, V3.2S, V5.2S
+	WORD $0x4EA5C079 // SMULL2 V25.2D, V3.4S, V5.4S
+	WORD $0x0F318707 // SHRN   V7.2S, V24.2D, #15
+	WORD $0x4F318727 // SHRN2  V7.4S, V25.2D, #15
+	WORD $0x6EA784D4 // SUB    V20.4S, V6.4S, V7.4S (yi)
+
+	VST2 [V20.S4, V21.S4], (R0)
+
+	ADD  $32, R1
+	SUB  $32, R2
+	ADD  $8, R3
+	ADD  $8, R4
+	ADD  $32, R0
+	SUBS $1, R6
+	BNE  prerot_loop
+
+prerot_done:
+	RET
+
+// func imdctPostRotateNeon(y []int32, cpx []FFTCpx, trig []int16, n4, postShift, blocks int)
+//
+// Runs blocks*4 bins from each end of the FIXED_POINT clt_mdct_backward
+// post-rotation. Bin k (re = cpx[k].i, im = cpx[k].r) gives
+//
+//	yr = PSHR32_ovflw(S_MUL(re, t[k]) + S_MUL(im, t[N4+k]), postShift)
+//	yi = PSHR32_ovflw(S_MUL(re, t[N4+k]) - S_MUL(im, t[k]), postShift)
+//
+// stored at y[2k] and y[N2-1-2k]. Each iteration takes 4 front bins and the 4
+// mirrored back bins so both ST2 stores are whole runs of pairs. The shift is
+// an SSHL by -postShift, which truncates like the scalar arithmetic shift.
+TEXT ·imdctPostRotateNeon(SB), NOSPLIT, $0-96
+	MOVD y_base+0(FP), R0
+	MOVD cpx_base+24(FP), R1
+	MOVD trig_base+48(FP), R3
+	MOVD n4+72(FP), R4
+	MOVD postShift+80(FP), R5
+	MOVD blocks+88(FP), R6
+
+	CBZ R6, postrot_done
+
+	SUB $4, R4, R7
+	ADD R7<<3, R0, R8  // y[2kb], kb = N4-4
+	ADD R7<<3, R1, R9  // cpx[kb]
+	ADD R7<<1, R3, R10 // t[kb]
+	ADD R4<<1, R3, R11 // t[N4+k]
+	ADD R4<<1, R10, R12 // t[N4+kb]
+
+	NEG  R5, R13
+	VDUP R13, V16.S4
+	MOVD $1, R14
+	LSL  R5, R14, R14
+	LSR  $1, R14, R14
+	VDUP R14, V17.S4 // rounding bias
+
+postrot_loop:
+	VLD2 (R1), [V0.S4, V1.S4]
+	VLD1 (R3), [V2.H4]
+	VLD1 (R11), [V3.H4]
+	VLD2 (R9), [V4.S4, V5.S4]
+	VLD1 (R10), [V6.H4]
+	VLD1 (R12), [V7.H4]
+
+	WORD $0x0F10A442 // SXTL   V2.4S, V2.4H
+	WORD $0x0F10A463 // SXTL   V3.4S, V3.4H
+	WORD $0x0F10A4C6 // SXTL   V6.4S, V6.4H
+	WORD $0x0F10A4E7 // SXTL   V7.4S, V7.4H
+	WORD $0x0EA2C038 // SMULL  V24.2D, V1.2S, V2.2S (front)
+	WORD $0x4EA2C039 // SMULL2 V25.2D, V1.4S, V2.4S
+	WORD $0x0F31871A // SHRN   V26.2S, V24.2D, #15
+	WORD $0x4F31873A // SHRN2  V26.4S, V25.2D, #15
+	WORD $0x0EA3C018 // SMULL  V24.2D, V0.2S, V3.2S
+	WORD $0x4EA3C019 // SMULL2 V25.2D, V0.4S, V3.4S
+	WORD $0x0F318716 // SHRN   V22.2S, V24.2D, #15
+	WORD $0x4F318736 // SHRN2  V22.4S, V25.2D, #15
+	WORD $0x4EB68756 // ADD    V22.4S, V26.4S, V22.4S
+	WORD $0x0EA3C038 // SMULL  V24.2D, V1.2S, V3.2S
+	WORD $0x4EA3C039 // SMULL2 V25.2D, V1.4S, V3.4S
+	WORD $0x0F31871A // SHRN   V26.2S, V24.2D, #15
+	WORD $0x4F31873A // SHRN2  V26.4S, V25.2D, #15
+	WORD $0x0EA2C018 // SMULL  V24.2D, V0.2S, V2.2S
+	WORD $0x4EA2C019 // SMULL2 V25.2D, V0.4S, V2.4S
+	WORD $0x0F318713 // SHRN   V19.2S, V24.2D, #15
+	WORD $0x4F318733 // SHRN2  V19.4S, V25.2D, #15
+	WORD $0x6EB38753 // SUB    V19.4S, V26.4S, V19.4S
+	WORD $0x4EB186D6 // ADD    V22.4S, V22.4S, V17.4S
+	WORD $0x4EB18673 // ADD    V19.4S, V19.4S, V17.4S
+	WORD $0x4EB046D6 // SSHL   V22.4S, V22.4S, V16.4S
+	WORD $0x4EB04673 // SSHL   V19.4S, V19.4S, V16.4S
+	WORD $0x0EA6C0B8 // SMULL  V24.2D, V5.2S, V6.2S (back)
+	WORD $0x4EA6C0B9 // SMULL2 V25.2D, V5.4S, V6.4S
+	WORD $0x0F31871A // SHRN   V26.2S, V24.2D, #15
+	WORD $0x4F31873A // SHRN2  V26.4S, V25.2D, #15
+	WORD $0x0EA7C098 // SMULL  V24.2D, V4.2S, V7.2S
+	WORD $0x4EA7C099 // SMULL2 V25.2D, V4.4S, V7.4S
+	WORD $0x0F318714 // SHRN   V20.2S, V24.2D, #15
+	WORD $0x4F318734 // SHRN2  V20.4S, V25.2D, #15
+	WORD $0x4EB48754 // ADD    V20.4S, V26.4S, V20.4S
+	WORD $0x0EA7C0B8 // SMULL  V24.2D, V5.2S, V7.2S
+	WORD $0x4EA7C0B9 // SMULL2 V25.2D, V5.4S, V7.4S
+	WORD $0x0F31871A // SHRN   V26.2S, V24.2D, #15
+	WORD $0x4F31873A // SHRN2  V26.4S, V25.2D, #15
+	WORD $0x0EA6C098 // SMULL  V24.2D, V4.2S, V6.2S
+	WORD $0x4EA6C099 // SMULL2 V25.2D, V4.4S, V6.4S
+	WORD $0x0F318717 // SHRN   V23.2S, V24.2D, #15
+	WORD $0x4F318737 // SHRN2  V23.4S, V25.2D, #15
+	WORD $0x6EB78757 // SUB    V23.4S, V26.4S, V23.4S
+	WORD $0x4EB18694 // ADD    V20.4S, V20.4S, V17.4S
+	WORD $0x4EB186F7 // ADD    V23.4S, V23.4S, V17.4S
+	WORD $0x4EB04694 // SSHL   V20.4S, V20.4S, V16.4S
+	WORD $0x4EB046F7 // SSHL   V23.4S, V23.4S, V16.4S
+	WORD $0x4EA00AF7 // REV64  V23.4S, V23.4S
+	WORD $0x6E1742F7 // EXT    V23.16B, V23.16B, V23.16B, #8
+	WORD $0x4EA00A75 // REV64  V21.4S, V19.4S
+	WORD $0x6E1542B5 // EXT    V21.16B, V21.16B, V21.16B, #8
+
+	VST2 [V22.S4, V23.S4], (R0)
+	VST2 [V20.S4, V21.S4], (R8)
+
+	ADD  $32, R1
+	SUB  $32, R9
+	ADD  $8, R3
+	ADD  $8, R11
+	SUB  $8, R10
+	SUB  $8, R12
+	ADD  $32, R0
+	SUB  $32, R8
+	SUBS $1, R6
+	BNE  postrot_loop
+
+postrot_done:
+	RET
@@ -0,0 +1,39 @@
+//go:build gopus_fixed_point && ((!amd64 && !arm64) || purego)
+
+package fixedpoint
+
+// combFilterConstVector has no vector kernel on this target; the scalar loop
+// handles every sample.
+func combFilterConstVector(dst, src, delay []int32, n int, g10, g11, g12 int16) int {
+	return 0
+}
+
+// kfBfly4M1Vector has no vector kernel on this target; the scalar loop
+// handles every group.
+func kfBfly4M1Vector(fout []FFTCpx, groups int) int {
+	return 0
+}
+
+// kfBfly2Vector has no vector kernel on this target; the scalar loop handles
+// every group.
+func kfBfly2Vector(fout []FFTCpx, groups int) int {
+	return 0
+}
+
+// kfBfly4TwVector has no vector kernel on this target; the scalar loop
+// handles the twiddled radix-4 stage.
+func kfBfly4TwVector(fout []FFTCpx, tw []FFTTwiddle, fstride, m, n, mm int) bool {
+	return false
+}
+
+// imdctPreRotateVector has no vector kernel on this target; the scalar loop
+// rotates every bin.
+func imdctPreRotateVector(y, in []int32, trig []int16, n4, preShift int) int {
+	return 0
+}
+
+// imdctPostRotateVector has no vector kernel on this target; the scalar loop
+// rotates every bin.
+func imdctPostRotateVector(y []int32, cpx []FFTCpx, trig []int16, n4, postShift int) int {
+	return 0
+}
@@ -0,0 +1,362 @@
+//go:build gopus_fixed_point
+
+package fixedpoint
+
+import (
+	"fmt"
+	"math"
+	"math/rand"
+	"testing"
+)
+
+// combFilterConstScalar is the reference comb_filter_const_c loop the vector
+// kernels must reproduce bit for bit.
+func combFilterConstScalar(y, x []int32, base, t, n int, g10, g11, g12 int16) {
+	x4 := x[base-t-2]
+	x3 := x[base-t-1]
+	x2 := x[base-t]
+	x1 := x[base-t+1]
+	for i := 0; i < n; i++ {
+		x0 := x[base+i-t+2]
+		v := x[base+i] +
+			mult16x32q15(g10, x2) +
+			mult16x32q15(g11, x1+x3) +
+			mult16x32q15(g12, x0+x4)
+		y[base+i] = saturateSig(v - 1)
+		x4 = x3
+		x3 = x2
+		x2 = x1
+		x1 = x0
+	}
+}
+
+// kernelTestSignal mixes ordinary signal-range samples with values near the
+// int32 limits so the wrapping adds and the saturation are exercised.
+func kernelTestSignal(rng *rand.Rand, n int) []int32 {
+	x := make([]int32, n)
+	for i := range x {
+		switch rng.Intn(8) {
+		case 0:
+			x[i] = math.MaxInt32 - int32(rng.Intn(4))
+		case 1:
+			x[i] = math.MinInt32 + int32(rng.Intn(4))
+		default:
+			x[i] = int32(rng.Uint32()) >> uint(rng.Intn(8))
+		}
+	}
+	return x
+}
+
+func TestCombFilterConstVectorMatchesScalar(t *testing.T) {
+	rng := rand.New(rand.NewSource(33))
+	for trial := 0; trial < 200; trial++ {
+		period := combFilterMinPeriod + rng.Intn(100)
+		n := rng.Intn(120)
+		base := period + 2 + rng.Intn(4)
+		x := kernelTestSignal(rng, base+n+4)
+		g10, g11, g12 := int16(rng.Uint32()), int16(rng.Uint32()), int16(rng.Uint32())
+
+		for _, inPlace := range []bool{true, false} {
+			want := append([]int32(nil), x...)
+			got := append([]int32(nil), x...)
+			wantY, gotY := want, got
+			if !inPlace {
+				wantY = make([]int32, len(x))
+				gotY = make([]int32, len(x))
+			}
+			combFilterConstScalar(wantY, want, base, period, n, g10, g11, g12)
+			CombFilterConst(gotY, got, base, period, n, g10, g11, g12)
+			for i := range gotY {
+				if gotY[i] != wantY[i] {
+					t.Fatalf("trial %d (T=%d n=%d inPlace=%v): y[%d]=%d want %d",
+						trial, period, n, inPlace, i, gotY[i], wantY[i])
+				}
+			}
+		}
+	}
+}
+
+func TestKFBfly4M1VectorMatchesScalar(t *testing.T) {
+	rng := rand.New(rand.NewSource(34))
+	for _, n := range []int{0, 1, 2, 3, 7, 8, 15, 60, 61} {
+		const offset = 3
+		src := kernelTestSignal(rng, 2*(offset+4*n))
+		fout := make([]FFTCpx, offset+4*n)
+		for i := range fout {
+			fout[i] = FFTCpx{R: src[2*i], I: src[2*i+1]}
+		}
+		want := append([]FFTCpx(nil), fout...)
+		KFBfly4(fout, offset, nil, 0, 1, n, 0)
+
+		// Scalar reference: force every group through the scalar path.
+		for g := 0; g < n; g++ {
+			f := want[offset+4*g : offset+4*g+4]
+			s0 := FFTCpx{sub32Ovflw(f[0].R, f[2].R), sub32Ovflw(f[0].I, f[2].I)}
+			a0 := FFTCpx{add32Ovflw(f[0].R, f[2].R), add32Ovflw(f[0].I, f[2].I)}
+			s1 := FFTCpx{add32Ovflw(f[1].R, f[3].R), add32Ovflw(f[1].I, f[3].I)}
+			d1 := FFTCpx{sub32Ovflw(f[1].R, f[3].R), sub32Ovflw(f[1].I, f[3].I)}
+			f[0] = FFTCpx{add32Ovflw(a0.R, s1.R), add32Ovflw(a0.I, s1.I)}
+			f[2] = FFTCpx{sub32Ovflw(a0.R, s1.R), sub32Ovflw(a0.I, s1.I)}
+			f[1] = FFTCpx{add32Ovflw(s0.R, d1.I), sub32Ovflw(s0.I, d1.R)}
+			f[3] = FFTCpx{sub32Ovflw(s0.R, d1.I), add32Ovflw(s0.I, d1.R)}
+		}
+		for i := range fout {
+			if fout[i] != want[i] {
+				t.Fatalf("n=%d: fout[%d]=%+v want %+v", n, i, fout[i], want[i])
+			}
+		}
+	}
+}
+
+// kfBfly2Scalar is the reference m == 4 kf_bfly2 loop for one group.
+func kfBfly2Scalar(f []FFTCpx) {
+	tw := kfBfly2Tw
+	var t [4]FFTCpx
+	t[0] = f[4]
+	t[1] = FFTCpx{sMul(add32Ovflw(f[5].R, f[5].I), tw), sMul(sub32Ovflw(f[5].I, f[5].R), tw)}
+	t[2] = FFTCpx{f[6].I, neg32Ovflw(f[6].R)}
+	t[3] = FFTCpx{sMul(sub32Ovflw(f[7].I, f[7].R), tw), sMul(neg32Ovflw(add32Ovflw(f[7].I, f[7].R)), tw)}
+	for k := range t {
+		f[4+k] = FFTCpx{sub32Ovflw(f[k].R, t[k].R), sub32Ovflw(f[k].I, t[k].I)}
+		f[k] = FFTCpx{add32Ovflw(f[k].R, t[k].R), add32Ovflw(f[k].I, t[k].I)}
+	}
+}
+
+// kfBfly4TwScalar is the reference twiddled kf_bfly4 loop.
+func kfBfly4TwScalar(fout []FFTCpx, tw []FFTTwiddle, fstride, m, n, mm int) {
+	for i := 0; i < n; i++ {
+		for j := 0; j < m; j++ {
+			f := i*mm + j
+			s0 := cMul(fout[f+m], tw[j*fstride])
+			s1 := cMul(fout[f+2*m], tw[2*j*fstride])
+			s2 := cMul(fout[f+3*m], tw[3*j*fstride])
+			s5 := FFTCpx{sub32Ovflw(fout[f].R, s1.R), sub32Ovflw(fout[f].I, s1.I)}
+			f0 := FFTCpx{add32Ovflw(fout[f].R, s1.R), add32Ovflw(fout[f].I, s1.I)}
+			s3 := FFTCpx{add32Ovflw(s0.R, s2.R), add32Ovflw(s0.I, s2.I)}
+			s4 := FFTCpx{sub32Ovflw(s0.R, s2.R), sub32Ovflw(s0.I, s2.I)}
+			fout[f+2*m] = FFTCpx{sub32Ovflw(f0.R, s3.R), sub32Ovflw(f0.I, s3.I)}
+			fout[f] = FFTCpx{add32Ovflw(f0.R, s3.R), add32Ovflw(f0.I, s3.I)}
+			fout[f+m] = FFTCpx{add32Ovflw(s5.R, s4.I), sub32Ovflw(s5.I, s4.R)}
+			fout[f+3*m] = FFTCpx{sub32Ovflw(s5.R, s4.I), add32Ovflw(s5.I, s4.R)}
+		}
+	}
+}
+
+// mdctBackwardInPlace is the reference clt_mdct_backward_c port that runs the
+// rotations in place in out, as libopus does.
+func mdctBackwardInPlace(l *MDCTLookup, in, out []int32, window []int16, overlap, shift, stride int) {
+	trig, n := l.trigForShift(shift)
+	n2 := n >> 1
+	n4 := n >> 2
+	var sumval int32 = int32(n2)
+	var maxval int32
+	for i := 0; i < n2; i++ {
+		v := abs32(in[i*stride])
+		if v > maxval {
+			maxval = v
+		}
+		sumval = add32Ovflw(sumval, abs32(in[i*stride]>>11))
+	}
+	preShift := imax(0, 29-int(celtZlog2(1+maxval)))
+	postShift := imin(imax(0, 19-int(CeltILog2(abs32(sumval)))), preShift)
+	fftShift := preShift - postShift
+
+	y := out[overlap>>1:]
+	bitrev := l.kfft[shift].bitrev
+	for i := 0; i < n4; i++ {
+		x1 := shl32Ovflw(in[2*i*stride], preShift)
+		x2 := shl32Ovflw(in[stride*(n2-1-2*i)], preShift)
+		rev := int(bitrev[i])
+		y[2*rev+1] = add32Ovflw(sMul(x2, trig[i]), sMul(x1, trig[n4+i]))
+		y[2*rev] = sub32Ovflw(sMul(x1, trig[i]), sMul(x2, trig[n4+i]))
+	}
+	cpx := make([]FFTCpx, n4)
+	for i := range cpx {
+		cpx[i] = FFTCpx{R: y[2*i], I: y[2*i+1]}
+	}
+	opusFFTImpl(l.kfft[shift], cpx, fftShift)
+	for i := range cpx {
+		y[2*i], y[2*i+1] = cpx[i].R, cpx[i].I
+	}
+	yp0, yp1 := 0, n2-2
+	for i := 0; i < (n4+1)>>1; i++ {
+		re, im := y[yp0+1], y[yp0]
+		t0, t1 := trig[i], trig[n4+i]
+		yr := pshr32Ovflw(add32Ovflw(sMul(re, t0), sMul(im, t1)), postShift)
+		yi := pshr32Ovflw(sub32Ovflw(sMul(re, t1), sMul(im, t0)), postShift)
+		re, im = y[yp1+1], y[yp1]
+		y[yp0] = yr
+		y[yp1+1] = yi
+		t0, t1 = trig[n4-i-1], trig[n2-i-1]
+		yr = pshr32Ovflw(add32Ovflw(sMul(re, t0), sMul(im, t1)), postShift)
+		yi = pshr32Ovflw(sub32Ovflw(sMul(re, t1), sMul(im, t0)), postShift)
+		y[yp1] = yr
+		y[yp0+1] = yi
+		yp0 += 2
+		yp1 -= 2
+	}
+	for i := 0; i < overlap/2; i++ {
+		x1, x2 := out[overlap-1-i], out[i]
+		out[i] = sub32Ovflw(sMul(x2, window[overlap-1-i]), sMul(x1, window[i]))
+		out[overlap-1-i] = add32Ovflw(sMul(x2, window[i]), sMul(x1, window[overlap-1-i]))
+	}
+}
+
+func kernelTestCpx(rng *rand.Rand, n int) []FFTCpx {
+	src := kernelTestSignal(rng, 2*n)
+	c := make([]FFTCpx, n)
+	for i := range c {
+		c[i] = FFTCpx{R: src[2*i], I: src[2*i+1]}
+	}
+	return c
+}
+
+func TestKFBfly2VectorMatchesScalar(t *testing.T) {
+	rng := rand.New(rand.NewSource(36))
+	for _, n := range []int{0, 1, 2, 3, 15, 30, 60} {
+		const offset = 5
+		fout := kernelTestCpx(rng, offset+8*n+3)
+		want := append([]FFTCpx(nil), fout...)
+		KFBfly2(fout, offset, n)
+		for g := 0; g < n; g++ {
+			kfBfly2Scalar(want[offset+8*g:])
+		}
+		for i := range fout {
+			if fout[i] != want[i] {
+				t.Fatalf("n=%d: fout[%d]=%+v want %+v", n, i, fout[i], want[i])
+			}
+		}
+	}
+}
+
+func TestKFBfly4TwVectorMatchesScalar(t *testing.T) {
+	rng := rand.New(rand.NewSource(37))
+	for _, c := range []struct{ fstride, m, n, mm int }{
+		{1, 4, 1, 16}, {30, 4, 30, 16}, {15, 4, 15, 16}, {8, 8, 8, 32},
+		{2, 8, 3, 40}, {3, 12, 2, 48}, {1, 16, 1, 64}, {5, 5, 2, 20},
+	} {
+		const offset = 3
+		size := offset + (c.n-1)*c.mm + 4*c.m
+		fout := kernelTestCpx(rng, size+2)
+		tw := make([]FFTTwiddle, 3*(c.m-1)*c.fstride+1)
+		for i := range tw {
+			tw[i] = FFTTwiddle{R: int16(rng.Uint32()), I: int16(rng.Uint32())}
+		}
+		want := append([]FFTCpx(nil), fout...)
+		KFBfly4(fout, offset, tw, c.fstride, c.m, c.n, c.mm)
+		kfBfly4TwScalar(want[offset:], tw, c.fstride, c.m, c.n, c.mm)
+		for i := range fout {
+			if fout[i] != want[i] {
+				t.Fatalf("%+v: fout[%d]=%+v want %+v", c, i, fout[i], want[i])
+			}
+		}
+	}
+}
+
+func TestMDCTBackwardMatchesInPlace(t *testing.T) {
+	rng := rand.New(rand.NewSource(38))
+	for _, c := range []struct{ n, maxshift, overlap int }{
+		{1920, 3, 120}, {80, 0, 16}, {60, 0, 8},
+	} {
+		l := NewMDCTLookup(c.n, c.maxshift)
+		window := mdctWindow(c.overlap, 39)
+		for shift := 0; shift <= c.maxshift; shift++ {
+			n2 := (c.n >> shift) >> 1
+			for _, stride := range []int{1, 2, 8} {
+				for _, scale := range []uint{0, 6, 12} {
+					in := kernelTestSignal(rng, stride*(n2-1)+1)
+					for i := range in {
+						in[i] >>= scale
+					}
+					size := c.overlap>>1 + n2 + c.overlap
+					got := kernelTestSignal(rng, size)
+					want := append([]int32(nil), got...)
+					l.MDCTBackward(in, got, window, c.overlap, shift, stride)
+					mdctBackwardInPlace(l, in, want, window, c.overlap, shift, stride)
+					for i := range got {
+						if got[i] != want[i] {
+							t.Fatalf("N=%d shift=%d stride=%d scale=%d: out[%d]=%d want %d",
+								c.n, shift, stride, scale, i, got[i], want[i])
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+func BenchmarkCombFilterConst(b *testing.B) {
+	rng := rand.New(rand.NewSource(35))
+	const period, n = 120, 960
+	x := kernelTestSignal(rng, period+2+n)
+	for _, impl := range []string{"scalar", "dispatch"} {
+		b.Run(impl, func(b *testing.B) {
+			y := make([]int32, len(x))
+			b.SetBytes(4 * n)
+			for i := 0; i < b.N; i++ {
+				if impl == "scalar" {
+					combFilterConstScalar(y, x, period+2, period, n, 9000, 5000, 3000)
+				} else {
+					CombFilterConst(y, x, period+2, period, n, 9000, 5000, 3000)
+				}
+			}
+		})
+	}
+}
+
+func BenchmarkKFBfly4M1(b *testing.B) {
+	for _, n := range []int{60, 240} {
+		b.Run(fmt.Sprint(n), func(b *testing.B) {
+			fout := make([]FFTCpx, 4*n)
+			for i := range fout {
+				fout[i] = FFTCpx{R: int32(i * 7919), I: int32(i * -104729)}
+			}
+			b.SetBytes(int64(8 * len(fout)))
+			for i := 0; i < b.N; i++ {
+				KFBfly4(fout, 0, nil, 0, 1, n, 0)
+			}
+		})
+	}
+}
+
+func BenchmarkKFBfly2(b *testing.B) {
+	const n = 60
+	fout := kernelTestCpx(rand.New(rand.NewSource(40)), 8*n)
+	b.SetBytes(int64(8 * len(fout)))
+	for i := 0; i < b.N; i++ {
+		KFBfly2(fout, 0, n)
+	}
+}
+
+func BenchmarkKFBfly4Tw(b *testing.B) {
+	for _, c := range []struct{ fstride, m, n, mm int }{{30, 4, 30, 16}, {15, 8, 15, 32}} {
+		b.Run(fmt.Sprintf("m%d", c.m), func(b *testing.B) {
+			rng := rand.New(rand.NewSource(41))
+			fout := kernelTestCpx(rng, c.n*c.mm)
+			tw := make([]FFTTwiddle, 3*(c.m-1)*c.fstride+1)
+			for i := range tw {
+				tw[i] = FFTTwiddle{R: int16(rng.Uint32()), I: int16(rng.Uint32())}
+			}
+			b.SetBytes(int64(8 * len(fout)))
+			for i := 0; i < b.N; i++ {
+				KFBfly4(fout, 0, tw, c.fstride, c.m, c.n, c.mm)
+			}
+		})
+	}
+}
+
+func BenchmarkMDCTBackward(b *testing.B) {
+	l := NewStaticMDCTLookup48000()
+	window := mdctWindow(120, 42)
+	for _, shift := range []int{0, 3} {
+		n2 := (1920 >> shift) >> 1
+		b.Run(fmt.Sprint(n2), func(b *testing.B) {
+			in := mdctSignal(n2, 43)
+			out := make([]int32, 60+n2+120)
+			b.SetBytes(int64(4 * n2))
+			for i := 0; i < b.N; i++ {
+				l.MDCTBackward(in, out, window, 120, shift, 1)
+			}
+		})
+	}
+}
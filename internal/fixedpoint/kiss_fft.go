@@ -76,8 +76,10 @@ func neg32Ovflw(a int32) int32 {
 // fout must hold at least offset + 8*N elements.
 func KFBfly2(fout []FFTCpx, offset, n int) {
 	tw := kfBfly2Tw
-	base := offset
-	for i := 0; i < n; i++ {
+	// Groups are independent; the vector kernel takes a leading run.
+	i := kfBfly2Vector(fout[offset:offset+8*n], n)
+	base := offset + 8*i
+	for ; i < n; i++ {
 		// Fout points at base; Fout2 = Fout + 4.
 		f0 := base
 		f2 := base + 4
@@ -146,8 +148,10 @@ func KFBfly2(fout []FFTCpx, offset, n int) {
 // hold offset + (N-1)*mm + m3 + m elements.
 func KFBfly4(fout []FFTCpx, offset int, tw []FFTTwiddle, fstride, m, n, mm int) {
 	if m == 1 {
-		base := offset
-		for i := 0; i < n; i++ {
+		// Groups are independent; the vector kernel takes a leading run.
+		i := kfBfly4M1Vector(fout[offset:offset+4*n], n)
+		base := offset + 4*i
+		for ; i < n; i++ {
 			f := base
 			scratch0 := FFTCpx{
 				R: sub32Ovflw(fout[f+0].R, fout[f+2].R),
@@ -183,6 +187,10 @@ func KFBfly4(fout []FFTCpx, offset int, tw []FFTTwiddle, fstride, m, n, mm int)
 		return
 	}
 
+	// The vector kernel runs the whole twiddled path when it supports m.
+	if n > 0 && kfBfly4TwVector(fout[offset:offset+(n-1)*mm+4*m], tw[:3*(m-1)*fstride+1], fstride, m, n, mm) {
+		return
+	}
 	m2 := 2 * m
 	m3 := 3 * m
 	for i := 0; i < n; i++ {
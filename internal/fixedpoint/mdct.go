@@ -227,11 +227,20 @@ func (l *MDCTLookup) MDCTForward(in, out []int32, window []int16, overlap, shift
 	}
 }
 
+// imdctPostRotateBin post-rotates one FFT output bin of the backward MDCT,
+// swapping real and imag because the transform is an FFT rather than an IFFT.
+func imdctPostRotateBin(c FFTCpx, t0, t1 int16, postShift int) (yr, yi int32) {
+	re, im := c.I, c.R
+	yr = pshr32Ovflw(add32Ovflw(sMul(re, t0), sMul(im, t1)), postShift)
+	yi = pshr32Ovflw(sub32Ovflw(sMul(re, t1), sMul(im, t0)), postShift)
+	return yr, yi
+}
+
 // MDCTBackward reproduces libopus clt_mdct_backward_c in the FIXED_POINT
 // (non-QEXT) build. It pre-rotates the N2 frequency samples (read at the given
-// input stride) into bit-reversed complex order written into out at offset
-// overlap>>1, runs the in-place N4-point FFT, post-rotates and de-shuffles in
-// place, then mirrors the overlap region for TDAC. in holds stride*(N2-1)+1
+// input stride) into bit-reversed complex order, runs the N4-point FFT,
+// post-rotates and de-shuffles into out at offset overlap>>1, then mirrors the
+// overlap region for TDAC. in holds stride*(N2-1)+1
 // int32 frequency samples; out must hold at least overlap>>1 + N2 (and at least
 // overlap) int32 elements.
 func (l *MDCTLookup) MDCTBackward(in, out []int32, window []int16, overlap, shift, stride int) {
@@ -254,67 +263,41 @@ func (l *MDCTLookup) MDCTBackward(in, out []int32, window []int16, overlap, shif
 	postShift = imin(postShift, preShift)
 	fftShift := preShift - postShift
 
-	// out reinterpreted as complex starting at overlap>>1 (kiss_fft_cpx pairs).
+	// out[yBase:yBase+N2] is the complex work area libopus runs the FFT in.
 	yBase := overlap >> 1
+	y := out[yBase : yBase+n2]
+	bitrev := l.kfft[shift].bitrev
+	cpx := make([]FFTCpx, n4)
 
-	// Pre-rotate, storing directly in bit-reversed order.
-	{
-		xp1 := 0
-		xp2 := stride * (n2 - 1)
-		bitrev := l.kfft[shift].bitrev
-		for i := 0; i < n4; i++ {
-			rev := int(bitrev[i])
-			x1 := shl32Ovflw(in[xp1], preShift)
-			x2 := shl32Ovflw(in[xp2], preShift)
-			yr := add32Ovflw(sMul(x2, trig[i]), sMul(x1, trig[n4+i]))
-			yi := sub32Ovflw(sMul(x1, trig[i]), sMul(x2, trig[n4+i]))
-			// Swap real and imag because we use an FFT instead of an IFFT.
-			out[yBase+2*rev+1] = yr
-			out[yBase+2*rev] = yi
-			xp1 += 2 * stride
-			xp2 -= 2 * stride
+	// Pre-rotate into bit-reversed order. With a unit stride the vector
+	// kernel rotates a leading run into y in natural order, which is then
+	// scattered; the rest goes straight to its bit-reversed slot.
+	done := 0
+	if stride == 1 {
+		done = imdctPreRotateVector(y, in[:n2], trig[:n2], n4, preShift)
+		for i := 0; i < done; i++ {
+			cpx[bitrev[i]] = FFTCpx{R: y[2*i], I: y[2*i+1]}
 		}
 	}
-
-	// In-place N4 complex FFT over the complex view at yBase. The FFT operates
-	// on (re,im) pairs; copy out, transform, and write back so the post-rotate
-	// reads the transformed samples from the same out positions libopus does.
-	cpx := make([]FFTCpx, n4)
-	for i := range cpx {
-		cpx[i] = FFTCpx{R: out[yBase+2*i], I: out[yBase+2*i+1]}
-	}
-	opusFFTImpl(l.kfft[shift], cpx, fftShift)
-	for i := range cpx {
-		out[yBase+2*i] = cpx[i].R
-		out[yBase+2*i+1] = cpx[i].I
+	for i := done; i < n4; i++ {
+		x1 := shl32Ovflw(in[2*i*stride], preShift)
+		x2 := shl32Ovflw(in[stride*(n2-1-2*i)], preShift)
+		yr := add32Ovflw(sMul(x2, trig[i]), sMul(x1, trig[n4+i]))
+		yi := sub32Ovflw(sMul(x1, trig[i]), sMul(x2, trig[n4+i]))
+		// Swap real and imag because we use an FFT instead of an IFFT.
+		cpx[bitrev[i]] = FFTCpx{R: yi, I: yr}
 	}
 
-	// Post-rotate and de-shuffle from both ends to keep it in place.
-	{
-		yp0 := yBase
-		yp1 := yBase + n2 - 2
-		for i := 0; i < (n4+1)>>1; i++ {
-			// Swap real and imag because we use an FFT instead of an IFFT.
-			re := out[yp0+1]
-			im := out[yp0]
-			t0 := trig[i]
-			t1 := trig[n4+i]
-			yr := pshr32Ovflw(add32Ovflw(sMul(re, t0), sMul(im, t1)), postShift)
-			yi := pshr32Ovflw(sub32Ovflw(sMul(re, t1), sMul(im, t0)), postShift)
-			re = out[yp1+1]
-			im = out[yp1]
-			out[yp0] = yr
-			out[yp1+1] = yi
+	opusFFTImpl(l.kfft[shift], cpx, fftShift)
 
-			t0 = trig[n4-i-1]
-			t1 = trig[n2-i-1]
-			yr = pshr32Ovflw(add32Ovflw(sMul(re, t0), sMul(im, t1)), postShift)
-			yi = pshr32Ovflw(sub32Ovflw(sMul(re, t1), sMul(im, t0)), postShift)
-			out[yp1] = yr
-			out[yp0+1] = yi
-			yp0 += 2
-			yp1 -= 2
-		}
+	// Post-rotate and de-shuffle. libopus walks in place from both ends; with
+	// the FFT output held apart, bin k simply lands at y[2k] (real) and
+	// y[N2-1-2k] (imag). The vector kernel takes matching runs from both ends.
+	done = imdctPostRotateVector(y, cpx, trig[:n2], n4, postShift)
+	for k := done; k < n4-done; k++ {
+		yr, yi := imdctPostRotateBin(cpx[k], trig[k], trig[n4+k], postShift)
+		y[2*k] = yr
+		y[n2-1-2*k] = yi
 	}
 
 	// Mirror on both sides for TDAC.
@@ -3,6 +3,7 @@ package lpcnetplc
 import (
 	"github.com/thesyncim/gopus/internal/celt"
 	"github.com/thesyncim/gopus/internal/dnnblob"
+	"github.com/thesyncim/gopus/internal/dnnmath"
 	"github.com/thesyncim/gopus/internal/opusmath"
 )
 
@@ -813,13 +814,7 @@ func pitchXCorrFloat(dst, x, y []float32, length, maxPitch int) {
 		pitchXCorrFloatNEON(dst, x, y, length, maxPitch)
 		return
 	}
-	for i := range maxPitch {
-		var sum float32
-		for j := range length {
-			sum += x[j] * y[i+j]
-		}
-		dst[i] = sum
-	}
+	dnnmath.Xcorr(dst[:maxPitch], x[:length], y)
 }
 
 func innerProdFloat(x, y []float32, length int) float32 {
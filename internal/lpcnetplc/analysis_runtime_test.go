@@ -2,6 +2,8 @@ package lpcnetplc
 
 import (
 	"encoding/binary"
+	"math"
+	"math/rand"
 	"sort"
 	"testing"
 
@@ -54,7 +56,7 @@ func addAnalysisConv2DLayerSpec(specs map[string]analysisTestBlobSpec, spec Conv
 	}
 }
 
-func makePitchDNNTestBlob(t *testing.T) *dnnblob.Blob {
+func makePitchDNNTestBlob(t testing.TB) *dnnblob.Blob {
 	t.Helper()
 	specs := make(map[string]analysisTestBlobSpec)
 	for _, spec := range PitchDNNLinearLayerSpecs() {
@@ -142,3 +144,97 @@ func TestAnalysisBurgCepstralAnalysisDoesNotAllocate(t *testing.T) {
 		t.Fatalf("Analysis.BurgCepstralAnalysis allocs=%v want 0", allocs)
 	}
 }
+
+// TestPitchXCorrFloatMatchesScalar pins the scalar-build pitch cross-correlation
+// bit-for-bit to the libopus celt_pitch_xcorr_c loop on the analysis shape.
+func TestPitchXCorrFloatMatchesScalar(t *testing.T) {
+	if useNEONAnalysisKernels {
+		t.Skip("NEON analysis kernels use their own FMA order")
+	}
+	rng := rand.New(rand.NewSource(0x5c0))
+	y := make([]float32, PitchMaxPeriod+FrameSize)
+	for i := range y {
+		y[i] = float32(rng.NormFloat64() * 300)
+	}
+	x := y[PitchMaxPeriod:]
+	var got [pitchXcorrFeatures]float32
+	pitchXCorrFloat(got[:], x, y, FrameSize, pitchXcorrFeatures)
+	for i := range got {
+		var want float32
+		for j := range FrameSize {
+			want += x[j] * y[i+j]
+		}
+		if math.Float32bits(got[i]) != math.Float32bits(want) {
+			t.Fatalf("xcorr[%d]=%v want %v", i, got[i], want)
+		}
+	}
+}
+
+// TestConv2D3x3FloatMatchesScalar checks conv2D3x3Float bit-for-bit against a
+// per-position conv3x3Acc9 loop for the PitchDNN conv shapes and a height that
+// leaves a tail after the vector blocks.
+func TestConv2D3x3FloatMatchesScalar(t *testing.T) {
+	rng := rand.New(rand.NewSource(0xc0de))
+	for _, tc := range []struct{ in, out, height int }{
+		{pitchConv1InChannels, pitchConv1OutChannels, pitchXcorrFeatures},
+		{pitchConv2InChannels, pitchConv2OutChannels, pitchXcorrFeatures},
+		{2, 3, 21},
+	} {
+		weights := make([]byte, 4*9*tc.in*tc.out)
+		for i := 0; i < len(weights); i += 4 {
+			binary.LittleEndian.PutUint32(weights[i:], math.Float32bits(float32(rng.NormFloat64())))
+		}
+		view, err := dnnblob.Float32ViewFromBytes(weights, int32(len(weights)))
+		if err != nil {
+			t.Fatal(err)
+		}
+		layer := Conv2DLayer{FloatWeights: view, InChannels: tc.in, OutChannels: tc.out, KTime: 3, KHeight: 3}
+		inStride := tc.height + 2
+		in := make([]float32, 3*tc.in*inStride)
+		for i := range in {
+			in[i] = float32(rng.NormFloat64())
+		}
+		got := make([]float32, tc.out*tc.height)
+		conv2D3x3Float(got, &layer, in, tc.height, tc.height)
+		for o := 0; o < tc.out; o++ {
+			for j := 0; j < tc.height; j++ {
+				var want float32
+				for m := 0; m < tc.in; m++ {
+					var w [9]float32
+					for k := range w {
+						w[k] = view.At((o*tc.in+m)*9 + k)
+					}
+					r0 := in[m*inStride+j:]
+					r1 := in[(tc.in+m)*inStride+j:]
+					r2 := in[(2*tc.in+m)*inStride+j:]
+					want += conv3x3Acc9(w[0], w[1], w[2], w[3], w[4], w[5], w[6], w[7], w[8],
+						r0[0], r0[1], r0[2], r1[0], r1[1], r1[2], r2[0], r2[1], r2[2])
+				}
+				if g := got[o*tc.height+j]; math.Float32bits(g) != math.Float32bits(want) {
+					t.Fatalf("%dx%d height %d: out[%d][%d]=%v want %v", tc.in, tc.out, tc.height, o, j, g, want)
+				}
+			}
+		}
+	}
+}
+
+// BenchmarkAnalysisFrameFeatures measures the per-10 ms LPCNet feature
+// extraction the DRED encoder and deep-PLC priming run, PitchDNN included.
+func BenchmarkAnalysisFrameFeatures(b *testing.B) {
+	blob := makePitchDNNTestBlob(b)
+	var analysis Analysis
+	if err := analysis.SetModel(blob); err != nil {
+		b.Fatal(err)
+	}
+	var frame [FrameSize]float32
+	var features [NumTotalFeatures]float32
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		for j := range frame {
+			tm := float64(i*FrameSize+j) / 16000
+			frame[j] = float32(0.3*math.Sin(2*math.Pi*180*tm) + 0.1*math.Sin(2*math.Pi*1270*tm))
+		}
+		analysis.ComputeSingleFrameFeaturesFloat(features[:], frame[:])
+	}
+	b.ReportMetric(float64(b.N)/b.Elapsed().Seconds(), "frames/s")
+}
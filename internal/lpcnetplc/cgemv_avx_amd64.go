@@ -0,0 +1,18 @@
+//go:build amd64 && !purego
+
+package lpcnetplc
+
+import "github.com/thesyncim/gopus/internal/cpufeat"
+
+// cgemvUsesAVX runs the scalar-tier cgemv8x4FloatAccum through AVX2. Each
+// 4-column group is an exact integer dot product per row, converted and added
+// into that row's float accumulator in column order exactly as the scalar
+// loop does; the eight rows of a block are the eight YMM lanes, so the output
+// is bit-identical (TestCgemv8x4FloatAccumAVXMatchesScalar).
+var cgemvUsesAVX = cpufeat.AMD64.HasAVX2
+
+// cgemv8x4AccumAVX sets out[r] for r < rows to the unscaled float
+// accumulation of the 8x4-tiled int8 weights against q.
+//
+//go:noescape
+func cgemv8x4AccumAVX(out []float32, weights []byte, q []int16, rows, cols int)
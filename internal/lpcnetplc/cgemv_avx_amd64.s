@@ -0,0 +1,52 @@
+//go:build amd64 && !purego
+
+#include "textflag.h"
+
+// func cgemv8x4AccumAVX(out []float32, weights []byte, q []int16, rows, cols int)
+//
+// Per 8-row block and 4-column group, the 32 weight bytes are rows 0..7 times
+// columns 0..3. VPMADDWD forms the two column-pair sums per row, VPHADDD and
+// VPERMQ fold them into one int32 dot per row in row order, and the dot is
+// converted and added into the row's float accumulator.
+TEXT ·cgemv8x4AccumAVX(SB), NOSPLIT, $0-88
+	MOVQ out_base+0(FP), DI
+	MOVQ weights_base+24(FP), SI
+	MOVQ q_base+48(FP), R8
+	MOVQ rows+72(FP), CX
+	MOVQ cols+80(FP), R9
+	SHRQ $2, R9
+
+	TESTQ CX, CX
+	JLE   cgemv_done
+
+cgemv_rows:
+	VXORPS Y0, Y0, Y0
+	MOVQ   R8, BX
+	MOVQ   R9, DX
+	TESTQ  DX, DX
+	JLE    cgemv_store
+
+cgemv_cols:
+	VPBROADCASTQ (BX), Y5
+	VPMOVSXBW    (SI), Y1
+	VPMOVSXBW    16(SI), Y2
+	VPMADDWD     Y5, Y1, Y1
+	VPMADDWD     Y5, Y2, Y2
+	VPHADDD      Y2, Y1, Y3
+	VPERMQ       $0xD8, Y3, Y3
+	VCVTDQ2PS    Y3, Y3
+	VADDPS       Y3, Y0, Y0
+	ADDQ         $32, SI
+	ADDQ         $8, BX
+	DECQ         DX
+	JNZ          cgemv_cols
+
+cgemv_store:
+	VMOVUPS Y0, (DI)
+	ADDQ    $32, DI
+	SUBQ    $8, CX
+	JG      cgemv_rows
+
+cgemv_done:
+	VZEROUPPER
+	RET
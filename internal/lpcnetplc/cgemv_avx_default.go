@@ -0,0 +1,25 @@
+//go:build !amd64 || purego
+
+package lpcnetplc
+
+// cgemvUsesAVX is false off amd64; cgemv8x4FloatAccum runs its scalar loop.
+const cgemvUsesAVX = false
+
+// cgemv8x4AccumAVX is never called off amd64 (guarded by cgemvUsesAVX); the
+// stub mirrors the per-row accumulation.
+func cgemv8x4AccumAVX(out []float32, weights []byte, q []int16, rows, cols int) {
+	clear(out[:rows])
+	w := 0
+	for row := 0; row < rows; row += 8 {
+		for col := 0; col < cols; col += 4 {
+			for k := range 8 {
+				var dot int
+				for c := range 4 {
+					dot += int(int8(weights[w+4*k+c])) * int(q[col+c])
+				}
+				out[row+k] += float32(dot)
+			}
+			w += 32
+		}
+	}
+}
@@ -0,0 +1,18 @@
+//go:build amd64 && !purego
+
+package lpcnetplc
+
+import "github.com/thesyncim/gopus/internal/cpufeat"
+
+// conv3x3UsesAVX runs whole blocks of eight conv2D3x3Float outputs through AVX.
+// Each YMM lane is one output position and evaluates the nine products with
+// conv3x3Acc9's rounding and left-to-right order before adding into out, so
+// the result is bit-identical to the scalar DRED reference
+// (TestConv2D3x3FloatMatchesScalar).
+var conv3x3UsesAVX = cpufeat.AMD64.HasAVX2
+
+// conv3x3BlocksAVX adds conv3x3Acc9(w, in0[j:j+3], in1[j:j+3], in2[j:j+3])
+// into out[j] for j < 8*blocks. Each input row must hold 8*blocks+2 values.
+//
+//go:noescape
+func conv3x3BlocksAVX(out []float32, w *[9]float32, in0, in1, in2 []float32, blocks int)
@@ -0,0 +1,48 @@
+//go:build amd64 && !purego
+
+#include "textflag.h"
+
+// TAP multiplies the broadcast weight at w+woff by eight inputs at ptr+ioff
+// and adds the product into the running sum Y0.
+#define TAP(woff, ptr, ioff) \
+	VBROADCASTSS woff(R8), Y2; \
+	VMULPS       ioff(ptr), Y2, Y3; \
+	VADDPS       Y3, Y0, Y0
+
+// func conv3x3BlocksAVX(out []float32, w *[9]float32, in0, in1, in2 []float32, blocks int)
+TEXT ·conv3x3BlocksAVX(SB), NOSPLIT, $0-112
+	MOVQ out_base+0(FP), DI
+	MOVQ w+24(FP), R8
+	MOVQ in0_base+32(FP), SI
+	MOVQ in1_base+56(FP), BX
+	MOVQ in2_base+80(FP), DX
+	MOVQ blocks+104(FP), CX
+
+	TESTQ CX, CX
+	JLE   conv_done
+
+conv_loop:
+	// The first product seeds the sum, as in w00*i00 + w01*i01 + ...
+	VBROADCASTSS (R8), Y2
+	VMULPS       (SI), Y2, Y0
+	TAP(4, SI, 4)
+	TAP(8, SI, 8)
+	TAP(12, BX, 0)
+	TAP(16, BX, 4)
+	TAP(20, BX, 8)
+	TAP(24, DX, 0)
+	TAP(28, DX, 4)
+	TAP(32, DX, 8)
+	VADDPS  (DI), Y0, Y0
+	VMOVUPS Y0, (DI)
+
+	ADDQ $32, DI
+	ADDQ $32, SI
+	ADDQ $32, BX
+	ADDQ $32, DX
+	DECQ CX
+	JNZ  conv_loop
+
+conv_done:
+	VZEROUPPER
+	RET
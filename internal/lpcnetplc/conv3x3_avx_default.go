@@ -0,0 +1,17 @@
+//go:build !amd64 || purego
+
+package lpcnetplc
+
+// conv3x3UsesAVX is false off amd64; conv2D3x3Float runs its scalar loop.
+const conv3x3UsesAVX = false
+
+// conv3x3BlocksAVX is never called off amd64 (guarded by conv3x3UsesAVX); the
+// stub mirrors the per-lane accumulation.
+func conv3x3BlocksAVX(out []float32, w *[9]float32, in0, in1, in2 []float32, blocks int) {
+	for j := range out[:8*blocks] {
+		out[j] += conv3x3Acc9(w[0], w[1], w[2], w[3], w[4], w[5], w[6], w[7], w[8],
+			in0[j], in0[j+1], in0[j+2],
+			in1[j], in1[j+1], in1[j+2],
+			in2[j], in2[j+1], in2[j+2])
+	}
+}
@@ -411,7 +411,15 @@ func conv2D3x3Float(out []float32, layer *Conv2DLayer, in []float32, height, hst
 			w20 := weights.At(wBase + 6)
 			w21 := weights.At(wBase + 7)
 			w22 := weights.At(wBase + 8)
-			for j := range height {
+			j := 0
+			if conv3x3UsesAVX && height >= 8 {
+				w := [9]float32{w00, w01, w02, w10, w11, w12, w20, w21, w22}
+				blocks := height / 8
+				_ = in[in2+8*blocks+1]
+				conv3x3BlocksAVX(out[baseOut:baseOut+height], &w, in[in0:], in[in1:], in[in2:], blocks)
+				j = 8 * blocks
+			}
+			for ; j < height; j++ {
 				out[baseOut+j] += conv3x3Acc9(
 					w00, w01, w02, w10, w11, w12, w20, w21, w22,
 					in[in0+j+0], in[in0+j+1], in[in0+j+2],
@@ -277,6 +277,15 @@ func cgemv8x4IntAccum(out []float32, weights dnnblob.Int8View, scale dnnblob.Flo
 }
 
 func cgemv8x4FloatAccum(out []float32, weights dnnblob.Int8View, scale dnnblob.Float32View, rows, cols int, q []int16) {
+	if cgemvUsesAVX && rows > 0 {
+		w := weights.Bytes()
+		_, _, _ = out[rows-1], w[rows*cols-1], q[cols-1]
+		cgemv8x4AccumAVX(out, w, q, rows, cols)
+		for i := range rows {
+			out[i] *= scale.At(i)
+		}
+		return
+	}
 	clear(out[:rows])
 	wOffset := 0
 	for row := 0; row < rows; row += 8 {
@@ -3,6 +3,7 @@ package lpcnetplc
 import (
 	"encoding/binary"
 	"math"
+	"math/rand"
 	"testing"
 
 	"github.com/thesyncim/gopus/internal/dnnblob"
@@ -187,3 +188,50 @@ func TestConsumeFECOrPredictFallsBackToPrediction(t *testing.T) {
 		t.Fatalf("fecSkip=%d want 1", state.fecSkip)
 	}
 }
+
+// TestCgemv8x4FloatAccumAVXMatchesScalar checks cgemv8x4FloatAccum bit-for-bit
+// against the scalar-tier per-column-group float accumulation, with weights and
+// quantized inputs spanning their full integer ranges.
+func TestCgemv8x4FloatAccumAVXMatchesScalar(t *testing.T) {
+	rng := rand.New(rand.NewSource(0xc6e))
+	for _, tc := range []struct{ rows, cols int }{{8, 4}, {64, 88}, {192, 256}, {40, 1024}} {
+		weights := make([]byte, tc.rows*tc.cols)
+		rng.Read(weights)
+		scale := make([]byte, 4*tc.rows)
+		for i := 0; i < len(scale); i += 4 {
+			binary.LittleEndian.PutUint32(scale[i:], math.Float32bits(float32(rng.Float64()*1e-3)))
+		}
+		q := make([]int16, tc.cols)
+		for i := range q {
+			q[i] = int16(rng.Intn(1 << 16))
+		}
+		q[0] = math.MinInt16
+		wView, _ := dnnblob.Int8ViewFromBytes(weights, int32(len(weights)))
+		sView, _ := dnnblob.Float32ViewFromBytes(scale, int32(len(scale)))
+		got := make([]float32, tc.rows)
+		cgemv8x4FloatAccum(got, wView, sView, tc.rows, tc.cols, q)
+
+		want := make([]float32, tc.rows)
+		w := 0
+		for row := 0; row < tc.rows; row += 8 {
+			for col := 0; col < tc.cols; col += 4 {
+				for k := range 8 {
+					var dot int
+					for c := range 4 {
+						dot += int(int8(weights[w+4*k+c])) * int(q[col+c])
+					}
+					want[row+k] += float32(dot)
+				}
+				w += 32
+			}
+			for k := range 8 {
+				want[row+k] *= sView.At(row + k)
+			}
+		}
+		for i := range got {
+			if math.Float32bits(got[i]) != math.Float32bits(want[i]) {
+				t.Fatalf("%dx%d: out[%d]=%v want %v", tc.rows, tc.cols, i, got[i], want[i])
+			}
+		}
+	}
+}
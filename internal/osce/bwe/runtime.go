@@ -867,6 +867,7 @@ func adaconvProcessFrame(
 
 	// Compute output: cross-correlation of kernel0/kernel1 with the input
 	// signal. For sample i: y[i] = sum_k kernel[k] * input[i + k - leftPadding].
+	var sumNew, sumOld [maxFrame]float32
 	for o := range outChannels {
 		for ic := range inChannels {
 			// pInput points into inputBuf at p_input[i_in_channels * (frame_size+kernel_size)] +
@@ -875,21 +876,16 @@ func adaconvProcessFrame(
 			// Old kernel (kernel0 from previous frame's last_kernel).
 			kernelOld := lastKernel[(o*inChannels+ic)*kernelSize : (o*inChannels+ic)*kernelSize+kernelSize]
 			kernelNew := kernelBuf[(o*inChannels+ic)*kernelSize : (o*inChannels+ic)*kernelSize+kernelSize]
+			// New-frame contribution over the whole frame, old-kernel
+			// contribution over the overlap.
+			dnnmath.Xcorr(sumNew[:frameSize], kernelNew, inputBuf[base-leftPadding:])
+			dnnmath.Xcorr(sumOld[:overlapSize], kernelOld, inputBuf[base-leftPadding:])
 			for i := range frameSize {
-				// Compute new-frame contribution.
-				var sumNew float32
-				for k := range kernelSize {
-					sumNew += kernelNew[k] * inputBuf[base+i+k-leftPadding]
-				}
 				if i < overlapSize {
-					var sumOld float32
-					for k := range kernelSize {
-						sumOld += kernelOld[k] * inputBuf[base+i+k-leftPadding]
-					}
-					outputBuf[o*frameSize+i] += window[i] * sumOld
-					outputBuf[o*frameSize+i] += (1.0 - window[i]) * sumNew
+					outputBuf[o*frameSize+i] += window[i] * sumOld[i]
+					outputBuf[o*frameSize+i] += (1.0 - window[i]) * sumNew[i]
 				} else {
-					outputBuf[o*frameSize+i] += sumNew
+					outputBuf[o*frameSize+i] += sumNew[i]
 				}
 			}
 		}
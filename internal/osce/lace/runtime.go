@@ -1191,24 +1191,12 @@ func adacombProcessFrame(
 
 	// Output for last kernel over overlap_size samples (uses last_pitch_lag).
 	lastK := *lastPitchLag
-	for i := range overlapSize {
-		var sum float32
-		idx := pInputOffset + i - leftPadding - lastK
-		for k := range kernelSize {
-			sum += lastKernel[k] * inputBuf[idx+k]
-		}
-		outputBufLast[i] = sum
-	}
+	dnnmath.Xcorr(outputBufLast[:overlapSize], lastKernel[:kernelSize],
+		inputBuf[pInputOffset-leftPadding-lastK:])
 
 	// Output for new kernel over frame_size samples (uses pitch_lag).
-	for i := range frameSize {
-		var sum float32
-		idx := pInputOffset + i - leftPadding - pitchLag
-		for k := range kernelSize {
-			sum += kernelBuf[k] * inputBuf[idx+k]
-		}
-		outputBuf[i] = sum
-	}
+	dnnmath.Xcorr(outputBuf[:frameSize], kernelBuf[:kernelSize],
+		inputBuf[pInputOffset-leftPadding-pitchLag:])
 
 	// Overlap mix. libopus dnn/nndsp.c:adacomb_process_frame:
 	//   output_buffer[i] = last_global_gain*window[i]*output_buffer_last[i]
@@ -1312,6 +1300,7 @@ func adaconvProcessFrame(
 	}
 
 	// Cross-correlation.
+	var sumNew, sumOld [maxFrame]float32
 	for o := range outChannels {
 		for i := range frameSize {
 			outputBuf[o*frameSize+i] = 0
@@ -1320,20 +1309,14 @@ func adaconvProcessFrame(
 			base := ic*(frameSize+kernelSize) + kernelSize
 			kernelOld := lastKernel[(o*inChannels+ic)*kernelSize : (o*inChannels+ic)*kernelSize+kernelSize]
 			kernelNew := kernelBuf[(o*inChannels+ic)*kernelSize : (o*inChannels+ic)*kernelSize+kernelSize]
+			dnnmath.Xcorr(sumNew[:frameSize], kernelNew, inputBuf[base-leftPadding:])
+			dnnmath.Xcorr(sumOld[:overlapSize], kernelOld, inputBuf[base-leftPadding:])
 			for i := range frameSize {
-				var sumNew float32
-				for k := range kernelSize {
-					sumNew += kernelNew[k] * inputBuf[base+i+k-leftPadding]
-				}
 				if i < overlapSize {
-					var sumOld float32
-					for k := range kernelSize {
-						sumOld += kernelOld[k] * inputBuf[base+i+k-leftPadding]
-					}
-					outputBuf[o*frameSize+i] += window[i] * sumOld
-					outputBuf[o*frameSize+i] += (1.0 - window[i]) * sumNew
+					outputBuf[o*frameSize+i] += window[i] * sumOld[i]
+					outputBuf[o*frameSize+i] += (1.0 - window[i]) * sumNew[i]
 				} else {
-					outputBuf[o*frameSize+i] += sumNew
+					outputBuf[o*frameSize+i] += sumNew[i]
 				}
 			}
 		}
@@ -231,6 +231,24 @@ type SILKPLCState struct {
 
 	// Flag indicating if last frame was lost
 	LastFrameLost bool
+
+	// Work buffers for ConcealSILKWithLTP, reused across lost frames so a DTX
+	// gap conceals without allocating. The output buffer is returned to the
+	// caller and is valid until the next concealment on this state.
+	scratchOut  []int16
+	scratchSLTP []int16
+	scratchLTP  []int32
+	scratchLPC  []int32
+}
+
+// plcScratch returns buf resized to n and zeroed, growing it when needed.
+func plcScratch[T int16 | int32](buf *[]T, n int) []T {
+	if cap(*buf) < n {
+		*buf = make([]T, n)
+	}
+	s := (*buf)[:n]
+	clear(s)
+	return s
 }
 
 // NewSILKPLCState returns a SILKPLCState initialized to the libopus
@@ -476,7 +494,8 @@ func ConcealSILK(dec SILKDecoderState, frameSize int, fadeFactor float32) []floa
 //   - lossCnt: consecutive lost-frame count (0 for the first loss)
 //   - frameSize: samples to generate at the native SILK rate
 //
-// Returns the concealed mono samples at the native SILK rate (int16 Q0).
+// Returns the concealed mono samples at the native SILK rate (int16 Q0), in a
+// buffer owned by plcState that the next call overwrites.
 func ConcealSILKWithLTP(dec SILKDecoderStateExtended, plcState *SILKPLCState, lossCnt int, frameSize int) []int16 {
 	if frameSize <= 0 {
 		// Nothing to generate; a negative size would also panic make().
@@ -553,7 +572,8 @@ func ConcealSILKWithLTP(dec SILKDecoderStateExtended, plcState *SILKPLCState, lo
 	// Apply bandwidth expansion to previous LPC in-state, matching libopus
 	// silk_PLC_conceal() cadence across consecutive losses.
 	bwExpandQ12(plcState.PrevLPCQ12[:lpcOrder], bweCoef)
-	lpcQ12 := make([]int16, lpcOrder)
+	var lpcQ12Buf [maxLPCOrder]int16
+	lpcQ12 := lpcQ12Buf[:lpcOrder]
 	copy(lpcQ12, plcState.PrevLPCQ12[:lpcOrder])
 
 	// Initialize random scale on first lost frame
@@ -586,11 +606,11 @@ func ConcealSILKWithLTP(dec SILKDecoderStateExtended, plcState *SILKPLCState, lo
 	lag := int(plcState.PitchLQ8+128) >> 8
 
 	// Prepare output buffers
-	output := make([]int16, frameSize)
+	output := plcScratch(&plcState.scratchOut, frameSize)
 
 	// Generate excitation history buffer for random noise source
 	excHistory := dec.GetExcitationHistory()
-	randBuf := make([]int32, randBufSize)
+	var randBuf [randBufSize]int32
 	if len(excHistory) > 0 {
 		// Use excitation from subframe with lower energy
 		energy1, shift1 := computeEnergy(excHistory, prevGainQ10[0], subfrLength, (nbSubfr-2)*subfrLength)
@@ -609,7 +629,7 @@ func ConcealSILKWithLTP(dec SILKDecoderStateExtended, plcState *SILKPLCState, lo
 	}
 
 	// LTP synthesis filtering
-	sLTPQ15 := make([]int32, ltpMemLength+frameSize)
+	sLTPQ15 := plcScratch(&plcState.scratchLTP, ltpMemLength+frameSize)
 	sLTPBufIdx := ltpMemLength
 
 	// Rewhiten LTP state using LPC analysis
@@ -621,7 +641,7 @@ func ConcealSILKWithLTP(dec SILKDecoderStateExtended, plcState *SILKPLCState, lo
 
 		// Perform LPC analysis to get sLTP.
 		// Prefer decoder outBuf history (Q0), which matches libopus PLC inputs.
-		sLTP := make([]int16, ltpMemLength)
+		sLTP := plcScratch(&plcState.scratchSLTP, ltpMemLength)
 		haveOutBufQ0 := false
 		if provider, ok := dec.(SILKOutBufProvider); ok {
 			outBufQ0 := provider.GetOutBufHistoryQ0()
@@ -659,7 +679,7 @@ func ConcealSILKWithLTP(dec SILKDecoderStateExtended, plcState *SILKPLCState, lo
 	B_Q14 := plcState.LTPCoefQ14
 
 	// Process each subframe
-	sLPCQ14 := make([]int32, frameSize+maxLPCOrder)
+	sLPCQ14 := plcScratch(&plcState.scratchLPC, frameSize+maxLPCOrder)
 	haveSLPCHistory := false
 	if provider, ok := dec.(SILKSLPCQ14Provider); ok {
 		historyQ14 := provider.GetSLPCQ14HistoryQ14()
@@ -1,6 +1,9 @@
 package rangecoding
 
-import "math/bits"
+import (
+	"encoding/binary"
+	"math/bits"
+)
 
 var tellFracCorrection = [8]uint32{35733, 38967, 42495, 46340, 50535, 55109, 60097, 65535}
 
@@ -86,9 +89,46 @@ func (d *Decoder) readByte() byte {
 //
 //go:nosplit
 func (d *Decoder) normalize() {
-	for d.rng <= EC_CODE_BOT {
+	if d.rng <= EC_CODE_BOT {
+		d.renormalize(d.rng, d.val)
+	}
+}
+
+// renormalize stores rng and val, which must have rng <= EC_CODE_BOT, after
+// shifting in every byte the RFC 6716 Section 4.1.1 loop would read for them
+// in one step. The byte count follows from the bit length of rng, the bytes
+// are read as one big-endian word, and the per-byte (EC_SYM_MAX &^ sym) terms
+// are merged into a single masked complement of the bit-shifted input, so the
+// state after the call is the one the byte-at-a-time loop leaves. The last
+// bytes of the buffer go through renormalizeTail. The DecodeICDF*_8 fast
+// paths keep their own inlined byte loop instead: their symbols never need
+// more than one byte, and the call would cost more than it saves.
+//
+//go:nosplit
+func (d *Decoder) renormalize(rng, val uint32) {
+	offs := d.offs
+	if int(offs)+4 > len(d.buf) {
+		d.renormalizeTail(rng, val)
+		return
+	}
+	// rng << 8k > EC_CODE_BOT needs bits.Len32(rng-1) >= 24-8k; rng > 0 keeps
+	// k at most 3.
+	shift := uint(31-bits.Len32(rng-1)) &^ 7
+	in := binary.BigEndian.Uint32(d.buf[offs:]) >> (32 - shift)
+	sym := (uint32(d.rem)<<shift | in) >> (EC_SYM_BITS - EC_CODE_EXTRA)
+	d.val = ((val << shift) + (^sym & (1<<shift - 1))) & (EC_CODE_TOP - 1)
+	d.rng = rng << shift
+	d.rem = int32(in & EC_SYM_MAX)
+	d.offs = offs + uint32(shift>>3)
+	d.nbitsTotal += int32(shift)
+}
+
+// renormalizeTail is renormalize within four bytes of the end of the buffer,
+// where reads past the end yield zero bytes.
+func (d *Decoder) renormalizeTail(rng, val uint32) {
+	for rng <= EC_CODE_BOT {
 		d.nbitsTotal += int32(EC_SYM_BITS)
-		d.rng <<= EC_SYM_BITS
+		rng <<= EC_SYM_BITS
 
 		// Combine previous remainder with new byte
 		sym := uint32(d.rem)
@@ -96,8 +136,10 @@ func (d *Decoder) normalize() {
 		sym = (sym<<EC_SYM_BITS | uint32(d.rem)) >> (EC_SYM_BITS - EC_CODE_EXTRA)
 
 		// Update val: shift in new bits, mask to valid range
-		d.val = ((d.val << EC_SYM_BITS) + (EC_SYM_MAX &^ sym)) & (EC_CODE_TOP - 1)
+		val = ((val << EC_SYM_BITS) + (EC_SYM_MAX &^ sym)) & (EC_CODE_TOP - 1)
 	}
+	d.rng = rng
+	d.val = val
 }
 
 // DecodeICDF decodes a symbol using an inverse cumulative distribution function table.
@@ -1226,18 +1268,10 @@ func (d *Decoder) DecodeUniform(ft uint32) uint32 {
 		endWindow := d.endWindow
 		nendBits := int(d.nendBits)
 		if nendBits < ftb {
-			endOffs := d.endOffs
-			storage := d.storage
-			buf := d.buf
-			for nendBits <= 56 && endOffs < storage {
-				endOffs++
-				endWindow |= uint64(buf[storage-endOffs]) << uint(nendBits)
-				nendBits += 8
-			}
+			endWindow, nendBits = d.refillEndWindow(endWindow, nendBits)
 			if nendBits < ftb {
 				nendBits = ftb
 			}
-			d.endOffs = endOffs
 		}
 		raw := uint32(endWindow) & ((1 << rawBits) - 1)
 		d.endWindow = endWindow >> rawBits
@@ -1455,18 +1489,10 @@ func (d *Decoder) DecodeRawBits(bits uint) uint32 {
 		// buffering choice: the window holds the same end-of-buffer bit
 		// stream, so every (call, bits) sequence sees identical values, and
 		// exhaustion still pads with zeros from the same bit position.
-		endOffs := d.endOffs
-		storage := d.storage
-		buf := d.buf
-		for nendBits <= 56 && endOffs < storage {
-			endOffs++
-			endWindow |= uint64(buf[storage-endOffs]) << uint(nendBits)
-			nendBits += 8
-		}
+		endWindow, nendBits = d.refillEndWindow(endWindow, nendBits)
 		if nendBits < int(bits) {
 			nendBits = int(bits)
 		}
-		d.endOffs = endOffs
 	}
 
 	val := uint32(endWindow) & ((1 << bits) - 1)
@@ -1477,6 +1503,33 @@ func (d *Decoder) DecodeRawBits(bits uint) uint32 {
 	return val
 }
 
+// refillEndWindow tops the raw-bit window up to more than 56 valid bits from
+// the end of the buffer, the libopus ec_dec_bits refill loop over a 64-bit
+// window. With at least eight unread bytes left the whole refill is one
+// big-endian word load, whose low bytes are the next end-of-buffer bytes in
+// reading order.
+//
+//go:nosplit
+func (d *Decoder) refillEndWindow(endWindow uint64, nendBits int) (uint64, int) {
+	endOffs := d.endOffs
+	storage := d.storage
+	buf := d.buf
+	if nendBits <= 56 && storage-endOffs >= 8 {
+		n := uint(64-nendBits) >> 3
+		w := binary.BigEndian.Uint64(buf[storage-endOffs-8 : storage-endOffs])
+		endWindow |= w << (64 - 8*n) >> (64 - 8*n) << uint(nendBits)
+		d.endOffs = endOffs + uint32(n)
+		return endWindow, nendBits + int(8*n)
+	}
+	for nendBits <= 56 && endOffs < storage {
+		endOffs++
+		endWindow |= uint64(buf[storage-endOffs]) << uint(nendBits)
+		nendBits += 8
+	}
+	d.endOffs = endOffs
+	return endWindow, nendBits
+}
+
 // DecodeRawBit reads a single raw bit from the end of the buffer.
 func (d *Decoder) DecodeRawBit() uint32 {
 	if d.nendBits == 0 {
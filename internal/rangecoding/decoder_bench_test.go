@@ -110,3 +110,27 @@ func BenchmarkDecodeICDF5_8(b *testing.B) {
 		_ = d.DecodeICDF5_8(205, 154, 102, 51)
 	}
 }
+
+// BenchmarkDecodeBinRawBits mixes wide DecodeBin symbols, which shift in up
+// to three bytes per renormalization, with raw-bit reads from the end of the
+// buffer, the CELT fine-energy and PVQ-index pattern.
+func BenchmarkDecodeBinRawBits(b *testing.B) {
+	buf := make([]byte, 1275)
+	for i := range buf {
+		buf[i] = byte(i*37 + 11)
+	}
+
+	var d Decoder
+	d.Init(buf)
+
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		if i&511 == 0 {
+			d.Init(buf)
+		}
+		s := d.DecodeBin(13)
+		d.Update(s, s+1, 1<<13)
+		_ = d.DecodeRawBits(uint(i&7) + 1)
+	}
+}
@@ -2,6 +2,7 @@ package rangecoding
 
 import (
 	"math/rand"
+	"reflect"
 	"testing"
 )
 
@@ -455,3 +456,60 @@ func TestBytesUsed(t *testing.T) {
 		t.Errorf("BytesUsed() decreased from %d to %d", initialUsed, d.BytesUsed())
 	}
 }
+
+// TestRenormalizeMatchesBytewise checks the word refill against the
+// byte-at-a-time RFC loop (renormalizeTail) for every byte count and for
+// reads that run into and past the end of the buffer.
+func TestRenormalizeMatchesBytewise(t *testing.T) {
+	rng := rand.New(rand.NewSource(39))
+	buf := make([]byte, 12)
+	for i := 0; i < 20000; i++ {
+		rng.Read(buf)
+		var want Decoder
+		want.Init(buf[:rng.Intn(len(buf)+1)])
+		want.offs = uint32(rng.Intn(len(want.buf) + 1))
+		want.rem = int32(rng.Intn(256))
+		r := uint32(1) << uint(rng.Intn(24)) // up to EC_CODE_BOT inclusive
+		if r < EC_CODE_BOT {
+			r |= rng.Uint32() & (r - 1)
+		}
+		v := rng.Uint32() & (EC_CODE_TOP - 1)
+		got := want
+		want.renormalizeTail(r, v)
+		got.renormalize(r, v)
+		got.buf, want.buf = nil, nil
+		if !reflect.DeepEqual(got, want) {
+			t.Fatalf("case %d rng=%#x: got %+v want %+v", i, r, got, want)
+		}
+	}
+}
+
+// TestRefillEndWindowMatchesBytewise checks the word refill of the raw-bit
+// window against the byte-at-a-time ec_dec_bits loop.
+func TestRefillEndWindowMatchesBytewise(t *testing.T) {
+	rng := rand.New(rand.NewSource(40))
+	buf := make([]byte, 20)
+	for i := 0; i < 20000; i++ {
+		rng.Read(buf)
+		var d Decoder
+		d.Init(buf[:rng.Intn(len(buf)+1)])
+		d.endOffs = uint32(rng.Intn(len(d.buf) + 1))
+		nendBits := rng.Intn(65)
+		window := rng.Uint64()
+		if nendBits < 64 {
+			window &= 1<<uint(nendBits) - 1
+		}
+
+		wantWindow, wantBits, wantOffs := window, nendBits, d.endOffs
+		for wantBits <= 56 && wantOffs < d.storage {
+			wantOffs++
+			wantWindow |= uint64(d.buf[d.storage-wantOffs]) << uint(wantBits)
+			wantBits += 8
+		}
+		gotWindow, gotBits := d.refillEndWindow(window, nendBits)
+		if gotWindow != wantWindow || gotBits != wantBits || d.endOffs != wantOffs {
+			t.Fatalf("case %d: got (%#x, %d, %d) want (%#x, %d, %d)",
+				i, gotWindow, gotBits, d.endOffs, wantWindow, wantBits, wantOffs)
+		}
+	}
+}
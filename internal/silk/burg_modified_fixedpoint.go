@@ -265,13 +265,14 @@ func silkBurgModifiedFixed(
 }
 
 // silkInnerProd16Fixed is the FIXED_POINT silk_inner_prod16_c: a 64-bit
-// accumulation of the products of the int16 lanes.
+// accumulation of the products of the int16 lanes. The exact sum does not
+// depend on order, so innerProd16Vector takes the leading lanes.
 //
 // NOTE(dedup): self-contained copy. silk_inner_prod16 may also exist in a
 // sibling fixed-point file; if a shared one lands, fold this into it.
 func silkInnerProd16Fixed(inVec1, inVec2 []int16, length int) int64 {
-	var sum int64
-	for i := 0; i < length; i++ {
+	sum, i := innerProd16Vector(inVec1, inVec2, length)
+	for ; i < length; i++ {
 		sum += int64(inVec1[i]) * int64(inVec2[i])
 	}
 	return sum
@@ -311,14 +312,13 @@ func silkADD32(a, b int32) int32 {
 // with MAC16_16 in an int32. The unrolled libopus kernel reorders the same
 // integer additions and is therefore bit-exact to this scalar form.
 //
+// Each lag is the wrapping int32 sum silkInnerProdAlignedFixed computes, so it
+// shares that function's vector kernel.
+//
 // NOTE(dedup): a fixed-point integer celt_pitch_xcorr is not otherwise present
 // in the silk package (only the float variant exists).
 func celtPitchXcorrFixed(x, y []int16, xcorr []int32, length, maxPitch int) {
 	for i := 0; i < maxPitch; i++ {
-		var sum int32
-		for j := 0; j < length; j++ {
-			sum = silkMAC16_16(sum, int32(x[j]), int32(y[i+j]))
-		}
-		xcorr[i] = sum
+		xcorr[i] = silkInnerProdAlignedFixed(x, y[i:], length)
 	}
 }
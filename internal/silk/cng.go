@@ -24,6 +24,7 @@ func silkCNGReset(st *decoderState) {
 	}
 	st.cng.smthGainQ16 = 0
 	st.cng.randSeed = 3176576
+	st.cng.lpcValid = false
 }
 
 // silkCNGExc fills a comfort-noise excitation buffer (Q14) by randomly sampling
@@ -89,6 +90,7 @@ func shouldUpdateCNGHistory(st *decoderState, ctrl *decoderControl) bool {
 // silk/CNG.c silk_CNG.
 func updateCNGHistory(st *decoderState, ctrl *decoderControl) {
 	order := cngLPCOrder(st)
+	st.cng.lpcValid = false
 	for i := range order {
 		smthQ15 := int32(st.cng.smthNLSFQ15[i])
 		delta := int32(st.prevNLSFQ15[i]) - smthQ15
@@ -170,15 +172,7 @@ func (d *Decoder) applyCNGLostFrame(channel int, st *decoderState, frame []int16
 	}
 	silkCNGExc(sig[maxLPCOrder:], st.cng.excBufQ14[:], len(frame), &st.cng.randSeed)
 
-	var aQ12 [maxLPCOrder]int16
-	var nlsfQ15 [maxLPCOrder]int16
-	for i := range order {
-		nlsfQ15[i] = st.cng.smthNLSFQ15[i]
-	}
-	if !silkNLSF2A(aQ12[:order], nlsfQ15[:order], order) {
-		lpc := lsfToLPCDirect(nlsfQ15[:order])
-		copy(aQ12[:order], lpc[:order])
-	}
+	aQ12 := cngLPC(st, order)
 
 	copy(sig[:maxLPCOrder], st.cng.synthStateQ14[:])
 	for i := range frame {
@@ -195,6 +189,24 @@ func (d *Decoder) applyCNGLostFrame(channel int, st *decoderState, frame []int16
 	return true
 }
 
+// cngLPC returns the comfort-noise LPC filter for the smoothed CNG NLSFs,
+// converting them only when they changed since the last call.
+func cngLPC(st *decoderState, order int) *[maxLPCOrder]int16 {
+	c := &st.cng
+	if c.lpcValid && int(c.lpcOrder) == order {
+		return &c.lpcQ12
+	}
+	var nlsfQ15 [maxLPCOrder]int16
+	copy(nlsfQ15[:order], c.smthNLSFQ15[:order])
+	if !silkNLSF2A(c.lpcQ12[:order], nlsfQ15[:order], order) {
+		lpc := lsfToLPCDirect(nlsfQ15[:order])
+		copy(c.lpcQ12[:order], lpc[:order])
+	}
+	c.lpcOrder = int32(order)
+	c.lpcValid = true
+	return &c.lpcQ12
+}
+
 func clearCNGSynthesisState(st *decoderState) {
 	for i := 0; i < int(st.lpcOrder) && i < maxLPCOrder; i++ {
 		st.cng.synthStateQ14[i] = 0
@@ -0,0 +1,53 @@
+package silk
+
+import "testing"
+
+// cngLPCDirect converts the smoothed CNG NLSFs the way applyCNGLostFrame did
+// before the filter was cached.
+func cngLPCDirect(st *decoderState, order int) []int16 {
+	aQ12 := make([]int16, order)
+	nlsfQ15 := append([]int16(nil), st.cng.smthNLSFQ15[:order]...)
+	if !silkNLSF2A(aQ12, nlsfQ15, order) {
+		copy(aQ12, lsfToLPCDirect(nlsfQ15))
+	}
+	return aQ12
+}
+
+// TestCNGLPCCacheTracksSmoothedNLSF checks that the cached comfort-noise
+// filter matches a fresh conversion after a reset, after each history update
+// and across an LPC order change.
+func TestCNGLPCCacheTracksSmoothedNLSF(t *testing.T) {
+	var st decoderState
+	st.lpcOrder, st.nbSubfr, st.subfrLength = 16, 4, 80
+	silkCNGReset(&st)
+
+	check := func(step string) {
+		t.Helper()
+		order := cngLPCOrder(&st)
+		want := cngLPCDirect(&st, order)
+		for pass := 0; pass < 2; pass++ {
+			got := cngLPC(&st, order)
+			for i, w := range want {
+				if got[i] != w {
+					t.Fatalf("%s pass %d: aQ12[%d] = %d, want %d", step, pass, i, got[i], w)
+				}
+			}
+		}
+	}
+	check("reset")
+
+	var ctrl decoderControl
+	for i := range ctrl.GainsQ16 {
+		ctrl.GainsQ16[i] = 1 << 16
+	}
+	for frame := 0; frame < 6; frame++ {
+		for i := range st.prevNLSFQ15 {
+			st.prevNLSFQ15[i] = int16((i + 1) * 1900 / (1 + frame%3))
+		}
+		updateCNGHistory(&st, &ctrl)
+		check("update")
+	}
+
+	st.lpcOrder = 10
+	check("order 10")
+}
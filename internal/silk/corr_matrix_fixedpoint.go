@@ -102,13 +102,15 @@ func silkCorrMatrixFixed(x []int16, L, order int, XX []int32) (nrg int32, rshift
 
 // silkInnerProdAlignedFixed is the FIXED_POINT silk_inner_prod_aligned
 // (celt_inner_prod_c): sum over i of inVec1[i]*inVec2[i] accumulated in an
-// int32 with wrap-around-free signed multiplication of int16 lanes.
+// int32 with wrap-around-free signed multiplication of int16 lanes. The sum
+// wraps modulo 2^32 whatever the order, so innerProdAlignedVector takes the
+// leading lanes.
 //
 // NOTE(dedup): self-contained copy used by the correlation kernels. If a shared
 // fixed-point inner-product lands in the default silk build, fold this into it.
 func silkInnerProdAlignedFixed(inVec1, inVec2 []int16, length int) int32 {
-	var sum int32
-	for i := 0; i < length; i++ {
+	sum, i := innerProdAlignedVector(inVec1, inVec2, length)
+	for ; i < length; i++ {
 		sum = silkSMLABB(sum, int32(inVec1[i]), int32(inVec2[i]))
 	}
 	return sum
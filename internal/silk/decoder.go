@@ -198,6 +198,14 @@ type Decoder struct {
 	plcLowbandCapture    []int16
 	plcLowbandCaptured   int
 	plcLowbandCaptureArm bool
+	// outputCapture, when non-nil, receives the resampled int16 API-rate output
+	// (interleaved by channel) of the next received-frame decode through
+	// DecodeWithDecoderInto, DecodeStereoWithDecoderInto or
+	// DecodeMonoToStereoWithDecoderInto. The FIXED_POINT integer SILK-only path
+	// arms it so DecodeInt16 / DecodeInt24 read the silk_resampler int16 output
+	// directly; like the PLC capture it does not change the float output.
+	outputCapture  []int16
+	outputCaptured int
 	// plcConcealI16 is reusable scratch for converting a mono float PLC
 	// concealment frame to int16 before int16 resampling on the capture path.
 	plcConcealI16 []int16
@@ -222,6 +230,20 @@ func (d *Decoder) ArmPLCLowbandCapture(buf []int16) {
 // the capture buffer armed via ArmPLCLowbandCapture by the most recent PLC decode.
 func (d *Decoder) PLCLowbandCaptured() int { return d.plcLowbandCaptured }
 
+// ArmOutputCapture arms (or, with buf==nil, disarms) capture of the next
+// received-frame decode's resampled int16 output into buf (interleaved by
+// channel). Capture only happens when the resampler produces native int16, i.e.
+// the API rate is at or above the SILK internal rate; OutputCaptured reports 0
+// otherwise. It is used only by the FIXED_POINT integer SILK-only path.
+func (d *Decoder) ArmOutputCapture(buf []int16) {
+	d.outputCapture = buf
+	d.outputCaptured = 0
+}
+
+// OutputCaptured returns the number of interleaved int16 samples written to the
+// buffer armed via ArmOutputCapture by the most recent received-frame decode.
+func (d *Decoder) OutputCaptured() int { return d.outputCaptured }
+
 // NewDecoder creates a new SILK decoder with proper initial state.
 // The decoder is ready to process SILK frames after creation.
 func NewDecoder() *Decoder {
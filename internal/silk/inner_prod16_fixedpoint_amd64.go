@@ -0,0 +1,37 @@
+//go:build gopus_fixed_point && amd64 && !purego
+
+package silk
+
+import "github.com/thesyncim/gopus/internal/cpufeat"
+
+// silkUseInnerProd16AVX2 gates the AVX2 int16 dot-product kernels. Both are
+// bit-identical to the scalar loops they replace.
+var silkUseInnerProd16AVX2 = cpufeat.AMD64.HasAVX2
+
+//go:noescape
+func innerProd16BlocksAVX2(a, b []int16, blocks int) int64
+
+//go:noescape
+func innerProdAlignedBlocksAVX2(a, b []int16, blocks int) int32
+
+// innerProd16Vector returns the exact 64-bit dot product of the leading
+// multiple of 16 lanes of a and b, and how many lanes it covered.
+func innerProd16Vector(a, b []int16, n int) (int64, int) {
+	blocks := n / 16
+	if !silkUseInnerProd16AVX2 || blocks == 0 {
+		return 0, 0
+	}
+	done := 16 * blocks
+	return innerProd16BlocksAVX2(a[:done], b[:done], blocks), done
+}
+
+// innerProdAlignedVector returns the wrapping int32 dot product of the leading
+// multiple of 16 lanes of a and b, and how many lanes it covered.
+func innerProdAlignedVector(a, b []int16, n int) (int32, int) {
+	blocks := n / 16
+	if !silkUseInnerProd16AVX2 || blocks == 0 {
+		return 0, 0
+	}
+	done := 16 * blocks
+	return innerProdAlignedBlocksAVX2(a[:done], b[:done], blocks), done
+}
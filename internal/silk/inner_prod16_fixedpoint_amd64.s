@@ -0,0 +1,80 @@
+//go:build gopus_fixed_point && amd64 && !purego
+
+#include "textflag.h"
+
+// func innerProd16BlocksAVX2(a, b []int16, blocks int) int64
+//
+// Exact 64-bit sum of a[i]*b[i] over blocks*16 lanes (silk_inner_prod16).
+// VPMADDWD pair sums lie in [-2^31+2^16, 2^31]; only +2^31 (two -32768^2
+// products) overflows int32. Biasing each pair sum by -2^16 brings the range
+// into int32, so the pair sums are sign-extended and accumulated in int64 and
+// the bias is added back once: blocks*8 pairs of 2^16, i.e. blocks<<19.
+TEXT ·innerProd16BlocksAVX2(SB), NOSPLIT, $0-64
+	MOVQ a_base+0(FP), AX
+	MOVQ b_base+24(FP), BX
+	MOVQ blocks+48(FP), CX
+	MOVQ CX, DX
+
+	MOVL         $0x10000, SI
+	VMOVD        SI, X7
+	VPBROADCASTD X7, Y7
+	VPXOR        Y3, Y3, Y3
+	VPXOR        Y4, Y4, Y4
+
+ip16_loop:
+	VMOVDQU      (AX), Y0
+	VPMADDWD     (BX), Y0, Y0
+	VPSUBD       Y7, Y0, Y0
+	VPMOVSXDQ    X0, Y1
+	VEXTRACTI128 $1, Y0, X0
+	VPMOVSXDQ    X0, Y2
+	VPADDQ       Y1, Y3, Y3
+	VPADDQ       Y2, Y4, Y4
+	ADDQ         $32, AX
+	ADDQ         $32, BX
+	DECQ         CX
+	JNZ          ip16_loop
+
+	VPADDQ       Y4, Y3, Y3
+	VEXTRACTI128 $1, Y3, X4
+	VPADDQ       X4, X3, X3
+	VPSHUFD      $0x4E, X3, X4
+	VPADDQ       X4, X3, X3
+	VMOVQ        X3, AX
+	SHLQ         $19, DX
+	ADDQ         DX, AX
+	MOVQ         AX, ret+56(FP)
+	VZEROUPPER
+	RET
+
+// func innerProdAlignedBlocksAVX2(a, b []int16, blocks int) int32
+//
+// Wrapping int32 sum of a[i]*b[i] over blocks*16 lanes (silk_inner_prod_aligned,
+// the FIXED_POINT celt_pitch_xcorr lag sum). Every step is an int32 add modulo
+// 2^32, so the VPMADDWD pairing and lane order give the scalar result.
+TEXT ·innerProdAlignedBlocksAVX2(SB), NOSPLIT, $0-60
+	MOVQ a_base+0(FP), AX
+	MOVQ b_base+24(FP), BX
+	MOVQ blocks+48(FP), CX
+
+	VPXOR Y1, Y1, Y1
+
+ipa_loop:
+	VMOVDQU  (AX), Y0
+	VPMADDWD (BX), Y0, Y0
+	VPADDD   Y0, Y1, Y1
+	ADDQ     $32, AX
+	ADDQ     $32, BX
+	DECQ     CX
+	JNZ      ipa_loop
+
+	VEXTRACTI128 $1, Y1, X2
+	VPADDD       X2, X1, X1
+	VPSHUFD      $0x4E, X1, X2
+	VPADDD       X2, X1, X1
+	VPSHUFD      $0xB1, X1, X2
+	VPADDD       X2, X1, X1
+	VMOVD        X1, AX
+	MOVL         AX, ret+56(FP)
+	VZEROUPPER
+	RET
@@ -0,0 +1,31 @@
+//go:build gopus_fixed_point && arm64 && !purego
+
+package silk
+
+//go:noescape
+func innerProd16BlocksNeon(a, b []int16, blocks int) int64
+
+//go:noescape
+func innerProdAlignedBlocksNeon(a, b []int16, blocks int) int32
+
+// innerProd16Vector returns the exact 64-bit dot product of the leading
+// multiple of 8 lanes of a and b, and how many lanes it covered.
+func innerProd16Vector(a, b []int16, n int) (int64, int) {
+	blocks := n / 8
+	if blocks == 0 {
+		return 0, 0
+	}
+	done := 8 * blocks
+	return innerProd16BlocksNeon(a[:done], b[:done], blocks), done
+}
+
+// innerProdAlignedVector returns the wrapping int32 dot product of the leading
+// multiple of 8 lanes of a and b, and how many lanes it covered.
+func innerProdAlignedVector(a, b []int16, n int) (int32, int) {
+	blocks := n / 8
+	if blocks == 0 {
+		return 0, 0
+	}
+	done := 8 * blocks
+	return innerProdAlignedBlocksNeon(a[:done], b[:done], blocks), done
+}
@@ -0,0 +1,59 @@
+//go:build gopus_fixed_point && arm64 && !purego
+
+#include "textflag.h"
+
+// func innerProd16BlocksNeon(a, b []int16, blocks int) int64
+//
+// Exact 64-bit sum of a[i]*b[i] over blocks*8 lanes (silk_inner_prod16):
+// SMULL/SMULL2 form exact int32 products and SADALP widens them pairwise into
+// int64 accumulators.
+TEXT ·innerProd16BlocksNeon(SB), NOSPLIT, $0-64
+	MOVD a_base+0(FP), R0
+	MOVD b_base+24(FP), R1
+	MOVD blocks+48(FP), R2
+
+	VEOR V4.B16, V4.B16, V4.B16
+	VEOR V5.B16, V5.B16, V5.B16
+
+ip16_loop:
+	VLD1.P 16(R0), [V0.H8]
+	VLD1.P 16(R1), [V1.H8]
+	WORD   $0x0e61c002 // SMULL  V2.4S, V0.4H, V1.4H
+	WORD   $0x4e61c003 // SMULL2 V3.4S, V0.8H, V1.8H
+	WORD   $0x4ea06844 // SADALP V4.2D, V2.4S
+	WORD   $0x4ea06865 // SADALP V5.2D, V3.4S
+	SUBS   $1, R2, R2
+	BNE    ip16_loop
+
+	WORD $0x4ee58484 // ADD  V4.2D, V4.2D, V5.2D
+	WORD $0x5ef1b884 // ADDP D4, V4.2D
+	VMOV V4.D[0], R3
+	MOVD R3, ret+56(FP)
+	RET
+
+// func innerProdAlignedBlocksNeon(a, b []int16, blocks int) int32
+//
+// Wrapping int32 sum of a[i]*b[i] over blocks*8 lanes (silk_inner_prod_aligned,
+// the FIXED_POINT celt_pitch_xcorr lag sum). SMLAL/SMLAL2 accumulate modulo
+// 2^32 like the scalar int32 adds, so the lane order does not change the sum.
+TEXT ·innerProdAlignedBlocksNeon(SB), NOSPLIT, $0-60
+	MOVD a_base+0(FP), R0
+	MOVD b_base+24(FP), R1
+	MOVD blocks+48(FP), R2
+
+	VEOR V4.B16, V4.B16, V4.B16
+	VEOR V5.B16, V5.B16, V5.B16
+
+ipa_loop:
+	VLD1.P 16(R0), [V0.H8]
+	VLD1.P 16(R1), [V1.H8]
+	WORD   $0x0e618004 // SMLAL  V4.4S, V0.4H, V1.4H
+	WORD   $0x4e618005 // SMLAL2 V5.4S, V0.8H, V1.8H
+	SUBS   $1, R2, R2
+	BNE    ipa_loop
+
+	WORD $0x4ea58484 // ADD  V4.4S, V4.4S, V5.4S
+	WORD $0x4eb1b884 // ADDV S4, V4.4S
+	VMOV V4.S[0], R3
+	MOVW R3, ret+56(FP)
+	RET
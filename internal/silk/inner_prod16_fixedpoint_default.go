@@ -0,0 +1,14 @@
+//go:build gopus_fixed_point && ((!amd64 && !arm64) || purego)
+
+package silk
+
+// innerProd16Vector has no portable kernel; the scalar loop covers every lane.
+func innerProd16Vector(a, b []int16, n int) (int64, int) {
+	return 0, 0
+}
+
+// innerProdAlignedVector has no portable kernel; the scalar loop covers every
+// lane.
+func innerProdAlignedVector(a, b []int16, n int) (int32, int) {
+	return 0, 0
+}
@@ -0,0 +1,74 @@
+//go:build gopus_fixed_point
+
+package silk
+
+import (
+	"math/rand"
+	"testing"
+)
+
+// TestInnerProd16FixedMatchesScalar checks the vector-backed int16 dot
+// products against plain scalar loops, including -32768 pairs whose
+// two-product sum overflows int32.
+func TestInnerProd16FixedMatchesScalar(t *testing.T) {
+	rng := rand.New(rand.NewSource(40))
+	for _, n := range []int{0, 1, 7, 8, 15, 16, 17, 40, 80, 161, 320} {
+		for trial := 0; trial < 4; trial++ {
+			a := make([]int16, n)
+			b := make([]int16, n)
+			for i := range a {
+				switch trial {
+				case 0:
+					a[i], b[i] = -32768, -32768
+				case 1:
+					a[i], b[i] = 32767, -32768
+				default:
+					a[i], b[i] = int16(rng.Intn(65536)-32768), int16(rng.Intn(65536)-32768)
+				}
+			}
+			var want64 int64
+			var want32 int32
+			for i := range a {
+				want64 += int64(a[i]) * int64(b[i])
+				want32 += int32(a[i]) * int32(b[i])
+			}
+			if got := silkInnerProd16Fixed(a, b, n); got != want64 {
+				t.Fatalf("n=%d trial %d: silkInnerProd16Fixed=%d want %d", n, trial, got, want64)
+			}
+			if got := silkInnerProdAlignedFixed(a, b, n); got != want32 {
+				t.Fatalf("n=%d trial %d: silkInnerProdAlignedFixed=%d want %d", n, trial, got, want32)
+			}
+		}
+	}
+
+	x := make([]int16, 200)
+	y := make([]int16, 260)
+	for i := range y {
+		y[i] = int16(rng.Intn(65536) - 32768)
+	}
+	copy(x, y[30:])
+	xcorr := make([]int32, 60)
+	celtPitchXcorrFixed(x, y, xcorr, len(x), len(xcorr))
+	for lag, got := range xcorr {
+		var want int32
+		for j := range x {
+			want += int32(x[j]) * int32(y[lag+j])
+		}
+		if got != want {
+			t.Fatalf("xcorr lag %d: %d want %d", lag, got, want)
+		}
+	}
+}
+
+func BenchmarkSilkBurgModifiedFixed(b *testing.B) {
+	const subfr, nbSubfr, order = 96, 4, 16
+	x := make([]int16, subfr*nbSubfr)
+	for i := range x {
+		x[i] = int16(8000 * ((i*7919)%200 - 100) / 100)
+	}
+	var aQ16 [silkMaxOrderLPC]int32
+	b.ReportAllocs()
+	for i := 0; i < b.N; i++ {
+		silkBurgModifiedFixed(aQ16[:], x, 1<<20, subfr, nbSubfr, order)
+	}
+}
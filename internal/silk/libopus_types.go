@@ -36,6 +36,14 @@ type cngState struct {
 	smthGainQ16   int32
 	randSeed      int32
 	fsKHz         int32
+
+	// lpcQ12 caches silkNLSF2A(smthNLSFQ15) for lpcOrder coefficients. The
+	// smoothed NLSFs only move on a no-voice-activity frame or a reset, so a
+	// DTX gap reuses one conversion for every comfort-noise frame. gopus-only;
+	// the zero value is an empty cache.
+	lpcQ12   [maxLPCOrder]int16
+	lpcOrder int32
+	lpcValid bool
 }
 
 type decoderState struct {
@@ -0,0 +1,307 @@
+package silk
+
+import (
+	"math"
+	"sync"
+
+	"github.com/thesyncim/gopus/internal/opusmath"
+)
+
+const (
+	// polyphaseTaps is the FIR length per phase for ratios up to 1:1. Every
+	// bank's tap count is a multiple of it, which the vector kernels rely on.
+	// Downsampling by more than that widens it by ceil(down/up) so the
+	// transition band keeps its width relative to the output Nyquist.
+	polyphaseTaps = 64
+	// polyphaseMaxPhases bounds the reduced interpolation factor, and with it
+	// the coefficient bank (polyphaseMaxPhases * taps float32 values).
+	polyphaseMaxPhases = 1024
+	// polyphaseKaiserBeta gives roughly 80 dB of stopband attenuation.
+	polyphaseKaiserBeta = 8.0
+	// polyphaseCutoff places the passband edge relative to the lower Nyquist:
+	// 20.1 kHz for 44.1 kHz, inside the 20 kHz Opus fullband passband.
+	polyphaseCutoff = 0.91
+)
+
+// polyphaseBank is the immutable coefficient table shared by every
+// PolyphaseResampler with the same reduced ratio.
+type polyphaseBank struct {
+	up, down int
+	taps     int
+	// coefs holds up rows of taps coefficients. Row p is phase p of the
+	// prototype filter, time reversed so that a dot product against the input
+	// window x[b-taps+1..b] yields the output at phase p.
+	coefs []float32
+}
+
+var polyphaseBanks sync.Map // map[[2]int]*polyphaseBank
+
+// PolyphaseResampler converts interleaved float32 PCM between two arbitrary
+// rates (e.g. 44.1 kHz <-> 48 kHz) with a Kaiser-windowed sinc polyphase FIR.
+// The libopus silk_resampler only covers the fixed Opus ratios; this filter
+// serves the codec boundary for every other PCM rate. Its per-phase dot
+// products run on AVX2/FMA or NEON kernels (polyphaseDot).
+//
+// Input is pushed with Load and output pulled with Emit, which may be called
+// with a partial output buffer; the state carries across calls, so a stream
+// split into arbitrary blocks resamples identically to one long block. The
+// filter is linear phase and is not delay-compensated: output lags the input by
+// Delay() input samples.
+type PolyphaseResampler struct {
+	bank     *polyphaseBank
+	channels int
+
+	// hist holds one planar row per channel: taps-1 samples of history
+	// followed by avail loaded samples not yet fully consumed.
+	hist   []float32
+	stride int
+	avail  int
+	// t is the position of the next output in upsampled units (input index
+	// times up), relative to the first loaded sample.
+	t int
+}
+
+// NewPolyphaseResampler creates a resampler from inRate to outRate for the
+// given channel count, with history preallocated for Load blocks of up to
+// maxBlock samples per channel. Both rates must be positive and their reduced
+// ratio must have at most polyphaseMaxPhases interpolation phases.
+func NewPolyphaseResampler(inRate, outRate, channels, maxBlock int) (*PolyphaseResampler, error) {
+	if inRate <= 0 || outRate <= 0 || channels < 1 {
+		return nil, ErrInvalidResampleRate
+	}
+	g := gcdInt(inRate, outRate)
+	up, down := outRate/g, inRate/g
+	if up > polyphaseMaxPhases {
+		return nil, ErrInvalidResampleRate
+	}
+	r := &PolyphaseResampler{
+		bank:     loadPolyphaseBank(up, down),
+		channels: channels,
+	}
+	r.reserve(max(maxBlock, 0))
+	return r, nil
+}
+
+func gcdInt(a, b int) int {
+	for b != 0 {
+		a, b = b, a%b
+	}
+	return a
+}
+
+func loadPolyphaseBank(up, down int) *polyphaseBank {
+	key := [2]int{up, down}
+	if b, ok := polyphaseBanks.Load(key); ok {
+		return b.(*polyphaseBank)
+	}
+	b, _ := polyphaseBanks.LoadOrStore(key, newPolyphaseBank(up, down))
+	return b.(*polyphaseBank)
+}
+
+// newPolyphaseBank designs the prototype low-pass filter at up times the input
+// rate and splits it into up phases. Each phase is normalised to unit DC gain,
+// so a constant input resamples to the same constant at every phase.
+func newPolyphaseBank(up, down int) *polyphaseBank {
+	taps := polyphaseTaps * ((down + up - 1) / up)
+	n := taps * up
+	// Cutoff in cycles per upsampled sample: polyphaseCutoff of the lower of
+	// the input and output Nyquist frequencies.
+	fc := float32(polyphaseCutoff*0.5) / float32(max(up, down))
+	i0Beta := besselI0(polyphaseKaiserBeta)
+
+	proto := make([]float32, n)
+	for i := range proto {
+		// Twice the offset from the centre tap is an exact integer.
+		x2 := 2*i - (n - 1)
+		s := 2 * fc
+		if x2 != 0 {
+			x := float32(x2) / 2
+			s = opusmath.SinF32(2*math.Pi*fc*x) / (math.Pi * x)
+		}
+		r := float32(x2) / float32(n-1)
+		w := besselI0(polyphaseKaiserBeta*opusmath.SqrtF32(max(0, 1-r*r))) / i0Beta
+		proto[i] = s * w
+	}
+
+	b := &polyphaseBank{up: up, down: down, taps: taps, coefs: make([]float32, up*taps)}
+	for p := 0; p < up; p++ {
+		var sum float32
+		for j := 0; j < taps; j++ {
+			sum += proto[p+j*up]
+		}
+		row := b.coefs[p*taps : (p+1)*taps]
+		for j := 0; j < taps; j++ {
+			row[taps-1-j] = proto[p+j*up] / sum
+		}
+	}
+	return b
+}
+
+// besselI0 evaluates the zeroth-order modified Bessel function of the first
+// kind by its power series.
+func besselI0(x float32) float32 {
+	sum, term := float32(1), float32(1)
+	q := x * x / 4
+	for k := 1; k < 64; k++ {
+		term *= q / float32(k*k)
+		sum += term
+		if term < sum*1e-8 {
+			break
+		}
+	}
+	return sum
+}
+
+// reserve grows the history so that block more samples per channel fit after
+// the avail samples already loaded.
+func (r *PolyphaseResampler) reserve(block int) {
+	need := r.bank.taps - 1 + r.avail + block
+	if need <= r.stride {
+		return
+	}
+	hist := make([]float32, need*r.channels)
+	used := r.bank.taps - 1 + r.avail
+	for c := 0; c < r.channels && r.stride > 0; c++ {
+		copy(hist[c*need:c*need+used], r.hist[c*r.stride:c*r.stride+used])
+	}
+	r.hist = hist
+	r.stride = need
+}
+
+// Channels returns the interleaved channel count.
+func (r *PolyphaseResampler) Channels() int { return r.channels }
+
+// Delay returns the filter group delay in input samples.
+func (r *PolyphaseResampler) Delay() float32 {
+	return float32(r.bank.taps*r.bank.up-1) / float32(2*r.bank.up)
+}
+
+// Reset clears the history and phase, as for a new stream.
+func (r *PolyphaseResampler) Reset() {
+	clear(r.hist)
+	r.avail = 0
+	r.t = 0
+}
+
+// OutputLen returns how many samples per channel Emit would produce, given an
+// unbounded output buffer, after n more samples per channel are loaded.
+func (r *PolyphaseResampler) OutputLen(n int) int {
+	end := (r.avail + n) * r.bank.up
+	if r.t >= end {
+		return 0
+	}
+	return (end - r.t + r.bank.down - 1) / r.bank.down
+}
+
+// MaxInputLen returns the largest number of samples per channel that can be
+// loaded while OutputLen stays within outLen.
+func (r *PolyphaseResampler) MaxInputLen(outLen int) int {
+	return max(0, (outLen*r.bank.down+r.t)/r.bank.up-r.avail)
+}
+
+// Load appends len(in)/channels interleaved samples per channel. The FIR reads
+// planar rows, so loading is also the deinterleave; LoadInt16 and LoadInt24
+// fold the integer-to-float input conversion into that same pass.
+func (r *PolyphaseResampler) Load(in []float32) {
+	channels := r.channels
+	n := len(in) / channels
+	if n == 0 {
+		return
+	}
+	r.reserve(n)
+	base := r.bank.taps - 1 + r.avail
+	if channels == 1 {
+		copy(r.hist[base:base+n], in[:n])
+	} else {
+		for c := 0; c < channels; c++ {
+			dst := r.hist[c*r.stride+base : c*r.stride+base+n]
+			for i := range dst {
+				dst[i] = in[i*channels+c]
+			}
+		}
+	}
+	r.avail += n
+}
+
+// LoadInt16 is Load for int16 input, converted to float PCM as v/32768.
+func (r *PolyphaseResampler) LoadInt16(in []int16) {
+	channels := r.channels
+	n := len(in) / channels
+	if n == 0 {
+		return
+	}
+	r.reserve(n)
+	base := r.bank.taps - 1 + r.avail
+	for c := 0; c < channels; c++ {
+		dst := r.hist[c*r.stride+base : c*r.stride+base+n]
+		for i := range dst {
+			dst[i] = float32(in[i*channels+c]) * (1.0 / 32768)
+		}
+	}
+	r.avail += n
+}
+
+// LoadInt24 is Load for right-justified 24-bit input carried in int32,
+// converted to float PCM as v/8388608.
+func (r *PolyphaseResampler) LoadInt24(in []int32) {
+	channels := r.channels
+	n := len(in) / channels
+	if n == 0 {
+		return
+	}
+	r.reserve(n)
+	base := r.bank.taps - 1 + r.avail
+	for c := 0; c < channels; c++ {
+		dst := r.hist[c*r.stride+base : c*r.stride+base+n]
+		for i := range dst {
+			dst[i] = float32(in[i*channels+c]) * (1.0 / 8388608)
+		}
+	}
+	r.avail += n
+}
+
+// Emit writes up to len(out)/channels interleaved output samples per channel
+// from the loaded input and returns the count written. Input that no further
+// output depends on is dropped from the history.
+func (r *PolyphaseResampler) Emit(out []float32) int {
+	channels := r.channels
+	up, down, taps := r.bank.up, r.bank.down, r.bank.taps
+	limit := len(out) / channels
+	end := r.avail * up
+	k := 0
+	for ; k < limit && r.t < end; k++ {
+		b, p := r.t/up, r.t%up
+		coefs := r.bank.coefs[p*taps : (p+1)*taps]
+		for c := 0; c < channels; c++ {
+			out[k*channels+c] = polyphaseDot(coefs, r.hist[c*r.stride+b:c*r.stride+b+taps], taps)
+		}
+		r.t += down
+	}
+
+	// Slide the history to the next output's window.
+	shift := min(r.t/up, r.avail)
+	if shift > 0 {
+		keep := taps - 1 + r.avail - shift
+		for c := 0; c < channels; c++ {
+			row := r.hist[c*r.stride : c*r.stride+taps-1+r.avail]
+			copy(row, row[shift:shift+keep])
+		}
+		r.avail -= shift
+		r.t -= shift * up
+	}
+	return k
+}
+
+// polyphaseDotGo is the portable polyphaseDot: four partial sums, mirroring
+// the lane split of the vector kernels.
+func polyphaseDotGo(coefs, x []float32, taps int) float32 {
+	coefs, x = coefs[:taps], x[:taps]
+	var s0, s1, s2, s3 float32
+	for i := 0; i+3 < taps; i += 4 {
+		s0 += coefs[i] * x[i]
+		s1 += coefs[i+1] * x[i+1]
+		s2 += coefs[i+2] * x[i+2]
+		s3 += coefs[i+3] * x[i+3]
+	}
+	return (s0 + s1) + (s2 + s3)
+}
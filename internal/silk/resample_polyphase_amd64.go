@@ -0,0 +1,19 @@
+//go:build amd64 && !purego
+
+package silk
+
+import "github.com/thesyncim/gopus/internal/cpufeat"
+
+var polyphaseUseAVX2FMA = cpufeat.AMD64.HasAVX2 && cpufeat.AMD64.HasFMA
+
+//go:noescape
+func polyphaseDotAVX2(coefs, x []float32, taps int) float32
+
+func polyphaseDot(coefs, x []float32, taps int) float32 {
+	if polyphaseUseAVX2FMA {
+		_ = coefs[taps-1]
+		_ = x[taps-1]
+		return polyphaseDotAVX2(coefs, x, taps)
+	}
+	return polyphaseDotGo(coefs, x, taps)
+}
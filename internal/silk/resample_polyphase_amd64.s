@@ -0,0 +1,50 @@
+//go:build amd64 && !purego
+
+#include "textflag.h"
+
+// func polyphaseDotAVX2(coefs, x []float32, taps int) float32
+//
+// Single-precision dot product of one polyphase coefficient row against the
+// input window. taps must be a multiple of 32; four independent FMA
+// accumulators hide the FMA latency.
+TEXT ·polyphaseDotAVX2(SB), NOSPLIT, $0-60
+	MOVQ coefs_base+0(FP), SI
+	MOVQ x_base+24(FP), DI
+	MOVQ taps+48(FP), CX
+
+	VXORPS Y0, Y0, Y0
+	VXORPS Y1, Y1, Y1
+	VXORPS Y2, Y2, Y2
+	VXORPS Y3, Y3, Y3
+
+	SHRQ $5, CX
+	JZ   reduce
+
+loop32:
+	VMOVUPS     (SI), Y4
+	VMOVUPS     32(SI), Y5
+	VMOVUPS     64(SI), Y6
+	VMOVUPS     96(SI), Y7
+	VFMADD231PS (DI), Y4, Y0
+	VFMADD231PS 32(DI), Y5, Y1
+	VFMADD231PS 64(DI), Y6, Y2
+	VFMADD231PS 96(DI), Y7, Y3
+
+	ADDQ $128, SI
+	ADDQ $128, DI
+	DECQ CX
+	JNZ  loop32
+
+reduce:
+	VADDPS       Y1, Y0, Y0
+	VADDPS       Y3, Y2, Y2
+	VADDPS       Y2, Y0, Y0
+	VEXTRACTF128 $1, Y0, X1
+	VADDPS       X1, X0, X0
+	VMOVHLPS     X0, X0, X1
+	VADDPS       X1, X0, X0
+	VMOVSHDUP    X0, X1
+	VADDSS       X1, X0, X0
+	VZEROUPPER
+	MOVSS        X0, ret+56(FP)
+	RET
@@ -0,0 +1,12 @@
+//go:build arm64 && !purego
+
+package silk
+
+//go:noescape
+func polyphaseDotNeon(coefs, x []float32, taps int) float32
+
+func polyphaseDot(coefs, x []float32, taps int) float32 {
+	_ = coefs[taps-1]
+	_ = x[taps-1]
+	return polyphaseDotNeon(coefs, x, taps)
+}
@@ -0,0 +1,40 @@
+//go:build arm64 && !purego
+
+#include "textflag.h"
+
+// func polyphaseDotNeon(coefs, x []float32, taps int) float32
+//
+// Single-precision dot product of one polyphase coefficient row against the
+// input window. taps must be a multiple of 16; four independent FMLA
+// accumulators hide the FMLA latency.
+TEXT ·polyphaseDotNeon(SB), NOSPLIT, $0-60
+	MOVD coefs_base+0(FP), R0
+	MOVD x_base+24(FP), R1
+	MOVD taps+48(FP), R2
+
+	VEOR V16.B16, V16.B16, V16.B16
+	VEOR V17.B16, V17.B16, V17.B16
+	VEOR V18.B16, V18.B16, V18.B16
+	VEOR V19.B16, V19.B16, V19.B16
+
+	LSR $4, R2
+	CBZ R2, reduce
+
+loop16:
+	VLD1.P 64(R0), [V0.S4, V1.S4, V2.S4, V3.S4]
+	VLD1.P 64(R1), [V4.S4, V5.S4, V6.S4, V7.S4]
+	WORD   $0x4E24CC10 // FMLA V16.4S, V0.4S, V4.4S
+	WORD   $0x4E25CC31 // FMLA V17.4S, V1.4S, V5.4S
+	WORD   $0x4E26CC52 // FMLA V18.4S, V2.4S, V6.4S
+	WORD   $0x4E27CC73 // FMLA V19.4S, V3.4S, V7.4S
+	SUBS   $1, R2
+	BNE    loop16
+
+reduce:
+	WORD $0x4E31D610 // FADD  V16.4S, V16.4S, V17.4S
+	WORD $0x4E33D652 // FADD  V18.4S, V18.4S, V19.4S
+	WORD $0x4E32D610 // FADD  V16.4S, V16.4S, V18.4S
+	WORD $0x6E30D610 // FADDP V16.4S, V16.4S, V16.4S
+	WORD $0x7E30DA10 // FADDP S16, V16.2S
+	FMOVS F16, ret+56(FP)
+	RET
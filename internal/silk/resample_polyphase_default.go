@@ -0,0 +1,7 @@
+//go:build (!amd64 && !arm64) || purego
+
+package silk
+
+func polyphaseDot(coefs, x []float32, taps int) float32 {
+	return polyphaseDotGo(coefs, x, taps)
+}
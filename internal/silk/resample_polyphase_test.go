@@ -0,0 +1,201 @@
+package silk
+
+import (
+	"fmt"
+	"math"
+	"testing"
+)
+
+func polyphaseTestSine(rate, channels, n int, freqs ...float64) []float32 {
+	x := make([]float32, n*channels)
+	for i := 0; i < n; i++ {
+		for c := 0; c < channels; c++ {
+			tm := float64(i) / float64(rate)
+			x[i*channels+c] = float32(0.5 * math.Sin(2*math.Pi*freqs[c]*tm+0.3*float64(c)))
+		}
+	}
+	return x
+}
+
+// polyphaseSNR fits got[skip:] (channel c) against a sine of freq at rate,
+// delayed by delay output samples, and returns the SNR in dB.
+func polyphaseSNR(got []float32, channels, c, skip, rate int, freq, delay float64) float64 {
+	var sig, noise float64
+	for i := skip; i < len(got)/channels; i++ {
+		tm := (float64(i) - delay) / float64(rate)
+		want := 0.5 * math.Sin(2*math.Pi*freq*tm+0.3*float64(c))
+		d := float64(got[i*channels+c]) - want
+		sig += want * want
+		noise += d * d
+	}
+	return 10 * math.Log10(sig/noise)
+}
+
+func TestPolyphaseResamplerSineSNR(t *testing.T) {
+	for _, rates := range [][2]int{{48000, 44100}, {44100, 48000}, {48000, 22050}, {16000, 44100}} {
+		in, out := rates[0], rates[1]
+		// A low tone pair and one near 60% of the lower Nyquist, well inside
+		// the passband.
+		hi := 0.3 * float64(min(in, out))
+		for _, freqs := range [][]float64{{1000, 440}, {hi, hi / 2}} {
+			t.Run(fmt.Sprintf("%d_to_%d_%.0fHz", in, out, freqs[0]), func(t *testing.T) {
+				r, err := NewPolyphaseResampler(in, out, 2, in/50)
+				if err != nil {
+					t.Fatal(err)
+				}
+				x := polyphaseTestSine(in, 2, in/5, freqs...)
+				y := make([]float32, r.OutputLen(len(x)/2)*2)
+				r.Load(x)
+				if n := r.Emit(y); n != len(y)/2 {
+					t.Fatalf("Emit=%d want %d", n, len(y)/2)
+				}
+				delay := float64(r.Delay()) * float64(out) / float64(in)
+				for c := 0; c < 2; c++ {
+					if snr := polyphaseSNR(y, 2, c, out/50, out, freqs[c], delay); snr < 70 {
+						t.Fatalf("channel %d SNR %.1f dB, want >= 70", c, snr)
+					}
+				}
+			})
+		}
+	}
+}
+
+// TestPolyphaseResamplerBlockInvariance checks that arbitrary Load / Emit
+// splits produce the same stream as one call, and that OutputLen predicts each
+// block's output count.
+func TestPolyphaseResamplerBlockInvariance(t *testing.T) {
+	const in, out, channels = 48000, 44100, 2
+	x := polyphaseTestSine(in, channels, 4800, 523, 1201)
+
+	whole, err := NewPolyphaseResampler(in, out, channels, 0)
+	if err != nil {
+		t.Fatal(err)
+	}
+	want := make([]float32, whole.OutputLen(len(x)/channels)*channels)
+	whole.Load(x)
+	whole.Emit(want)
+
+	r, err := NewPolyphaseResampler(in, out, channels, 0)
+	if err != nil {
+		t.Fatal(err)
+	}
+	var got []float32
+	blocks := []int{120, 960, 1, 37, 480, 2880}
+	for pos, b := 0, 0; pos < len(x)/channels; b++ {
+		n := min(blocks[b%len(blocks)], len(x)/channels-pos)
+		expect := r.OutputLen(n)
+		r.Load(x[pos*channels : (pos+n)*channels])
+		pos += n
+		// Drain through a deliberately small output buffer.
+		emitted := 0
+		buf := make([]float32, 7*channels)
+		for {
+			k := r.Emit(buf)
+			if k == 0 {
+				break
+			}
+			emitted += k
+			got = append(got, buf[:k*channels]...)
+		}
+		if emitted != expect {
+			t.Fatalf("block %d: emitted %d, OutputLen predicted %d", b, emitted, expect)
+		}
+	}
+	if len(got) != len(want) {
+		t.Fatalf("split output %d samples, want %d", len(got), len(want))
+	}
+	for i := range got {
+		if got[i] != want[i] {
+			t.Fatalf("sample %d: %v want %v", i, got[i], want[i])
+		}
+	}
+}
+
+// TestPolyphaseResamplerFrameCounts pins the exact per-frame counts the codec
+// boundary relies on: 20 ms frames map 960 <-> 882 with no phase drift.
+func TestPolyphaseResamplerFrameCounts(t *testing.T) {
+	down, _ := NewPolyphaseResampler(48000, 44100, 1, 960)
+	up, _ := NewPolyphaseResampler(44100, 48000, 1, 882)
+	for f := 0; f < 5; f++ {
+		if n := down.OutputLen(960); n != 882 {
+			t.Fatalf("frame %d: 48k->44.1k OutputLen(960)=%d", f, n)
+		}
+		if n := down.MaxInputLen(882); n != 960 {
+			t.Fatalf("frame %d: MaxInputLen(882)=%d", f, n)
+		}
+		down.Load(make([]float32, 960))
+		down.Emit(make([]float32, 882))
+		if n := up.OutputLen(882); n != 960 {
+			t.Fatalf("frame %d: 44.1k->48k OutputLen(882)=%d", f, n)
+		}
+		up.Load(make([]float32, 882))
+		up.Emit(make([]float32, 960))
+	}
+}
+
+func TestPolyphaseResamplerIntegerLoads(t *testing.T) {
+	f, _ := NewPolyphaseResampler(44100, 48000, 2, 0)
+	i16, _ := NewPolyphaseResampler(44100, 48000, 2, 0)
+	i24, _ := NewPolyphaseResampler(44100, 48000, 2, 0)
+	x16 := make([]int16, 882*2)
+	x24 := make([]int32, 882*2)
+	xf := make([]float32, 882*2)
+	for i := range x16 {
+		x16[i] = int16((i * 7919) % 65536)
+		x24[i] = int32(x16[i]) << 8
+		xf[i] = float32(x16[i]) / 32768
+	}
+	f.Load(xf)
+	i16.LoadInt16(x16)
+	i24.LoadInt24(x24)
+	want := make([]float32, 960*2)
+	got16 := make([]float32, 960*2)
+	got24 := make([]float32, 960*2)
+	f.Emit(want)
+	i16.Emit(got16)
+	i24.Emit(got24)
+	for i := range want {
+		if got16[i] != want[i] || got24[i] != want[i] {
+			t.Fatalf("sample %d: int16 %v int24 %v want %v", i, got16[i], got24[i], want[i])
+		}
+	}
+}
+
+func TestPolyphaseResamplerRejectsHugeRatios(t *testing.T) {
+	if _, err := NewPolyphaseResampler(48000, 44101, 1, 0); err == nil {
+		t.Fatal("expected an error for a 44101/48000 ratio")
+	}
+}
+
+func BenchmarkPolyphaseResampler(b *testing.B) {
+	for _, rates := range [][2]int{{48000, 44100}, {44100, 48000}} {
+		in, out := rates[0], rates[1]
+		b.Run(fmt.Sprintf("%d_to_%d_stereo", in, out), func(b *testing.B) {
+			r, _ := NewPolyphaseResampler(in, out, 2, in/50)
+			x := polyphaseTestSine(in, 2, in/50, 1000, 440)
+			y := make([]float32, (out/50+1)*2)
+			b.SetBytes(int64(4 * len(x)))
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				r.Load(x)
+				r.Emit(y)
+			}
+		})
+	}
+}
+
+func TestPolyphaseDotMatchesGo(t *testing.T) {
+	for _, taps := range []int{64, 128, 320} {
+		coefs := make([]float32, taps)
+		x := make([]float32, taps)
+		for i := range coefs {
+			coefs[i] = float32(math.Sin(float64(i)*0.37)) * 0.1
+			x[i] = float32(math.Cos(float64(i) * 1.13))
+		}
+		got := polyphaseDot(coefs, x, taps)
+		want := polyphaseDotGo(coefs, x, taps)
+		if d := math.Abs(float64(got - want)); d > 1e-5 {
+			t.Fatalf("taps=%d: polyphaseDot=%v want %v", taps, got, want)
+		}
+	}
+}
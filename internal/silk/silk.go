@@ -485,6 +485,7 @@ func (d *Decoder) DecodeWithDecoderInto(
 	}
 
 	resampler := d.GetResampler(bandwidth)
+	capture := d.outputCaptureArmed(resampler)
 	outputOffset := 0
 	for f := range framesPerPacket {
 		start := f * frameLength
@@ -494,9 +495,17 @@ func (d *Decoder) DecodeWithDecoderInto(
 		}
 		frame := nativeSamples[start:end]
 		resamplerInput := d.BuildMonoResamplerInputInt16(frame)
-		n := resampler.ProcessInt16Into(resamplerInput, output[outputOffset:])
+		var n int
+		if capture {
+			n = resampler.ProcessInt16IntoBoth(resamplerInput, output[outputOffset:], d.outputCapture[min(outputOffset, len(d.outputCapture)):])
+		} else {
+			n = resampler.ProcessInt16Into(resamplerInput, output[outputOffset:])
+		}
 		outputOffset += n
 	}
+	if capture {
+		d.outputCaptured = min(outputOffset, len(d.outputCapture))
+	}
 
 	d.finalizeSuccessfulDecode(frameSizeSamples, 1)
 
@@ -557,8 +566,18 @@ func (d *Decoder) DecodeStereoWithDecoderInto(
 		return 0, ErrDecodeFailed
 	}
 
-	nLeft := leftResampler.ProcessInt16Into(leftNative[:nativeSamples], leftScratch)
-	nRight := rightResampler.ProcessInt16Into(rightNative[:nativeSamples], rightScratch)
+	capture := d.outputCaptureArmed(leftResampler)
+	var nLeft, nRight int
+	var leftI16, rightI16 []int16
+	if capture {
+		leftI16 = d.plcStereoLeftI16Scratch(frameSizeSamples)
+		rightI16 = d.plcStereoRightI16Scratch(frameSizeSamples)
+		nLeft = leftResampler.ProcessInt16IntoBoth(leftNative[:nativeSamples], leftScratch, leftI16)
+		nRight = rightResampler.ProcessInt16IntoBoth(rightNative[:nativeSamples], rightScratch, rightI16)
+	} else {
+		nLeft = leftResampler.ProcessInt16Into(leftNative[:nativeSamples], leftScratch)
+		nRight = rightResampler.ProcessInt16Into(rightNative[:nativeSamples], rightScratch)
+	}
 	n := min(nRight, nLeft)
 	if n < 0 || n*2 > len(output) {
 		return 0, ErrDecodeFailed
@@ -567,6 +586,9 @@ func (d *Decoder) DecodeStereoWithDecoderInto(
 		output[i*2] = leftScratch[i]
 		output[i*2+1] = rightScratch[i]
 	}
+	if capture {
+		d.outputCaptured = interleaveCaptureInt16(d.outputCapture, 0, leftI16, rightI16, n)
+	}
 
 	d.finalizeSuccessfulDecode(frameSizeSamples, 2)
 	return n, nil
@@ -805,6 +827,15 @@ func (d *Decoder) DecodeMonoToStereoWithDecoderInto(
 		return 0, ErrDecodeFailed
 	}
 
+	capture := d.outputCaptureArmed(leftResampler)
+	var leftI16, rightI16 []int16
+	if capture {
+		leftI16 = d.plcStereoLeftI16Scratch(frameSizeSamples)
+		rightI16 = leftI16
+		if useStereoHistory {
+			rightI16 = d.plcStereoRightI16Scratch(frameSizeSamples)
+		}
+	}
 	outputOffset := 0
 	for f := range framesPerPacket {
 		start := f * frameLength
@@ -813,14 +844,27 @@ func (d *Decoder) DecodeMonoToStereoWithDecoderInto(
 			return 0, ErrDecodeFailed
 		}
 		resamplerInput := d.BuildMonoResamplerInputInt16(nativeSamples[start:end])
-		nLeft := leftResampler.ProcessInt16Into(resamplerInput, leftScratch)
+		var nLeft int
+		if capture {
+			nLeft = leftResampler.ProcessInt16IntoBoth(resamplerInput, leftScratch, leftI16)
+		} else {
+			nLeft = leftResampler.ProcessInt16Into(resamplerInput, leftScratch)
+		}
 		n := nLeft
 		if useStereoHistory {
-			nRight := rightResampler.ProcessInt16Into(resamplerInput, rightScratch)
+			var nRight int
+			if capture {
+				nRight = rightResampler.ProcessInt16IntoBoth(resamplerInput, rightScratch, rightI16)
+			} else {
+				nRight = rightResampler.ProcessInt16Into(resamplerInput, rightScratch)
+			}
 			if nRight < n {
 				n = nRight
 			}
 		}
+		if capture {
+			d.outputCaptured = interleaveCaptureInt16(d.outputCapture, outputOffset, leftI16, rightI16, n)
+		}
 		if n < 0 || (outputOffset+n)*2 > len(output) {
 			return 0, ErrDecodeFailed
 		}
@@ -840,6 +884,27 @@ func (d *Decoder) DecodeMonoToStereoWithDecoderInto(
 	return outputOffset, nil
 }
 
+// outputCaptureArmed reports whether the received-frame int16 output capture is
+// armed and the resampler emits native int16 (the float downsampler used when
+// the API rate is below the SILK internal rate does not). A decode that cannot
+// capture leaves OutputCaptured at 0 so the caller declines the integer path.
+func (d *Decoder) outputCaptureArmed(r *LibopusResampler) bool {
+	return len(d.outputCapture) > 0 && r != nil && r.down == nil
+}
+
+// interleaveCaptureInt16 writes n left/right int16 sample pairs into dst starting
+// at sample-pair offset, stopping at the end of dst. It returns the number of
+// interleaved samples filled from the start of dst.
+func interleaveCaptureInt16(dst []int16, offset int, left, right []int16, n int) int {
+	filled := 2 * offset
+	for i := 0; i < n && filled+1 < len(dst); i++ {
+		dst[filled] = left[i]
+		dst[filled+1] = right[i]
+		filled += 2
+	}
+	return filled
+}
+
 func duplicateMonoFloat32ToStereo(dst, src []float32, n int) {
 	if n <= 0 {
 		return
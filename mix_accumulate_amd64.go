@@ -0,0 +1,25 @@
+//go:build amd64 && !purego
+
+package gopus
+
+import "github.com/thesyncim/gopus/internal/cpufeat"
+
+// mixUseAVX2FMA gates the AVX2/FMA mix-bus kernel.
+var mixUseAVX2FMA = cpufeat.AMD64.HasAVX2 && cpufeat.AMD64.HasFMA
+
+//go:noescape
+func mixAccumulateBlocksAVX2(bus, src []float32, gain float32, n int)
+
+// mixAccumulate adds gain*src[i] to bus[i] for every sample of src.
+func mixAccumulate(bus, src []float32, gain float32) {
+	n := len(src)
+	bus = bus[:n]
+	blocks := 0
+	if mixUseAVX2FMA {
+		blocks = n &^ 15
+		if blocks > 0 {
+			mixAccumulateBlocksAVX2(bus, src, gain, blocks)
+		}
+	}
+	mixAccumulateGo(bus[blocks:], src[blocks:], gain)
+}
@@ -0,0 +1,33 @@
+//go:build amd64 && !purego
+
+#include "textflag.h"
+
+// func mixAccumulateBlocksAVX2(bus, src []float32, gain float32, n int)
+//
+// bus[i] += gain * src[i] over complete 16-sample blocks, one FMA per eight
+// samples.
+TEXT ·mixAccumulateBlocksAVX2(SB), NOSPLIT, $0-64
+	MOVQ         bus_base+0(FP), DI
+	MOVQ         src_base+24(FP), SI
+	VBROADCASTSS gain+48(FP), Y2
+	MOVQ         n+56(FP), CX
+
+	SHRQ $4, CX
+	JZ   done
+
+loop16:
+	VMOVUPS     (DI), Y0
+	VMOVUPS     32(DI), Y1
+	VFMADD231PS (SI), Y2, Y0
+	VFMADD231PS 32(SI), Y2, Y1
+	VMOVUPS     Y0, (DI)
+	VMOVUPS     Y1, 32(DI)
+
+	ADDQ $64, SI
+	ADDQ $64, DI
+	DECQ CX
+	JNZ  loop16
+
+done:
+	VZEROUPPER
+	RET
@@ -0,0 +1,17 @@
+//go:build arm64 && !purego
+
+package gopus
+
+//go:noescape
+func mixAccumulateBlocksNeon(bus, src []float32, gain float32, n int)
+
+// mixAccumulate adds gain*src[i] to bus[i] for every sample of src.
+func mixAccumulate(bus, src []float32, gain float32) {
+	n := len(src)
+	bus = bus[:n]
+	blocks := n &^ 15
+	if blocks > 0 {
+		mixAccumulateBlocksNeon(bus, src, gain, blocks)
+	}
+	mixAccumulateGo(bus[blocks:], src[blocks:], gain)
+}
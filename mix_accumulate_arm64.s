@@ -0,0 +1,30 @@
+//go:build arm64 && !purego
+
+#include "textflag.h"
+
+// func mixAccumulateBlocksNeon(bus, src []float32, gain float32, n int)
+//
+// bus[i] += gain * src[i] over complete 16-sample blocks.
+TEXT ·mixAccumulateBlocksNeon(SB), NOSPLIT, $0-64
+	MOVD  bus_base+0(FP), R0
+	MOVD  src_base+24(FP), R1
+	FMOVS gain+48(FP), F20
+	MOVD  n+56(FP), R2
+	WORD  $0x4E040694 // DUP V20.4S, V20.S[0]
+
+	LSR $4, R2
+	CBZ R2, done
+
+loop16:
+	VLD1   (R0), [V0.S4, V1.S4, V2.S4, V3.S4]
+	VLD1.P 64(R1), [V4.S4, V5.S4, V6.S4, V7.S4]
+	WORD   $0x4E34CC80 // FMLA V0.4S, V4.4S, V20.4S
+	WORD   $0x4E34CCA1 // FMLA V1.4S, V5.4S, V20.4S
+	WORD   $0x4E34CCC2 // FMLA V2.4S, V6.4S, V20.4S
+	WORD   $0x4E34CCE3 // FMLA V3.4S, V7.4S, V20.4S
+	VST1.P [V0.S4, V1.S4, V2.S4, V3.S4], 64(R0)
+	SUBS   $1, R2
+	BNE    loop16
+
+done:
+	RET
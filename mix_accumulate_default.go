@@ -0,0 +1,8 @@
+//go:build (!amd64 && !arm64) || purego
+
+package gopus
+
+// mixAccumulate adds gain*src[i] to bus[i] for every sample of src.
+func mixAccumulate(bus, src []float32, gain float32) {
+	mixAccumulateGo(bus, src, gain)
+}
@@ -193,6 +193,7 @@ type MultistreamDecoder struct {
 	ignoreExtensions bool
 	dnnBlob          *dnnblob.Blob
 	softClipMem      []float32
+	pcmScratch       []float32 // float32 decode buffer for the integer outputs
 }
 
 // NewMultistreamDecoder creates a new multistream decoder with explicit configuration.
@@ -693,6 +693,7 @@ type Decoder struct {
 	dnnBlob            *dnnblob.Blob
 	decoderDREDFields
 	decoderOSCEFields
+	decoderDownmixFields
 	pitchDNNLoaded    bool
 	plcModelLoaded    bool
 	farganModelLoaded bool
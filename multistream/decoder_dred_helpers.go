@@ -78,6 +78,9 @@ func (d *Decoder) setDREDDecoderBlob(blob *dnnblob.Blob) {
 			s.dredModelLoaded = true
 		}
 	}
+	for i := range s.dredProcesses {
+		s.dredProcesses[i].Restart()
+	}
 	if !s.dredModelLoaded {
 		d.clearDREDPayloadState()
 		clear(s.dredProcesses)
@@ -256,13 +259,15 @@ func (d *Decoder) maybeCacheDREDPayload(stream int, packet []byte) {
 		return
 	}
 	minFeatureFrames := 2 * internaldred.NumRedundancyFrames
+	// The RDOVAE feature decode is deferred to queueCachedDREDRecovery so
+	// streams without losses only pay for the entropy decode.
+	s.dredProcesses[stream].Restart()
 	if _, err := s.dredDecoded[stream].Decode(payload, frameOffset, minFeatureFrames); err != nil {
 		s.dredCache[stream].Invalidate()
 		s.dredDecoded[stream].Invalidate()
 		s.dredPLC[stream].FECClear()
 		return
 	}
-	s.dredModel.DecodeAllWithProcessor(&s.dredProcesses[stream], s.dredDecoded[stream].Features[:], s.dredDecoded[stream].State[:], s.dredDecoded[stream].Latents[:], s.dredDecoded[stream].NbLatents)
 }
 
 func (d *Decoder) markDREDUpdated(stream int) {
@@ -334,7 +339,13 @@ func (d *Decoder) queueCachedDREDRecovery(stream, maxDredSamples, decodeOffsetSa
 	if s.dredBlend[stream] == 0 {
 		initFrames = 2
 	}
-	return internaldred.QueueProcessedFeaturesWithInitFrames(&s.dredPLC[stream], d.cachedDREDResult(stream, maxDredSamples), &s.dredDecoded[stream], decodeOffsetSamples, frameSizeSamples, initFrames)
+	result := d.cachedDREDResult(stream, maxDredSamples)
+	decoded := &s.dredDecoded[stream]
+	window := internaldred.ProcessedFeatureWindow(result, decoded, decodeOffsetSamples, frameSizeSamples, initFrames)
+	if need := window.LatentsNeeded(); need > s.dredProcesses[stream].DecodedLatents() {
+		s.dredModel.DecodePrefixWithProcessor(&s.dredProcesses[stream], decoded.Features[:], decoded.State[:], decoded.Latents[:], need)
+	}
+	return internaldred.QueueProcessedFeaturesWithInitFrames(&s.dredPLC[stream], result, decoded, decodeOffsetSamples, frameSizeSamples, initFrames)
 }
 
 func (d *Decoder) dredNeuralConcealmentAvailable() bool {
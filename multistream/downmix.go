@@ -0,0 +1,179 @@
+package multistream
+
+import "errors"
+
+// ErrInvalidDownmix indicates a downmix matrix whose size does not match the
+// requested output channels and the decoder's mapped channel count.
+var ErrInvalidDownmix = errors.New("multistream: invalid downmix matrix")
+
+// decoderDownmixFields holds the fused downmix selected by SetDownmix. The
+// user matrix over mapped output channels is folded through the channel
+// mapping into one gain row per decoded stream channel, so each elementary
+// stream is accumulated into the downmix output as soon as it is decoded and
+// the full-channel interleaved frame is never built.
+type decoderDownmixFields struct {
+	downmixChannels int
+	// downmixGains holds downmixChannels gains per decoded stream channel,
+	// indexed by mapping value: coupled stream s channel c is row 2*s+c,
+	// uncoupled stream s is row coupledStreams+s.
+	downmixGains []float32
+	// downmixActive reports, per stream, whether any of its channels reaches
+	// the downmix. Inactive streams (LFE on a stereo downmix) are not decoded.
+	downmixActive []bool
+	downmixOut    []float32
+}
+
+// SetDownmix makes Decode and DecodeToFloat32 return channels downmixed
+// channels instead of the mapped output channels. matrix is row-major with
+// Channels() columns: output channel o is the sum over mapped channel ch of
+// matrix[o*Channels()+ch] times that channel. Streams that contribute to no
+// downmix channel are skipped entirely; their decoders are reset if a later
+// matrix brings them back. channels 0 with a nil matrix restores the full
+// mapped output.
+//
+// A downmix cannot be combined with a projection demixing matrix.
+func (d *Decoder) SetDownmix(channels int, matrix []float32) error {
+	if channels == 0 && len(matrix) == 0 {
+		d.reactivateDownmixStreams()
+		d.downmixChannels = 0
+		d.downmixGains = nil
+		d.downmixActive = nil
+		return nil
+	}
+	if channels < 1 || channels > 255 || len(matrix) != channels*d.outputChannels || len(d.projectionDemixing) != 0 {
+		return ErrInvalidDownmix
+	}
+
+	gains := make([]float32, (d.streams+d.coupledStreams)*channels)
+	for ch, m := range d.mapping {
+		if m == 255 {
+			continue
+		}
+		row := gains[int(m)*channels : (int(m)+1)*channels]
+		for o := range row {
+			row[o] += matrix[o*d.outputChannels+ch]
+		}
+	}
+	active := make([]bool, d.streams)
+	for s := range active {
+		first, n := d.coupledStreams+s, 1
+		if s < d.coupledStreams {
+			first, n = 2*s, 2
+		}
+		for _, g := range gains[first*channels : (first+n)*channels] {
+			if g != 0 {
+				active[s] = true
+				break
+			}
+		}
+	}
+
+	d.reactivateDownmixStreams(active...)
+	if len(d.softClipMem) < channels {
+		d.softClipMem = make([]float32, channels)
+	}
+	d.downmixChannels = channels
+	d.downmixGains = gains
+	d.downmixActive = active
+	return nil
+}
+
+// reactivateDownmixStreams resets the decoders of streams the current downmix
+// skips and next (nil: no downmix) decodes again, so they do not resume from
+// state that is several packets stale.
+func (d *Decoder) reactivateDownmixStreams(next ...bool) {
+	for s, was := range d.downmixActive {
+		if !was && (next == nil || next[s]) {
+			d.decoders[s].Reset()
+			d.decoders[s].SetIgnoreExtensions(d.ignoreExtensions)
+		}
+	}
+}
+
+// DownmixChannels returns the channel count set by SetDownmix, or 0 when the
+// decoder returns the full mapped output.
+func (d *Decoder) DownmixChannels() int {
+	return d.downmixChannels
+}
+
+// resultChannels returns the interleaved channel count of decoded output.
+func (d *Decoder) resultChannels() int {
+	if d.downmixChannels > 0 {
+		return d.downmixChannels
+	}
+	return d.outputChannels
+}
+
+// downmixSkipsStream reports whether stream s is left undecoded because it
+// does not reach the downmix.
+func (d *Decoder) downmixSkipsStream(s int) bool {
+	return d.downmixChannels > 0 && !d.downmixActive[s]
+}
+
+// beginDownmix returns the zeroed downmix accumulator for frameSize samples.
+// It is decoder scratch, valid until the next decode call.
+func (d *Decoder) beginDownmix(frameSize int) []float32 {
+	n := frameSize * d.downmixChannels
+	if cap(d.downmixOut) < n {
+		d.downmixOut = make([]float32, n)
+	}
+	out := d.downmixOut[:n]
+	clear(out)
+	return out
+}
+
+// callerOwned returns samples as a slice the caller may keep: the downmix
+// accumulator is decoder scratch that the next decode overwrites, so it is
+// copied out; every other decode result is already a fresh slice.
+func (d *Decoder) callerOwned(samples []float32) []float32 {
+	if len(samples) == 0 || cap(d.downmixOut) == 0 || &samples[0] != &d.downmixOut[:1][0] {
+		return samples
+	}
+	return append([]float32(nil), samples...)
+}
+
+// accumulateDownmix mixes stream s's interleaved decoded frame into out.
+func (d *Decoder) accumulateDownmix(out []float32, s int, decoded []float32, frameSize int) {
+	channels := d.downmixChannels
+	if s < d.coupledStreams {
+		g := d.downmixGains[2*s*channels : (2*s+2)*channels]
+		decoded = decoded[:2*frameSize]
+		if channels == 2 {
+			gll, glr, grl, grr := g[0], g[1], g[2], g[3]
+			out = out[:2*frameSize]
+			for i := 0; i < frameSize; i++ {
+				l, r := decoded[2*i], decoded[2*i+1]
+				out[2*i] += gll*l + grl*r
+				out[2*i+1] += glr*l + grr*r
+			}
+			return
+		}
+		for i := 0; i < frameSize; i++ {
+			l, r := decoded[2*i], decoded[2*i+1]
+			dst := out[i*channels : (i+1)*channels]
+			for o := range dst {
+				dst[o] += g[o]*l + g[channels+o]*r
+			}
+		}
+		return
+	}
+
+	row := d.coupledStreams + s
+	g := d.downmixGains[row*channels : (row+1)*channels]
+	decoded = decoded[:frameSize]
+	if channels == 2 {
+		gl, gr := g[0], g[1]
+		out = out[:2*frameSize]
+		for i, v := range decoded {
+			out[2*i] += gl * v
+			out[2*i+1] += gr * v
+		}
+		return
+	}
+	for i, v := range decoded {
+		dst := out[i*channels : (i+1)*channels]
+		for o := range dst {
+			dst[o] += g[o] * v
+		}
+	}
+}
@@ -0,0 +1,113 @@
+package multistream
+
+import (
+	"errors"
+	"slices"
+	"testing"
+)
+
+// TestSetDownmixSkipsLFE folds a 5.1 stereo downmix through the default
+// mapping: the LFE stream reaches neither output and is not decoded, and the
+// centre stream feeds both sides.
+func TestSetDownmixSkipsLFE(t *testing.T) {
+	dec, err := NewDecoderDefault(48000, 6)
+	if err != nil {
+		t.Fatal(err)
+	}
+	const h = 0.5
+	// FL C FR RL RR LFE
+	matrix := []float32{
+		1, h, 0, h, 0, 0,
+		0, h, 1, 0, h, 0,
+	}
+	if err := dec.SetDownmix(2, matrix); err != nil {
+		t.Fatalf("SetDownmix: %v", err)
+	}
+	if want := []bool{true, true, true, false}; !slices.Equal(dec.downmixActive, want) {
+		t.Fatalf("active streams %v, want %v", dec.downmixActive, want)
+	}
+	// Mapping value 4 is the centre (uncoupled stream 2).
+	if g := dec.downmixGains[4*2 : 5*2]; g[0] != h || g[1] != h {
+		t.Fatalf("centre gains %v, want [%v %v]", g, h, h)
+	}
+
+	out, err := dec.DecodeToFloat32(nil, 960)
+	if err != nil || len(out) != 960*2 {
+		t.Fatalf("PLC DecodeToFloat32 = %d samples, %v; want %d", len(out), err, 960*2)
+	}
+	// The returned slice belongs to the caller, not the downmix scratch.
+	next, err := dec.DecodeToFloat32(nil, 960)
+	if err != nil {
+		t.Fatalf("second PLC DecodeToFloat32: %v", err)
+	}
+	if &out[0] == &next[0] {
+		t.Fatal("DecodeToFloat32 results alias the downmix accumulator")
+	}
+	into := make([]float32, 960*2)
+	if n, err := dec.DecodeToFloat32Into(into, nil, 960); err != nil || n != 960 {
+		t.Fatalf("DecodeToFloat32Into = %d, %v; want 960", n, err)
+	}
+	if _, err := dec.DecodeToFloat32Into(into[:960], nil, 960); !errors.Is(err, ErrBufferTooSmall) {
+		t.Fatalf("short DecodeToFloat32Into err=%v, want ErrBufferTooSmall", err)
+	}
+	if err := dec.SetProjectionDemixingMatrix(make([]byte, 2*6*6)); !errors.Is(err, ErrInvalidProjectionMatrix) {
+		t.Fatalf("projection with downmix err=%v, want ErrInvalidProjectionMatrix", err)
+	}
+	if err := dec.SetDownmix(2, matrix[:11]); !errors.Is(err, ErrInvalidDownmix) {
+		t.Fatalf("short matrix err=%v, want ErrInvalidDownmix", err)
+	}
+}
+
+// TestDecodeToFloat32IntoShortBufferKeepsState checks that an undersized dst
+// is rejected before the packet is consumed: retrying with a full buffer must
+// match a decoder that never saw the failed call.
+func TestDecodeToFloat32IntoShortBufferKeepsState(t *testing.T) {
+	const frameSize = 960
+	enc, err := NewEncoderDefault(48000, 6)
+	if err != nil {
+		t.Fatal(err)
+	}
+	frames := generateContinuousTestSignal(6, frameSize, 3, 48000, 440)
+	packets := make([][]byte, len(frames))
+	for i, pcm := range frames {
+		if packets[i], err = enc.Encode(pcm, frameSize); err != nil {
+			t.Fatalf("Encode frame %d: %v", i, err)
+		}
+	}
+
+	got, err := NewDecoderDefault(48000, 6)
+	if err != nil {
+		t.Fatal(err)
+	}
+	want, err := NewDecoderDefault(48000, 6)
+	if err != nil {
+		t.Fatal(err)
+	}
+	matrix := []float32{
+		1, 0.5, 0, 0.5, 0, 0,
+		0, 0.5, 1, 0, 0.5, 0,
+	}
+	for _, dec := range []*Decoder{got, want} {
+		if err := dec.SetDownmix(2, matrix); err != nil {
+			t.Fatalf("SetDownmix: %v", err)
+		}
+	}
+
+	dst := make([]float32, frameSize*2)
+	for i, packet := range packets {
+		if _, err := got.DecodeToFloat32Into(dst[:frameSize], packet, frameSize); !errors.Is(err, ErrBufferTooSmall) {
+			t.Fatalf("frame %d short dst err=%v, want ErrBufferTooSmall", i, err)
+		}
+		n, err := got.DecodeToFloat32Into(dst, packet, frameSize)
+		if err != nil || n != frameSize {
+			t.Fatalf("frame %d DecodeToFloat32Into = %d, %v", i, n, err)
+		}
+		ref, err := want.DecodeToFloat32(packet, frameSize)
+		if err != nil {
+			t.Fatalf("frame %d reference decode: %v", i, err)
+		}
+		if !slices.Equal(dst, ref) {
+			t.Fatalf("frame %d differs after a rejected short decode", i)
+		}
+	}
+}
@@ -11,7 +11,6 @@ import (
 	"fmt"
 	"math"
 
-	"github.com/thesyncim/gopus/internal/arena"
 	"github.com/thesyncim/gopus/internal/celt"
 	"github.com/thesyncim/gopus/internal/dnnblob"
 	"github.com/thesyncim/gopus/internal/encoder"
@@ -122,19 +121,19 @@ type Encoder struct {
 	// Per-call encode scratch reused across Encode calls to reduce the
 	// steady-state encode allocation footprint. These slice headers and their
 	// element buffers are intra-call scratch consumed before the assembled
-	// packet is produced; they never escape the encoder. The assembled output
-	// bytes are freshly allocated because the caller may retain them.
+	// packet is produced; they never escape the encoder.
 	streamInputScratch   [][]float32 // routed per-stream input buffers
 	analysisInputScratch [][]float32 // routed per-stream analysis buffers (distinct length)
-	streamPacketsScratch [][]byte    // per-stream encoded packets
-	assembleScratch      [][]byte    // self-delimited framing slices for assembly
 
-	// packetParser holds reusable parse/build working buffers and assembleArena
-	// backs the self-delimited reframing of the first N-1 stream packets during
-	// assembly. The arena slices coexist until the final packet copy but never
-	// escape the assemble call.
-	packetParser  packetScratch
-	assembleArena arena.Bump[byte]
+	// packetParser holds reusable parse/build working buffers for the
+	// self-delimited reframing. ownedPacketScratch is the assembly target of
+	// the allocating EncodeFloat32WithAnalysisMaxBytes, whose result is copied
+	// out because the caller may retain it.
+	packetParser       packetScratch
+	ownedPacketScratch []byte
+	// streamPackets holds the per-stream packets, still in their stream
+	// encoders' buffers, until EncodeFloat32WithAnalysisInto places them.
+	streamPackets [][]byte
 }
 
 const surroundBands = 21
@@ -1362,18 +1361,53 @@ func (e *Encoder) EncodeFloat32WithAnalysis(pcm []float32, frameSize int, analys
 // packet budget. maxDataBytes is the total output buffer size; libopus uses it
 // as the top-level max_data_bytes and derives each stream's curr_max from it
 // (opus_multistream_encoder.c opus_multistream_encode_native(), lines 1016-1024).
+//
+// The returned packet is freshly allocated; EncodeFloat32WithAnalysisInto
+// writes into a caller buffer instead.
 func (e *Encoder) EncodeFloat32WithAnalysisMaxBytes(pcm []float32, frameSize int, analysisPCM []float32, maxDataBytes int) ([]byte, error) {
+	// Self-delimiting only ever drops padding and adds at most two length
+	// bytes per stream, so this bound always holds the assembled packet.
+	out := e.ensureOwnedPacketScratch(e.streams * (msFrameTmp + 2))
+	n, err := e.EncodeFloat32WithAnalysisInPlace(pcm, frameSize, analysisPCM, maxDataBytes, out)
+	if err != nil || n == 0 {
+		return nil, err
+	}
+	return append([]byte(nil), out[:n]...), nil
+}
+
+// EncodeFloat32WithAnalysisInto encodes one frame into dst and returns the
+// packet length, or 0 when every stream is in DTX. maxDataBytes is the libopus
+// max_data_bytes budget as for EncodeFloat32WithAnalysisMaxBytes.
+//
+// Like libopus opus_multistream_encode, only dst[:n] is written, and nothing
+// at all for DTX or on error: each stream packet is placed once, after every
+// stream has encoded, with the first N-1 reframed to self-delimited form
+// straight from the stream encoders' buffers. It returns ErrBufferTooSmall if
+// the packet does not fit.
+func (e *Encoder) EncodeFloat32WithAnalysisInto(pcm []float32, frameSize int, analysisPCM []float32, maxDataBytes int, dst []byte) (int, error) {
+	return e.encodeFloat32WithAnalysisInto(pcm, frameSize, analysisPCM, maxDataBytes, dst, false)
+}
+
+// EncodeFloat32WithAnalysisInPlace is EncodeFloat32WithAnalysisInto for
+// callers that hand over all of dst as scratch. The last stream encoder
+// assembles its packet in place in the tail of dst, saving its copy, so bytes
+// past the returned length, or all of dst in the DTX case, may be clobbered.
+func (e *Encoder) EncodeFloat32WithAnalysisInPlace(pcm []float32, frameSize int, analysisPCM []float32, maxDataBytes int, dst []byte) (int, error) {
+	return e.encodeFloat32WithAnalysisInto(pcm, frameSize, analysisPCM, maxDataBytes, dst, true)
+}
+
+func (e *Encoder) encodeFloat32WithAnalysisInto(pcm []float32, frameSize int, analysisPCM []float32, maxDataBytes int, dst []byte, inPlace bool) (int, error) {
 	// Validate input length
 	expectedLen := frameSize * e.inputChannels
 	if len(pcm) != expectedLen {
-		return nil, fmt.Errorf("%w: got %d samples, expected %d (frameSize=%d, channels=%d)",
+		return 0, fmt.Errorf("%w: got %d samples, expected %d (frameSize=%d, channels=%d)",
 			ErrInvalidInput, len(pcm), expectedLen, frameSize, e.inputChannels)
 	}
 	if analysisPCM == nil {
 		analysisPCM = pcm
 	}
 	if len(analysisPCM) < expectedLen || len(analysisPCM)%e.inputChannels != 0 {
-		return nil, fmt.Errorf("%w: got %d analysis samples for frameSize=%d channels=%d",
+		return 0, fmt.Errorf("%w: got %d analysis samples for frameSize=%d channels=%d",
 			ErrInvalidInput, len(analysisPCM), frameSize, e.inputChannels)
 	}
 
@@ -1429,15 +1463,12 @@ func (e *Encoder) EncodeFloat32WithAnalysisMaxBytes(pcm []float32, frameSize int
 	//
 	// tot_size accumulates the self-delimited size of the already-emitted streams,
 	// matching opus_repacketizer_out_range_impl()'s returned len (line 1048).
-	streamPackets := e.streamPacketsScratch
-	if cap(streamPackets) < e.streams {
-		streamPackets = make([][]byte, e.streams)
-	}
-	streamPackets = streamPackets[:e.streams]
-	e.streamPacketsScratch = streamPackets
 	allDTX := true
+	missing := false
 	totSize := 0
+	written := 0
 	hundredMs := frameSize > 0 && int(e.sampleRate)/frameSize == 10
+	streamPackets := e.streamPackets[:0]
 
 	for i := 0; i < e.streams; i++ {
 		enc := e.encoders[i]
@@ -1469,39 +1500,71 @@ func (e *Encoder) EncodeFloat32WithAnalysisMaxBytes(pcm []float32, frameSize int
 			enc.SetAllocatedBitrate(bitsToBitrate(currMax*8, fs, frameSize))
 		}
 
-		packet, err := enc.EncodeFloat32WithAnalysisMaxBytes(streamBuffers[i], frameSize, analysisStreamBuffers[i], currMax)
+		last := i == e.streams-1
+		var packet []byte
+		var err error
+		if last && inPlace {
+			packet, err = enc.EncodeFloat32WithAnalysisInto(streamBuffers[i], frameSize, analysisStreamBuffers[i], currMax, dst[written:])
+		} else {
+			packet, err = enc.EncodeFloat32WithAnalysisMaxBytes(streamBuffers[i], frameSize, analysisStreamBuffers[i], currMax)
+		}
 		if err != nil {
-			return nil, fmt.Errorf("stream %d encode failed: %w", i, err)
+			return 0, fmt.Errorf("stream %d encode failed: %w", i, err)
 		}
 
-		if packet == nil {
-			streamPackets[i] = []byte{}
+		if len(packet) == 0 {
+			missing = true
+			continue
+		}
+		// DTX packets are 1-byte TOC-only; full packets are >1 byte
+		if len(packet) > 1 {
+			allDTX = false
+		}
+		// tot_size tracks the self-delimited size for non-last streams.
+		if !last {
+			totSize += len(packet) + frameLengthBytes(len(packet))
 		} else {
-			streamPackets[i] = packet
-			// DTX packets are 1-byte TOC-only; full packets are >1 byte
-			if len(packet) > 1 {
-				allDTX = false
-			}
-			// tot_size tracks the self-delimited size for non-last streams.
-			if i != e.streams-1 {
-				totSize += len(packet) + frameLengthBytes(len(packet))
-			} else {
-				totSize += len(packet)
-			}
+			totSize += len(packet)
+		}
+		if missing {
+			continue
+		}
+		if !inPlace {
+			// Each stream packet stays valid in its own encoder's buffer.
+			streamPackets = append(streamPackets, packet)
+			continue
+		}
+
+		// Place the stream in the RFC 6716 Appendix B framing.
+		n, err := e.placeStreamPacket(dst, written, packet, last)
+		if err != nil {
+			return 0, err
 		}
+		written += n
 	}
+	e.streamPackets = streamPackets
 
-	// If all streams are DTX (1-byte TOC or nil), return nil to signal silence
+	// If all streams are DTX (1-byte TOC or nil), return 0 to signal silence
 	if allDTX {
-		return nil, nil
+		return 0, nil
 	}
-
-	// Assemble multistream packet with RFC 6716 Appendix B framing.
-	packet, err := e.assembleMultistreamPacket(streamPackets)
-	if err != nil {
-		return nil, err
+	if missing {
+		return 0, ErrInvalidPacket
+	}
+	if inPlace {
+		return written, nil
+	}
+	if totSize > len(dst) {
+		return 0, ErrBufferTooSmall
+	}
+	for i, packet := range streamPackets {
+		n, err := e.placeStreamPacket(dst, written, packet, i == len(streamPackets)-1)
+		if err != nil {
+			return 0, err
+		}
+		written += n
 	}
-	return packet, nil
+	return written, nil
 }
 
 // SetComplexity sets encoder complexity (0-10) for all stream encoders.
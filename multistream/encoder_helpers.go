@@ -123,50 +123,54 @@ func (e *Encoder) assembleMultistreamPacket(streamPackets [][]byte) ([]byte, err
 		return nil, nil
 	}
 
-	encoded := e.assembleScratch
-	if cap(encoded) < n {
-		encoded = make([][]byte, n)
-	}
-	encoded = encoded[:n]
-	e.assembleScratch = encoded
-
-	// The first N-1 packets are reframed to self-delimited form, each growing by
-	// at most 2 bytes; carve them from one reusable arena so they coexist until
-	// the final copy below without per-packet allocation.
-	arenaNeed := 0
-	for i := 0; i < n-1; i++ {
-		if len(streamPackets[i]) == 0 {
+	// Reframing grows each of the first N-1 packets by at most 2 bytes.
+	bound := 0
+	for _, packet := range streamPackets {
+		if len(packet) == 0 {
 			return nil, ErrInvalidPacket
 		}
-		arenaNeed += len(streamPackets[i]) + 2
+		bound += len(packet) + 2
 	}
-	e.assembleArena.Ensure(arenaNeed)
-
-	totalSize := 0
+	output := make([]byte, bound)
+	written := 0
 	for i, packet := range streamPackets {
-		if len(packet) == 0 {
-			return nil, ErrInvalidPacket
+		m, err := e.placeStreamPacket(output, written, packet, i == n-1)
+		if err != nil {
+			return nil, err
 		}
+		written += m
+	}
+	return output[:written], nil
+}
 
-		if i < n-1 {
-			written, err := makeSelfDelimitedPacketInto(&e.packetParser, e.assembleArena.Tail(), packet)
-			if err != nil {
-				return nil, err
-			}
-			packet = e.assembleArena.AllocN(written)
+// placeStreamPacket writes one stream packet into the multistream packet dst
+// at offset and returns the bytes written: self-delimited for all but the
+// last stream, standard framing for the last. A last-stream packet that the
+// stream encoder already assembled at dst[offset:] is not copied.
+func (e *Encoder) placeStreamPacket(dst []byte, offset int, packet []byte, last bool) (int, error) {
+	tail := dst[offset:]
+	if !last {
+		// Reframing adds at most the last frame's length field, and may only
+		// shrink the packet by dropping padding.
+		if len(packet)+frameLengthBytes(len(packet)) > len(tail) {
+			return 0, ErrBufferTooSmall
 		}
-		encoded[i] = packet
-		totalSize += len(packet)
+		return makeSelfDelimitedPacketInto(&e.packetParser, tail, packet)
+	}
+	if len(packet) > len(tail) {
+		return 0, ErrBufferTooSmall
 	}
+	if &packet[0] != &tail[0] {
+		copy(tail, packet)
+	}
+	return len(packet), nil
+}
 
-	// The assembled bytes are returned directly to the caller and may be
-	// retained (e.g. building a packet sequence), so this buffer is freshly
-	// allocated rather than reused.
-	output := make([]byte, totalSize)
-	offset := 0
-	for _, packet := range encoded {
-		copy(output[offset:], packet)
-		offset += len(packet)
+// ensureOwnedPacketScratch returns the reusable assembly buffer for the
+// allocating encode entry points, grown to at least n bytes.
+func (e *Encoder) ensureOwnedPacketScratch(n int) []byte {
+	if cap(e.ownedPacketScratch) < n {
+		e.ownedPacketScratch = make([]byte, n)
 	}
-	return output, nil
+	return e.ownedPacketScratch[:n]
 }
@@ -0,0 +1,135 @@
+package multistream
+
+import (
+	"bytes"
+	"errors"
+	"fmt"
+	"testing"
+)
+
+func TestEncodeFloat32WithAnalysisIntoMatchesMaxBytes(t *testing.T) {
+	const frameSize = 960
+	for _, channels := range []int{2, 6, 8} {
+		t.Run(fmt.Sprintf("%dch", channels), func(t *testing.T) {
+			owned, err := NewEncoderDefault(48000, channels)
+			if err != nil {
+				t.Fatalf("NewEncoderDefault: %v", err)
+			}
+			inPlace, err := NewEncoderDefault(48000, channels)
+			if err != nil {
+				t.Fatalf("NewEncoderDefault: %v", err)
+			}
+			owned.SetBitrate(channels * 64000)
+			inPlace.SetBitrate(channels * 64000)
+
+			maxBytes := 4000 * owned.Streams()
+			dst := make([]byte, maxBytes)
+			pcm := generateMultichannelSine(channels, frameSize)
+			for frame := range 8 {
+				want, err := owned.EncodeFloat32WithAnalysisMaxBytes(pcm, frameSize, pcm, maxBytes)
+				if err != nil {
+					t.Fatalf("frame %d: EncodeFloat32WithAnalysisMaxBytes: %v", frame, err)
+				}
+				encode := inPlace.EncodeFloat32WithAnalysisInto
+				if frame%2 == 1 {
+					encode = inPlace.EncodeFloat32WithAnalysisInPlace
+				}
+				for i := range dst {
+					dst[i] = 0xA5
+				}
+				n, err := encode(pcm, frameSize, pcm, maxBytes, dst)
+				if err != nil {
+					t.Fatalf("frame %d: encode into dst: %v", frame, err)
+				}
+				if !bytes.Equal(dst[:n], want) {
+					t.Fatalf("frame %d: in-place packet differs from owned packet (%d vs %d bytes)", frame, n, len(want))
+				}
+				if frame%2 == 0 && bytes.Count(dst[n:], []byte{0xA5}) != len(dst)-n {
+					t.Fatalf("frame %d: EncodeFloat32WithAnalysisInto wrote past the %d-byte packet", frame, n)
+				}
+			}
+		})
+	}
+}
+
+func TestEncodeFloat32WithAnalysisIntoBufferTooSmall(t *testing.T) {
+	const frameSize = 960
+	enc, err := NewEncoderDefault(48000, 6)
+	if err != nil {
+		t.Fatalf("NewEncoderDefault: %v", err)
+	}
+	pcm := generateMultichannelSine(6, frameSize)
+	dst := make([]byte, 16)
+	_, err = enc.EncodeFloat32WithAnalysisInto(pcm, frameSize, pcm, 4000*enc.Streams(), dst)
+	if !errors.Is(err, ErrBufferTooSmall) {
+		t.Fatalf("EncodeFloat32WithAnalysisInto error = %v, want ErrBufferTooSmall", err)
+	}
+}
+
+// BenchmarkEncoderPacketOutput compares the caller-buffer multistream encodes
+// with the allocating entry point. copied-B/frame counts the packet bytes
+// moved after the stream encoders finish: the self-delimited reframing of the
+// first N-1 streams, the last stream unless it was assembled in place, and the
+// final copy-out for the allocating path.
+func BenchmarkEncoderPacketOutput(b *testing.B) {
+	const frameSize = 960
+	layouts := []struct {
+		name     string
+		channels int
+	}{
+		{"stereo", 2},
+		{"7.1", 8},
+	}
+	for _, layout := range layouts {
+		for _, mode := range []string{"inplace", "into", "owned"} {
+			name := layout.name + "/" + mode
+			b.Run(name, func(b *testing.B) {
+				enc, err := NewEncoderDefault(48000, layout.channels)
+				if err != nil {
+					b.Fatalf("NewEncoderDefault: %v", err)
+				}
+				enc.SetBitrate(layout.channels * 64000)
+				streams := enc.Streams()
+				maxBytes := 4000 * streams
+				dst := make([]byte, maxBytes)
+				pcm := generateMultichannelSine(layout.channels, frameSize)
+
+				copied := 0
+				b.ReportAllocs()
+				b.ResetTimer()
+				for i := 0; i < b.N; i++ {
+					var packet []byte
+					switch mode {
+					case "inplace", "into":
+						encode := enc.EncodeFloat32WithAnalysisInto
+						if mode == "inplace" {
+							encode = enc.EncodeFloat32WithAnalysisInPlace
+						}
+						n, err := encode(pcm, frameSize, pcm, maxBytes, dst)
+						if err != nil {
+							b.Fatal(err)
+						}
+						packet = dst[:n]
+					default:
+						packet, err = enc.EncodeFloat32WithAnalysisMaxBytes(pcm, frameSize, pcm, maxBytes)
+						if err != nil {
+							b.Fatal(err)
+						}
+						copied += len(packet)
+					}
+					b.StopTimer()
+					parsed, err := parseMultistreamPacket(packet, streams)
+					if err != nil {
+						b.Fatal(err)
+					}
+					copied += len(packet) - len(parsed[streams-1])
+					if mode == "into" {
+						copied += len(parsed[streams-1])
+					}
+					b.StartTimer()
+				}
+				b.ReportMetric(float64(copied)/float64(b.N), "copied-B/frame")
+			})
+		}
+	}
+}
@@ -78,7 +78,8 @@ func (d *Decoder) decodeStreamToFloat32(stream int, packet []byte, frameSize int
 // All elementary streams within the packet must have the same frame duration.
 // If durations differ, ErrDurationMismatch is returned.
 func (d *Decoder) Decode(data []byte, frameSize int) ([]float32, error) {
-	return d.decodeToFloat32(data, frameSize, true, false)
+	samples, err := d.decodeToFloat32(data, frameSize, true, false)
+	return d.callerOwned(samples), err
 }
 
 // DecodeToInt16 decodes a multistream packet and converts to int16 PCM.
@@ -104,7 +105,7 @@ func (d *Decoder) DecodeToInt16(data []byte, frameSize int) ([]int16, error) {
 		return output, nil
 	}
 
-	samples, err := d.DecodeToFloat32(data, frameSize)
+	samples, err := d.decodeToFloat32(data, frameSize, true, false)
 	if err != nil {
 		return nil, err
 	}
@@ -112,7 +113,8 @@ func (d *Decoder) DecodeToInt16(data []byte, frameSize int) ([]int16, error) {
 	if len(data) == 0 {
 		return float32ToInt16(samples), nil
 	}
-	return float32ToInt16SoftClip(samples, len(samples)/d.outputChannels, d.outputChannels, d.softClipMem), nil
+	channels := d.resultChannels()
+	return float32ToInt16SoftClip(samples, len(samples)/channels, channels, d.softClipMem), nil
 }
 
 // DecodeToFloat32 decodes a multistream packet and returns float32 PCM.
@@ -124,19 +126,43 @@ func (d *Decoder) DecodeToInt16(data []byte, frameSize int) ([]int16, error) {
 //
 // Returns sample-interleaved float32 samples in approximate range [-1, 1].
 // The output format is: [ch0_s0, ch1_s0, ..., chN_s0, ch0_s1, ch1_s1, ...]
+// The slice is newly allocated and owned by the caller; DecodeToFloat32Into
+// decodes into a caller buffer instead.
 func (d *Decoder) DecodeToFloat32(data []byte, frameSize int) ([]float32, error) {
-	return d.decodeToFloat32(data, frameSize, true, false)
+	samples, err := d.decodeToFloat32(data, frameSize, true, false)
+	return d.callerOwned(samples), err
 }
 
-func (d *Decoder) decodeToFloat32(data []byte, frameSize int, applyProjection, perStreamSoftClip bool) ([]float32, error) {
-	if extsupport.DREDRuntime && data != nil && len(data) > 0 && d.dredSidecarActive() {
-		d.invalidateDREDPayloadState()
+// DecodeToFloat32Into decodes like DecodeToFloat32 but writes the interleaved
+// samples into dst and returns the number of samples per channel. dst must
+// hold the decoded duration (frameSize for PLC) for each output (or downmix)
+// channel; a shorter dst fails with ErrBufferTooSmall without consuming the
+// packet or advancing any stream state. With a downmix set the decode
+// allocates nothing.
+func (d *Decoder) DecodeToFloat32Into(dst []float32, data []byte, frameSize int) (int, error) {
+	samples, err := d.decodeToFloat32Limit(data, frameSize, len(dst), true, false)
+	if err != nil {
+		return 0, err
 	}
+	copy(dst, samples)
+	return len(samples) / d.resultChannels(), nil
+}
 
+func (d *Decoder) decodeToFloat32(data []byte, frameSize int, applyProjection, perStreamSoftClip bool) ([]float32, error) {
+	return d.decodeToFloat32Limit(data, frameSize, -1, applyProjection, perStreamSoftClip)
+}
+
+// decodeToFloat32Limit decodes like decodeToFloat32 but, when maxSamples is
+// non-negative, fails with ErrBufferTooSmall before any decoder state moves
+// if the interleaved result would exceed maxSamples.
+func (d *Decoder) decodeToFloat32Limit(data []byte, frameSize, maxSamples int, applyProjection, perStreamSoftClip bool) ([]float32, error) {
 	// A nil OR zero-length packet is packet loss: libopus opus_multistream_decode
 	// sets do_plc=1 for len==0 (opus_multistream_decoder.c:213), concealing the
 	// requested frame size exactly as for a NULL packet.
 	if len(data) == 0 {
+		if maxSamples >= 0 && frameSize*d.resultChannels() > maxSamples {
+			return nil, ErrBufferTooSmall
+		}
 		output, err := d.decodePLCToFloat32(frameSize, applyProjection, perStreamSoftClip)
 		if err == nil && extsupport.DREDRuntime && d.dredSidecarActive() {
 			d.markDREDConcealedAll()
@@ -144,23 +170,38 @@ func (d *Decoder) decodeToFloat32(data []byte, frameSize int, applyProjection, p
 		return output, err
 	}
 
-	packets, err := parseMultistreamPacketScratch(d.packetsScratch, &d.packetParser, &d.reframeArena, data, d.streams)
-	if err != nil {
-		return nil, fmt.Errorf("multistream: parse error: %w", err)
+	// Parsing only touches scratch, so an undersized output is rejected before
+	// the DRED payload state or any stream decoder moves.
+	packets, parseErr := parseMultistreamPacketScratch(d.packetsScratch, &d.packetParser, &d.reframeArena, data, d.streams)
+	var duration int
+	var durationErr error
+	if parseErr == nil {
+		d.packetsScratch = packets
+		duration, durationErr = validateStreamDurationsAtRateScratch(&d.packetParser, packets, int(d.sampleRate))
+		if durationErr == nil && (duration > frameSize || maxSamples >= 0 && duration*d.resultChannels() > maxSamples) {
+			return nil, ErrBufferTooSmall
+		}
 	}
-	d.packetsScratch = packets
-
-	duration, err := validateStreamDurationsAtRateScratch(&d.packetParser, packets, int(d.sampleRate))
-	if err != nil {
-		return nil, err
+	if extsupport.DREDRuntime && d.dredSidecarActive() {
+		d.invalidateDREDPayloadState()
 	}
-	if duration > frameSize {
-		return nil, ErrBufferTooSmall
+	if parseErr != nil {
+		return nil, fmt.Errorf("multistream: parse error: %w", parseErr)
+	}
+	if durationErr != nil {
+		return nil, durationErr
 	}
 	decodeFrameSize := duration
 
 	decodedStreams := d.ensureDecodedStreamsScratch()
+	var downmix []float32
+	if d.downmixChannels > 0 {
+		downmix = d.beginDownmix(decodeFrameSize)
+	}
 	for i := 0; i < d.streams; i++ {
+		if d.downmixSkipsStream(i) {
+			continue
+		}
 		var endDREDCapture func()
 		if extsupport.DREDRuntime && d.dredPayloadScannerActive() {
 			if st, ok := d.decoders[i].(*streamState); ok && len(packets[i]) > 0 {
@@ -180,21 +221,32 @@ func (d *Decoder) decodeToFloat32(data []byte, frameSize int, applyProjection, p
 		// callback; otherwise it clears the per-stream soft-clip memory.
 		d.applyPerStreamSoftClip(i, decoded, decodeFrameSize, perStreamSoftClip)
 		decodedStreams[i] = decoded
+		if downmix != nil {
+			d.accumulateDownmix(downmix, i, decoded, decodeFrameSize)
+		}
 	}
 	if extsupport.DREDRuntime && d.dredPayloadScannerActive() {
 		for i := 0; i < d.streams; i++ {
-			d.maybeCacheDREDPayload(i, packets[i])
+			if !d.downmixSkipsStream(i) {
+				d.maybeCacheDREDPayload(i, packets[i])
+			}
 		}
 	}
 	if extsupport.DREDRuntime && d.dredSidecarActive() {
 		for i := 0; i < d.streams; i++ {
-			d.markDREDUpdated(i)
+			// Streams the downmix leaves undecoded keep their DRED state.
+			if !d.downmixSkipsStream(i) {
+				d.markDREDUpdated(i)
+			}
 		}
 	}
 
-	output := applyChannelMapping32(decodedStreams, d.mapping, d.coupledStreams, decodeFrameSize, d.outputChannels)
-	if applyProjection {
-		d.applyProjectionDemixing32(output, decodeFrameSize)
+	output := downmix
+	if output == nil {
+		output = applyChannelMapping32(decodedStreams, d.mapping, d.coupledStreams, decodeFrameSize, d.outputChannels)
+		if applyProjection {
+			d.applyProjectionDemixing32(output, decodeFrameSize)
+		}
 	}
 
 	d.plcState.Reset()
@@ -205,7 +257,8 @@ func (d *Decoder) decodeToFloat32(data []byte, frameSize int, applyProjection, p
 
 func (d *Decoder) decodePLCToFloat32(frameSize int, applyProjection, perStreamSoftClip bool) ([]float32, error) {
 	fadeFactor := d.plcState.RecordLoss()
-	totalSamples := frameSize * d.outputChannels
+	resultChannels := d.resultChannels()
+	totalSamples := frameSize * resultChannels
 	if fadeFactor < 0.001 {
 		return make([]float32, totalSamples), nil
 	}
@@ -221,7 +274,7 @@ func (d *Decoder) decodePLCToFloat32(frameSize int, applyProjection, perStreamSo
 			if err != nil {
 				return nil, err
 			}
-			total := chunk * d.outputChannels
+			total := chunk * resultChannels
 			if len(decoded) < total {
 				return nil, ErrBufferTooSmall
 			}
@@ -237,13 +290,23 @@ func (d *Decoder) decodePLCToFloat32(frameSize int, applyProjection, perStreamSo
 
 func (d *Decoder) decodePLCChunkToFloat32(frameSize int, applyProjection, perStreamSoftClip bool) ([]float32, error) {
 	decodedStreams := make([][]float32, d.streams)
+	var downmix []float32
+	if d.downmixChannels > 0 {
+		downmix = d.beginDownmix(frameSize)
+	}
 	for i := 0; i < d.streams; i++ {
+		if d.downmixSkipsStream(i) {
+			continue
+		}
 		if extsupport.DREDRuntime {
 			if decoded, ok, err := d.decodeDREDPLCStream(i, frameSize); err != nil {
 				return nil, err
 			} else if ok {
 				d.applyPerStreamSoftClip(i, decoded, frameSize, perStreamSoftClip)
 				decodedStreams[i] = decoded
+				if downmix != nil {
+					d.accumulateDownmix(downmix, i, decoded, frameSize)
+				}
 				continue
 			}
 		}
@@ -254,8 +317,14 @@ func (d *Decoder) decodePLCChunkToFloat32(frameSize int, applyProjection, perStr
 		}
 		d.applyPerStreamSoftClip(i, decoded, frameSize, perStreamSoftClip)
 		decodedStreams[i] = decoded
+		if downmix != nil {
+			d.accumulateDownmix(downmix, i, decoded, frameSize)
+		}
 	}
 
+	if downmix != nil {
+		return downmix, nil
+	}
 	output := applyChannelMapping32(decodedStreams, d.mapping, d.coupledStreams, frameSize, d.outputChannels)
 	if applyProjection {
 		d.applyProjectionDemixing32(output, frameSize)
@@ -18,7 +18,7 @@ func (d *Decoder) SetProjectionDemixingMatrix(matrix []byte) error {
 
 	rows := d.outputChannels
 	cols := d.streams + d.coupledStreams
-	if rows <= 0 || cols <= 0 {
+	if rows <= 0 || cols <= 0 || d.downmixChannels > 0 {
 		return ErrInvalidProjectionMatrix
 	}
 	if len(matrix) != 2*rows*cols {
@@ -3,7 +3,7 @@ package gopus
 import "github.com/thesyncim/gopus/multistream"
 
 func (d *MultistreamDecoder) requestedOutputFrameSize(sampleCount int) (int, error) {
-	channels := int(d.channels)
+	channels := d.pcmChannels()
 	sampleRate := int(d.sampleRate)
 	if channels <= 0 {
 		return 0, ErrInvalidChannels
@@ -50,8 +50,22 @@ func (d *MultistreamDecoder) nextPLCChunkSamples(remaining int) int {
 	return chunk
 }
 
+// decodeScratch decodes into the decoder's float32 scratch for the integer
+// output paths, which convert it straight into the caller's buffer.
+func (d *MultistreamDecoder) decodeScratch(data []byte, frameSize int) ([]float32, error) {
+	total := frameSize * d.pcmChannels()
+	if cap(d.pcmScratch) < total {
+		d.pcmScratch = make([]float32, total)
+	}
+	n, err := d.dec.DecodeToFloat32Into(d.pcmScratch[:total], data, frameSize)
+	if err != nil {
+		return nil, err
+	}
+	return d.pcmScratch[:n*d.pcmChannels()], nil
+}
+
 func (d *MultistreamDecoder) decodePLCFloat32Into(pcm []float32, frameSize int) error {
-	channels := int(d.channels)
+	channels := d.pcmChannels()
 	remaining := frameSize
 	offset := 0
 	for remaining > 0 {
@@ -59,15 +73,13 @@ func (d *MultistreamDecoder) decodePLCFloat32Into(pcm []float32, frameSize int)
 		if chunk <= 0 {
 			return ErrInvalidFrameSize
 		}
-		samples, err := d.dec.DecodeToFloat32(nil, chunk)
-		if err != nil {
-			return err
-		}
 		total := chunk * channels
-		if len(samples) < total || offset+total > len(pcm) {
+		if offset+total > len(pcm) {
 			return ErrBufferTooSmall
 		}
-		copy(pcm[offset:offset+total], samples[:total])
+		if _, err := d.dec.DecodeToFloat32Into(pcm[offset:offset+total], nil, chunk); err != nil {
+			return err
+		}
 		offset += total
 		remaining -= chunk
 	}
@@ -75,7 +87,7 @@ func (d *MultistreamDecoder) decodePLCFloat32Into(pcm []float32, frameSize int)
 }
 
 func (d *MultistreamDecoder) decodePLCInt16Into(pcm []int16, frameSize int) error {
-	channels := int(d.channels)
+	channels := d.pcmChannels()
 	remaining := frameSize
 	offset := 0
 	for remaining > 0 {
@@ -83,7 +95,7 @@ func (d *MultistreamDecoder) decodePLCInt16Into(pcm []int16, frameSize int) erro
 		if chunk <= 0 {
 			return ErrInvalidFrameSize
 		}
-		samples, err := d.dec.DecodeToFloat32(nil, chunk)
+		samples, err := d.decodeScratch(nil, chunk)
 		if err != nil {
 			return err
 		}
@@ -99,7 +111,7 @@ func (d *MultistreamDecoder) decodePLCInt16Into(pcm []int16, frameSize int) erro
 }
 
 func (d *MultistreamDecoder) decodePLCInt24Into(pcm []int32, frameSize int) error {
-	channels := int(d.channels)
+	channels := d.pcmChannels()
 	remaining := frameSize
 	offset := 0
 	for remaining > 0 {
@@ -107,7 +119,7 @@ func (d *MultistreamDecoder) decodePLCInt24Into(pcm []int32, frameSize int) erro
 		if chunk <= 0 {
 			return ErrInvalidFrameSize
 		}
-		samples, err := d.dec.DecodeToFloat32(nil, chunk)
+		samples, err := d.decodeScratch(nil, chunk)
 		if err != nil {
 			return err
 		}
@@ -133,7 +145,7 @@ func (d *MultistreamDecoder) decodePLCInt24Into(pcm []int32, frameSize int) erro
 // When data is nil, the decoder performs packet loss concealment using
 // the last successfully decoded frame parameters.
 func (d *MultistreamDecoder) Decode(data []byte, pcm []float32) (int, error) {
-	channels := int(d.channels)
+	channels := d.pcmChannels()
 	frameSize, err := d.decodeFrameSize(data, len(pcm))
 	if err != nil {
 		return 0, err
@@ -150,18 +162,16 @@ func (d *MultistreamDecoder) Decode(data []byte, pcm []float32) (int, error) {
 		return frameSize, nil
 	}
 
-	samples, err := d.dec.DecodeToFloat32(data, frameSize)
+	n, err := d.dec.DecodeToFloat32Into(pcm, data, frameSize)
 	if err != nil {
 		return 0, err
 	}
 
-	copy(pcm, samples)
-
 	if len(data) > 0 {
 		d.lastFrameSize = int32(frameSize)
 	}
 
-	return len(samples) / channels, nil
+	return n, nil
 }
 
 // DecodeInt16 decodes an Opus multistream packet into int16 PCM samples.
@@ -171,7 +181,7 @@ func (d *MultistreamDecoder) Decode(data []byte, pcm []float32) (int, error) {
 //
 // Returns the number of samples per channel decoded, or an error.
 func (d *MultistreamDecoder) DecodeInt16(data []byte, pcm []int16) (int, error) {
-	channels := int(d.channels)
+	channels := d.pcmChannels()
 	frameSize, err := d.decodeFrameSize(data, len(pcm))
 	if err != nil {
 		return 0, err
@@ -195,7 +205,7 @@ func (d *MultistreamDecoder) DecodeInt16(data []byte, pcm []int16) (int, error)
 		return frameSize, nil
 	}
 
-	samples, err := d.dec.DecodeToFloat32(data, frameSize)
+	samples, err := d.decodeScratch(data, frameSize)
 	if err != nil {
 		return 0, err
 	}
@@ -220,7 +230,7 @@ func (d *MultistreamDecoder) DecodeInt16(data []byte, pcm []int16) (int, error)
 //
 // Returns the number of samples per channel decoded, or an error.
 func (d *MultistreamDecoder) DecodeInt24(data []byte, pcm []int32) (int, error) {
-	channels := int(d.channels)
+	channels := d.pcmChannels()
 	frameSize, err := d.decodeFrameSize(data, len(pcm))
 	if err != nil {
 		return 0, err
@@ -244,7 +254,7 @@ func (d *MultistreamDecoder) DecodeInt24(data []byte, pcm []int32) (int, error)
 		return frameSize, nil
 	}
 
-	samples, err := d.dec.DecodeToFloat32(data, frameSize)
+	samples, err := d.decodeScratch(data, frameSize)
 	if err != nil {
 		return 0, err
 	}
@@ -266,7 +276,7 @@ func (d *MultistreamDecoder) DecodeInt24(data []byte, pcm []int32) (int, error)
 // This is a convenience method that allocates the output buffer.
 // For performance-critical code, use DecodeInt24 with a pre-allocated buffer.
 func (d *MultistreamDecoder) DecodeInt24Slice(data []byte) ([]int32, error) {
-	channels := int(d.channels)
+	channels := d.pcmChannels()
 	sampleRate := int(d.sampleRate)
 	// 60 ms is the maximum Opus frame duration; allocate a buffer large
 	// enough for any valid packet, then trim to the actual decoded length.
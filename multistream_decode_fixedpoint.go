@@ -13,6 +13,10 @@ import "github.com/thesyncim/gopus/internal/fixedpoint"
 // bit-exactly by the integer path; otherwise the caller uses the float
 // conversion for this packet.
 func (d *MultistreamDecoder) fixedDecodeInt16(data []byte, pcm []int16, frameSize int) (bool, error) {
+	if d.dec.DownmixChannels() > 0 {
+		// A downmix is accumulated on the float path.
+		return false, nil
+	}
 	res, allHandled, err := d.dec.DecodeToResFixed(data, frameSize)
 	if err != nil {
 		return false, err
@@ -37,6 +41,10 @@ func (d *MultistreamDecoder) fixedDecodeInt16(data []byte, pcm []int16, frameSiz
 // (copy_channel_out_int24). Returns handled=true only when every stream frame
 // was produced bit-exactly by the integer path.
 func (d *MultistreamDecoder) fixedDecodeInt24(data []byte, pcm []int32, frameSize int) (bool, error) {
+	if d.dec.DownmixChannels() > 0 {
+		// A downmix is accumulated on the float path.
+		return false, nil
+	}
 	res, allHandled, err := d.dec.DecodeToResFixed(data, frameSize)
 	if err != nil {
 		return false, err
@@ -0,0 +1,82 @@
+package gopus
+
+// stereoDownmixSqrtHalf is the -3 dB gain ITU-R BS.775 applies to the centre
+// and surround channels in a stereo downmix.
+const stereoDownmixSqrtHalf = 0.70710678
+
+// StereoDownmixMatrix returns the ITU-R BS.775 style stereo downmix matrix for
+// the Vorbis channel order used by NewMultistreamDecoderDefault with the given
+// channel count (1-8), in the layout MultistreamDecoder.SetDownmix expects:
+// two rows (left, right) of channels gains. Centre and surround channels are
+// mixed at -3 dB and the LFE channel is dropped; the rows are not normalized,
+// so loud surround content can exceed full scale (DecodeInt16 soft-clips it).
+func StereoDownmixMatrix(channels int) ([]float32, error) {
+	const h = stereoDownmixSqrtHalf
+	var left, right []float32
+	switch channels {
+	case 1:
+		left, right = []float32{1}, []float32{1}
+	case 2:
+		left, right = []float32{1, 0}, []float32{0, 1}
+	case 3: // L C R
+		left, right = []float32{1, h, 0}, []float32{0, h, 1}
+	case 4: // FL FR RL RR
+		left, right = []float32{1, 0, h, 0}, []float32{0, 1, 0, h}
+	case 5: // FL C FR RL RR
+		left, right = []float32{1, h, 0, h, 0}, []float32{0, h, 1, 0, h}
+	case 6: // FL C FR RL RR LFE
+		left, right = []float32{1, h, 0, h, 0, 0}, []float32{0, h, 1, 0, h, 0}
+	case 7: // FL C FR SL SR RC LFE
+		left, right = []float32{1, h, 0, h, 0, 0.5, 0}, []float32{0, h, 1, 0, h, 0.5, 0}
+	case 8: // FL C FR SL SR RL RR LFE
+		left, right = []float32{1, h, 0, h, 0, h, 0, 0}, []float32{0, h, 1, 0, h, 0, h, 0}
+	default:
+		return nil, ErrInvalidChannels
+	}
+	return append(left, right...), nil
+}
+
+// SetDownmix makes Decode, DecodeInt16 and DecodeInt24 return channels
+// downmixed channels instead of Channels() mapped channels. matrix is
+// row-major, channels rows of Channels() gains: output channel o is the sum
+// over decoded channel ch of matrix[o*Channels()+ch] times that channel (see
+// StereoDownmixMatrix).
+//
+// The downmix is fused into the decode: each coupled or mono elementary
+// stream is accumulated into the downmixed output as soon as it is decoded,
+// the full-channel frame is never built, and a stream that reaches no output
+// channel (the LFE of a stereo downmix) is not decoded at all. DecodeInt16
+// soft-clips the downmixed output once. channels 0 with a nil matrix restores
+// the full-channel output.
+func (d *MultistreamDecoder) SetDownmix(channels int, matrix []float32) error {
+	if channels == 0 && len(matrix) == 0 {
+		return d.dec.SetDownmix(0, nil)
+	}
+	if channels < 1 || channels > 255 {
+		return ErrInvalidChannels
+	}
+	if len(matrix) != channels*int(d.channels) {
+		return ErrInvalidArgument
+	}
+	if err := d.dec.SetDownmix(channels, matrix); err != nil {
+		return ErrInvalidArgument
+	}
+	if len(d.softClipMem) < channels {
+		d.softClipMem = make([]float32, channels)
+	}
+	clear(d.softClipMem)
+	return nil
+}
+
+// OutputChannels returns the interleaved channel count Decode writes: the
+// SetDownmix channel count when a downmix is set, otherwise Channels().
+func (d *MultistreamDecoder) OutputChannels() int {
+	return d.pcmChannels()
+}
+
+func (d *MultistreamDecoder) pcmChannels() int {
+	if n := d.dec.DownmixChannels(); n > 0 {
+		return n
+	}
+	return int(d.channels)
+}
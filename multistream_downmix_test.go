@@ -0,0 +1,159 @@
+package gopus
+
+import (
+	"errors"
+	"fmt"
+	"math"
+	"testing"
+)
+
+// encodeSurroundPackets encodes frames 20 ms packets of the default-mapping
+// surround layout for channels.
+func encodeSurroundPackets(tb testing.TB, channels, frames int) [][]byte {
+	tb.Helper()
+	enc, err := NewMultistreamEncoderDefault(48000, channels, ApplicationAudio)
+	if err != nil {
+		tb.Fatalf("NewMultistreamEncoderDefault: %v", err)
+	}
+	pcm := generateSurroundTestSignal(48000, 960, channels)
+	packets := make([][]byte, 0, frames)
+	for f := 0; f < frames; f++ {
+		pkt, err := enc.EncodeFloat32(pcm)
+		if err != nil {
+			tb.Fatalf("frame %d Encode: %v", f, err)
+		}
+		packets = append(packets, append([]byte(nil), pkt...))
+	}
+	return packets
+}
+
+// applyDownmixMatrix is the external downmix pass the fused decoder replaces.
+func applyDownmixMatrix(dst, src, matrix []float32, n, inCh, outCh int) {
+	for i := 0; i < n; i++ {
+		for o := 0; o < outCh; o++ {
+			var acc float32
+			for c := 0; c < inCh; c++ {
+				acc += matrix[o*inCh+c] * src[i*inCh+c]
+			}
+			dst[i*outCh+o] = acc
+		}
+	}
+}
+
+// TestMultistreamDownmixMatchesExternalDownmix checks the fused stereo
+// downmix against full-channel decode followed by the same matrix, for 5.1
+// and 7.1 with a lost packet.
+func TestMultistreamDownmixMatchesExternalDownmix(t *testing.T) {
+	for _, channels := range []int{6, 8} {
+		t.Run(fmt.Sprintf("%dch", channels), func(t *testing.T) {
+			packets := encodeSurroundPackets(t, channels, 6)
+			packets[3] = nil
+			matrix, err := StereoDownmixMatrix(channels)
+			if err != nil {
+				t.Fatal(err)
+			}
+
+			full := mustNewDefaultMultistreamDecoder(t, 48000, channels)
+			mixed := mustNewDefaultMultistreamDecoder(t, 48000, channels)
+			if err := mixed.SetDownmix(2, matrix); err != nil {
+				t.Fatalf("SetDownmix: %v", err)
+			}
+			if mixed.OutputChannels() != 2 || full.OutputChannels() != channels {
+				t.Fatalf("OutputChannels = %d / %d", mixed.OutputChannels(), full.OutputChannels())
+			}
+
+			pcm := make([]float32, 960*channels)
+			want := make([]float32, 960*2)
+			got := make([]float32, 960*2)
+			for p, pkt := range packets {
+				n, err := full.Decode(pkt, pcm)
+				if err != nil {
+					t.Fatalf("packet %d full Decode: %v", p, err)
+				}
+				applyDownmixMatrix(want, pcm, matrix, n, channels, 2)
+				m, err := mixed.Decode(pkt, got)
+				if err != nil {
+					t.Fatalf("packet %d downmix Decode: %v", p, err)
+				}
+				if m != n {
+					t.Fatalf("packet %d: downmix decoded %d samples, want %d", p, m, n)
+				}
+				for i := 0; i < n*2; i++ {
+					if d := math.Abs(float64(got[i] - want[i])); d > 1e-5 {
+						t.Fatalf("packet %d sample %d: %v want %v", p, i, got[i], want[i])
+					}
+				}
+			}
+
+			// DecodeInt16 soft-clips the downmixed output once.
+			pcm16 := make([]int16, 960*2)
+			if n, err := mixed.DecodeInt16(packets[5], pcm16); err != nil || n != 960 {
+				t.Fatalf("DecodeInt16 = %d, %v", n, err)
+			}
+		})
+	}
+}
+
+func TestMultistreamSetDownmixValidation(t *testing.T) {
+	dec := mustNewDefaultMultistreamDecoder(t, 48000, 6)
+	if err := dec.SetDownmix(2, make([]float32, 11)); !errors.Is(err, ErrInvalidArgument) {
+		t.Fatalf("SetDownmix(short matrix) err=%v, want ErrInvalidArgument", err)
+	}
+	if err := dec.SetDownmix(256, make([]float32, 256*6)); !errors.Is(err, ErrInvalidChannels) {
+		t.Fatalf("SetDownmix(256) err=%v, want ErrInvalidChannels", err)
+	}
+	if _, err := StereoDownmixMatrix(9); !errors.Is(err, ErrInvalidChannels) {
+		t.Fatalf("StereoDownmixMatrix(9) err=%v, want ErrInvalidChannels", err)
+	}
+	matrix, _ := StereoDownmixMatrix(6)
+	if err := dec.SetDownmix(2, matrix); err != nil {
+		t.Fatalf("SetDownmix: %v", err)
+	}
+	if err := dec.SetDownmix(0, nil); err != nil || dec.OutputChannels() != 6 {
+		t.Fatalf("SetDownmix(0, nil) = %v, OutputChannels %d", err, dec.OutputChannels())
+	}
+}
+
+// BenchmarkMultistreamStereoDownmix decodes 5.1 and 7.1 to stereo, either as
+// full-channel decode plus an external matrix pass or through SetDownmix.
+func BenchmarkMultistreamStereoDownmix(b *testing.B) {
+	for _, channels := range []int{6, 8} {
+		packets := encodeSurroundPackets(b, channels, 8)
+		matrix, err := StereoDownmixMatrix(channels)
+		if err != nil {
+			b.Fatal(err)
+		}
+		b.Run(fmt.Sprintf("%dch/decode_then_downmix", channels), func(b *testing.B) {
+			dec, err := NewMultistreamDecoderDefault(48000, channels)
+			if err != nil {
+				b.Fatal(err)
+			}
+			pcm := make([]float32, 960*channels)
+			out := make([]float32, 960*2)
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				n, err := dec.Decode(packets[i%len(packets)], pcm)
+				if err != nil {
+					b.Fatal(err)
+				}
+				applyDownmixMatrix(out, pcm, matrix, n, channels, 2)
+			}
+		})
+		b.Run(fmt.Sprintf("%dch/fused", channels), func(b *testing.B) {
+			dec, err := NewMultistreamDecoderDefault(48000, channels)
+			if err != nil {
+				b.Fatal(err)
+			}
+			if err := dec.SetDownmix(2, matrix); err != nil {
+				b.Fatal(err)
+			}
+			out := make([]float32, 960*2)
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				if _, err := dec.Decode(packets[i%len(packets)], out); err != nil {
+					b.Fatal(err)
+				}
+			}
+		})
+	}
+}
@@ -1,5 +1,11 @@
 package gopus
 
+import (
+	"errors"
+
+	"github.com/thesyncim/gopus/multistream"
+)
+
 // Encode encodes float32 PCM samples into an Opus multistream packet.
 //
 // pcm: Input samples (interleaved). Length must be frameSize * channels.
@@ -23,13 +29,17 @@ func (e *MultistreamEncoder) Encode(pcm []float32, data []byte) (int, error) {
 	// libopus threads the caller buffer size (max_data_bytes) into the per-stream
 	// curr_max budgeting (opus_multistream_encoder.c opus_multistream_encode_native()),
 	// so pass the caller output buffer length rather than a fixed per-stream cap.
-	packet, err := e.enc.EncodeFloat32WithAnalysisMaxBytes(pcm[:inputSamples], frameSize, pcm, len(data))
+	// The stream packets are placed straight into data; bytes past the packet
+	// are left untouched, as in libopus.
+	n, err := e.enc.EncodeFloat32WithAnalysisInto(pcm[:inputSamples], frameSize, pcm, len(data), data)
 	if err != nil {
+		if errors.Is(err, multistream.ErrBufferTooSmall) {
+			return 0, ErrBufferTooSmall
+		}
 		return 0, err
 	}
 	e.encodedOnce = true
-
-	return copyEncodedPacket(packet, data)
+	return n, nil
 }
 
 // EncodeInt16 encodes int16 PCM samples into an Opus multistream packet.
@@ -45,9 +55,7 @@ func (e *MultistreamEncoder) EncodeInt16(pcm []int16, data []byte) (int, error)
 	}
 
 	pcm32 := e.scratchPCM32[:len(pcm)]
-	for i, v := range pcm {
-		pcm32[i] = float32(v) / 32768.0
-	}
+	convertInt16ToFloat32(pcm32, pcm)
 	return e.Encode(pcm32, data)
 }
 
@@ -67,9 +75,7 @@ func (e *MultistreamEncoder) EncodeInt24(pcm []int32, data []byte) (int, error)
 		return 0, ErrInvalidFrameSize
 	}
 	pcm32 := e.scratchPCM32[:len(pcm)]
-	for i, v := range pcm {
-		pcm32[i] = float32(v) / 8388608.0
-	}
+	convertInt24ToFloat32(pcm32, pcm)
 	return e.Encode(pcm32, data)
 }
 
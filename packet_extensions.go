@@ -6,7 +6,10 @@ type packetExtensionData struct {
 	Data  []byte
 }
 
-const qextPacketExtensionID = 124
+const (
+	qextPacketExtensionID = 124
+	dredPacketExtensionID = 126 // libopus DRED_EXTENSION_ID
+)
 
 type packetExtensionIterator struct {
 	data             []byte
@@ -432,9 +435,7 @@ func generatePacketExtensions(dst []byte, length int, extensions []packetExtensi
 		return 0, ErrBufferTooSmall
 	}
 
-	frameMinIdx := make([]int, nbFrames)
-	frameMaxIdx := make([]int, nbFrames)
-	frameRepeatIdx := make([]int, nbFrames)
+	var frameMinIdx, frameMaxIdx, frameRepeatIdx [maxRepacketizerFrames]int
 	for f := range nbFrames {
 		frameMinIdx[f] = len(extensions)
 	}
@@ -455,7 +456,7 @@ func generatePacketExtensions(dst []byte, length int, extensions []packetExtensi
 			}
 		}
 	}
-	copy(frameRepeatIdx, frameMinIdx)
+	frameRepeatIdx = frameMinIdx
 
 	pos := 0
 	written := 0
@@ -28,148 +28,15 @@ type PacketInfo struct {
 
 // ParsePacket parses an Opus packet and returns information about its structure.
 // It determines the frame boundaries based on the TOC byte's frame code (0-3).
+//
+// ParsePacket allocates FrameSizes; use PacketView to index packets on a hot
+// path.
 func ParsePacket(data []byte) (PacketInfo, error) {
-	if len(data) < 1 {
-		return PacketInfo{}, ErrPacketTooShort
+	var v PacketView
+	if err := v.Parse(data); err != nil {
+		return PacketInfo{}, err
 	}
-
-	toc := ParseTOC(data[0])
-	info := PacketInfo{
-		TOC:       toc,
-		TotalSize: len(data),
-	}
-
-	switch toc.FrameCode {
-	case 0:
-		// Code 0: One frame
-		if len(data)-1 > maxOpusFrameBytes {
-			return PacketInfo{}, ErrInvalidPacket
-		}
-		info.FrameCount = 1
-		info.FrameSizes = []int{len(data) - 1}
-
-	case 1:
-		// Code 1: Two equal-sized frames
-		frameDataLen := len(data) - 1
-		if frameDataLen%2 != 0 {
-			return PacketInfo{}, ErrInvalidPacket
-		}
-		frameSize := frameDataLen / 2
-		if frameSize > maxOpusFrameBytes {
-			return PacketInfo{}, ErrInvalidPacket
-		}
-		info.FrameCount = 2
-		info.FrameSizes = []int{frameSize, frameSize}
-
-	case 2:
-		// Code 2: Two frames with different sizes
-		if len(data) < 2 {
-			return PacketInfo{}, ErrPacketTooShort
-		}
-		frame1Len, bytesRead, err := parseFrameLength(data, 1)
-		if err != nil {
-			return PacketInfo{}, err
-		}
-		headerLen := 1 + bytesRead
-		frame2Len := len(data) - headerLen - frame1Len
-		if frame2Len < 0 {
-			return PacketInfo{}, ErrInvalidPacket
-		}
-		if frame2Len > maxOpusFrameBytes {
-			return PacketInfo{}, ErrInvalidPacket
-		}
-		info.FrameCount = 2
-		info.FrameSizes = []int{frame1Len, frame2Len}
-
-	case 3:
-		// Code 3: Arbitrary number of frames
-		if len(data) < 2 {
-			return PacketInfo{}, ErrPacketTooShort
-		}
-		frameCountByte := data[1]
-		vbr := (frameCountByte & 0x80) != 0
-		hasPadding := (frameCountByte & 0x40) != 0
-		m := int(frameCountByte & 0x3F)
-
-		if m == 0 || m > 48 {
-			return PacketInfo{}, ErrInvalidFrameCount
-		}
-		if toc.FrameSize*m > maxRepacketizerDuration48k {
-			return PacketInfo{}, ErrInvalidPacket
-		}
-
-		offset := 2
-		padding := 0
-
-		// Parse padding if present
-		if hasPadding {
-			for {
-				if offset >= len(data) {
-					return PacketInfo{}, ErrPacketTooShort
-				}
-				padByte := int(data[offset])
-				offset++
-				if padByte == 255 {
-					padding += 254
-				} else {
-					padding += padByte
-				}
-				if padByte < 255 {
-					break
-				}
-			}
-		}
-
-		info.FrameCount = m
-		info.Padding = padding
-		info.FrameSizes = make([]int, m)
-
-		if vbr {
-			// VBR: Parse each frame length (except last)
-			totalFrameLen := 0
-			for i := 0; i < m-1; i++ {
-				frameLen, bytesRead, err := parseFrameLength(data, offset)
-				if err != nil {
-					return PacketInfo{}, err
-				}
-				info.FrameSizes[i] = frameLen
-				totalFrameLen += frameLen
-				offset += bytesRead
-			}
-			// Last frame is remainder
-			lastFrameLen := len(data) - offset - padding - totalFrameLen
-			if lastFrameLen < 0 {
-				return PacketInfo{}, ErrInvalidPacket
-			}
-			if lastFrameLen > maxOpusFrameBytes {
-				return PacketInfo{}, ErrInvalidPacket
-			}
-			info.FrameSizes[m-1] = lastFrameLen
-		} else {
-			// CBR: Parse single frame length, all frames are same size
-			// For CBR, no frame lengths are encoded. All frames share the
-			// remaining bytes (minus padding) equally.
-			frameDataLen := len(data) - offset - padding
-			if frameDataLen < 0 {
-				return PacketInfo{}, ErrInvalidPacket
-			}
-			if m == 0 {
-				return PacketInfo{}, ErrInvalidFrameCount
-			}
-			if frameDataLen%m != 0 {
-				return PacketInfo{}, ErrInvalidPacket
-			}
-			frameLen := frameDataLen / m
-			if frameLen > maxOpusFrameBytes {
-				return PacketInfo{}, ErrInvalidPacket
-			}
-			for i := range m {
-				info.FrameSizes[i] = frameLen
-			}
-		}
-	}
-
-	return info, nil
+	return v.packetInfo(), nil
 }
 
 // parseFrameLength parses a frame length from the packet data at the given offset.
@@ -49,23 +49,31 @@ func (r *Repacketizer) Cat(packet []byte) error {
 	if len(packet) < 1 {
 		return ErrInvalidPacket
 	}
-
-	info, frames, padding, paddingFrameCount, err := parsePacketFramesAndPadding(packet)
-	if err != nil {
+	var view PacketView
+	if err := view.Parse(packet); err != nil {
 		return err
 	}
-	if len(frames) == 0 {
+	return r.CatView(&view)
+}
+
+// CatView adds a packet that has already been parsed into view, so callers
+// that inspected or decoded the packet do not parse it again. The frames and
+// padding are copied; the packet need not outlive the call.
+func (r *Repacketizer) CatView(view *PacketView) error {
+	frameCount := view.FrameCount()
+	if frameCount == 0 {
 		return ErrInvalidPacket
 	}
+	packet := view.Data()
 
 	if len(r.frames) == 0 {
 		r.toc = packet[0]
-		r.frameSize = info.TOC.FrameSize
+		r.frameSize = view.TOC().FrameSize
 	} else if (r.toc & 0xFC) != (packet[0] & 0xFC) {
 		return ErrInvalidPacket
 	}
 
-	totalFrames := len(r.frames) + len(frames)
+	totalFrames := len(r.frames) + frameCount
 	if totalFrames > maxRepacketizerFrames {
 		return ErrInvalidPacket
 	}
@@ -73,7 +81,9 @@ func (r *Repacketizer) Cat(packet []byte) error {
 		return ErrInvalidPacket
 	}
 
-	for i, frame := range frames {
+	padding := view.Padding()
+	for i := range frameCount {
+		frame := view.Frame(i)
 		owned := make([]byte, len(frame))
 		copy(owned, frame)
 		r.frames = append(r.frames, owned)
@@ -81,7 +91,7 @@ func (r *Repacketizer) Cat(packet []byte) error {
 			ownedPadding := make([]byte, len(padding))
 			copy(ownedPadding, padding)
 			r.paddings = append(r.paddings, ownedPadding)
-			r.padFrames = append(r.padFrames, paddingFrameCount)
+			r.padFrames = append(r.padFrames, frameCount)
 		} else {
 			r.paddings = append(r.paddings, nil)
 			r.padFrames = append(r.padFrames, 0)
@@ -375,95 +385,15 @@ func buildPacketWithOptions(tocBase byte, frames [][]byte, data []byte, targetLe
 }
 
 func parsePacketFrames(data []byte) (PacketInfo, [][]byte, error) {
-	info, err := ParsePacket(data)
-	if err != nil {
+	var v PacketView
+	if err := v.Parse(data); err != nil {
 		return PacketInfo{}, nil, err
 	}
-
-	frames := make([][]byte, info.FrameCount)
-	switch info.TOC.FrameCode {
-	case 0:
-		if len(data) < 1+info.FrameSizes[0] {
-			return PacketInfo{}, nil, ErrInvalidPacket
-		}
-		frames[0] = data[1 : 1+info.FrameSizes[0]]
-	case 1:
-		offset := 1
-		for i := 0; i < info.FrameCount; i++ {
-			frameLen := info.FrameSizes[i]
-			if offset+frameLen > len(data) {
-				return PacketInfo{}, nil, ErrInvalidPacket
-			}
-			frames[i] = data[offset : offset+frameLen]
-			offset += frameLen
-		}
-	case 2:
-		frame1Len, bytesRead, err := parseFrameLength(data, 1)
-		if err != nil {
-			return PacketInfo{}, nil, err
-		}
-		headerLen := 1 + bytesRead
-		if frame1Len != info.FrameSizes[0] {
-			return PacketInfo{}, nil, ErrInvalidPacket
-		}
-		if headerLen+info.FrameSizes[0]+info.FrameSizes[1] > len(data) {
-			return PacketInfo{}, nil, ErrInvalidPacket
-		}
-		frames[0] = data[headerLen : headerLen+info.FrameSizes[0]]
-		frames[1] = data[headerLen+info.FrameSizes[0] : headerLen+info.FrameSizes[0]+info.FrameSizes[1]]
-	case 3:
-		if len(data) < 2 {
-			return PacketInfo{}, nil, ErrPacketTooShort
-		}
-		frameCountByte := data[1]
-		vbr := (frameCountByte & 0x80) != 0
-		hasPadding := (frameCountByte & 0x40) != 0
-
-		offset := 2
-		padding := 0
-		if hasPadding {
-			for {
-				if offset >= len(data) {
-					return PacketInfo{}, nil, ErrPacketTooShort
-				}
-				padByte := int(data[offset])
-				offset++
-				if padByte == 255 {
-					padding += 254
-				} else {
-					padding += padByte
-				}
-				if padByte < 255 {
-					break
-				}
-			}
-		}
-
-		if vbr {
-			for i := 0; i < info.FrameCount-1; i++ {
-				_, bytesRead, err := parseFrameLength(data, offset)
-				if err != nil {
-					return PacketInfo{}, nil, err
-				}
-				offset += bytesRead
-			}
-		}
-
-		frameOffset := offset
-		frameDataEnd := len(data) - padding
-		for i := 0; i < info.FrameCount; i++ {
-			frameLen := info.FrameSizes[i]
-			if frameLen < 0 || frameOffset+frameLen > frameDataEnd {
-				return PacketInfo{}, nil, ErrInvalidPacket
-			}
-			frames[i] = data[frameOffset : frameOffset+frameLen]
-			frameOffset += frameLen
-		}
-	default:
-		return PacketInfo{}, nil, ErrInvalidPacket
+	frames := make([][]byte, v.FrameCount())
+	for i := range frames {
+		frames[i] = v.Frame(i)
 	}
-
-	return info, frames, nil
+	return v.packetInfo(), frames, nil
 }
 
 func parsePacketFramesAndPadding(data []byte) (PacketInfo, [][]byte, []byte, int, error) {
@@ -0,0 +1,108 @@
+package gopus
+
+// PacketThinOptions selects what PacketThinner strips from a packet. The zero
+// value keeps everything.
+type PacketThinOptions struct {
+	// DropDRED removes DRED (extension 126) payloads. Only receivers that
+	// lose packets and run a DRED-capable decoder benefit from them.
+	DropDRED bool
+	// DropQEXT removes QEXT (extension 124) payloads. The base CELT layer
+	// still decodes; the receiver just loses the extended-precision layer.
+	DropQEXT bool
+	// DropPadding removes padding that carries no kept extension and emits
+	// the most compact framing for the remaining frames: code 0/1/2 when the
+	// padding is gone and the packet has one or two frames, and CBR code 3
+	// when all frames have the same length. Without it the packet keeps its
+	// original length, so CBR streams stay CBR.
+	DropPadding bool
+}
+
+// PacketThinner rewrites Opus packets in the compressed domain for
+// forwarding, without decoding them: it strips selected packet extensions
+// and padding while copying every coded frame unchanged, so the result
+// decodes to the same audio as the original apart from the dropped
+// extensions.
+//
+// One PacketThinner can serve every stream and receiver handled by a
+// goroutine. After the first packets have grown its extension scratch, Thin
+// and ThinView do not allocate.
+type PacketThinner struct {
+	view   PacketView
+	frames [maxRepacketizerFrames][]byte
+	exts   []packetExtensionData
+}
+
+// NewPacketThinner creates a PacketThinner.
+func NewPacketThinner() *PacketThinner {
+	return &PacketThinner{exts: make([]packetExtensionData, 0, 8)}
+}
+
+// Thin writes packet to dst with the parts selected by opts removed and
+// returns the length written. dst must not overlap packet.
+func (t *PacketThinner) Thin(dst, packet []byte, opts PacketThinOptions) (int, error) {
+	if err := t.view.Parse(packet); err != nil {
+		return 0, err
+	}
+	return t.ThinView(dst, &t.view, opts)
+}
+
+// ThinView is Thin for a packet that has already been parsed into view, so a
+// forwarder can parse each incoming packet once and thin it per receiver.
+// dst must not overlap the packet.
+func (t *PacketThinner) ThinView(dst []byte, view *PacketView, opts PacketThinOptions) (int, error) {
+	frameCount := view.FrameCount()
+	if frameCount == 0 {
+		return 0, ErrInvalidPacket
+	}
+	packet := view.Data()
+	padding := view.Padding()
+
+	exts := t.exts[:0]
+	dropped := 0
+	if len(padding) > 0 && (opts.DropDRED || opts.DropQEXT || opts.DropPadding) {
+		var iter packetExtensionIterator
+		initPacketExtensionIterator(&iter, padding, frameCount)
+		for {
+			var ext packetExtensionData
+			ok, err := iter.next(&ext)
+			if err != nil {
+				return 0, err
+			}
+			if !ok {
+				break
+			}
+			if (opts.DropDRED && ext.ID == dredPacketExtensionID) || (opts.DropQEXT && ext.ID == qextPacketExtensionID) {
+				dropped++
+				continue
+			}
+			exts = append(exts, ext)
+		}
+		t.exts = exts
+	}
+
+	if dropped == 0 && (!opts.DropPadding || len(padding) == 0 && view.TOC().FrameCode != 3) {
+		// Nothing to strip: forward the packet as is.
+		if len(dst) < len(packet) {
+			return 0, ErrBufferTooSmall
+		}
+		clear(exts)
+		return copy(dst, packet), nil
+	}
+
+	for i := range frameCount {
+		t.frames[i] = view.Frame(i)
+	}
+	frames := t.frames[:frameCount]
+	tocBase := packet[0] & 0xFC
+	var n int
+	var err error
+	if opts.DropPadding {
+		n, err = buildRepacketizedPacketWithOptions(tocBase, frames, dst, 0, false, exts)
+	} else {
+		n, err = buildRepacketizedPacketWithOptions(tocBase, frames, dst, len(packet), true, exts)
+	}
+	// Drop the references into packet so the scratch does not pin it.
+	clear(frames)
+	clear(exts)
+	return n, err
+}
@@ -0,0 +1,255 @@
+package gopus
+
+import (
+	"bytes"
+	"testing"
+)
+
+// buildThinTestPacket assembles a code 3 packet of frames carrying exts,
+// padded to targetLen when targetLen > 0.
+func buildThinTestPacket(t testing.TB, toc byte, frames [][]byte, exts []packetExtensionData, targetLen int) []byte {
+	t.Helper()
+	buf := make([]byte, 4000)
+	n, err := buildCode3Packet(toc, frames, buf, targetLen, targetLen > 0, exts, false)
+	if err != nil {
+		t.Fatalf("buildCode3Packet: %v", err)
+	}
+	return buf[:n]
+}
+
+// thinTestExtensions returns the extensions in packet's padding.
+func thinTestExtensions(t *testing.T, packet []byte) (PacketView, []packetExtensionData) {
+	t.Helper()
+	view, err := ParsePacketView(packet)
+	if err != nil {
+		t.Fatalf("ParsePacketView(%x): %v", packet, err)
+	}
+	exts, err := parsePacketExtensionList(view.Padding(), view.FrameCount())
+	if err != nil {
+		t.Fatalf("parse extensions: %v", err)
+	}
+	return view, exts
+}
+
+func TestPacketThinnerDropsExtensions(t *testing.T) {
+	frames := [][]byte{
+		bytes.Repeat([]byte{0x11}, 40),
+		bytes.Repeat([]byte{0x22}, 37),
+		bytes.Repeat([]byte{0x33}, 40),
+	}
+	dred := bytes.Repeat([]byte{0xd0}, 60)
+	packet := buildThinTestPacket(t, 0x08, frames, []packetExtensionData{
+		{ID: dredPacketExtensionID, Frame: 0, Data: dred},
+		{ID: 33, Frame: 1, Data: []byte("keep")},
+		{ID: qextPacketExtensionID, Frame: 2, Data: []byte{1, 2, 3}},
+	}, 240)
+
+	thinner := NewPacketThinner()
+	dst := make([]byte, 4000)
+	for _, tc := range []struct {
+		name    string
+		opts    PacketThinOptions
+		wantIDs []int
+	}{
+		{"keep_all", PacketThinOptions{}, []int{dredPacketExtensionID, 33, qextPacketExtensionID}},
+		{"drop_dred", PacketThinOptions{DropDRED: true}, []int{33, qextPacketExtensionID}},
+		{"drop_qext", PacketThinOptions{DropQEXT: true}, []int{dredPacketExtensionID, 33}},
+		{"drop_both_unpad", PacketThinOptions{DropDRED: true, DropQEXT: true, DropPadding: true}, []int{33}},
+		{"unpad_only", PacketThinOptions{DropPadding: true}, []int{dredPacketExtensionID, 33, qextPacketExtensionID}},
+	} {
+		n, err := thinner.Thin(dst, packet, tc.opts)
+		if err != nil {
+			t.Fatalf("%s: Thin: %v", tc.name, err)
+		}
+		out := dst[:n]
+		if tc.opts.DropPadding {
+			if n >= len(packet) {
+				t.Fatalf("%s: length %d, want < %d", tc.name, n, len(packet))
+			}
+		} else if n != len(packet) {
+			t.Fatalf("%s: length %d, want %d", tc.name, n, len(packet))
+		}
+		view, exts := thinTestExtensions(t, out)
+		if view.TOC().Config != ParseTOC(packet[0]).Config || view.FrameCount() != len(frames) {
+			t.Fatalf("%s: toc/frames changed: %x", tc.name, out[:2])
+		}
+		for i, frame := range frames {
+			if !bytes.Equal(view.Frame(i), frame) {
+				t.Fatalf("%s: frame %d changed", tc.name, i)
+			}
+		}
+		if len(exts) != len(tc.wantIDs) {
+			t.Fatalf("%s: %d extensions, want %v", tc.name, len(exts), tc.wantIDs)
+		}
+		for i, ext := range exts {
+			if ext.ID != tc.wantIDs[i] {
+				t.Fatalf("%s: extension %d id %d, want %v", tc.name, i, ext.ID, tc.wantIDs)
+			}
+			if ext.ID == dredPacketExtensionID && (ext.Frame != 0 || !bytes.Equal(ext.Data, dred)) {
+				t.Fatalf("%s: DRED extension changed: %+v", tc.name, ext)
+			}
+		}
+	}
+}
+
+func TestPacketThinnerCompactsFraming(t *testing.T) {
+	thinner := NewPacketThinner()
+	dst := make([]byte, 512)
+	opts := PacketThinOptions{DropDRED: true, DropPadding: true}
+	dred := []packetExtensionData{{ID: dredPacketExtensionID, Frame: 0, Data: bytes.Repeat([]byte{7}, 30)}}
+
+	one := []byte{1, 2, 3, 4, 5}
+	packet := buildThinTestPacket(t, 0x78, [][]byte{one}, dred, 0)
+	n, err := thinner.Thin(dst, packet, opts)
+	if err != nil || !bytes.Equal(dst[:n], append([]byte{0x78}, one...)) {
+		t.Fatalf("one frame: %x, %v; want code 0", dst[:n], err)
+	}
+
+	packet = buildThinTestPacket(t, 0x78, [][]byte{one, one}, dred, 0)
+	n, err = thinner.Thin(dst, packet, opts)
+	if err != nil || !bytes.Equal(dst[:n], append(append([]byte{0x79}, one...), one...)) {
+		t.Fatalf("two equal frames: %x, %v; want code 1", dst[:n], err)
+	}
+
+	three := [][]byte{one, one, one}
+	packet = buildThinTestPacket(t, 0x78, three, dred, 200)
+	n, err = thinner.Thin(dst, packet, opts)
+	if err != nil || !bytes.Equal(dst[:n], append([]byte{0x7b, 0x03}, bytes.Repeat(one, 3)...)) {
+		t.Fatalf("three padded frames: %x, %v; want unpadded CBR code 3", dst[:n], err)
+	}
+
+	// Packets with nothing to strip are forwarded byte for byte.
+	for _, packet := range [][]byte{{0x78, 9, 9}, {0x7a, 1, 8, 9, 9}, buildThinTestPacket(t, 0x78, three, nil, 40)} {
+		n, err := thinner.Thin(dst, packet, PacketThinOptions{DropDRED: true, DropQEXT: true})
+		if err != nil || !bytes.Equal(dst[:n], packet) {
+			t.Fatalf("Thin(%x) = %x, %v; want unchanged", packet, dst[:n], err)
+		}
+	}
+
+	// Without extensions DropPadding matches PacketUnpad.
+	padded := buildThinTestPacket(t, 0x78, three, nil, 90)
+	n, err = thinner.Thin(dst, padded, PacketThinOptions{DropPadding: true})
+	if err != nil {
+		t.Fatalf("Thin: %v", err)
+	}
+	unpadded := append([]byte(nil), padded...)
+	m, err := PacketUnpad(unpadded, len(unpadded))
+	if err != nil || !bytes.Equal(dst[:n], unpadded[:m]) {
+		t.Fatalf("Thin = %x, PacketUnpad = %x (%v)", dst[:n], unpadded[:m], err)
+	}
+
+	if _, err := thinner.Thin(dst[:len(padded)-1], padded, PacketThinOptions{}); err != ErrBufferTooSmall {
+		t.Fatalf("short dst err = %v, want ErrBufferTooSmall", err)
+	}
+	if _, err := thinner.Thin(dst, []byte{0x7b, 0x00}, opts); err == nil {
+		t.Fatal("Thin accepted a zero-frame packet")
+	}
+}
+
+func TestPacketThinnerEncodedPacketsDecodeUnchanged(t *testing.T) {
+	enc, err := NewEncoder(EncoderConfig{SampleRate: 48000, Channels: 1, Application: ApplicationAudio})
+	if err != nil {
+		t.Fatalf("NewEncoder: %v", err)
+	}
+	if err := enc.SetFrameSize(2880); err != nil {
+		t.Fatalf("SetFrameSize: %v", err)
+	}
+	pcm := make([]float32, 2880)
+	buf := make([]byte, 4000)
+	padded := make([]byte, 4000)
+	thin := make([]byte, 4000)
+	thinner := NewPacketThinner()
+	decA, _ := NewDecoder(DefaultDecoderConfig(48000, 1))
+	decB, _ := NewDecoder(DefaultDecoderConfig(48000, 1))
+	outA := make([]float32, 2880)
+	outB := make([]float32, 2880)
+	for f := range 8 {
+		for i := range pcm {
+			pcm[i] = 0.3 * float32(((f*len(pcm)+i)%109)-54) / 54
+		}
+		n, err := enc.Encode(pcm, buf)
+		if err != nil {
+			t.Fatalf("Encode: %v", err)
+		}
+		copy(padded, buf[:n])
+		if err := PacketPad(padded[:n], n, n+64); err != nil {
+			t.Fatalf("PacketPad: %v", err)
+		}
+		m, err := thinner.Thin(thin, padded[:n+64], PacketThinOptions{DropDRED: true, DropQEXT: true, DropPadding: true})
+		if err != nil {
+			t.Fatalf("Thin: %v", err)
+		}
+		if m > n {
+			t.Fatalf("frame %d: thinned %d bytes, encoder emitted %d", f, m, n)
+		}
+		na, errA := decA.Decode(buf[:n], outA)
+		nb, errB := decB.Decode(thin[:m], outB)
+		if errA != nil || errB != nil || na != nb {
+			t.Fatalf("frame %d: decode %d/%v vs %d/%v", f, na, errA, nb, errB)
+		}
+		for i := range na {
+			if outA[i] != outB[i] {
+				t.Fatalf("frame %d sample %d: %v vs %v", f, i, outA[i], outB[i])
+			}
+		}
+	}
+}
+
+func TestPacketThinnerNoAllocs(t *testing.T) {
+	frames := [][]byte{bytes.Repeat([]byte{1}, 60), bytes.Repeat([]byte{2}, 61), bytes.Repeat([]byte{3}, 60)}
+	packet := buildThinTestPacket(t, 0x08, frames, []packetExtensionData{
+		{ID: dredPacketExtensionID, Frame: 0, Data: bytes.Repeat([]byte{9}, 80)},
+		{ID: 40, Frame: 1, Data: []byte{1, 2}},
+		{ID: 40, Frame: 2, Data: []byte{3, 4}},
+	}, 0)
+	thinner := NewPacketThinner()
+	var view PacketView
+	if err := view.Parse(packet); err != nil {
+		t.Fatalf("Parse: %v", err)
+	}
+	dst := make([]byte, 1500)
+	for _, opts := range []PacketThinOptions{
+		{DropDRED: true},
+		{DropDRED: true, DropPadding: true},
+		{DropPadding: true},
+	} {
+		allocs := testing.AllocsPerRun(200, func() {
+			if _, err := thinner.ThinView(dst, &view, opts); err != nil {
+				t.Fatalf("ThinView: %v", err)
+			}
+		})
+		if allocs != 0 {
+			t.Fatalf("ThinView(%+v) allocs=%v want 0", opts, allocs)
+		}
+	}
+}
+
+// BenchmarkPacketThin measures single-core forwarding throughput: each
+// iteration parses one 20 ms packet carrying a DRED extension and thins it for
+// a receiver that does not want DRED.
+func BenchmarkPacketThin(b *testing.B) {
+	frame := bytes.Repeat([]byte{0x5a}, 120)
+	packet := buildThinTestPacket(b, 0x78, [][]byte{frame}, []packetExtensionData{
+		{ID: dredPacketExtensionID, Frame: 0, Data: bytes.Repeat([]byte{0xd0}, 90)},
+	}, 0)
+	dst := make([]byte, 1500)
+	for _, bc := range []struct {
+		name string
+		opts PacketThinOptions
+	}{
+		{"forward", PacketThinOptions{}},
+		{"drop_dred", PacketThinOptions{DropDRED: true}},
+		{"drop_dred_unpad", PacketThinOptions{DropDRED: true, DropPadding: true}},
+	} {
+		b.Run(bc.name, func(b *testing.B) {
+			thinner := NewPacketThinner()
+			b.ReportAllocs()
+			for i := 0; i < b.N; i++ {
+				if _, err := thinner.Thin(dst, packet, bc.opts); err != nil {
+					b.Fatal(err)
+				}
+			}
+			b.ReportMetric(float64(b.N)/b.Elapsed().Seconds(), "packets/s")
+		})
+	}
+}
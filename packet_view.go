@@ -0,0 +1,220 @@
+package gopus
+
+// PacketView is a parse-once index of an Opus packet: its TOC, the byte range
+// of every frame, the padding (extension) region and the first frame's LBRR
+// flag. It aliases the packet bytes instead of copying them and holds no heap
+// state, so a single PacketView can be reused for every packet of a stream
+// without allocating.
+//
+// Parse validates the framing exactly like ParsePacket (RFC 6716 Section 3.2
+// plus the libopus 120 ms duration limit). The decoder builds one view per
+// packet and hands it to frame decoding, FEC, DRED and QEXT extension lookup,
+// so none of them walk the framing again.
+type PacketView struct {
+	data        []byte
+	toc         TOC
+	frameCount  int
+	paddingLen  int
+	frameStart  [maxRepacketizerFrames]int32
+	frameLength [maxRepacketizerFrames]int32
+}
+
+// ParsePacketView parses data into a new PacketView.
+func ParsePacketView(data []byte) (PacketView, error) {
+	var v PacketView
+	err := v.Parse(data)
+	return v, err
+}
+
+// Parse indexes data, replacing the view's previous contents. On error the
+// view is left empty. The view aliases data, which must stay unmodified while
+// the view is in use.
+func (v *PacketView) Parse(data []byte) error {
+	v.data = nil
+	v.frameCount = 0
+	v.paddingLen = 0
+	if len(data) < 1 {
+		return ErrPacketTooShort
+	}
+
+	toc := ParseTOC(data[0])
+	switch toc.FrameCode {
+	case 0:
+		// Code 0: One frame
+		if len(data)-1 > maxOpusFrameBytes {
+			return ErrInvalidPacket
+		}
+		v.frameStart[0], v.frameLength[0] = 1, int32(len(data)-1)
+		v.frameCount = 1
+
+	case 1:
+		// Code 1: Two equal-sized frames
+		frameDataLen := len(data) - 1
+		if frameDataLen%2 != 0 {
+			return ErrInvalidPacket
+		}
+		frameLen := frameDataLen / 2
+		if frameLen > maxOpusFrameBytes {
+			return ErrInvalidPacket
+		}
+		v.frameStart[0], v.frameLength[0] = 1, int32(frameLen)
+		v.frameStart[1], v.frameLength[1] = int32(1+frameLen), int32(frameLen)
+		v.frameCount = 2
+
+	case 2:
+		// Code 2: Two frames with different sizes
+		if len(data) < 2 {
+			return ErrPacketTooShort
+		}
+		frame1Len, bytesRead, err := parseFrameLength(data, 1)
+		if err != nil {
+			return err
+		}
+		headerLen := 1 + bytesRead
+		frame2Len := len(data) - headerLen - frame1Len
+		if frame2Len < 0 || frame2Len > maxOpusFrameBytes {
+			return ErrInvalidPacket
+		}
+		v.frameStart[0], v.frameLength[0] = int32(headerLen), int32(frame1Len)
+		v.frameStart[1], v.frameLength[1] = int32(headerLen+frame1Len), int32(frame2Len)
+		v.frameCount = 2
+
+	case 3:
+		// Code 3: Arbitrary number of frames
+		if len(data) < 2 {
+			return ErrPacketTooShort
+		}
+		frameCountByte := data[1]
+		vbr := (frameCountByte & 0x80) != 0
+		hasPadding := (frameCountByte & 0x40) != 0
+		m := int(frameCountByte & 0x3F)
+		if m == 0 || m > 48 {
+			return ErrInvalidFrameCount
+		}
+		if toc.FrameSize*m > maxRepacketizerDuration48k {
+			return ErrInvalidPacket
+		}
+
+		offset := 2
+		padding := 0
+		if hasPadding {
+			for {
+				if offset >= len(data) {
+					return ErrPacketTooShort
+				}
+				padByte := int(data[offset])
+				offset++
+				if padByte == 255 {
+					padding += 254
+				} else {
+					padding += padByte
+				}
+				if padByte < 255 {
+					break
+				}
+			}
+		}
+
+		if vbr {
+			totalFrameLen := 0
+			for i := 0; i < m-1; i++ {
+				frameLen, bytesRead, err := parseFrameLength(data, offset)
+				if err != nil {
+					return err
+				}
+				v.frameLength[i] = int32(frameLen)
+				totalFrameLen += frameLen
+				offset += bytesRead
+			}
+			// Last frame is remainder
+			lastFrameLen := len(data) - offset - padding - totalFrameLen
+			if lastFrameLen < 0 || lastFrameLen > maxOpusFrameBytes {
+				return ErrInvalidPacket
+			}
+			v.frameLength[m-1] = int32(lastFrameLen)
+		} else {
+			// CBR: all frames share the bytes before the padding equally.
+			frameDataLen := len(data) - offset - padding
+			if frameDataLen < 0 || frameDataLen%m != 0 {
+				return ErrInvalidPacket
+			}
+			frameLen := frameDataLen / m
+			if frameLen > maxOpusFrameBytes {
+				return ErrInvalidPacket
+			}
+			for i := range m {
+				v.frameLength[i] = int32(frameLen)
+			}
+		}
+		for i := range m {
+			v.frameStart[i] = int32(offset)
+			offset += int(v.frameLength[i])
+		}
+		v.frameCount = m
+		v.paddingLen = padding
+	}
+
+	v.data = data
+	v.toc = toc
+	return nil
+}
+
+// Data returns the packet bytes the view indexes.
+func (v *PacketView) Data() []byte {
+	return v.data
+}
+
+// TOC returns the packet's parsed TOC byte.
+func (v *PacketView) TOC() TOC {
+	return v.toc
+}
+
+// FrameCount returns the number of frames in the packet.
+func (v *PacketView) FrameCount() int {
+	return v.frameCount
+}
+
+// Frame returns the payload of frame i, aliasing the packet, or nil if i is
+// out of range. Its capacity is clipped so appending to it cannot overwrite
+// the following frame.
+func (v *PacketView) Frame(i int) []byte {
+	if i < 0 || i >= v.frameCount {
+		return nil
+	}
+	start := int(v.frameStart[i])
+	end := start + int(v.frameLength[i])
+	return v.data[start:end:end]
+}
+
+// Padding returns the code 3 padding region, which carries the packet
+// extensions, or nil if the packet has none.
+func (v *PacketView) Padding() []byte {
+	if v.paddingLen == 0 {
+		return nil
+	}
+	return v.data[len(v.data)-v.paddingLen:]
+}
+
+// HasLBRR reports whether the packet's first frame carries in-band FEC (LBRR)
+// data. It matches PacketHasLBRR.
+func (v *PacketView) HasLBRR() bool {
+	if v.frameCount == 0 {
+		return false
+	}
+	return packetHasLBRR(v.Frame(0), v.toc)
+}
+
+// packetInfo expands the view into the allocating PacketInfo form.
+func (v *PacketView) packetInfo() PacketInfo {
+	info := PacketInfo{
+		TOC:        v.toc,
+		FrameCount: v.frameCount,
+		FrameSizes: make([]int, v.frameCount),
+		Padding:    v.paddingLen,
+		TotalSize:  len(v.data),
+	}
+	for i := range v.frameCount {
+		info.FrameSizes[i] = int(v.frameLength[i])
+	}
+	return info
+}
@@ -0,0 +1,214 @@
+package gopus
+
+import (
+	"bytes"
+	"math/rand"
+	"testing"
+)
+
+// packetViewTestPackets returns valid and malformed packets covering every
+// frame code, padding and the VBR length encodings.
+func packetViewTestPackets() [][]byte {
+	packets := [][]byte{
+		{},
+		{0x08},
+		{0x08, 1, 2, 3},
+		{0x09, 1, 2, 3, 4},
+		{0x09, 1, 2, 3},
+		{0x0a},
+		{0x0a, 2, 1, 2, 3, 4, 5},
+		{0x0a, 9, 1, 2},
+		{0x0a, 252, 1},
+		{0x0b},
+		{0x0b, 0x00},
+		{0x0b, 0x03, 1, 2, 3, 4, 5, 6},
+		{0x0b, 0x43, 2, 1, 2, 3, 4, 5, 6, 0xaa, 0xbb},
+		{0x0b, 0x83, 1, 2, 9, 8, 7, 6, 5},
+		{0x0b, 0xc2, 3, 1, 7, 8, 9, 0xaa, 0xbb, 0xcc},
+		{0x0b, 0xc2, 255},
+		{0x0b, 0x83, 9, 1},
+		{0x0b, 0x3f},
+		{0x1b, 0x07, 1, 2, 3, 4, 5, 6, 7},
+	}
+
+	// Code 3 with continued (255) padding bytes.
+	pad := append([]byte{0x0b, 0x41, 255, 2}, bytes.Repeat([]byte{0x55}, 4)...)
+	packets = append(packets, append(pad, bytes.Repeat([]byte{0}, 256)...))
+
+	// Code 2 with a two-byte first frame length.
+	long := append([]byte{0x0a, 252, 1}, bytes.Repeat([]byte{0x11}, 256+10)...)
+	packets = append(packets, long)
+
+	rng := rand.New(rand.NewSource(31))
+	for range 256 {
+		p := make([]byte, 1+rng.Intn(48))
+		rng.Read(p)
+		packets = append(packets, p)
+	}
+	return packets
+}
+
+func TestPacketViewMatchesParsePacket(t *testing.T) {
+	for i, packet := range packetViewTestPackets() {
+		info, wantErr := ParsePacket(packet)
+		view, err := ParsePacketView(packet)
+		if err != wantErr {
+			t.Fatalf("packet %d %x: ParsePacketView error=%v, ParsePacket error=%v", i, packet, err, wantErr)
+		}
+		if err != nil {
+			if view.FrameCount() != 0 || view.Data() != nil || view.Padding() != nil || view.HasLBRR() {
+				t.Fatalf("packet %d: failed parse left view populated", i)
+			}
+			continue
+		}
+
+		if view.TOC() != info.TOC || view.FrameCount() != info.FrameCount {
+			t.Fatalf("packet %d: TOC/frame count mismatch: got %+v/%d want %+v/%d",
+				i, view.TOC(), view.FrameCount(), info.TOC, info.FrameCount)
+		}
+		if len(view.Padding()) != info.Padding {
+			t.Fatalf("packet %d: padding len=%d want %d", i, len(view.Padding()), info.Padding)
+		}
+
+		// Frames are contiguous and end where the padding starts.
+		end := info.TotalSize - info.Padding
+		for f := info.FrameCount - 1; f >= 0; f-- {
+			want := packet[end-info.FrameSizes[f] : end]
+			end -= info.FrameSizes[f]
+			got := view.Frame(f)
+			if !bytes.Equal(got, want) || len(got) != cap(got) {
+				t.Fatalf("packet %d frame %d: got %x (cap %d) want %x", i, f, got, cap(got), want)
+			}
+		}
+		if view.Frame(-1) != nil || view.Frame(info.FrameCount) != nil {
+			t.Fatalf("packet %d: out-of-range Frame returned data", i)
+		}
+		if view.HasLBRR() != PacketHasLBRR(packet) {
+			t.Fatalf("packet %d: HasLBRR=%v want %v", i, view.HasLBRR(), PacketHasLBRR(packet))
+		}
+	}
+}
+
+func TestPacketViewReuseDoesNotAllocate(t *testing.T) {
+	packets := packetViewTestPackets()
+	var view PacketView
+	allocs := testing.AllocsPerRun(20, func() {
+		for _, packet := range packets {
+			_ = view.Parse(packet)
+		}
+	})
+	if allocs != 0 {
+		t.Fatalf("PacketView.Parse allocs=%v want 0", allocs)
+	}
+}
+
+func TestRepacketizerCatViewMatchesCat(t *testing.T) {
+	packets := [][]byte{
+		{0x00, 1, 2, 3},
+		{0x01, 4, 5, 6, 7},
+		{0x02, 1, 8, 9, 10},
+		{0x03, 0xc2, 3, 1, 7, 8, 9, 0xaa, 0xbb, 0xcc},
+	}
+
+	fromCat, fromView := NewRepacketizer(), NewRepacketizer()
+	out1 := make([]byte, 256)
+	out2 := make([]byte, 256)
+	for _, packet := range packets {
+		if err := fromCat.Cat(packet); err != nil {
+			t.Fatalf("Cat(%x) error: %v", packet, err)
+		}
+		view, err := ParsePacketView(packet)
+		if err != nil {
+			t.Fatalf("ParsePacketView(%x) error: %v", packet, err)
+		}
+		if err := fromView.CatView(&view); err != nil {
+			t.Fatalf("CatView(%x) error: %v", packet, err)
+		}
+	}
+	n1, err := fromCat.Out(out1)
+	if err != nil {
+		t.Fatalf("Out after Cat error: %v", err)
+	}
+	n2, err := fromView.Out(out2)
+	if err != nil {
+		t.Fatalf("Out after CatView error: %v", err)
+	}
+	if !bytes.Equal(out1[:n1], out2[:n2]) {
+		t.Fatalf("CatView output %x, Cat output %x", out2[:n2], out1[:n1])
+	}
+
+	var empty PacketView
+	if err := fromView.CatView(&empty); err == nil {
+		t.Fatal("CatView accepted an unparsed view")
+	}
+}
+
+func BenchmarkPacketParse(b *testing.B) {
+	packet := append([]byte{0x0b, 0x83, 40, 40}, bytes.Repeat([]byte{0x5a}, 120)...)
+
+	b.Run("ParsePacket", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			if _, err := ParsePacket(packet); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+	b.Run("PacketView", func(b *testing.B) {
+		var view PacketView
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			if err := view.Parse(packet); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+}
+
+// BenchmarkDecodeWithFECSmallSILK measures the per-packet overhead of the FEC
+// decode path on small SILK packets, where packet bookkeeping is a visible
+// share of the work.
+func BenchmarkDecodeWithFECSmallSILK(b *testing.B) {
+	enc, err := NewEncoder(EncoderConfig{SampleRate: 48000, Channels: 1, Application: ApplicationVoIP})
+	if err != nil {
+		b.Fatalf("NewEncoder error: %v", err)
+	}
+	enc.SetFEC(true)
+	if err := enc.SetPacketLoss(15); err != nil {
+		b.Fatalf("SetPacketLoss error: %v", err)
+	}
+	if err := enc.SetBitrate(16000); err != nil {
+		b.Fatalf("SetBitrate error: %v", err)
+	}
+
+	const frameSize = 960
+	pcm := make([]float32, frameSize)
+	buf := make([]byte, 4000)
+	var packets [][]byte
+	for f := range 50 {
+		for i := range pcm {
+			pcm[i] = 0.3 * float32(((f*frameSize+i)%97)-48) / 48
+		}
+		n, err := enc.Encode(pcm, buf)
+		if err != nil {
+			b.Fatalf("Encode error: %v", err)
+		}
+		if n > 0 {
+			packets = append(packets, append([]byte(nil), buf[:n]...))
+		}
+	}
+
+	dec, err := NewDecoder(DefaultDecoderConfig(48000, 1))
+	if err != nil {
+		b.Fatalf("NewDecoder error: %v", err)
+	}
+	out := make([]float32, frameSize)
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		packet := packets[i%len(packets)]
+		if _, err := dec.DecodeWithFEC(packet, out, i%8 == 7); err != nil {
+			b.Fatalf("DecodeWithFEC error: %v", err)
+		}
+	}
+}
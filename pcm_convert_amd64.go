@@ -0,0 +1,143 @@
+//go:build amd64 && !purego
+
+package gopus
+
+import "github.com/thesyncim/gopus/internal/cpufeat"
+
+// pcmUseAVX2 gates the AVX2 PCM conversion kernels. Every kernel matches the
+// scalar conversion it replaces bit for bit, so the choice only affects speed.
+var pcmUseAVX2 = cpufeat.AMD64.HasAVX2
+
+// pcmUnitConvertAvailable reports whether convertFloat32ToInt16Unit has a
+// vector implementation on this CPU.
+var pcmUnitConvertAvailable = pcmUseAVX2
+
+//go:noescape
+func convertFloat32ToInt16UnitBlocksAVX2(dst []int16, src []float32, n int) bool
+
+//go:noescape
+func convertFloat32ToInt16SaturatingBlocksAVX2(dst []int16, src []float32, n int)
+
+//go:noescape
+func convertFloat32ToInt24BlocksAVX2(dst []int32, src []float32, n int) int
+
+//go:noescape
+func convertInt16ToFloat32BlocksAVX2(dst []float32, src []int16, n int)
+
+//go:noescape
+func convertInt24ToFloat32BlocksAVX2(dst []float32, src []int32, n int)
+
+//go:noescape
+func pcmExceedsUnitBlocksAVX2(x []float32, n int) bool
+
+func convertFloat32ToInt16Unit(dst []int16, src []float32, n int) bool {
+	if !pcmUseAVX2 {
+		return false
+	}
+	blocks := n &^ 15
+	if blocks > 0 {
+		_ = src[blocks-1]
+		_ = dst[blocks-1]
+		if !convertFloat32ToInt16UnitBlocksAVX2(dst, src, blocks) {
+			return false
+		}
+	}
+	for i := blocks; i < n; i++ {
+		v := src[i]
+		if !(v >= -1 && v <= 1) {
+			return false
+		}
+		dst[i] = float32ToInt16(v)
+	}
+	return true
+}
+
+func convertFloat32ToInt16NoSoftClipUnit(dst []int16, src []float32, n int) {
+	blocks := 0
+	if pcmUseAVX2 {
+		blocks = n &^ 15
+		if blocks > 0 {
+			_ = src[blocks-1]
+			_ = dst[blocks-1]
+			convertFloat32ToInt16SaturatingBlocksAVX2(dst, src, blocks)
+		}
+	}
+	for i := blocks; i < n; i++ {
+		dst[i] = float32ToInt16(src[i])
+	}
+}
+
+// convertFloat32ToInt24 converts n samples with float32ToInt24. Blocks whose
+// scaled samples would overflow int32 are left to the scalar conversion.
+func convertFloat32ToInt24(dst []int32, src []float32, n int) {
+	i := 0
+	if pcmUseAVX2 {
+		blocks := n &^ 7
+		if blocks > 0 {
+			_ = src[blocks-1]
+			_ = dst[blocks-1]
+		}
+		for i < blocks {
+			i += convertFloat32ToInt24BlocksAVX2(dst[i:], src[i:], blocks-i)
+			if i < blocks {
+				for end := i + 8; i < end; i++ {
+					dst[i] = float32ToInt24(src[i])
+				}
+			}
+		}
+	}
+	for ; i < n; i++ {
+		dst[i] = float32ToInt24(src[i])
+	}
+}
+
+// convertInt16ToFloat32 converts len(src) int16 samples to float32 in [-1, 1).
+func convertInt16ToFloat32(dst []float32, src []int16) {
+	n := len(src)
+	dst = dst[:n]
+	blocks := 0
+	if pcmUseAVX2 {
+		blocks = n &^ 15
+		if blocks > 0 {
+			convertInt16ToFloat32BlocksAVX2(dst, src, blocks)
+		}
+	}
+	for i := blocks; i < n; i++ {
+		dst[i] = float32(src[i]) / 32768.0
+	}
+}
+
+// convertInt24ToFloat32 converts len(src) right-justified 24-bit samples to
+// float32 in [-1, 1).
+func convertInt24ToFloat32(dst []float32, src []int32) {
+	n := len(src)
+	dst = dst[:n]
+	blocks := 0
+	if pcmUseAVX2 {
+		blocks = n &^ 7
+		if blocks > 0 {
+			convertInt24ToFloat32BlocksAVX2(dst, src, blocks)
+		}
+	}
+	for i := blocks; i < n; i++ {
+		dst[i] = float32(src[i]) / 8388608.0
+	}
+}
+
+// pcmExceedsUnit reports whether any sample of x has |x| > 1. NaN samples do
+// not count, matching the range scan in opusmath.PCMSoftClip.
+func pcmExceedsUnit(x []float32) bool {
+	blocks := 0
+	if pcmUseAVX2 {
+		blocks = len(x) &^ 15
+		if blocks > 0 && pcmExceedsUnitBlocksAVX2(x, blocks) {
+			return true
+		}
+	}
+	for _, v := range x[blocks:] {
+		if v > 1 || v < -1 {
+			return true
+		}
+	}
+	return false
+}
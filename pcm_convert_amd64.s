@@ -0,0 +1,269 @@
+//go:build amd64 && !purego
+
+#include "textflag.h"
+
+// func convertFloat32ToInt16UnitBlocksAVX2(dst []int16, src []float32, n int) bool
+//
+// Converts complete 16-sample blocks from the already-soft-clipped path where
+// every sample is in [-1, 1]. Returns false on the first block holding an
+// out-of-range or NaN sample so the Go soft-clip fallback can process the whole
+// frame. VCVTPS2DQ rounds to nearest with ties to even under the default MXCSR,
+// matching libopus float2int (lrintf); VPACKSSDW saturates +1.0 to 32767.
+TEXT ·convertFloat32ToInt16UnitBlocksAVX2(SB), NOSPLIT, $0-57
+	MOVQ dst_base+0(FP), DI
+	MOVQ src_base+24(FP), SI
+	MOVQ n+48(FP), CX
+
+	MOVL         $0x7fffffff, AX
+	VMOVD        AX, X10
+	VPBROADCASTD X10, Y10 // |x| mask
+	MOVL         $0x3f800000, AX
+	VMOVD        AX, X11
+	VPBROADCASTD X11, Y11 // 1.0
+	MOVL         $0x47000000, AX
+	VMOVD        AX, X12
+	VPBROADCASTD X12, Y12 // 32768.0
+
+	TESTQ CX, CX
+	JZ    unit_done
+
+unit_loop16:
+	VMOVUPS   (SI), Y0
+	VMOVUPS   32(SI), Y1
+	VANDPS    Y10, Y0, Y2
+	VANDPS    Y10, Y1, Y3
+	VCMPPS    $0x02, Y11, Y2, Y2 // |x| <= 1, false for NaN
+	VCMPPS    $0x02, Y11, Y3, Y3
+	VANDPS    Y3, Y2, Y2
+	VMOVMSKPS Y2, AX
+	CMPL      AX, $0xff
+	JNE       unit_fallback
+
+	VMULPS    Y12, Y0, Y0
+	VMULPS    Y12, Y1, Y1
+	VCVTPS2DQ Y0, Y0
+	VCVTPS2DQ Y1, Y1
+	VPACKSSDW Y1, Y0, Y0
+	VPERMQ    $0xd8, Y0, Y0
+	VMOVDQU   Y0, (DI)
+
+	ADDQ $64, SI
+	ADDQ $32, DI
+	SUBQ $16, CX
+	JNZ  unit_loop16
+
+unit_done:
+	VZEROUPPER
+	MOVB $1, ret+56(FP)
+	RET
+
+unit_fallback:
+	VZEROUPPER
+	MOVB $0, ret+56(FP)
+	RET
+
+// func convertFloat32ToInt16SaturatingBlocksAVX2(dst []int16, src []float32, n int)
+//
+// Converts complete 16-sample blocks of arbitrary float32 samples with the
+// float32ToInt16 semantics: scale by 32768, clamp to [-32768, 32767], round to
+// nearest even. NaN lanes are zeroed first, matching the scalar conversion.
+TEXT ·convertFloat32ToInt16SaturatingBlocksAVX2(SB), NOSPLIT, $0-56
+	MOVQ dst_base+0(FP), DI
+	MOVQ src_base+24(FP), SI
+	MOVQ n+48(FP), CX
+
+	MOVL         $0x47000000, AX
+	VMOVD        AX, X12
+	VPBROADCASTD X12, Y12 // 32768.0
+	MOVL         $0x46fffe00, AX
+	VMOVD        AX, X13
+	VPBROADCASTD X13, Y13 // 32767.0
+	MOVL         $0xc7000000, AX
+	VMOVD        AX, X14
+	VPBROADCASTD X14, Y14 // -32768.0
+
+	TESTQ CX, CX
+	JZ    sat_done
+
+sat_loop16:
+	VMOVUPS   (SI), Y0
+	VMOVUPS   32(SI), Y1
+	VMULPS    Y12, Y0, Y0
+	VMULPS    Y12, Y1, Y1
+	VCMPPS    $0x07, Y0, Y0, Y2 // ordered: false for NaN
+	VCMPPS    $0x07, Y1, Y1, Y3
+	VANDPS    Y2, Y0, Y0
+	VANDPS    Y3, Y1, Y1
+	VMINPS    Y13, Y0, Y0
+	VMINPS    Y13, Y1, Y1
+	VMAXPS    Y14, Y0, Y0
+	VMAXPS    Y14, Y1, Y1
+	VCVTPS2DQ Y0, Y0
+	VCVTPS2DQ Y1, Y1
+	VPACKSSDW Y1, Y0, Y0
+	VPERMQ    $0xd8, Y0, Y0
+	VMOVDQU   Y0, (DI)
+
+	ADDQ $64, SI
+	ADDQ $32, DI
+	SUBQ $16, CX
+	JNZ  sat_loop16
+
+sat_done:
+	VZEROUPPER
+	RET
+
+// func convertFloat32ToInt24BlocksAVX2(dst []int32, src []float32, n int) int
+//
+// Converts complete 8-sample blocks with RES2INT24 semantics (scale by 2^23,
+// round to nearest even, no saturation). It stops before the first block
+// holding a sample with |x| >= 256 or NaN, whose scaled value leaves the int32
+// range where the scalar conversion's overflow behaviour must be reproduced,
+// and returns the number of samples converted.
+TEXT ·convertFloat32ToInt24BlocksAVX2(SB), NOSPLIT, $0-64
+	MOVQ dst_base+0(FP), DI
+	MOVQ src_base+24(FP), SI
+	MOVQ n+48(FP), CX
+	XORQ DX, DX
+
+	MOVL         $0x7fffffff, AX
+	VMOVD        AX, X10
+	VPBROADCASTD X10, Y10 // |x| mask
+	MOVL         $0x43800000, AX
+	VMOVD        AX, X11
+	VPBROADCASTD X11, Y11 // 256.0
+	MOVL         $0x4b000000, AX
+	VMOVD        AX, X12
+	VPBROADCASTD X12, Y12 // 8388608.0
+
+int24_loop8:
+	CMPQ DX, CX
+	JGE  int24_done
+
+	VMOVUPS   (SI)(DX*4), Y0
+	VANDPS    Y10, Y0, Y2
+	VCMPPS    $0x01, Y11, Y2, Y2 // |x| < 256, false for NaN
+	VMOVMSKPS Y2, AX
+	CMPL      AX, $0xff
+	JNE       int24_done
+
+	VMULPS    Y12, Y0, Y0
+	VCVTPS2DQ Y0, Y0
+	VMOVDQU   Y0, (DI)(DX*4)
+
+	ADDQ $8, DX
+	JMP  int24_loop8
+
+int24_done:
+	VZEROUPPER
+	MOVQ DX, ret+56(FP)
+	RET
+
+// func convertInt16ToFloat32BlocksAVX2(dst []float32, src []int16, n int)
+//
+// Converts complete 16-sample blocks of int16 PCM to float32 scaled by 1/32768.
+// The power-of-two scale is exact, so the result equals float32(v) / 32768.
+TEXT ·convertInt16ToFloat32BlocksAVX2(SB), NOSPLIT, $0-56
+	MOVQ dst_base+0(FP), DI
+	MOVQ src_base+24(FP), SI
+	MOVQ n+48(FP), CX
+
+	MOVL         $0x38000000, AX
+	VMOVD        AX, X12
+	VPBROADCASTD X12, Y12 // 1/32768
+
+	TESTQ CX, CX
+	JZ    i16_done
+
+i16_loop16:
+	VPMOVSXWD (SI), Y0
+	VPMOVSXWD 16(SI), Y1
+	VCVTDQ2PS Y0, Y0
+	VCVTDQ2PS Y1, Y1
+	VMULPS    Y12, Y0, Y0
+	VMULPS    Y12, Y1, Y1
+	VMOVUPS   Y0, (DI)
+	VMOVUPS   Y1, 32(DI)
+
+	ADDQ $32, SI
+	ADDQ $64, DI
+	SUBQ $16, CX
+	JNZ  i16_loop16
+
+i16_done:
+	VZEROUPPER
+	RET
+
+// func convertInt24ToFloat32BlocksAVX2(dst []float32, src []int32, n int)
+//
+// Converts complete 8-sample blocks of right-justified 24-bit PCM to float32
+// scaled by 2^-23. VCVTDQ2PS rounds like the scalar int32-to-float32
+// conversion and the power-of-two scale is exact.
+TEXT ·convertInt24ToFloat32BlocksAVX2(SB), NOSPLIT, $0-56
+	MOVQ dst_base+0(FP), DI
+	MOVQ src_base+24(FP), SI
+	MOVQ n+48(FP), CX
+
+	MOVL         $0x34000000, AX
+	VMOVD        AX, X12
+	VPBROADCASTD X12, Y12 // 2^-23
+
+	TESTQ CX, CX
+	JZ    i24_done
+
+i24_loop8:
+	VCVTDQ2PS (SI), Y0
+	VMULPS    Y12, Y0, Y0
+	VMOVUPS   Y0, (DI)
+
+	ADDQ $32, SI
+	ADDQ $32, DI
+	SUBQ $8, CX
+	JNZ  i24_loop8
+
+i24_done:
+	VZEROUPPER
+	RET
+
+// func pcmExceedsUnitBlocksAVX2(x []float32, n int) bool
+//
+// Peak scan for the soft-clip fast path over complete 16-sample blocks:
+// reports whether any sample has |x| > 1. NaN samples compare false, as in the
+// scalar scan.
+TEXT ·pcmExceedsUnitBlocksAVX2(SB), NOSPLIT, $0-33
+	MOVQ x_base+0(FP), SI
+	MOVQ n+24(FP), CX
+
+	MOVL         $0x7fffffff, AX
+	VMOVD        AX, X10
+	VPBROADCASTD X10, Y10 // |x| mask
+	MOVL         $0x3f800000, AX
+	VMOVD        AX, X11
+	VPBROADCASTD X11, Y11 // 1.0
+
+	TESTQ CX, CX
+	JZ    peak_within
+
+peak_loop16:
+	VANDPS    (SI), Y10, Y0
+	VANDPS    32(SI), Y10, Y1
+	VCMPPS    $0x0e, Y11, Y0, Y0 // |x| > 1, false for NaN
+	VCMPPS    $0x0e, Y11, Y1, Y1
+	VORPS     Y1, Y0, Y0
+	VMOVMSKPS Y0, AX
+	TESTL     AX, AX
+	JNZ       peak_exceeds
+
+	ADDQ $64, SI
+	SUBQ $16, CX
+	JNZ  peak_loop16
+
+peak_within:
+	VZEROUPPER
+	MOVB $0, ret+32(FP)
+	RET
+
+peak_exceeds:
+	VZEROUPPER
+	MOVB $1, ret+32(FP)
+	RET
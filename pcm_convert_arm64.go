@@ -2,6 +2,10 @@
 
 package gopus
 
+// pcmUnitConvertAvailable reports whether convertFloat32ToInt16Unit has a
+// vector implementation.
+const pcmUnitConvertAvailable = true
+
 //go:noescape
 func convertFloat32ToInt16UnitBlocks(dst []int16, src []float32, n int) bool
 
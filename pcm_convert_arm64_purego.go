@@ -12,6 +12,8 @@ package gopus
 
 const pcmConvertBlock = 16
 
+const pcmUnitConvertAvailable = true
+
 // fcvtnsFloat32ToInt16 mirrors one lane of FCVTNS followed by SMIN/SQXTN: round
 // v*32768 to nearest with ties to even and saturate into int16.
 func fcvtnsFloat32ToInt16(v float32) int16 {
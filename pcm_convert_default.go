@@ -1,7 +1,9 @@
-//go:build !arm64
+//go:build !arm64 && (!amd64 || purego)
 
 package gopus
 
+const pcmUnitConvertAvailable = false
+
 func convertFloat32ToInt16Unit(dst []int16, src []float32, n int) bool {
 	return false
 }
@@ -0,0 +1,38 @@
+//go:build !amd64 || purego
+
+package gopus
+
+// convertFloat32ToInt24 converts n samples with float32ToInt24.
+func convertFloat32ToInt24(dst []int32, src []float32, n int) {
+	for i := 0; i < n; i++ {
+		dst[i] = float32ToInt24(src[i])
+	}
+}
+
+// convertInt16ToFloat32 converts len(src) int16 samples to float32 in [-1, 1).
+func convertInt16ToFloat32(dst []float32, src []int16) {
+	dst = dst[:len(src)]
+	for i, v := range src {
+		dst[i] = float32(v) / 32768.0
+	}
+}
+
+// convertInt24ToFloat32 converts len(src) right-justified 24-bit samples to
+// float32 in [-1, 1).
+func convertInt24ToFloat32(dst []float32, src []int32) {
+	dst = dst[:len(src)]
+	for i, v := range src {
+		dst[i] = float32(v) / 8388608.0
+	}
+}
+
+// pcmExceedsUnit reports whether any sample of x has |x| > 1. NaN samples do
+// not count, matching the range scan in opusmath.PCMSoftClip.
+func pcmExceedsUnit(x []float32) bool {
+	for _, v := range x {
+		if v > 1 || v < -1 {
+			return true
+		}
+	}
+	return false
+}
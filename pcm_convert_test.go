@@ -2,6 +2,7 @@ package gopus
 
 import (
 	"math"
+	"math/rand"
 	"runtime"
 	"testing"
 
@@ -18,18 +19,19 @@ func TestConvertFloat32ToInt16Unit(t *testing.T) {
 	}
 	dst := make([]int16, len(src))
 	ok := convertFloat32ToInt16Unit(dst, src, len(src))
-	if runtime.GOARCH != "arm64" {
+	if !pcmUnitConvertAvailable {
 		if ok {
 			t.Fatal("default conversion unexpectedly handled the vector")
 		}
 		return
 	}
 	if !ok {
-		t.Fatal("arm64 conversion rejected in-range samples")
+		t.Fatalf("%s conversion rejected in-range samples", runtime.GOARCH)
 	}
 	for i, v := range src {
-		// The arm64 NEON block kernel uses FCVTNS (round to nearest, ties to
-		// even), matching libopus float2int (lrintf) and the scalar tail.
+		// The arm64 NEON (FCVTNS) and amd64 AVX2 (VCVTPS2DQ) block kernels
+		// round to nearest, ties to even, matching libopus float2int (lrintf)
+		// and the scalar tail.
 		want := float32ToInt16(v)
 		if dst[i] != want {
 			t.Fatalf("dst[%d] = %d, want %d", i, dst[i], want)
@@ -39,7 +41,7 @@ func TestConvertFloat32ToInt16Unit(t *testing.T) {
 	outOfRange := append([]float32(nil), src...)
 	outOfRange[8] = 1.01
 	if convertFloat32ToInt16Unit(make([]int16, len(outOfRange)), outOfRange, len(outOfRange)) {
-		t.Fatal("arm64 conversion accepted out-of-range samples")
+		t.Fatalf("%s conversion accepted out-of-range samples", runtime.GOARCH)
 	}
 }
 
@@ -104,3 +106,195 @@ func TestFloat32ToInt16OpusRoundingBitNeighbors(t *testing.T) {
 		})
 	}
 }
+
+// pcmConvertParitySamples returns n samples mixing in-range audio, exact
+// rounding ties, rail values and non-finite or overflowing inputs.
+func pcmConvertParitySamples(rng *rand.Rand, n int, scale float32) []float32 {
+	special := []float32{
+		0, -1, 1, 0.5 / 32768, 1.5 / 32768, -1.5 / 32768, 32767.0 / 32768,
+		math.Nextafter32(1, 2), math.Nextafter32(-1, -2), 1.5, -2.5, 255.99998, 256, -256,
+		1e9, -1e9, float32(math.Inf(1)), float32(math.Inf(-1)), float32(math.NaN()),
+		0.5 / 8388608, 1.5 / 8388608, -2.5 / 8388608,
+	}
+	x := make([]float32, n)
+	for i := range x {
+		if rng.Intn(8) == 0 {
+			x[i] = special[rng.Intn(len(special))]
+		} else {
+			x[i] = (rng.Float32()*2 - 1) * scale
+		}
+	}
+	return x
+}
+
+func TestPCMConvertMatchesScalar(t *testing.T) {
+	rng := rand.New(rand.NewSource(0x7c3a))
+	for n := 0; n <= 70; n++ {
+		for trial := 0; trial < 16; trial++ {
+			scale := float32(1)
+			if trial%4 == 3 {
+				scale = 1.2
+			}
+			src := pcmConvertParitySamples(rng, n, scale)
+
+			got16 := make([]int16, n)
+			convertFloat32ToInt16NoSoftClipUnit(got16, src, n)
+			for i, v := range src {
+				if want := float32ToInt16(v); got16[i] != want {
+					t.Fatalf("n=%d: saturating int16[%d] (%v) = %d, want %d", n, i, v, got16[i], want)
+				}
+			}
+
+			unit := make([]float32, n)
+			for i := range unit {
+				unit[i] = (rng.Float32()*2 - 1) * scale
+			}
+			inRange := true
+			for _, v := range unit {
+				inRange = inRange && v >= -1 && v <= 1
+			}
+			if ok := convertFloat32ToInt16Unit(got16, unit, n); ok {
+				if !inRange {
+					t.Fatalf("n=%d: unit conversion accepted out-of-range samples", n)
+				}
+				for i, v := range unit {
+					if want := float32ToInt16(v); got16[i] != want {
+						t.Fatalf("n=%d: unit int16[%d] (%v) = %d, want %d", n, i, v, got16[i], want)
+					}
+				}
+			} else if inRange && pcmUnitConvertAvailable {
+				t.Fatalf("n=%d: unit conversion rejected in-range samples", n)
+			}
+
+			got24 := make([]int32, n)
+			convertFloat32ToInt24(got24, src, n)
+			for i, v := range src {
+				if want := float32ToInt24(v); got24[i] != want {
+					t.Fatalf("n=%d: int24[%d] (%v) = %d, want %d", n, i, v, got24[i], want)
+				}
+			}
+
+			exceeds := false
+			for _, v := range src {
+				exceeds = exceeds || v > 1 || v < -1
+			}
+			if got := pcmExceedsUnit(src); got != exceeds {
+				t.Fatalf("n=%d: pcmExceedsUnit = %v, want %v", n, got, exceeds)
+			}
+
+			in16 := make([]int16, n)
+			in24 := make([]int32, n)
+			for i := range in16 {
+				in16[i] = int16(rng.Intn(65536) - 32768)
+				in24[i] = int32(rng.Intn(1<<24) - 1<<23)
+				if i%5 == 0 {
+					in24[i] = rng.Int31() - 1<<30 // beyond 24 bits: rounds like float32(v)
+				}
+			}
+			gotF := make([]float32, n)
+			convertInt16ToFloat32(gotF, in16)
+			for i, v := range in16 {
+				if want := float32(v) / 32768.0; gotF[i] != want {
+					t.Fatalf("n=%d: int16->float32[%d] = %v, want %v", n, i, gotF[i], want)
+				}
+			}
+			convertInt24ToFloat32(gotF, in24)
+			for i, v := range in24 {
+				if want := float32(v) / 8388608.0; gotF[i] != want {
+					t.Fatalf("n=%d: int24->float32[%d] = %v, want %v", n, i, gotF[i], want)
+				}
+			}
+		}
+	}
+}
+
+func TestOpusPCMSoftClipPeakScanFastPath(t *testing.T) {
+	rng := rand.New(rand.NewSource(0x5c11))
+	for _, channels := range []int{1, 2} {
+		for _, peak := range []float32{0.9, 1, 1.5, 3} {
+			for _, mem := range []float32{0, 0.25} {
+				n := 480
+				x := make([]float32, n*channels)
+				for i := range x {
+					x[i] = (rng.Float32()*2 - 1) * peak
+				}
+				want := append([]float32(nil), x...)
+				wantMem := make([]float32, channels)
+				gotMem := make([]float32, channels)
+				for c := range channels {
+					wantMem[c], gotMem[c] = mem, mem
+				}
+				opusmath.PCMSoftClip(want, n, channels, wantMem)
+				opusPCMSoftClip(x, n, channels, gotMem)
+				for i := range x {
+					if math.Float32bits(x[i]) != math.Float32bits(want[i]) {
+						t.Fatalf("channels=%d peak=%v mem=%v: x[%d] = %v, want %v", channels, peak, mem, i, x[i], want[i])
+					}
+				}
+				for c := range channels {
+					if gotMem[c] != wantMem[c] {
+						t.Fatalf("channels=%d peak=%v mem=%v: mem[%d] = %v, want %v", channels, peak, mem, c, gotMem[c], wantMem[c])
+					}
+				}
+			}
+		}
+	}
+}
+
+func BenchmarkPCMConvert(b *testing.B) {
+	const n = 960 * 2 // 20 ms stereo at 48 kHz
+	rng := rand.New(rand.NewSource(1))
+	f32 := make([]float32, n)
+	for i := range f32 {
+		f32[i] = (rng.Float32()*2 - 1) * 0.9
+	}
+	i16 := make([]int16, n)
+	i24 := make([]int32, n)
+	for i := range i16 {
+		i16[i] = int16(rng.Intn(65536) - 32768)
+		i24[i] = int32(rng.Intn(1<<24) - 1<<23)
+	}
+	out16 := make([]int16, n)
+	out24 := make([]int32, n)
+	outF := make([]float32, n)
+
+	b.Run("float32ToInt16Unit", func(b *testing.B) {
+		b.SetBytes(n * 4)
+		for range b.N {
+			if !convertFloat32ToInt16Unit(out16, f32, n) {
+				convertFloat32ToInt16NoSoftClipUnit(out16, f32, n)
+			}
+		}
+	})
+	b.Run("float32ToInt16Saturating", func(b *testing.B) {
+		b.SetBytes(n * 4)
+		for range b.N {
+			convertFloat32ToInt16NoSoftClipUnit(out16, f32, n)
+		}
+	})
+	b.Run("float32ToInt24", func(b *testing.B) {
+		b.SetBytes(n * 4)
+		for range b.N {
+			convertFloat32ToInt24(out24, f32, n)
+		}
+	})
+	b.Run("int16ToFloat32", func(b *testing.B) {
+		b.SetBytes(n * 2)
+		for range b.N {
+			convertInt16ToFloat32(outF, i16)
+		}
+	})
+	b.Run("int24ToFloat32", func(b *testing.B) {
+		b.SetBytes(n * 4)
+		for range b.N {
+			convertInt24ToFloat32(outF, i24)
+		}
+	})
+	b.Run("softClipPeakScan", func(b *testing.B) {
+		mem := make([]float32, 2)
+		b.SetBytes(n * 4)
+		for range b.N {
+			opusPCMSoftClip(f32, n/2, 2, mem)
+		}
+	})
+}
@@ -0,0 +1,15 @@
+package gopus
+
+// decimate2xGo is the portable decimate2x: each output sample is the mean of
+// the two input samples of its channel at 2*i and 2*i+1.
+func decimate2xGo(dst, src []float32, channels int) {
+	frames := len(dst) / channels
+	src = src[:2*frames*channels]
+	for i := 0; i < frames; i++ {
+		for c := 0; c < channels; c++ {
+			a := src[(2*i)*channels+c]
+			b := src[(2*i+1)*channels+c]
+			dst[i*channels+c] = (a + b) * 0.5
+		}
+	}
+}
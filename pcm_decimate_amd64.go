@@ -0,0 +1,28 @@
+//go:build amd64 && !purego
+
+package gopus
+
+//go:noescape
+func decimate2xMonoBlocksSSE(dst, src []float32, n int)
+
+//go:noescape
+func decimate2xStereoBlocksSSE(dst, src []float32, n int)
+
+// decimate2x halves the rate of interleaved src into dst by pair averaging.
+// Mono and stereo run whole 4-output blocks on the vector kernels, which add
+// and halve per lane exactly like decimate2xGo.
+func decimate2x(dst, src []float32, channels int) {
+	blocks := 0
+	if channels == 1 || channels == 2 {
+		blocks = len(dst) &^ 3
+		if blocks > 0 {
+			_ = src[2*blocks-1]
+			if channels == 1 {
+				decimate2xMonoBlocksSSE(dst, src, blocks)
+			} else {
+				decimate2xStereoBlocksSSE(dst, src, blocks)
+			}
+		}
+	}
+	decimate2xGo(dst[blocks:], src[2*blocks:], channels)
+}
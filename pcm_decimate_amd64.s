@@ -0,0 +1,47 @@
+//go:build amd64 && !purego
+
+#include "textflag.h"
+
+// Four outputs from src[0:8]: the even and odd sample sets are gathered with
+// SHUFPS (imm selects per-sample pairs for mono, per-frame pairs for stereo),
+// added and halved.
+#define DECIMATE2X_LOOP(even, odd) \
+	MOVQ   $0x3f000000, AX \
+	MOVQ   AX, X7          \
+	SHUFPS $0x00, X7, X7   \
+	SHRQ   $2, CX          \
+	JZ     done            \
+loop:                      \
+	MOVUPS (SI), X0        \
+	MOVUPS 16(SI), X1      \
+	MOVAPS X0, X2          \
+	SHUFPS $even, X1, X0   \
+	SHUFPS $odd, X1, X2    \
+	ADDPS  X2, X0          \
+	MULPS  X7, X0          \
+	MOVUPS X0, (DI)        \
+	ADDQ   $32, SI         \
+	ADDQ   $16, DI         \
+	DECQ   CX              \
+	JNZ    loop            \
+done:                      \
+	RET
+
+// func decimate2xMonoBlocksSSE(dst, src []float32, n int)
+//
+// dst[i] = (src[2i] + src[2i+1]) * 0.5 for i < n, n a multiple of 4.
+TEXT ·decimate2xMonoBlocksSSE(SB), NOSPLIT, $0-56
+	MOVQ dst_base+0(FP), DI
+	MOVQ src_base+24(FP), SI
+	MOVQ n+48(FP), CX
+	DECIMATE2X_LOOP(0x88, 0xDD)
+
+// func decimate2xStereoBlocksSSE(dst, src []float32, n int)
+//
+// dst[2i+c] = (src[4i+c] + src[4i+2+c]) * 0.5 for 2i+c < n, n a multiple
+// of 4.
+TEXT ·decimate2xStereoBlocksSSE(SB), NOSPLIT, $0-56
+	MOVQ dst_base+0(FP), DI
+	MOVQ src_base+24(FP), SI
+	MOVQ n+48(FP), CX
+	DECIMATE2X_LOOP(0x44, 0xEE)
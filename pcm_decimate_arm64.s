@@ -0,0 +1,54 @@
+//go:build arm64 && !purego
+
+#include "textflag.h"
+
+// func decimate2xMonoBlocksNeon(dst, src []float32, n int)
+//
+// dst[i] = (src[2i] + src[2i+1]) * 0.5 for i < n, n a multiple of 4.
+TEXT ·decimate2xMonoBlocksNeon(SB), NOSPLIT, $0-56
+	MOVD dst_base+0(FP), R0
+	MOVD src_base+24(FP), R1
+	MOVD n+48(FP), R2
+	WORD $0x4F03F414 // FMOV V20.4S, #0.5
+
+	LSR $2, R2
+	CBZ R2, mono_done
+
+mono_loop:
+	VLD1.P 32(R1), [V0.S4, V1.S4]
+	WORD   $0x4E811802 // UZP1 V2.4S, V0.4S, V1.4S (even samples)
+	WORD   $0x4E815803 // UZP2 V3.4S, V0.4S, V1.4S (odd samples)
+	WORD   $0x4E23D442 // FADD V2.4S, V2.4S, V3.4S
+	WORD   $0x6E34DC42 // FMUL V2.4S, V2.4S, V20.4S
+	VST1.P [V2.S4], 16(R0)
+	SUBS   $1, R2
+	BNE    mono_loop
+
+mono_done:
+	RET
+
+// func decimate2xStereoBlocksNeon(dst, src []float32, n int)
+//
+// dst[2i+c] = (src[4i+c] + src[4i+2+c]) * 0.5 for 2i+c < n, n a multiple
+// of 4. The frame pairs are split on 64-bit lanes.
+TEXT ·decimate2xStereoBlocksNeon(SB), NOSPLIT, $0-56
+	MOVD dst_base+0(FP), R0
+	MOVD src_base+24(FP), R1
+	MOVD n+48(FP), R2
+	WORD $0x4F03F414 // FMOV V20.4S, #0.5
+
+	LSR $2, R2
+	CBZ R2, stereo_done
+
+stereo_loop:
+	VLD1.P 32(R1), [V0.S4, V1.S4]
+	WORD   $0x4EC11802 // UZP1 V2.2D, V0.2D, V1.2D (even frames)
+	WORD   $0x4EC15803 // UZP2 V3.2D, V0.2D, V1.2D (odd frames)
+	WORD   $0x4E23D442 // FADD V2.4S, V2.4S, V3.4S
+	WORD   $0x6E34DC42 // FMUL V2.4S, V2.4S, V20.4S
+	VST1.P [V2.S4], 16(R0)
+	SUBS   $1, R2
+	BNE    stereo_loop
+
+stereo_done:
+	RET
@@ -0,0 +1,8 @@
+//go:build (!amd64 && !arm64) || purego
+
+package gopus
+
+// decimate2x halves the rate of interleaved src into dst by pair averaging.
+func decimate2x(dst, src []float32, channels int) {
+	decimate2xGo(dst, src, channels)
+}
@@ -0,0 +1,30 @@
+package gopus
+
+import (
+	"math"
+	"math/rand"
+	"testing"
+)
+
+// TestDecimate2xMatchesScalar checks the dispatched 2:1 pair-average
+// decimator against decimate2xGo bit-for-bit around the vector block sizes.
+func TestDecimate2xMatchesScalar(t *testing.T) {
+	rng := rand.New(rand.NewSource(47))
+	for _, channels := range []int{1, 2, 3} {
+		for _, frames := range []int{1, 2, 3, 4, 5, 7, 480, 960} {
+			src := make([]float32, 2*frames*channels)
+			for i := range src {
+				src[i] = float32(rng.NormFloat64())
+			}
+			got := make([]float32, frames*channels)
+			want := make([]float32, frames*channels)
+			decimate2x(got, src, channels)
+			decimate2xGo(want, src, channels)
+			for i := range want {
+				if math.Float32bits(got[i]) != math.Float32bits(want[i]) {
+					t.Fatalf("channels=%d frames=%d: dst[%d] = %v, want %v", channels, frames, i, got[i], want[i])
+				}
+			}
+		}
+	}
+}
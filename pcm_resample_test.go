@@ -0,0 +1,196 @@
+package gopus
+
+import (
+	"errors"
+	"math"
+	"testing"
+)
+
+// pcm44kStereoFrame fills an 882-sample (20 ms at 44.1 kHz) stereo frame of a
+// 440 Hz / 1 kHz tone pair starting at sample offset start.
+func pcm44kStereoFrame(dst []float32, start int) {
+	for i := 0; i < len(dst)/2; i++ {
+		tm := float64(start+i) / 44100
+		dst[2*i] = float32(0.3 * math.Sin(2*math.Pi*440*tm))
+		dst[2*i+1] = float32(0.3 * math.Sin(2*math.Pi*1000*tm))
+	}
+}
+
+func newPCM44kCodec(tb testing.TB) (*Encoder, *Decoder) {
+	tb.Helper()
+	enc, err := NewEncoder(EncoderConfig{SampleRate: 48000, Channels: 2, Application: ApplicationAudio, PCMSampleRate: 44100})
+	if err != nil {
+		tb.Fatalf("NewEncoder: %v", err)
+	}
+	cfg := DefaultDecoderConfig(48000, 2)
+	cfg.PCMSampleRate = 44100
+	dec, err := NewDecoder(cfg)
+	if err != nil {
+		tb.Fatalf("NewDecoder: %v", err)
+	}
+	return enc, dec
+}
+
+// TestPCMSampleRate44100RoundTrip runs 44.1 kHz stereo through the encoder
+// and decoder PCM resamplers: every packet and concealment frame must yield
+// 882 samples per channel, and the tones must survive at their level.
+func TestPCMSampleRate44100RoundTrip(t *testing.T) {
+	enc, dec := newPCM44kCodec(t)
+	if enc.FrameSize() != 882 || enc.PCMSampleRate() != 44100 || dec.PCMSampleRate() != 44100 {
+		t.Fatalf("FrameSize=%d enc rate=%d dec rate=%d", enc.FrameSize(), enc.PCMSampleRate(), dec.PCMSampleRate())
+	}
+
+	in := make([]float32, 882*2)
+	in16 := make([]int16, 882*2)
+	packet := make([]byte, 4000)
+	outF := make([]float32, 882*2)
+	out16 := make([]int16, 882*2)
+	out24 := make([]int32, 882*2)
+	var inEnergy, outEnergy float64
+	for f := 0; f < 50; f++ {
+		pcm44kStereoFrame(in, f*882)
+		var n int
+		var err error
+		if f%2 == 0 {
+			n, err = enc.Encode(in, packet)
+		} else {
+			for i, v := range in {
+				in16[i] = int16(v * 32767)
+			}
+			n, err = enc.EncodeInt16(in16, packet)
+		}
+		if err != nil {
+			t.Fatalf("frame %d encode: %v", f, err)
+		}
+		pkt := packet[:n]
+		if f == 30 {
+			pkt = nil
+		}
+
+		var got int
+		switch f % 3 {
+		case 0:
+			got, err = dec.Decode(pkt, outF)
+		case 1:
+			got, err = dec.DecodeInt16(pkt, out16)
+			for i, v := range out16 {
+				outF[i] = float32(v) / 32768
+			}
+		default:
+			got, err = dec.DecodeInt24(pkt, out24)
+			for i, v := range out24 {
+				outF[i] = float32(v) / 8388608
+			}
+		}
+		if err != nil {
+			t.Fatalf("frame %d decode: %v", f, err)
+		}
+		if got != 882 {
+			t.Fatalf("frame %d: decoded %d samples per channel, want 882", f, got)
+		}
+		if f >= 10 && f < 30 {
+			for i := range in {
+				inEnergy += float64(in[i]) * float64(in[i])
+				outEnergy += float64(outF[i]) * float64(outF[i])
+			}
+		}
+	}
+	if ratio := 10 * math.Log10(outEnergy/inEnergy); math.Abs(ratio) > 1.5 {
+		t.Fatalf("round-trip level %.2f dB, want within 1.5 dB", ratio)
+	}
+}
+
+func TestPCMSampleRateValidation(t *testing.T) {
+	for _, rate := range []int{7999, 192001, 44101} {
+		if _, err := NewEncoder(EncoderConfig{SampleRate: 48000, Channels: 1, Application: ApplicationAudio, PCMSampleRate: rate}); !errors.Is(err, ErrInvalidSampleRate) {
+			t.Fatalf("NewEncoder(PCMSampleRate=%d) err=%v, want ErrInvalidSampleRate", rate, err)
+		}
+		cfg := DefaultDecoderConfig(48000, 1)
+		cfg.PCMSampleRate = rate
+		if _, err := NewDecoder(cfg); !errors.Is(err, ErrInvalidSampleRate) {
+			t.Fatalf("NewDecoder(PCMSampleRate=%d) err=%v, want ErrInvalidSampleRate", rate, err)
+		}
+	}
+
+	enc, dec := newPCM44kCodec(t)
+	// 2.5 ms is 110.25 samples at 44.1 kHz.
+	if err := enc.SetFrameSize(110); !errors.Is(err, ErrInvalidFrameSize) {
+		t.Fatalf("SetFrameSize(110) err=%v, want ErrInvalidFrameSize", err)
+	}
+	if err := enc.SetFrameSize(441); err != nil {
+		t.Fatalf("SetFrameSize(441): %v", err)
+	}
+	packet := make([]byte, 4000)
+	if _, err := enc.Encode(make([]float32, 882*2), packet); !errors.Is(err, ErrInvalidFrameSize) {
+		t.Fatalf("Encode(882) at 10 ms err=%v, want ErrInvalidFrameSize", err)
+	}
+	n, err := enc.Encode(make([]float32, 441*2), packet)
+	if err != nil {
+		t.Fatalf("Encode(441): %v", err)
+	}
+	if _, err := dec.Decode(packet[:n], make([]float32, 440*2)); !errors.Is(err, ErrBufferTooSmall) {
+		t.Fatalf("Decode into 440 samples err=%v, want ErrBufferTooSmall", err)
+	}
+	if got, err := dec.Decode(packet[:n], make([]float32, 5760*2)); err != nil || got != 441 {
+		t.Fatalf("Decode=%d, %v; want 441", got, err)
+	}
+}
+
+func BenchmarkDecoder44100Stereo(b *testing.B) {
+	enc, dec := newPCM44kCodec(b)
+	in := make([]float32, 882*2)
+	packets := make([][]byte, 50)
+	for f := range packets {
+		pcm44kStereoFrame(in, f*882)
+		pkt, err := enc.EncodeFloat32(in)
+		if err != nil {
+			b.Fatal(err)
+		}
+		packets[f] = pkt
+	}
+	b.Run("float32", func(b *testing.B) {
+		pcm := make([]float32, 882*2)
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			if _, err := dec.Decode(packets[i%len(packets)], pcm); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+	b.Run("int16", func(b *testing.B) {
+		pcm := make([]int16, 882*2)
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			if _, err := dec.DecodeInt16(packets[i%len(packets)], pcm); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+}
+
+func BenchmarkEncoder44100Stereo(b *testing.B) {
+	enc, _ := newPCM44kCodec(b)
+	in := make([]float32, 882*2)
+	pcm44kStereoFrame(in, 0)
+	in16 := make([]int16, len(in))
+	for i, v := range in {
+		in16[i] = int16(v * 32767)
+	}
+	packet := make([]byte, 4000)
+	b.Run("float32", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			if _, err := enc.Encode(in, packet); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+	b.Run("int16", func(b *testing.B) {
+		b.ReportAllocs()
+		for i := 0; i < b.N; i++ {
+			if _, err := enc.EncodeInt16(in16, packet); err != nil {
+				b.Fatal(err)
+			}
+		}
+	})
+}
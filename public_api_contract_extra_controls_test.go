@@ -30,13 +30,13 @@ func TestExtraControlsBuildPublicAPIContract(t *testing.T) {
 			got:  &gopus.Encoder{},
 			want: []string{
 				"Application", "Bandwidth", "Bitrate", "BitrateMode", "Channels", "Complexity",
-				"DREDDuration", "DTXEnabled", "Encode", "EncodeFloat32", "EncodeInt16",
+				"DREDDuration", "DTXEnabled", "DTXFastPath", "Encode", "EncodeFloat32", "EncodeInt16",
 				"EncodeInt16Slice", "EncodeInt24", "EncodeInt24Slice", "ExpertFrameDuration",
 				"FECEnabled", "FinalRange", "ForceChannels", "FrameSize", "InBandFEC", "InDTX", "LSBDepth",
-				"Lookahead", "MaxBandwidth", "Mode", "PacketLoss", "PhaseInversionDisabled",
+				"Lookahead", "MaxBandwidth", "Mode", "PCMSampleRate", "PacketLoss", "PhaseInversionDisabled",
 				"PredictionDisabled", "Reset", "SampleRate", "SetApplication",
 				"SetBandwidth", "SetBandwidthAuto", "SetBitrate", "SetBitrateMode", "SetComplexity", "SetDNNBlob",
-				"SetDREDDuration", "SetDTX", "SetExpertFrameDuration", "SetFEC",
+				"SetDREDDuration", "SetDTX", "SetDTXFastPath", "SetExpertFrameDuration", "SetFEC",
 				"SetForceChannels", "SetFrameSize", "SetInBandFEC", "SetLSBDepth", "SetMaxBandwidth",
 				"SetMode", "SetPacketLoss", "SetPhaseInversionDisabled", "SetPredictionDisabled",
 				"SetSignal", "SetVBR", "SetVBRConstraint", "Signal", "VADActivity", "VBR", "VBRConstraint",
@@ -46,12 +46,12 @@ func TestExtraControlsBuildPublicAPIContract(t *testing.T) {
 			name: "Decoder",
 			got:  &gopus.Decoder{},
 			want: []string{
-				"Bandwidth", "Channels", "Complexity", "Decode", "DecodeDRED", "DecodeDREDInt24",
+				"Bandwidth", "Channels", "Complexity", "Decode", "DecodeAccumulate", "DecodeDRED", "DecodeDREDInt24",
 				"DecodeInt16", "DecodeInt24", "DecodeInt24Slice", "DecodeWithFEC", "FinalRange",
 				"Gain", "IgnoreExtensions", "InDTX", "LastPacketDuration", "OSCEBWE", "OSCELACE",
-				"PhaseInversionDisabled", "Pitch", "Reset", "SampleRate", "SetComplexity",
+				"PCMSampleRate", "PhaseInversionDisabled", "Pitch", "Reset", "SampleRate", "SetComplexity",
 				"SetDNNBlob", "SetGain", "SetIgnoreExtensions", "SetOSCEBWE", "SetOSCELACE",
-				"SetPhaseInversionDisabled",
+				"SetPhaseInversionDisabled", "SetSkipInaudibleDTX", "SkipInaudibleDTX",
 			},
 		},
 		{
@@ -78,8 +78,8 @@ func TestExtraControlsBuildPublicAPIContract(t *testing.T) {
 				"Bandwidth", "Channels", "Complexity", "CoupledStreams", "Decode", "DecodeInt16",
 				"DecodeInt24", "DecodeInt24Slice", "FinalRange",
 				"Gain", "GetFinalRange", "IgnoreExtensions", "LastPacketDuration", "OSCEBWE",
-				"OSCELACE", "PhaseInversionDisabled", "Reset", "SampleRate", "SetComplexity",
-				"SetDNNBlob", "SetGain", "SetIgnoreExtensions", "SetOSCEBWE", "SetOSCELACE",
+				"OSCELACE", "OutputChannels", "PhaseInversionDisabled", "Reset", "SampleRate", "SetComplexity",
+				"SetDNNBlob", "SetDownmix", "SetGain", "SetIgnoreExtensions", "SetOSCEBWE", "SetOSCELACE",
 				"SetPhaseInversionDisabled", "Streams",
 			},
 		},
@@ -102,7 +102,7 @@ func TestExtraControlsBuildPublicAPIContract(t *testing.T) {
 			name: "Reader",
 			got:  &gopus.Reader{},
 			want: []string{
-				"Channels", "LastGranulePos", "Read", "Reset", "SampleRate",
+				"Channels", "LastGranulePos", "Read", "Reset", "SampleRate", "SeekSample",
 			},
 		},
 		{
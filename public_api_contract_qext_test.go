@@ -30,12 +30,12 @@ func TestQEXTBuildPublicAPIContract(t *testing.T) {
 			got:  &gopus.Encoder{},
 			want: []string{
 				"Application", "Bandwidth", "Bitrate", "BitrateMode", "Channels", "Complexity",
-				"DTXEnabled", "Encode", "EncodeFloat32", "EncodeInt16", "EncodeInt16Slice",
+				"DTXEnabled", "DTXFastPath", "Encode", "EncodeFloat32", "EncodeInt16", "EncodeInt16Slice",
 				"EncodeInt24", "EncodeInt24Slice", "ExpertFrameDuration", "FECEnabled",
 				"FinalRange", "ForceChannels", "FrameSize", "InBandFEC", "InDTX", "LSBDepth", "Lookahead",
-				"MaxBandwidth", "Mode", "PacketLoss", "PhaseInversionDisabled", "PredictionDisabled",
+				"MaxBandwidth", "Mode", "PCMSampleRate", "PacketLoss", "PhaseInversionDisabled", "PredictionDisabled",
 				"QEXT", "Reset", "SampleRate", "SetApplication", "SetBandwidth", "SetBandwidthAuto", "SetBitrate",
-				"SetBitrateMode", "SetComplexity", "SetDNNBlob", "SetDTX", "SetExpertFrameDuration",
+				"SetBitrateMode", "SetComplexity", "SetDNNBlob", "SetDTX", "SetDTXFastPath", "SetExpertFrameDuration",
 				"SetFEC", "SetForceChannels", "SetFrameSize", "SetInBandFEC", "SetLSBDepth", "SetMaxBandwidth",
 				"SetMode", "SetPacketLoss", "SetPhaseInversionDisabled", "SetPredictionDisabled", "SetQEXT",
 				"SetSignal", "SetVBR", "SetVBRConstraint", "Signal", "VADActivity", "VBR", "VBRConstraint",
@@ -45,11 +45,11 @@ func TestQEXTBuildPublicAPIContract(t *testing.T) {
 			name: "Decoder",
 			got:  &gopus.Decoder{},
 			want: []string{
-				"Bandwidth", "Channels", "Complexity", "Decode", "DecodeInt16", "DecodeInt24",
+				"Bandwidth", "Channels", "Complexity", "Decode", "DecodeAccumulate", "DecodeInt16", "DecodeInt24",
 				"DecodeInt24Slice", "DecodeWithFEC", "FinalRange",
-				"Gain", "IgnoreExtensions", "InDTX", "LastPacketDuration", "PhaseInversionDisabled",
+				"Gain", "IgnoreExtensions", "InDTX", "LastPacketDuration", "PCMSampleRate", "PhaseInversionDisabled",
 				"Pitch", "Reset", "SampleRate", "SetComplexity", "SetDNNBlob", "SetGain",
-				"SetIgnoreExtensions", "SetPhaseInversionDisabled",
+				"SetIgnoreExtensions", "SetPhaseInversionDisabled", "SetSkipInaudibleDTX", "SkipInaudibleDTX",
 			},
 		},
 		{
@@ -75,7 +75,7 @@ func TestQEXTBuildPublicAPIContract(t *testing.T) {
 				"Bandwidth", "Channels", "Complexity", "CoupledStreams", "Decode", "DecodeInt16",
 				"DecodeInt24", "DecodeInt24Slice", "FinalRange",
 				"Gain", "GetFinalRange", "IgnoreExtensions", "LastPacketDuration",
-				"PhaseInversionDisabled", "Reset", "SampleRate", "SetComplexity", "SetDNNBlob",
+				"OutputChannels", "PhaseInversionDisabled", "Reset", "SampleRate", "SetComplexity", "SetDNNBlob", "SetDownmix",
 				"SetGain", "SetIgnoreExtensions", "SetPhaseInversionDisabled", "Streams",
 			},
 		},
@@ -83,7 +83,7 @@ func TestQEXTBuildPublicAPIContract(t *testing.T) {
 			name: "Reader",
 			got:  &gopus.Reader{},
 			want: []string{
-				"Channels", "LastGranulePos", "Read", "Reset", "SampleRate",
+				"Channels", "LastGranulePos", "Read", "Reset", "SampleRate", "SeekSample",
 			},
 		},
 		{
@@ -86,13 +86,13 @@ func TestQEXTExtraControlsBuildPublicAPIContract(t *testing.T) {
 			got:  &Encoder{},
 			want: []string{
 				"Application", "Bandwidth", "Bitrate", "BitrateMode", "Channels", "Complexity",
-				"DREDDuration", "DTXEnabled", "Encode", "EncodeFloat32", "EncodeInt16",
+				"DREDDuration", "DTXEnabled", "DTXFastPath", "Encode", "EncodeFloat32", "EncodeInt16",
 				"EncodeInt16Slice", "EncodeInt24", "EncodeInt24Slice", "ExpertFrameDuration",
 				"FECEnabled", "FinalRange", "ForceChannels", "FrameSize", "InBandFEC", "InDTX", "LSBDepth",
-				"Lookahead", "MaxBandwidth", "Mode", "PacketLoss", "PhaseInversionDisabled",
+				"Lookahead", "MaxBandwidth", "Mode", "PCMSampleRate", "PacketLoss", "PhaseInversionDisabled",
 				"PredictionDisabled", "QEXT", "Reset", "SampleRate", "SetApplication",
 				"SetBandwidth", "SetBandwidthAuto", "SetBitrate", "SetBitrateMode", "SetComplexity", "SetDNNBlob",
-				"SetDREDDuration", "SetDTX", "SetExpertFrameDuration", "SetFEC",
+				"SetDREDDuration", "SetDTX", "SetDTXFastPath", "SetExpertFrameDuration", "SetFEC",
 				"SetForceChannels", "SetFrameSize", "SetInBandFEC", "SetLSBDepth", "SetMaxBandwidth",
 				"SetMode", "SetPacketLoss", "SetPhaseInversionDisabled", "SetPredictionDisabled", "SetQEXT",
 				"SetSignal", "SetVBR", "SetVBRConstraint", "Signal", "VADActivity", "VBR", "VBRConstraint",
@@ -102,12 +102,12 @@ func TestQEXTExtraControlsBuildPublicAPIContract(t *testing.T) {
 			name: "Decoder",
 			got:  &Decoder{},
 			want: []string{
-				"Bandwidth", "Channels", "Complexity", "Decode", "DecodeDRED", "DecodeDREDInt24", "DecodeInt16",
+				"Bandwidth", "Channels", "Complexity", "Decode", "DecodeAccumulate", "DecodeDRED", "DecodeDREDInt24", "DecodeInt16",
 				"DecodeInt24", "DecodeInt24Slice", "DecodeWithFEC", "FinalRange",
 				"Gain", "IgnoreExtensions", "InDTX", "LastPacketDuration", "OSCEBWE", "OSCELACE",
-				"PhaseInversionDisabled", "Pitch", "Reset", "SampleRate", "SetComplexity",
+				"PCMSampleRate", "PhaseInversionDisabled", "Pitch", "Reset", "SampleRate", "SetComplexity",
 				"SetDNNBlob", "SetGain", "SetIgnoreExtensions", "SetOSCEBWE", "SetOSCELACE",
-				"SetPhaseInversionDisabled",
+				"SetPhaseInversionDisabled", "SetSkipInaudibleDTX", "SkipInaudibleDTX",
 			},
 		},
 		{
@@ -134,8 +134,8 @@ func TestQEXTExtraControlsBuildPublicAPIContract(t *testing.T) {
 				"Bandwidth", "Channels", "Complexity", "CoupledStreams", "Decode", "DecodeInt16",
 				"DecodeInt24", "DecodeInt24Slice", "FinalRange",
 				"Gain", "GetFinalRange", "IgnoreExtensions", "LastPacketDuration", "OSCEBWE",
-				"OSCELACE", "PhaseInversionDisabled", "Reset", "SampleRate", "SetComplexity",
-				"SetDNNBlob", "SetGain", "SetIgnoreExtensions", "SetOSCEBWE", "SetOSCELACE",
+				"OSCELACE", "OutputChannels", "PhaseInversionDisabled", "Reset", "SampleRate", "SetComplexity",
+				"SetDNNBlob", "SetDownmix", "SetGain", "SetIgnoreExtensions", "SetOSCEBWE", "SetOSCELACE",
 				"SetPhaseInversionDisabled", "Streams",
 			},
 		},
@@ -158,7 +158,7 @@ func TestQEXTExtraControlsBuildPublicAPIContract(t *testing.T) {
 			name: "Reader",
 			got:  &Reader{},
 			want: []string{
-				"Channels", "LastGranulePos", "Read", "Reset", "SampleRate",
+				"Channels", "LastGranulePos", "Read", "Reset", "SampleRate", "SeekSample",
 			},
 		},
 		{
@@ -18,13 +18,29 @@ func PCMSoftClip(pcm []float32, channels int, softclipMem []float32) {
 	if n < 1 {
 		return
 	}
-	opusmath.PCMSoftClip(pcm, n, channels, softclipMem)
+	opusPCMSoftClip(pcm, n, channels, softclipMem)
 }
 
 // opusPCMSoftClip applies the libopus soft clipping algorithm in-place.
 // It expects interleaved samples in the range of roughly [-1, 1].
 // This mirrors opus_pcm_soft_clip_impl() in libopus for float builds.
+//
+// When the declipping memory is clear and a vectorised peak scan finds no
+// sample with |x| > 1, the call is a no-op and returns before the scalar
+// clamp-and-scan in opusmath.PCMSoftClip.
 func opusPCMSoftClip(x []float32, n, channels int, declipMem []float32) {
+	if channels >= 1 && len(declipMem) >= channels && n >= 1 {
+		idle := true
+		for c := range channels {
+			if declipMem[c] != 0 {
+				idle = false
+				break
+			}
+		}
+		if idle && !pcmExceedsUnit(x[:min(n*channels, len(x))]) {
+			return
+		}
+	}
 	opusmath.PCMSoftClip(x, n, channels, declipMem)
 }
 
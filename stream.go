@@ -47,6 +47,12 @@ var hostIsLittleEndian = func() bool {
 //	    processAudio(buf[:n])
 //	}
 //
+// # Seeking
+//
+// When the PacketReader also implements PacketSeeker (as *ogg.Reader does),
+// Reader.SeekSample jumps to an exact output sample. It decodes and discards
+// the RFC 7845 pre-roll internally, so no manual warm-up is needed.
+//
 // # Streaming Encode
 //
 // To encode PCM audio to a stream of Opus packets:
@@ -121,6 +127,29 @@ type PacketReader interface {
 	ReadPacketInto(dst []byte) (n int, granulePos uint64, err error)
 }
 
+// PacketSeeker is implemented by packet sources that can reposition within
+// their stream, such as *ogg.Reader. Reader.SeekSample requires it.
+//
+// If the source also has a PreSkip() uint16 method reporting the stream
+// pre-skip in 48 kHz samples (as *ogg.Reader does), SeekSample honours it.
+type PacketSeeker interface {
+	// SeekGranule positions the source so the next ReadPacketInto returns the
+	// first packet whose granule position (its end sample at 48 kHz) is at or
+	// after granule.
+	SeekGranule(granule uint64) error
+}
+
+// preSkipSource is the optional PacketSeeker extension reporting the stream
+// pre-skip in 48 kHz samples.
+type preSkipSource interface {
+	PreSkip() uint16
+}
+
+// seekPreRoll48k is the pre-roll SeekSample decodes and discards ahead of the
+// target so the decoder has converged by then: RFC 7845 §4.6 recommends at
+// least 80 ms.
+const seekPreRoll48k = 3840
+
 // PacketSink receives encoded Opus packets from streaming encode.
 type PacketSink interface {
 	// WritePacket writes an encoded Opus packet.
@@ -198,76 +227,144 @@ func (r *Reader) Read(p []byte) (int, error) {
 			return 0, io.EOF
 		}
 
-		// Fetch next packet from source
-		nPacket, granulePos, err := r.source.ReadPacketInto(r.packetBuf)
-		if err == io.EOF {
-			r.eof = true
-			return 0, io.EOF
-		}
+		nSamples, err := r.decodeNext()
 		if err != nil {
 			return 0, err
 		}
-		r.lastGranulePos = granulePos
+		r.fillByteBuf(nSamples)
+		r.offset = 0
+	}
 
-		var packet []byte
-		if nPacket > 0 {
-			packet = r.packetBuf[:nPacket]
-		}
+	// Copy available bytes to p
+	n := copy(p, r.byteBuf[r.offset:])
+	r.offset += n
 
-		switch r.format {
-		case FormatFloat32LE:
-			nSamples, decErr := r.dec.Decode(packet, r.pcmFloat)
-			if decErr != nil {
-				return 0, decErr
-			}
-			nTotal := nSamples * int(r.dec.channels)
-			byteLen := nTotal * 4
-			if cap(r.byteBuf) < byteLen {
-				r.byteBuf = make([]byte, byteLen)
-			}
-			r.byteBuf = r.byteBuf[:byteLen]
-			if hostIsLittleEndian && nTotal > 0 {
-				// On LE hosts the in-memory float32 layout already matches
-				// FormatFloat32LE on the wire; copy the bytes directly.
-				raw := unsafe.Slice((*byte)(unsafe.Pointer(&r.pcmFloat[0])), nTotal*4)
-				copy(r.byteBuf, raw)
-			} else {
-				for i := range nTotal {
-					bits := math.Float32bits(r.pcmFloat[i])
-					binary.LittleEndian.PutUint32(r.byteBuf[i*4:], bits)
-				}
-			}
-		case FormatInt16LE:
-			nSamples, decErr := r.dec.DecodeInt16(packet, r.pcmInt16)
-			if decErr != nil {
-				return 0, decErr
-			}
-			nTotal := nSamples * int(r.dec.channels)
-			byteLen := nTotal * 2
-			if cap(r.byteBuf) < byteLen {
-				r.byteBuf = make([]byte, byteLen)
+	return n, nil
+}
+
+// decodeNext fetches the next packet from the source and decodes it into the
+// PCM scratch for the configured format, returning the samples per channel.
+// It marks the Reader exhausted when the source reports io.EOF.
+func (r *Reader) decodeNext() (int, error) {
+	nPacket, granulePos, err := r.source.ReadPacketInto(r.packetBuf)
+	if err == io.EOF {
+		r.eof = true
+		return 0, io.EOF
+	}
+	if err != nil {
+		return 0, err
+	}
+	r.lastGranulePos = granulePos
+
+	var packet []byte
+	if nPacket > 0 {
+		packet = r.packetBuf[:nPacket]
+	}
+
+	switch r.format {
+	case FormatFloat32LE:
+		return r.dec.Decode(packet, r.pcmFloat)
+	case FormatInt16LE:
+		return r.dec.DecodeInt16(packet, r.pcmInt16)
+	default:
+		return 0, ErrInvalidSampleFormat
+	}
+}
+
+// fillByteBuf serializes nSamples per channel of decoded PCM into byteBuf.
+func (r *Reader) fillByteBuf(nSamples int) {
+	nTotal := nSamples * int(r.dec.channels)
+	byteLen := nTotal * r.format.BytesPerSample()
+	if cap(r.byteBuf) < byteLen {
+		r.byteBuf = make([]byte, byteLen)
+	}
+	r.byteBuf = r.byteBuf[:byteLen]
+
+	switch r.format {
+	case FormatFloat32LE:
+		if hostIsLittleEndian && nTotal > 0 {
+			// On LE hosts the in-memory float32 layout already matches
+			// FormatFloat32LE on the wire; copy the bytes directly.
+			raw := unsafe.Slice((*byte)(unsafe.Pointer(&r.pcmFloat[0])), nTotal*4)
+			copy(r.byteBuf, raw)
+		} else {
+			for i := range nTotal {
+				bits := math.Float32bits(r.pcmFloat[i])
+				binary.LittleEndian.PutUint32(r.byteBuf[i*4:], bits)
 			}
-			r.byteBuf = r.byteBuf[:byteLen]
-			if hostIsLittleEndian && nTotal > 0 {
-				raw := unsafe.Slice((*byte)(unsafe.Pointer(&r.pcmInt16[0])), nTotal*2)
-				copy(r.byteBuf, raw)
-			} else {
-				for i := range nTotal {
-					binary.LittleEndian.PutUint16(r.byteBuf[i*2:], uint16(r.pcmInt16[i]))
-				}
+		}
+	case FormatInt16LE:
+		if hostIsLittleEndian && nTotal > 0 {
+			raw := unsafe.Slice((*byte)(unsafe.Pointer(&r.pcmInt16[0])), nTotal*2)
+			copy(r.byteBuf, raw)
+		} else {
+			for i := range nTotal {
+				binary.LittleEndian.PutUint16(r.byteBuf[i*2:], uint16(r.pcmInt16[i]))
 			}
-		default:
-			return 0, ErrInvalidSampleFormat
 		}
+	}
+}
 
-		r.offset = 0
+// SeekSample repositions the Reader so the next Read returns PCM starting at
+// sample n (per channel, at the Reader's sample rate) of the playable stream.
+//
+// Sample 0 is the first sample after the stream pre-skip, so n corresponds to
+// granule position n*48000/SampleRate() + preSkip (RFC 7845 §4). Since Read
+// does not trim the pre-skip itself, the PCM after SeekSample(n) lines up with
+// a linear decode from the start of the stream at sample n plus the pre-skip.
+//
+// The source must implement PacketSeeker, otherwise ErrNotSeekable is
+// returned. The decoder is reset and at least 80 ms ahead of the target are
+// decoded and discarded so it has converged by sample n; targets within that
+// pre-roll of the start re-decode from the first packet and therefore match a
+// linear decode exactly. SeekSample returns io.EOF when n lies past the end of
+// the stream.
+func (r *Reader) SeekSample(n int64) error {
+	seeker, ok := r.source.(PacketSeeker)
+	if !ok {
+		return ErrNotSeekable
+	}
+	if n < 0 {
+		return ErrInvalidArgument
 	}
 
-	// Copy available bytes to p
-	n := copy(p, r.byteBuf[r.offset:])
-	r.offset += n
+	fs := int64(r.dec.SampleRate())
+	target := n
+	if ps, ok := r.source.(preSkipSource); ok {
+		target += int64(ps.PreSkip()) * fs / 48000
+	}
+	seekGranule := uint64(0)
+	if target48 := target * 48000 / fs; target48 > seekPreRoll48k {
+		seekGranule = uint64(target48 - seekPreRoll48k)
+	}
 
-	return n, nil
+	r.Reset()
+	if err := seeker.SeekGranule(seekGranule); err != nil {
+		if err == io.EOF {
+			r.eof = true
+		}
+		return err
+	}
+
+	// Decode the pre-roll into the PCM scratch, tracking the position from the
+	// first packet's granule, until the packet holding the target arrives.
+	pos := int64(-1)
+	for {
+		nSamples, err := r.decodeNext()
+		if err != nil {
+			return err
+		}
+		if pos < 0 {
+			pos = max(int64(r.lastGranulePos)*fs/48000-int64(nSamples), 0)
+		}
+		if pos+int64(nSamples) > target {
+			r.fillByteBuf(nSamples)
+			skip := max(target-pos, 0)
+			r.offset = int(skip) * int(r.dec.channels) * r.format.BytesPerSample()
+			return nil
+		}
+		pos += int64(nSamples)
+	}
 }
 
 // SampleRate returns the sample rate in Hz.
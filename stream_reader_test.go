@@ -8,6 +8,8 @@ import (
 	"io"
 	"math"
 	"testing"
+
+	"github.com/thesyncim/gopus/container/ogg"
 )
 
 // TestNewReader_ValidParams tests creating readers with valid parameters.
@@ -502,3 +504,208 @@ func TestReader_io_Reader_Interface(t *testing.T) {
 		t.Error("io.Copy copied 0 bytes")
 	}
 }
+
+// buildSeekTestOgg encodes the given number of 20 ms frames of a swept two-tone
+// signal into an in-memory Ogg Opus file with the default pre-skip.
+func buildSeekTestOgg(tb testing.TB, channels, frames int) []byte {
+	tb.Helper()
+	enc, err := NewEncoder(EncoderConfig{SampleRate: 48000, Channels: channels, Application: ApplicationAudio})
+	if err != nil {
+		tb.Fatalf("NewEncoder failed: %v", err)
+	}
+	var buf bytes.Buffer
+	w, err := ogg.NewWriter(&buf, 48000, uint8(channels))
+	if err != nil {
+		tb.Fatalf("ogg.NewWriter failed: %v", err)
+	}
+	pcm := make([]float32, 960*channels)
+	packet := make([]byte, 4000)
+	for f := range frames {
+		for i := range 960 {
+			tt := float64(f*960+i) / 48000
+			v := 0.3*math.Sin(2*math.Pi*(220+40*tt)*tt) + 0.2*math.Sin(2*math.Pi*1375*tt)
+			for ch := range channels {
+				pcm[i*channels+ch] = float32(v)
+			}
+		}
+		n, err := enc.Encode(pcm, packet)
+		if err != nil {
+			tb.Fatalf("Encode frame %d failed: %v", f, err)
+		}
+		if err := w.WritePacket(packet[:n], 960); err != nil {
+			tb.Fatalf("WritePacket frame %d failed: %v", f, err)
+		}
+	}
+	if err := w.Close(); err != nil {
+		tb.Fatalf("ogg Close failed: %v", err)
+	}
+	return buf.Bytes()
+}
+
+func newOggStreamReader(tb testing.TB, file []byte, sampleRate, channels int, format SampleFormat) *Reader {
+	tb.Helper()
+	src, err := ogg.NewReader(bytes.NewReader(file))
+	if err != nil {
+		tb.Fatalf("ogg.NewReader failed: %v", err)
+	}
+	r, err := NewReader(DefaultDecoderConfig(sampleRate, channels), src, format)
+	if err != nil {
+		tb.Fatalf("NewReader failed: %v", err)
+	}
+	return r
+}
+
+// TestReader_SeekSample_MatchesLinearDecode seeks to a spread of positions and
+// compares the PCM that follows against a linear decode of the same file.
+// Seeks inside the pre-roll window of the start re-decode from the first packet
+// and must be bit-exact. Deeper seeks restart the decoder, so they must line up
+// sample-exactly with the linear decode (lag 0 beats any one-sample shift) and
+// converge to it once the decoder state has settled.
+func TestReader_SeekSample_MatchesLinearDecode(t *testing.T) {
+	const channels = 2
+	file := buildSeekTestOgg(t, channels, 250)
+
+	cases := []struct {
+		name       string
+		sampleRate int
+		format     SampleFormat
+	}{
+		{"48kHz float32", 48000, FormatFloat32LE},
+		{"48kHz int16", 48000, FormatInt16LE},
+		{"16kHz float32", 16000, FormatFloat32LE},
+	}
+	for _, tc := range cases {
+		t.Run(tc.name, func(t *testing.T) {
+			linear, err := io.ReadAll(newOggStreamReader(t, file, tc.sampleRate, channels, tc.format))
+			if err != nil {
+				t.Fatalf("linear decode failed: %v", err)
+			}
+			frameBytes := channels * tc.format.BytesPerSample()
+			skip := int(ogg.DefaultPreSkip) * tc.sampleRate / 48000
+			total := len(linear)/frameBytes - skip
+			window := tc.sampleRate / 5 // compare 200 ms after each seek
+			exactLimit := (seekPreRoll48k - int(ogg.DefaultPreSkip)) * tc.sampleRate / 48000
+
+			r := newOggStreamReader(t, file, tc.sampleRate, channels, tc.format)
+			targets := []int{0, 1, exactLimit / 2, exactLimit, total / 3, total/2 + 7, total - window - 1}
+			for _, n := range targets {
+				if err := r.SeekSample(int64(n)); err != nil {
+					t.Fatalf("SeekSample(%d) failed: %v", n, err)
+				}
+				got := make([]byte, window*frameBytes)
+				if _, err := io.ReadFull(r, got); err != nil {
+					t.Fatalf("read after SeekSample(%d) failed: %v", n, err)
+				}
+				at := func(lag int) []byte {
+					start := (n + skip + lag) * frameBytes
+					return linear[start : start+len(got)]
+				}
+				if n <= exactLimit {
+					if !bytes.Equal(got, at(0)) {
+						t.Fatalf("SeekSample(%d) within the pre-roll window is not bit-exact", n)
+					}
+					continue
+				}
+				aligned := seekPCMSNR(got, at(0), tc.format)
+				for _, lag := range []int{-1, 1} {
+					if n+lag < 0 || n+skip+lag+window > len(linear)/frameBytes {
+						continue
+					}
+					if shifted := seekPCMSNR(got, at(lag), tc.format); shifted >= aligned {
+						t.Fatalf("SeekSample(%d) is misaligned: SNR at lag %d = %.1f dB >= %.1f dB at lag 0",
+							n, lag, shifted, aligned)
+					}
+				}
+				half := len(got) / 2
+				if settled := seekPCMSNR(got[half:], at(0)[half:], tc.format); settled < 35 {
+					t.Fatalf("SeekSample(%d) SNR vs linear decode after settling = %.1f dB, want >= 35 dB", n, settled)
+				}
+			}
+
+			if err := r.SeekSample(int64(total + 48000)); err != io.EOF {
+				t.Fatalf("SeekSample past end error = %v, want io.EOF", err)
+			}
+			if _, err := r.Read(make([]byte, 16)); err != io.EOF {
+				t.Fatalf("Read after seeking past end error = %v, want io.EOF", err)
+			}
+		})
+	}
+}
+
+func seekPCMSNR(got, want []byte, format SampleFormat) float64 {
+	sample := func(b []byte, i int) float64 {
+		if format == FormatInt16LE {
+			return float64(int16(binary.LittleEndian.Uint16(b[i*2:]))) / 32768
+		}
+		return float64(math.Float32frombits(binary.LittleEndian.Uint32(b[i*4:])))
+	}
+	var sig, noise float64
+	for i := range len(want) / format.BytesPerSample() {
+		w, g := sample(want, i), sample(got, i)
+		sig += w * w
+		noise += (w - g) * (w - g)
+	}
+	if noise == 0 {
+		return math.Inf(1)
+	}
+	return 10 * math.Log10(sig/noise)
+}
+
+// TestReader_SeekSample_NotSeekable verifies sources without SeekGranule are
+// rejected.
+func TestReader_SeekSample_NotSeekable(t *testing.T) {
+	reader, err := NewReader(DefaultDecoderConfig(48000, 2), &slicePacketSource{}, FormatFloat32LE)
+	if err != nil {
+		t.Fatalf("NewReader failed: %v", err)
+	}
+	if err := reader.SeekSample(0); err != ErrNotSeekable {
+		t.Fatalf("SeekSample error = %v, want %v", err, ErrNotSeekable)
+	}
+}
+
+func BenchmarkReaderSeekSample(b *testing.B) {
+	// Ten minutes of stereo audio: a few seconds of real packets repeated so
+	// the file is long without paying for the encode.
+	short := buildSeekTestOgg(b, 2, 250)
+	src, err := ogg.NewReader(bytes.NewReader(short))
+	if err != nil {
+		b.Fatal(err)
+	}
+	var packets [][]byte
+	for {
+		pkt, _, err := src.ReadPacket()
+		if err == io.EOF {
+			break
+		}
+		if err != nil {
+			b.Fatal(err)
+		}
+		packets = append(packets, pkt)
+	}
+	var buf bytes.Buffer
+	w, err := ogg.NewWriter(&buf, 48000, 2)
+	if err != nil {
+		b.Fatal(err)
+	}
+	const frames = 30000
+	for i := range frames {
+		if err := w.WritePacket(packets[i%len(packets)], 960); err != nil {
+			b.Fatal(err)
+		}
+	}
+	_ = w.Close()
+
+	r := newOggStreamReader(b, buf.Bytes(), 48000, 2, FormatFloat32LE)
+	out := make([]byte, 960*2*4)
+	b.ReportAllocs()
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		n := int64(i*7919%(frames-10)) * 960
+		if err := r.SeekSample(n); err != nil {
+			b.Fatal(err)
+		}
+		if _, err := io.ReadFull(r, out); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
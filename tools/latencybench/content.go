@@ -0,0 +1,99 @@
+package main
+
+import (
+	"encoding/base64"
+	"encoding/binary"
+	"encoding/json"
+	"fmt"
+	"os"
+	"strings"
+
+	"github.com/thesyncim/gopus/internal/testsignal"
+)
+
+const sampleRate = 48000
+
+// contentSource is one looped 48 kHz PCM clip, interleaved at the run's
+// channel count.
+type contentSource struct {
+	name string
+	pcm  []float32
+}
+
+// realcontentFixture is the subset of the real-content corpus fixture
+// (tools/gen_realcontent_corpus_fixture.go) the harness reads.
+type realcontentFixture struct {
+	SampleRate int `json:"sample_rate"`
+	Cases      []struct {
+		Name     string `json:"name"`
+		Channels int    `json:"channels"`
+		PCM      string `json:"pcm_s16le_b64"`
+	} `json:"cases"`
+}
+
+// loadContent builds the session content: the synthetic corpus classes and,
+// when corpusPath is set, the real-content corpus clips.
+func loadContent(content, corpusPath string, seconds float64, channels int) ([]contentSource, error) {
+	var sources []contentSource
+	for _, kind := range strings.Split(content, ",") {
+		switch strings.TrimSpace(kind) {
+		case "synthetic":
+			perChannel := int(seconds * sampleRate)
+			classes := append(testsignal.CorpusSignalClasses(), testsignal.CorpusExtendedSignalClasses()...)
+			for _, class := range classes {
+				pcm, err := testsignal.GenerateCorpusSignal(class, sampleRate, perChannel*channels, channels)
+				if err != nil {
+					return nil, err
+				}
+				sources = append(sources, contentSource{name: class, pcm: pcm})
+			}
+		case "realcontent":
+			real, err := loadRealcontent(corpusPath, channels)
+			if err != nil {
+				return nil, err
+			}
+			sources = append(sources, real...)
+		default:
+			return nil, fmt.Errorf("unknown content kind %q (want synthetic, realcontent)", kind)
+		}
+	}
+	if len(sources) == 0 {
+		return nil, fmt.Errorf("no content selected")
+	}
+	return sources, nil
+}
+
+func loadRealcontent(path string, channels int) ([]contentSource, error) {
+	data, err := os.ReadFile(path)
+	if err != nil {
+		return nil, fmt.Errorf("read real-content corpus: %w", err)
+	}
+	var fixture realcontentFixture
+	if err := json.Unmarshal(data, &fixture); err != nil {
+		return nil, fmt.Errorf("parse real-content corpus: %w", err)
+	}
+	if fixture.SampleRate != sampleRate {
+		return nil, fmt.Errorf("real-content corpus rate %d, want %d", fixture.SampleRate, sampleRate)
+	}
+	sources := make([]contentSource, 0, len(fixture.Cases))
+	for _, c := range fixture.Cases {
+		raw, err := base64.StdEncoding.DecodeString(c.PCM)
+		if err != nil {
+			return nil, fmt.Errorf("real-content case %s: %w", c.Name, err)
+		}
+		if c.Channels < 1 || c.Channels > 2 || len(raw) < 4*c.Channels {
+			return nil, fmt.Errorf("real-content case %s: bad layout", c.Name)
+		}
+		frames := len(raw) / (2 * c.Channels)
+		pcm := make([]float32, frames*channels)
+		for i := 0; i < frames; i++ {
+			for ch := 0; ch < channels; ch++ {
+				src := min(ch, c.Channels-1)
+				v := int16(binary.LittleEndian.Uint16(raw[2*(i*c.Channels+src):]))
+				pcm[i*channels+ch] = float32(v) / 32768
+			}
+		}
+		sources = append(sources, contentSource{name: "realcontent_" + c.Name, pcm: pcm})
+	}
+	return sources, nil
+}
@@ -0,0 +1,36 @@
+//go:build !gopus_dred && !gopus_osce
+
+package main
+
+import (
+	"errors"
+
+	"github.com/thesyncim/gopus"
+)
+
+// sessionExtras is empty in the default build: DRED and OSCE need the
+// gopus_dred / gopus_osce controls.
+type sessionExtras struct{}
+
+func validateExtras(cfg config) error {
+	if cfg.dredDuration > 0 || cfg.osce || cfg.encoderBlob != "" || cfg.decoderBlob != "" {
+		return errors.New("-dred-duration, -osce and the DNN blob flags need -tags gopus_dred or gopus_osce")
+	}
+	return nil
+}
+
+func newSessionExtras(config, *gopus.Encoder, *gopus.Decoder) (*sessionExtras, error) {
+	return &sessionExtras{}, nil
+}
+
+// recoverDRED reports whether the lost frame was rebuilt from DRED carried
+// by next; the default build never does.
+func (*sessionExtras) recoverDRED(*gopus.Decoder, []byte, []float32, int) (int, bool) {
+	return 0, false
+}
+
+// osceActive reports whether OSCE post-processed the frame decoded from
+// packet.
+func (*sessionExtras) osceActive([]byte) bool {
+	return false
+}
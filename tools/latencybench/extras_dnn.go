@@ -0,0 +1,86 @@
+//go:build gopus_dred || gopus_osce
+
+package main
+
+import (
+	"errors"
+
+	"github.com/thesyncim/gopus"
+)
+
+// sessionExtras carries the per-session DRED recovery state and OSCE flag of
+// the gopus_dred / gopus_osce builds.
+type sessionExtras struct {
+	dredDecoder *gopus.DREDDecoder
+	dred        *gopus.DRED
+	osce        bool
+}
+
+func validateExtras(cfg config) error {
+	if cfg.dredDuration > 0 && (cfg.encoderBlob == "" || cfg.decoderBlob == "") {
+		return errors.New("-dred-duration needs -encoder-blob and -decoder-blob")
+	}
+	if cfg.osce && cfg.decoderBlob == "" {
+		return errors.New("-osce needs -decoder-blob")
+	}
+	return nil
+}
+
+func newSessionExtras(cfg config, enc *gopus.Encoder, dec *gopus.Decoder) (*sessionExtras, error) {
+	x := &sessionExtras{}
+	if cfg.encoderBlobData != nil {
+		if err := enc.SetDNNBlob(cfg.encoderBlobData); err != nil {
+			return nil, err
+		}
+	}
+	if cfg.decoderBlobData != nil {
+		if err := dec.SetDNNBlob(cfg.decoderBlobData); err != nil {
+			return nil, err
+		}
+	}
+	if cfg.dredDuration > 0 {
+		if err := enc.SetDREDDuration(cfg.dredDuration); err != nil {
+			return nil, err
+		}
+		x.dredDecoder = gopus.NewDREDDecoder()
+		if err := x.dredDecoder.SetDNNBlob(cfg.decoderBlobData); err != nil {
+			return nil, err
+		}
+		x.dred = gopus.NewDRED()
+	}
+	if cfg.osce {
+		if err := dec.SetComplexity(10); err != nil {
+			return nil, err
+		}
+		if err := enableOSCE(dec); err != nil {
+			return nil, err
+		}
+		x.osce = true
+	}
+	return x, nil
+}
+
+// recoverDRED rebuilds the lost frame right before next from the DRED
+// redundancy next carries, as a receiver with one frame of jitter buffer
+// would. It reports false when next has no usable DRED for that frame.
+func (x *sessionExtras) recoverDRED(dec *gopus.Decoder, next []byte, pcm []float32, frameSize int) (int, bool) {
+	if x.dredDecoder == nil || len(next) == 0 {
+		return 0, false
+	}
+	available, _, err := x.dredDecoder.Parse(x.dred, next, frameSize, sampleRate, false)
+	if err != nil || available < frameSize || !x.dred.Processed() {
+		return 0, false
+	}
+	n, err := dec.DecodeDRED(x.dred, frameSize, pcm, frameSize)
+	return n, err == nil
+}
+
+// osceActive reports whether OSCE post-processed the frame decoded from
+// packet: OSCE runs on the SILK layer of SILK and Hybrid frames.
+func (x *sessionExtras) osceActive(packet []byte) bool {
+	if !x.osce || len(packet) == 0 {
+		return false
+	}
+	mode := gopus.ParseTOC(packet[0]).Mode
+	return mode == gopus.ModeSILK || mode == gopus.ModeHybrid
+}
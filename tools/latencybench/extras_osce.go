@@ -0,0 +1,9 @@
+//go:build gopus_osce
+
+package main
+
+import "github.com/thesyncim/gopus"
+
+func enableOSCE(dec *gopus.Decoder) error {
+	return dec.SetOSCELACE(true)
+}
@@ -0,0 +1,13 @@
+//go:build gopus_dred && !gopus_osce
+
+package main
+
+import (
+	"errors"
+
+	"github.com/thesyncim/gopus"
+)
+
+func enableOSCE(*gopus.Decoder) error {
+	return errors.New("-osce needs -tags gopus_osce")
+}
@@ -0,0 +1,94 @@
+package main
+
+import (
+	"math/bits"
+	"sync/atomic"
+	"time"
+)
+
+// Latencies are bucketed log-linearly: exact below 64 ns, then 64 buckets per
+// power of two (<1.6% relative error). Counters are atomic so every session
+// records straight into the shared histograms without locks or per-session
+// copies; values past histMaxShift saturate into the last bucket and are
+// still reported exactly by max.
+const (
+	histSubBits  = 6
+	histSubCount = 1 << histSubBits
+	histMaxShift = 30 // ~137 s
+	histBuckets  = (histMaxShift + 2) * histSubCount
+)
+
+type histogram struct {
+	counts [histBuckets]atomic.Uint64
+	count  atomic.Uint64
+	sum    atomic.Uint64
+	max    atomic.Uint64
+}
+
+func histBucket(v uint64) int {
+	if v < histSubCount {
+		return int(v)
+	}
+	shift := bits.Len64(v) - histSubBits - 1
+	if shift > histMaxShift {
+		return histBuckets - 1
+	}
+	return (shift+1)*histSubCount + int(v>>uint(shift)) - histSubCount
+}
+
+// histBucketUpper returns the largest value that maps to bucket idx.
+func histBucketUpper(idx int) uint64 {
+	b, s := idx/histSubCount, uint64(idx%histSubCount)
+	if b == 0 {
+		return s
+	}
+	shift := uint(b - 1)
+	return ((s+histSubCount+1)<<shift - 1)
+}
+
+func (h *histogram) record(d time.Duration) {
+	v := uint64(0)
+	if d > 0 {
+		v = uint64(d)
+	}
+	h.counts[histBucket(v)].Add(1)
+	h.count.Add(1)
+	h.sum.Add(v)
+	for {
+		cur := h.max.Load()
+		if v <= cur || h.max.CompareAndSwap(cur, v) {
+			return
+		}
+	}
+}
+
+// quantile returns the upper bound of the bucket holding the q-quantile
+// (nearest-rank), clamped to the observed maximum.
+func (h *histogram) quantile(q float64) uint64 {
+	n := h.count.Load()
+	if n == 0 {
+		return 0
+	}
+	rank := uint64(q*float64(n) + 0.999999)
+	if rank < 1 {
+		rank = 1
+	}
+	if rank > n {
+		rank = n
+	}
+	var seen uint64
+	for i := range h.counts {
+		seen += h.counts[i].Load()
+		if seen >= rank {
+			return min(histBucketUpper(i), h.max.Load())
+		}
+	}
+	return h.max.Load()
+}
+
+func (h *histogram) mean() uint64 {
+	if n := h.count.Load(); n > 0 {
+		return h.sum.Load() / n
+	}
+	return 0
+}
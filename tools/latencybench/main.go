@@ -0,0 +1,663 @@
+// Command latencybench measures per-frame encode/decode tail latency of many
+// concurrent real-time sessions.
+//
+// Each session is an encoder/decoder pair fed looped corpus content (the
+// internal/testsignal classes and, optionally, the real-content corpus) on a
+// paced frame clock, the way a media server ticks its streams. The decoder
+// lags the encoder by one frame, as behind a one-packet jitter buffer, so a
+// lost packet is concealed by PLC or, in DRED builds, rebuilt from the DRED
+// redundancy of the packet after it. Sessions walk a bitrate ladder to force
+// SILK/Hybrid/CELT transitions.
+//
+// Every frame's latency is recorded per operation (encode, decode and the
+// whole tick) into histograms broken down by event: mode transitions, PLC,
+// DRED recovery, OSCE post-processing and frames that overlapped a GC cycle.
+// The report (JSON or TSV) lists count, mean, p50, p99, p99.9 and max per
+// operation/event, plus tick overruns against the frame budget. -gate turns
+// the report into a pass/fail check for CI.
+package main
+
+import (
+	"encoding/json"
+	"errors"
+	"flag"
+	"fmt"
+	"io"
+	"math/rand"
+	"os"
+	"runtime"
+	"runtime/metrics"
+	"sort"
+	"strconv"
+	"strings"
+	"sync"
+	"sync/atomic"
+	"time"
+
+	"github.com/thesyncim/gopus"
+)
+
+type config struct {
+	sessions       int
+	duration       time.Duration
+	warmup         time.Duration
+	frameMs        float64
+	channels       int
+	application    string
+	bitrates       []int
+	switchEvery    time.Duration
+	lossPercent    float64
+	seed           int64
+	paced          bool
+	content        string
+	corpusPath     string
+	contentSeconds float64
+	format         string
+	outPath        string
+	gates          []gate
+	maxOverruns    int64
+
+	dredDuration    int
+	osce            bool
+	encoderBlob     string
+	decoderBlob     string
+	encoderBlobData []byte
+	decoderBlobData []byte
+}
+
+const (
+	opEncode = iota
+	opDecode
+	opTick
+	numOps
+)
+
+var opNames = [numOps]string{"encode", "decode", "tick"}
+
+// Frame events. A frame with no event is "steady"; every frame also counts
+// towards "all".
+const (
+	eventModeTransition = 1 << iota
+	eventPLC
+	eventDRED
+	eventOSCE
+	eventGC
+)
+
+const (
+	rowAll = iota
+	rowSteady
+	rowModeTransition
+	rowPLC
+	rowDRED
+	rowOSCE
+	rowGC
+	numRows
+)
+
+var rowNames = [numRows]string{"all", "steady", "mode_transition", "plc", "dred", "osce", "gc"}
+
+type recorder struct {
+	hists      [numOps][numRows]histogram
+	ticks      atomic.Uint64
+	overruns   atomic.Uint64
+	lateTicks  atomic.Uint64
+	frameDur   time.Duration
+	encodeErrs atomic.Uint64
+	decodeErrs atomic.Uint64
+}
+
+func (r *recorder) record(op int, events int, d time.Duration) {
+	h := &r.hists[op]
+	h[rowAll].record(d)
+	if events == 0 {
+		h[rowSteady].record(d)
+		return
+	}
+	for row := rowModeTransition; row < numRows; row++ {
+		if events&(1<<(row-rowModeTransition)) != 0 {
+			h[row].record(d)
+		}
+	}
+}
+
+func main() {
+	cfg, err := parseFlags(os.Args[1:])
+	if err != nil {
+		fmt.Fprintf(os.Stderr, "latencybench: %v\n", err)
+		os.Exit(2)
+	}
+	rep, err := run(cfg)
+	if err != nil {
+		fmt.Fprintf(os.Stderr, "latencybench failed: %v\n", err)
+		os.Exit(1)
+	}
+	if err := writeReport(cfg, rep); err != nil {
+		fmt.Fprintf(os.Stderr, "latencybench: %v\n", err)
+		os.Exit(1)
+	}
+	if len(rep.Violations) > 0 {
+		for _, v := range rep.Violations {
+			fmt.Fprintf(os.Stderr, "latency gate failed: %s\n", v)
+		}
+		os.Exit(1)
+	}
+}
+
+func parseFlags(args []string) (config, error) {
+	var cfg config
+	var bitrates, gates string
+	fs := flag.NewFlagSet("latencybench", flag.ContinueOnError)
+	fs.IntVar(&cfg.sessions, "sessions", 64, "concurrent encode/decode sessions")
+	fs.DurationVar(&cfg.duration, "duration", 10*time.Second, "stream time per session")
+	fs.DurationVar(&cfg.warmup, "warmup", 500*time.Millisecond, "leading stream time per session left out of the report")
+	fs.Float64Var(&cfg.frameMs, "frame-ms", 20, "frame duration in ms (2.5, 5, 10, 20, 40 or 60)")
+	fs.IntVar(&cfg.channels, "channels", 1, "channels per session (1 or 2)")
+	fs.StringVar(&cfg.application, "application", "voip", "encoder application: voip, audio or lowdelay")
+	fs.StringVar(&bitrates, "bitrates", "12000,24000,48000,96000", "comma-separated bitrate ladder each session walks")
+	fs.DurationVar(&cfg.switchEvery, "switch-every", 2*time.Second, "stream time between bitrate steps (0 keeps the first bitrate)")
+	fs.Float64Var(&cfg.lossPercent, "loss", 5, "random packet loss in percent")
+	fs.Int64Var(&cfg.seed, "seed", 1, "random seed for loss and content offsets")
+	fs.BoolVar(&cfg.paced, "paced", true, "tick every session on a real-time frame clock; false runs frames back to back")
+	fs.StringVar(&cfg.content, "content", "synthetic", "comma-separated content kinds: synthetic, realcontent")
+	fs.StringVar(&cfg.corpusPath, "corpus", "testvectors/testdata/realcontent_corpus_fixture.json", "real-content corpus fixture")
+	fs.Float64Var(&cfg.contentSeconds, "content-seconds", 4, "length of each looped synthetic clip in seconds")
+	fs.StringVar(&cfg.format, "format", "json", "output format: json or tsv")
+	fs.StringVar(&cfg.outPath, "out", "", "optional output path (default stdout)")
+	fs.StringVar(&gates, "gate", "", "comma-separated latency gates op/event/stat<=duration, e.g. tick/all/p999<=4ms")
+	fs.Int64Var(&cfg.maxOverruns, "max-overruns", -1, "fail when more ticks than this overrun the frame budget (-1 disables)")
+	fs.IntVar(&cfg.dredDuration, "dred-duration", 0, "DRED redundancy depth in 10 ms units (gopus_dred builds)")
+	fs.BoolVar(&cfg.osce, "osce", false, "enable OSCE LACE on the decoders (gopus_osce builds)")
+	fs.StringVar(&cfg.encoderBlob, "encoder-blob", "", "encoder DNN blob for DRED")
+	fs.StringVar(&cfg.decoderBlob, "decoder-blob", "", "decoder DNN blob for DRED/OSCE")
+	if err := fs.Parse(args); err != nil {
+		return cfg, err
+	}
+
+	if cfg.sessions < 1 {
+		return cfg, fmt.Errorf("invalid -sessions %d", cfg.sessions)
+	}
+	if cfg.channels != 1 && cfg.channels != 2 {
+		return cfg, fmt.Errorf("invalid -channels %d", cfg.channels)
+	}
+	if cfg.format != "json" && cfg.format != "tsv" {
+		return cfg, fmt.Errorf("invalid -format %q", cfg.format)
+	}
+	for _, s := range strings.Split(bitrates, ",") {
+		b, err := strconv.Atoi(strings.TrimSpace(s))
+		if err != nil || b <= 0 {
+			return cfg, fmt.Errorf("invalid -bitrates entry %q", s)
+		}
+		cfg.bitrates = append(cfg.bitrates, b)
+	}
+	var err error
+	if cfg.gates, err = parseGates(gates); err != nil {
+		return cfg, err
+	}
+	if err := validateExtras(cfg); err != nil {
+		return cfg, err
+	}
+	if cfg.encoderBlob != "" {
+		if cfg.encoderBlobData, err = os.ReadFile(cfg.encoderBlob); err != nil {
+			return cfg, err
+		}
+	}
+	if cfg.decoderBlob != "" {
+		if cfg.decoderBlobData, err = os.ReadFile(cfg.decoderBlob); err != nil {
+			return cfg, err
+		}
+	}
+	return cfg, nil
+}
+
+func applicationFor(name string) (gopus.Application, error) {
+	switch name {
+	case "voip":
+		return gopus.ApplicationVoIP, nil
+	case "audio":
+		return gopus.ApplicationAudio, nil
+	case "lowdelay":
+		return gopus.ApplicationLowDelay, nil
+	}
+	return 0, fmt.Errorf("invalid -application %q", name)
+}
+
+type session struct {
+	id        int
+	cfg       config
+	enc       *gopus.Encoder
+	dec       *gopus.Decoder
+	extras    *sessionExtras
+	src       []float32
+	pos       int
+	rng       *rand.Rand
+	frameSize int
+	pcmIn     []float32
+	pcmOut    []float32
+	pkts      [2][]byte
+	lens      [2]int
+	lost      [2]bool
+	encMode   gopus.Mode
+	decMode   gopus.Mode
+	haveEnc   bool
+	haveDec   bool
+	gc        []metrics.Sample
+}
+
+func newSession(id int, cfg config, src contentSource, frameSize int) (*session, error) {
+	app, err := applicationFor(cfg.application)
+	if err != nil {
+		return nil, err
+	}
+	enc, err := gopus.NewEncoder(gopus.EncoderConfig{SampleRate: sampleRate, Channels: cfg.channels, Application: app})
+	if err != nil {
+		return nil, err
+	}
+	if err := enc.SetFrameSize(frameSize); err != nil {
+		return nil, err
+	}
+	if err := enc.SetBitrate(cfg.bitrates[id%len(cfg.bitrates)]); err != nil {
+		return nil, err
+	}
+	if err := enc.SetPacketLoss(min(int(cfg.lossPercent+0.5), 100)); err != nil {
+		return nil, err
+	}
+	dec, err := gopus.NewDecoder(gopus.DefaultDecoderConfig(sampleRate, cfg.channels))
+	if err != nil {
+		return nil, err
+	}
+	extras, err := newSessionExtras(cfg, enc, dec)
+	if err != nil {
+		return nil, err
+	}
+	rng := rand.New(rand.NewSource(cfg.seed + int64(id)*7919))
+	s := &session{
+		id:        id,
+		cfg:       cfg,
+		enc:       enc,
+		dec:       dec,
+		extras:    extras,
+		src:       src.pcm,
+		pos:       rng.Intn(len(src.pcm)/cfg.channels) * cfg.channels,
+		rng:       rng,
+		frameSize: frameSize,
+		pcmIn:     make([]float32, frameSize*cfg.channels),
+		pcmOut:    make([]float32, frameSize*cfg.channels),
+		gc:        []metrics.Sample{{Name: "/gc/cycles/total:gc-cycles"}},
+	}
+	for i := range s.pkts {
+		s.pkts[i] = make([]byte, 4000)
+	}
+	return s, nil
+}
+
+func (s *session) nextInput() {
+	for i := 0; i < len(s.pcmIn); {
+		n := copy(s.pcmIn[i:], s.src[s.pos:])
+		i += n
+		s.pos += n
+		if s.pos >= len(s.src) {
+			s.pos = 0
+		}
+	}
+}
+
+func (s *session) gcCycles() uint64 {
+	metrics.Read(s.gc)
+	return s.gc[0].Value.Uint64()
+}
+
+// run ticks the session frames times from start, recording every frame after
+// the first warmupFrames into rec.
+func (s *session) run(rec *recorder, start time.Time, frames, warmupFrames, switchFrames int) error {
+	frameDur := rec.frameDur
+	for k := 0; k < frames; k++ {
+		if s.cfg.paced {
+			due := start.Add(time.Duration(k) * frameDur)
+			if wait := time.Until(due); wait > 0 {
+				time.Sleep(wait)
+			} else if -wait > frameDur {
+				rec.lateTicks.Add(1)
+			}
+		}
+		if switchFrames > 0 && k > 0 && k%switchFrames == 0 {
+			step := (k/switchFrames + s.id) % len(s.cfg.bitrates)
+			if err := s.enc.SetBitrate(s.cfg.bitrates[step]); err != nil {
+				return err
+			}
+		}
+		s.nextInput()
+
+		cur := k & 1
+		gc0 := s.gcCycles()
+		t0 := time.Now()
+		n, err := s.enc.Encode(s.pcmIn, s.pkts[cur])
+		t1 := time.Now()
+		gc1 := s.gcCycles()
+		if err != nil {
+			rec.encodeErrs.Add(1)
+			n = 0
+		}
+		s.lens[cur] = n
+		s.lost[cur] = n == 0 || s.rng.Float64()*100 < s.cfg.lossPercent
+		encEvents := 0
+		if n > 0 {
+			mode := gopus.ParseTOC(s.pkts[cur][0]).Mode
+			if s.haveEnc && mode != s.encMode {
+				encEvents |= eventModeTransition
+			}
+			s.encMode, s.haveEnc = mode, true
+		}
+		if gc1 != gc0 {
+			encEvents |= eventGC
+		}
+		encDur := t1.Sub(t0)
+		measured := k >= warmupFrames
+		if measured {
+			rec.record(opEncode, encEvents, encDur)
+		}
+
+		decEvents := 0
+		var decDur time.Duration
+		if k > 0 {
+			prev := cur ^ 1
+			var next []byte
+			if !s.lost[cur] {
+				next = s.pkts[cur][:n]
+			}
+			var decErr error
+			t2 := time.Now()
+			if s.lost[prev] {
+				if _, ok := s.extras.recoverDRED(s.dec, next, s.pcmOut, s.frameSize); ok {
+					decEvents |= eventDRED
+				} else {
+					_, decErr = s.dec.Decode(nil, s.pcmOut)
+					decEvents |= eventPLC
+				}
+			} else {
+				pkt := s.pkts[prev][:s.lens[prev]]
+				_, decErr = s.dec.Decode(pkt, s.pcmOut)
+				mode := gopus.ParseTOC(pkt[0]).Mode
+				if s.haveDec && mode != s.decMode {
+					decEvents |= eventModeTransition
+				}
+				s.decMode, s.haveDec = mode, true
+				if s.extras.osceActive(pkt) {
+					decEvents |= eventOSCE
+				}
+			}
+			decDur = time.Since(t2)
+			if decErr != nil {
+				rec.decodeErrs.Add(1)
+			}
+			if s.gcCycles() != gc1 {
+				decEvents |= eventGC
+			}
+			if measured {
+				rec.record(opDecode, decEvents, decDur)
+			}
+		}
+		if !measured {
+			continue
+		}
+
+		tick := encDur + decDur
+		rec.record(opTick, encEvents|decEvents, tick)
+		rec.ticks.Add(1)
+		if tick > frameDur {
+			rec.overruns.Add(1)
+		}
+	}
+	return nil
+}
+
+type latencyRow struct {
+	Op     string `json:"op"`
+	Event  string `json:"event"`
+	Count  uint64 `json:"count"`
+	MeanNs uint64 `json:"mean_ns"`
+	P50Ns  uint64 `json:"p50_ns"`
+	P99Ns  uint64 `json:"p99_ns"`
+	P999Ns uint64 `json:"p999_ns"`
+	MaxNs  uint64 `json:"max_ns"`
+}
+
+type reportConfig struct {
+	Sessions     int     `json:"sessions"`
+	DurationSec  float64 `json:"duration_s"`
+	WarmupSec    float64 `json:"warmup_s"`
+	FrameMs      float64 `json:"frame_ms"`
+	Channels     int     `json:"channels"`
+	Application  string  `json:"application"`
+	Bitrates     []int   `json:"bitrates"`
+	SwitchSec    float64 `json:"switch_every_s"`
+	LossPercent  float64 `json:"loss_percent"`
+	Paced        bool    `json:"paced"`
+	Content      string  `json:"content"`
+	DREDDuration int     `json:"dred_duration"`
+	OSCE         bool    `json:"osce"`
+	Seed         int64   `json:"seed"`
+}
+
+type report struct {
+	Tool          string       `json:"tool"`
+	GoVersion     string       `json:"go_version"`
+	GOOS          string       `json:"goos"`
+	GOARCH        string       `json:"goarch"`
+	GOMAXPROCS    int          `json:"gomaxprocs"`
+	Config        reportConfig `json:"config"`
+	WallSec       float64      `json:"wall_s"`
+	Ticks         uint64       `json:"ticks"`
+	Overruns      uint64       `json:"overruns"`
+	LateTicks     uint64       `json:"late_ticks"`
+	EncodeErrors  uint64       `json:"encode_errors"`
+	DecodeErrors  uint64       `json:"decode_errors"`
+	GCCycles      uint32       `json:"gc_cycles"`
+	GCPauseTotNs  uint64       `json:"gc_pause_total_ns"`
+	Results       []latencyRow `json:"results"`
+	Violations    []string     `json:"violations,omitempty"`
+	ContentSource []string     `json:"content_sources"`
+}
+
+func run(cfg config) (*report, error) {
+	frameSize := int(cfg.frameMs*sampleRate/1000 + 0.5)
+	frameDur := time.Duration(float64(time.Millisecond) * cfg.frameMs)
+	warmupFrames := int(cfg.warmup / frameDur)
+	frames := warmupFrames + int(cfg.duration/frameDur)
+	if frames-warmupFrames < 2 {
+		return nil, fmt.Errorf("-duration %s is shorter than two frames", cfg.duration)
+	}
+	switchFrames := int(cfg.switchEvery / frameDur)
+
+	sources, err := loadContent(cfg.content, cfg.corpusPath, cfg.contentSeconds, cfg.channels)
+	if err != nil {
+		return nil, err
+	}
+	sessions := make([]*session, cfg.sessions)
+	for i := range sessions {
+		if sessions[i], err = newSession(i, cfg, sources[i%len(sources)], frameSize); err != nil {
+			return nil, fmt.Errorf("session %d: %w", i, err)
+		}
+	}
+
+	rec := &recorder{frameDur: frameDur}
+	runtime.GC()
+	var ms0, ms1 runtime.MemStats
+	runtime.ReadMemStats(&ms0)
+	begin := time.Now()
+	start := begin.Add(frameDur)
+	var wg sync.WaitGroup
+	errs := make([]error, len(sessions))
+	for i, s := range sessions {
+		wg.Add(1)
+		go func(i int, s *session) {
+			defer wg.Done()
+			// Spread the sessions' ticks across the frame, like
+			// independently started streams.
+			offset := time.Duration(int64(frameDur) * int64(i) / int64(len(sessions)))
+			errs[i] = s.run(rec, start.Add(offset), frames, warmupFrames, switchFrames)
+		}(i, s)
+	}
+	wg.Wait()
+	wall := time.Since(begin)
+	runtime.ReadMemStats(&ms1)
+	if err := errors.Join(errs...); err != nil {
+		return nil, err
+	}
+
+	rep := &report{
+		Tool:       "latencybench",
+		GoVersion:  runtime.Version(),
+		GOOS:       runtime.GOOS,
+		GOARCH:     runtime.GOARCH,
+		GOMAXPROCS: runtime.GOMAXPROCS(0),
+		Config: reportConfig{
+			Sessions:     cfg.sessions,
+			DurationSec:  cfg.duration.Seconds(),
+			WarmupSec:    cfg.warmup.Seconds(),
+			FrameMs:      cfg.frameMs,
+			Channels:     cfg.channels,
+			Application:  cfg.application,
+			Bitrates:     cfg.bitrates,
+			SwitchSec:    cfg.switchEvery.Seconds(),
+			LossPercent:  cfg.lossPercent,
+			Paced:        cfg.paced,
+			Content:      cfg.content,
+			DREDDuration: cfg.dredDuration,
+			OSCE:         cfg.osce,
+			Seed:         cfg.seed,
+		},
+		WallSec:      wall.Seconds(),
+		Ticks:        rec.ticks.Load(),
+		Overruns:     rec.overruns.Load(),
+		LateTicks:    rec.lateTicks.Load(),
+		EncodeErrors: rec.encodeErrs.Load(),
+		DecodeErrors: rec.decodeErrs.Load(),
+		GCCycles:     ms1.NumGC - ms0.NumGC,
+		GCPauseTotNs: ms1.PauseTotalNs - ms0.PauseTotalNs,
+		Results:      rec.rows(),
+	}
+	for _, src := range sources {
+		rep.ContentSource = append(rep.ContentSource, src.name)
+	}
+	rep.Violations = evaluateGates(rep, cfg)
+	return rep, nil
+}
+
+func (r *recorder) rows() []latencyRow {
+	var rows []latencyRow
+	for op := range r.hists {
+		for row := range r.hists[op] {
+			h := &r.hists[op][row]
+			if h.count.Load() == 0 {
+				continue
+			}
+			rows = append(rows, latencyRow{
+				Op:     opNames[op],
+				Event:  rowNames[row],
+				Count:  h.count.Load(),
+				MeanNs: h.mean(),
+				P50Ns:  h.quantile(0.50),
+				P99Ns:  h.quantile(0.99),
+				P999Ns: h.quantile(0.999),
+				MaxNs:  h.max.Load(),
+			})
+		}
+	}
+	return rows
+}
+
+// gate is one -gate clause: op/event/stat <= limit.
+type gate struct {
+	op, event, stat string
+	limit           time.Duration
+}
+
+func parseGates(spec string) ([]gate, error) {
+	var gates []gate
+	for _, clause := range strings.Split(spec, ",") {
+		clause = strings.TrimSpace(clause)
+		if clause == "" {
+			continue
+		}
+		lhs, rhs, ok := strings.Cut(clause, "<=")
+		parts := strings.Split(strings.TrimSpace(lhs), "/")
+		if !ok || len(parts) != 3 {
+			return nil, fmt.Errorf("invalid -gate clause %q (want op/event/stat<=duration)", clause)
+		}
+		limit, err := time.ParseDuration(strings.TrimSpace(rhs))
+		if err != nil {
+			return nil, fmt.Errorf("invalid -gate clause %q: %w", clause, err)
+		}
+		g := gate{op: parts[0], event: parts[1], stat: parts[2], limit: limit}
+		if indexOf(opNames[:], g.op) < 0 || indexOf(rowNames[:], g.event) < 0 {
+			return nil, fmt.Errorf("invalid -gate clause %q: unknown op or event", clause)
+		}
+		switch g.stat {
+		case "mean", "p50", "p99", "p999", "max":
+		default:
+			return nil, fmt.Errorf("invalid -gate clause %q: stat must be mean, p50, p99, p999 or max", clause)
+		}
+		gates = append(gates, g)
+	}
+	return gates, nil
+}
+
+func indexOf(names []string, name string) int {
+	for i, n := range names {
+		if n == name {
+			return i
+		}
+	}
+	return -1
+}
+
+func evaluateGates(rep *report, cfg config) []string {
+	var violations []string
+	for _, g := range cfg.gates {
+		for _, row := range rep.Results {
+			if row.Op != g.op || row.Event != g.event {
+				continue
+			}
+			v := map[string]uint64{"mean": row.MeanNs, "p50": row.P50Ns, "p99": row.P99Ns, "p999": row.P999Ns, "max": row.MaxNs}[g.stat]
+			if time.Duration(v) > g.limit {
+				violations = append(violations, fmt.Sprintf("%s/%s/%s %s > %s", g.op, g.event, g.stat, time.Duration(v), g.limit))
+			}
+		}
+	}
+	if cfg.maxOverruns >= 0 && rep.Overruns > uint64(cfg.maxOverruns) {
+		violations = append(violations, fmt.Sprintf("overruns %d > %d", rep.Overruns, cfg.maxOverruns))
+	}
+	sort.Strings(violations)
+	return violations
+}
+
+func writeReport(cfg config, rep *report) error {
+	var w io.Writer = os.Stdout
+	if cfg.outPath != "" {
+		f, err := os.Create(cfg.outPath)
+		if err != nil {
+			return err
+		}
+		defer f.Close()
+		w = f
+	}
+	if cfg.format == "tsv" {
+		_, err := io.WriteString(w, formatTSV(rep))
+		return err
+	}
+	enc := json.NewEncoder(w)
+	enc.SetIndent("", "  ")
+	return enc.Encode(rep)
+}
+
+func formatTSV(rep *report) string {
+	var b strings.Builder
+	b.WriteString("op\tevent\tcount\tmean_ns\tp50_ns\tp99_ns\tp999_ns\tmax_ns\n")
+	for _, r := range rep.Results {
+		fmt.Fprintf(&b, "%s\t%s\t%d\t%d\t%d\t%d\t%d\t%d\n", r.Op, r.Event, r.Count, r.MeanNs, r.P50Ns, r.P99Ns, r.P999Ns, r.MaxNs)
+	}
+	fmt.Fprintf(&b, "# ticks=%d overruns=%d late_ticks=%d gc_cycles=%d gc_pause_total_ns=%d\n",
+		rep.Ticks, rep.Overruns, rep.LateTicks, rep.GCCycles, rep.GCPauseTotNs)
+	return b.String()
+}
@@ -0,0 +1,112 @@
+package main
+
+import (
+	"encoding/json"
+	"strings"
+	"testing"
+	"time"
+)
+
+func TestHistogramBuckets(t *testing.T) {
+	prev := -1
+	for _, v := range []uint64{0, 1, 63, 64, 65, 127, 128, 1000, 12345, 1 << 20, 123456789, 1 << 36} {
+		idx := histBucket(v)
+		if idx < prev {
+			t.Fatalf("histBucket(%d)=%d below previous bucket %d", v, idx, prev)
+		}
+		prev = idx
+		upper := histBucketUpper(idx)
+		if upper < v {
+			t.Fatalf("histBucketUpper(histBucket(%d))=%d below value", v, upper)
+		}
+		if idx > 0 && histBucketUpper(idx-1) >= v {
+			t.Fatalf("value %d also fits bucket %d", v, idx-1)
+		}
+		if v >= histSubCount && float64(upper-v) > float64(v)/histSubCount {
+			t.Fatalf("bucket for %d too wide: upper %d", v, upper)
+		}
+	}
+	if got := histBucket(1 << 50); got != histBuckets-1 {
+		t.Fatalf("histBucket saturates at %d, want %d", got, histBuckets-1)
+	}
+}
+
+func TestHistogramQuantiles(t *testing.T) {
+	var h histogram
+	for v := 1; v <= 100000; v++ {
+		h.record(time.Duration(v))
+	}
+	for _, tc := range []struct {
+		q    float64
+		want uint64
+	}{{0.5, 50000}, {0.99, 99000}, {0.999, 99900}, {1, 100000}} {
+		got := h.quantile(tc.q)
+		if got < tc.want || float64(got-tc.want) > float64(tc.want)/histSubCount {
+			t.Fatalf("quantile(%v)=%d want ~%d", tc.q, got, tc.want)
+		}
+	}
+	if h.max.Load() != 100000 || h.mean() != 50000 {
+		t.Fatalf("max=%d mean=%d", h.max.Load(), h.mean())
+	}
+}
+
+func TestParseGates(t *testing.T) {
+	gates, err := parseGates("tick/all/p999<=4ms, decode/plc/max<=500us")
+	if err != nil {
+		t.Fatalf("parseGates: %v", err)
+	}
+	if len(gates) != 2 || gates[0] != (gate{"tick", "all", "p999", 4 * time.Millisecond}) ||
+		gates[1] != (gate{"decode", "plc", "max", 500 * time.Microsecond}) {
+		t.Fatalf("parseGates = %+v", gates)
+	}
+	for _, bad := range []string{"tick/all<=1ms", "tick/all/p95<=1ms", "mix/all/p99<=1ms", "tick/all/p99<1ms", "tick/all/p99<=soon"} {
+		if _, err := parseGates(bad); err == nil {
+			t.Fatalf("parseGates(%q) accepted", bad)
+		}
+	}
+
+	rep := &report{
+		Overruns: 3,
+		Results:  []latencyRow{{Op: "tick", Event: "all", P999Ns: uint64(5 * time.Millisecond)}},
+	}
+	violations := evaluateGates(rep, config{gates: gates, maxOverruns: 2})
+	if len(violations) != 2 || !strings.HasPrefix(violations[0], "overruns") || !strings.HasPrefix(violations[1], "tick/all/p999") {
+		t.Fatalf("evaluateGates = %q", violations)
+	}
+}
+
+func TestRunReport(t *testing.T) {
+	cfg, err := parseFlags([]string{
+		"-sessions", "3", "-duration", "400ms", "-warmup", "100ms", "-paced=false", "-loss", "20",
+		"-switch-every", "100ms", "-content-seconds", "0.5", "-gate", "tick/all/max<=1h",
+	})
+	if err != nil {
+		t.Fatalf("parseFlags: %v", err)
+	}
+	rep, err := run(cfg)
+	if err != nil {
+		t.Fatalf("run: %v", err)
+	}
+	if rep.Ticks != 60 || rep.EncodeErrors != 0 || rep.DecodeErrors != 0 || len(rep.Violations) != 0 {
+		t.Fatalf("ticks=%d encErr=%d decErr=%d violations=%q", rep.Ticks, rep.EncodeErrors, rep.DecodeErrors, rep.Violations)
+	}
+	counts := map[string]uint64{}
+	for _, r := range rep.Results {
+		counts[r.Op+"/"+r.Event] = r.Count
+		if r.P50Ns > r.P99Ns || r.P99Ns > r.P999Ns || r.P999Ns > r.MaxNs {
+			t.Fatalf("%s/%s quantiles not monotonic: %+v", r.Op, r.Event, r)
+		}
+	}
+	if counts["encode/all"] != 60 || counts["decode/all"] != 60 || counts["tick/all"] != 60 {
+		t.Fatalf("row counts %v", counts)
+	}
+	if counts["decode/plc"] == 0 || counts["encode/mode_transition"] == 0 {
+		t.Fatalf("expected PLC and mode-transition frames, got %v", counts)
+	}
+	if _, err := json.Marshal(rep); err != nil {
+		t.Fatalf("marshal report: %v", err)
+	}
+	if tsv := formatTSV(rep); !strings.HasPrefix(tsv, "op\tevent\t") {
+		t.Fatalf("tsv header: %q", tsv[:min(len(tsv), 40)])
+	}
+}